@@ -60,6 +60,7 @@ namespace TKGEngine
 			return;
 		}
 		m_transform = s_ptr->GetTransform();
+		m_owner_active_state = s_ptr->GetActiveState();
 	}
 
 }// namespace TKGEngine
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Objects/inc/Object.h"
+#include "../../Objects/inc/ActiveState.h"
 
 #include "Managers/ComponentManager.h"
 
@@ -56,6 +57,10 @@ namespace TKGEngine
 		void SetOwnerIDAndTransform(GameObjectID id);
 		inline GameObjectID GetOwnerID() const;
 
+		// GameObject擾ɃANeBuԂQƂ
+		inline bool IsOwnerActiveHierarchy() const;
+		inline bool IsOwnerActiveScene() const;
+
 		// R|[lgA^b`Ă邩
 		template<class T>
 		bool HasComponent();
@@ -103,10 +108,12 @@ namespace TKGEngine
 		// private variables
 		// ==============================================
 		COMPONENT_TYPE m_component_type = COMPONENT_TYPE::COMPONENT_GENERAL;
-		ComponentTypeID m_type_id = 0;
+		ComponentTypeID m_type_id = INVALID_COMPONENT_TYPE_ID;
 		GameObjectID m_owner_id = 0;
 
 		std::weak_ptr<Transform> m_transform;
+		// LGameObject̃ANeBu
+		std::shared_ptr<const ActiveState> m_owner_active_state;
 
 	};
 
@@ -128,6 +135,16 @@ namespace TKGEngine
 		return m_owner_id;
 	}
 
+	inline bool Component::IsOwnerActiveHierarchy() const
+	{
+		return m_owner_active_state && m_owner_active_state->IsActiveHierarchy();
+	}
+
+	inline bool Component::IsOwnerActiveScene() const
+	{
+		return m_owner_active_state && m_owner_active_state->IsActiveScene();
+	}
+
 	inline void Component::SetTransform(const std::weak_ptr<Transform>& p_transform)
 	{
 		m_transform = p_transform;
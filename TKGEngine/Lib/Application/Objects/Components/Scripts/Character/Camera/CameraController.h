@@ -12,7 +12,11 @@ namespace TKGEngine
 		: public TKGEngine::MonoBehaviour
 	{
 	public:
-		CameraController() = default;
+		CameraController()
+		{
+			m_use_update = true;
+			m_use_late_update = true;
+		}
 		virtual ~CameraController() override = default;
 		CameraController(const CameraController&) = delete;
 		CameraController& operator=(const CameraController&) = delete;
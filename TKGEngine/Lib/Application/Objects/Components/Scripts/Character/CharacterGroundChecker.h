@@ -10,7 +10,7 @@ namespace TKGEngine
 		: public TKGEngine::MonoBehaviour
 	{
 	public:
-		CharacterGroundChecker() = default;
+		CharacterGroundChecker() { m_use_update = true; }
 		virtual ~CharacterGroundChecker() override = default;
 		CharacterGroundChecker(const CharacterGroundChecker&) = delete;
 		CharacterGroundChecker& operator=(const CharacterGroundChecker&) = delete;
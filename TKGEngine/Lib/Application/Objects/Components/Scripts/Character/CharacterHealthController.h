@@ -7,7 +7,7 @@ namespace TKGEngine
 		: public MonoBehaviour
 	{
 	public:
-		CharacterHealthController() = default;
+		CharacterHealthController() { m_use_update = true; }
 		virtual ~CharacterHealthController() override = default;
 		CharacterHealthController(const CharacterHealthController&) = delete;
 		CharacterHealthController& operator=(const CharacterHealthController&) = delete;
@@ -11,7 +11,7 @@ namespace TKGEngine
 		: public TKGEngine::MonoBehaviour
 	{
 	public:
-		CharacterMoveController() = default;
+		CharacterMoveController() { m_use_late_update = true; }
 		virtual ~CharacterMoveController() override = default;
 		CharacterMoveController(const CharacterMoveController&) = delete;
 		CharacterMoveController& operator=(const CharacterMoveController&) = delete;
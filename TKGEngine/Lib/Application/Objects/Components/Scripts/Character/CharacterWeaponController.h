@@ -12,7 +12,7 @@ namespace TKGEngine
 		: public MonoBehaviour
 	{
 	public:
-		CharacterWeaponController() = default;
+		CharacterWeaponController() { m_use_update = true; }
 		virtual ~CharacterWeaponController() override = default;
 		CharacterWeaponController(const CharacterWeaponController&) = delete;
 		CharacterWeaponController& operator=(const CharacterWeaponController&) = delete;
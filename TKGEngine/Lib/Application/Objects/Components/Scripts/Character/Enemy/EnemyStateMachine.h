@@ -10,7 +10,10 @@ namespace TKGEngine
 	{
 	public:
 		EnemyStateMachine()
-			: ICharacterStateMachine(static_cast<int>(EnemyState::Max_EnemyState)) {}
+			: ICharacterStateMachine(static_cast<int>(EnemyState::Max_EnemyState))
+		{
+			m_use_update = true;
+		}
 		virtual ~EnemyStateMachine() override = default;
 		EnemyStateMachine(const EnemyStateMachine&) = delete;
 		EnemyStateMachine& operator=(const EnemyStateMachine&) = delete;
@@ -13,7 +13,11 @@ namespace TKGEngine
 		: public TKGEngine::MonoBehaviour
 	{
 	public:
-		PlayerController() = default;
+		PlayerController()
+		{
+			m_use_update = true;
+			m_use_late_update = true;
+		}
 		virtual ~PlayerController() override = default;
 		PlayerController(const PlayerController&) = delete;
 		PlayerController& operator=(const PlayerController&) = delete;
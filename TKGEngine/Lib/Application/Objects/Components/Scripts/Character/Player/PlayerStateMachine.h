@@ -10,7 +10,10 @@ namespace TKGEngine
 	{
 	public:
 		PlayerStateMachine()
-			: ICharacterStateMachine(static_cast<int>(PlayerState::Max_PlayerState)){}
+			: ICharacterStateMachine(static_cast<int>(PlayerState::Max_PlayerState))
+		{
+			m_use_update = true;
+		}
 		virtual ~PlayerStateMachine() override = default;
 		PlayerStateMachine(const PlayerStateMachine&) = delete;
 		PlayerStateMachine& operator=(const PlayerStateMachine&) = delete;
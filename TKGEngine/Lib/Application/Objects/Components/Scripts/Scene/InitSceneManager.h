@@ -9,7 +9,7 @@ namespace TKGEngine
 		: public MonoBehaviour
 	{
 	public:
-		InitSceneManager() = default;
+		InitSceneManager() { m_use_update = true; }
 		virtual ~InitSceneManager() override = default;
 		InitSceneManager(const InitSceneManager&) = delete;
 		InitSceneManager& operator=(const InitSceneManager&) = delete;
@@ -10,7 +10,7 @@ namespace TKGEngine
 		: public MonoBehaviour
 	{
 	public:
-		GameStageManager() = default;
+		GameStageManager() { m_use_update = true; }
 		virtual ~GameStageManager() override = default;
 		GameStageManager(const GameStageManager&) = delete;
 		GameStageManager& operator=(const GameStageManager&) = delete;
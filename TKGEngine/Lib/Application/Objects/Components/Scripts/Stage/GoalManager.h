@@ -7,7 +7,7 @@ namespace TKGEngine
 		: public TKGEngine::MonoBehaviour
 	{
 	public:
-		GoalManager() = default;
+		GoalManager() { m_use_update = true; }
 		virtual ~GoalManager() override = default;
 		GoalManager(const GoalManager&) = delete;
 		GoalManager& operator=(const GoalManager&) = delete;
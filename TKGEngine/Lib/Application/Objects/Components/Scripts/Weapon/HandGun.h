@@ -7,7 +7,7 @@ namespace TKGEngine
 		: public IWeaponBase
 	{
 	public:
-		HandGun() = default;
+		HandGun() { m_use_update = true; }
 		virtual ~HandGun() override = default;
 		HandGun(const HandGun&) = delete;
 		HandGun& operator=(const HandGun&) = delete;
@@ -7,6 +7,10 @@
 #include "Application/Resource/inc/AnimatorController.h"
 #include "Application/Resource/inc/Avatar.h"
 #include "Application/Resource/inc/ConstantBuffer.h"
+#include "Utility/inc/bounds.h"
+
+#include <mutex>
+#include <cstdint>
 
 
 struct ID3D11DeviceContext;
@@ -50,9 +54,18 @@ namespace TKGEngine
 
 		// BoneTransformXgԂ
 		std::vector<std::shared_ptr<Transform>>& GetBoneReferences();
+		// SẴ{[TransformɃ|[Y߂(͗L)
+		// ɂƎqA^b`ꂽ{[Ƃ̐êݏ߂A
+		// LODMinimumȉł̓{[t[ȊO̍s̍XVȗ
+		void SetWriteBackAllBones(bool write_back_all);
+		inline bool IsWriteBackAllBones() const;
 
 		int GetParameterCount() const;
-		std::shared_ptr<Animations::AnimatorControllerParameter> GetParameter(const std::string& param_name);
+		// p[^̒ǉA폜AO̕ύXō蒼邽߁A|C^̓t[܂ŕێȂ
+		Animations::AnimatorControllerParameter* GetParameter(const std::string& param_name);
+		// p[^Ɋ蓖ĂID(擾ĂΖOTɃp[^𑀍ł)
+		// Rg[̃[h܂łINVALID_PARAMETER_IDԂ߁AlȂ擾
+		Animations::ParameterID GetParameterID(const std::string& param_name) const;
 
 		void SetBool(const std::string& param_name, bool param);
 		void SetInteger(const std::string& param_name, int param);
@@ -64,9 +77,24 @@ namespace TKGEngine
 		float GetFloat(const std::string& param_name);
 		void ResetTrigger(const std::string& param_name);
 
+		void SetBool(Animations::ParameterID id, bool param);
+		void SetInteger(Animations::ParameterID id, int param);
+		void SetFloat(Animations::ParameterID id, float param);
+		void SetTrigger(Animations::ParameterID id);
+
+		bool GetBool(Animations::ParameterID id);
+		int GetInteger(Animations::ParameterID id);
+		float GetFloat(Animations::ParameterID id);
+		void ResetTrigger(Animations::ParameterID id);
+
 		// Aj[V̍XVɎgp^CXP[̐ݒ
 		void SetUpdateMode(UpdateMode mode);
 
+		// Aj[VLODőIĂXViK
+		inline Animations::AnimatorUpdateTier GetUpdateTier() const;
+		// Animator̍sŕ`悵_[Boundsʒm(̃t[LOD̔Ɏgp)
+		void OnRendered(const Bounds& bounds);
+
 
 		// ==============================================
 		// public variables
@@ -80,7 +108,26 @@ namespace TKGEngine
 		template <class Archive>
 		void serialize(Archive& archive, const std::uint32_t version)
 		{
-			if (version == 2)
+			if (version == 3)
+			{
+				archive(
+					cereal::base_class<Behaviour>(this),
+					CEREAL_NVP(m_controller_filedata),
+					CEREAL_NVP(m_avatar_filedata),
+					CEREAL_NVP(m_root_index),
+					CEREAL_NVP(m_bone_references),
+					CEREAL_NVP(m_node_references),
+					CEREAL_NVP(m_update_mode),
+					CEREAL_NVP(m_culling_mode),
+					CEREAL_NVP(m_root_bone_index),
+					CEREAL_NVP(m_root_bone_init_translate),
+					CEREAL_NVP(m_root_bone_init_rotation),
+					CEREAL_NVP(m_root_bone_init_scale),
+					CEREAL_NVP(m_ignore_root_motion),
+					CEREAL_NVP(m_write_back_all_bones)
+				);
+			}
+			else if (version == 2)
 			{
 				archive(
 					cereal::base_class<Behaviour>(this),
@@ -136,12 +183,21 @@ namespace TKGEngine
 		// OnAddAvatarŎgpċA
 		void RecurseCreateFromBone(const Node* node, const int self_idx, const std::shared_ptr<IGameObject>& parent, const bool is_root, int& counter);
 
-		// Animation MatrixRootBone珇ɌvZĂċA
-		void RecurseCalculateAnimationMatrix(const Node* node, const int self_idx, const MATRIX& matrix);
+		// {[RootBone[D揇(m_bone_referencesƓ)̔zɓWJ
+		void BuildBonePalette();
+		// |[Y߂{[Iђ
+		void RefreshBoneWriteBack();
+
+		// {[̃|[YɃL[Zbg(ratio1ȂO]L[Ԃ)
+		void SetBoneTransforms(float ratio);
 
 		// IAnimator
+		bool GetLODSphere(VECTOR3& center, float& radius) override;
+		bool SelectUpdateTier(float distance, float screen_size, bool was_rendered) override;
+		bool PrepareAnimationTransform() override;
 		void ApplyAnimationTransform() override;
 		void UpdateAnimationMatrix() override;
+		void UploadAnimationMatrix() override;
 		bool IsActiveAnimator() override;
 		// ~IAnimator
 
@@ -173,7 +229,7 @@ namespace TKGEngine
 
 		// XVɎgp^CXP[
 		UpdateMode m_update_mode = UpdateMode::Normal;
-		// TODO : ʊOŃAj[Vs邩̐ݒ
+		// Õt[ŕ`悳ȂƂɃAj[Vs邩̐ݒ
 		CullingMode m_culling_mode = CullingMode::AlwaysAnimation;
 		// I{[̃Aj[VKpȂݒ
 		int m_root_bone_index = -1;
@@ -182,7 +238,47 @@ namespace TKGEngine
 		VECTOR3 m_root_bone_init_scale = VECTOR3::One;
 		bool m_ignore_root_motion = false;
 
+		// Aj[VLOD
+		Animations::AnimatorUpdateTier m_update_tier = Animations::AnimatorUpdateTier::Full;
+		// Rg[]ԊuƁAO̕]̃t[Aoߎ
+		int m_lod_interval = 1;
+		int m_lod_frame_count = 0;
+		float m_lod_elapsed_time = 0.0f;
+		// ̃t[ŃRg[]邩
+		bool m_lod_evaluate = true;
+		// {[̃|[YĂAj[VsXVĂȂ
+		bool m_is_pose_updated = true;
+		// ReducedŕԂO]L[
+		std::vector<Animations::KeyData> m_prev_key_data;
+		// `悵_[Bounds(`Xbh珑܂)
+		std::mutex m_lod_bounds_mutex;
+		Bounds m_rendered_bounds;
+		bool m_is_rendered = false;
+		VECTOR3 m_lod_center = VECTOR3::Zero;
+		float m_lod_radius = 0.0f;
+
+		// eqOɗ鏇ɕׂ{[̔z(m_bone_referencesƓ)
+		// e̗vfԍ(Root-1)
+		std::vector<int> m_bone_parents;
+		// oCh|[Y̋ts
+		std::vector<MATRIX> m_bone_inverse_transforms;
+		// [J̃|[Y
+		std::vector<Animations::KeyData> m_bone_local_pose;
+		// Animator̃[JԂł̍s
+		std::vector<MATRIX> m_bone_model_matrices;
+		// TransformɃ|[Y߂
+		std::vector<std::uint8_t> m_bone_write_back;
+		bool m_write_back_all_bones = true;
+		// ߂{[I񂾂ƂRoot Boneȉ̃qGL[̏
+		std::uint32_t m_bone_hierarchy_revision = 0;
+		bool m_is_bone_write_back_dirty = true;
+		// ߂{[IђƂ̍Ɨ̈(WuŊmۂȂ悤Ɏg)
+		std::vector<std::uint8_t> m_bone_write_back_work;
+		std::vector<int> m_bone_child_counts;
+
 		std::vector<MATRIX> m_cb_matrix_data;
+		// CBufferɑĂȂXLjOs񂪂邩
+		bool m_is_matrix_updated = false;
 		ConstantBuffer m_cb_model;
 		static ConstantBuffer m_cb_default_model;
 		static bool m_is_initialized;
@@ -202,8 +298,18 @@ namespace TKGEngine
 		return m_culling_mode;
 	}
 
+	inline bool Animator::IsWriteBackAllBones() const
+	{
+		return m_write_back_all_bones;
+	}
+
+	inline Animations::AnimatorUpdateTier Animator::GetUpdateTier() const
+	{
+		return m_update_tier;
+	}
+
 }// namespaace TKGEngine
 
-CEREAL_CLASS_VERSION(TKGEngine::Animator, 2)
+CEREAL_CLASS_VERSION(TKGEngine::Animator, 3)
 CEREAL_REGISTER_TYPE_WITH_NAME(TKGEngine::Animator, "TKGEngine::Animator")
 CEREAL_REGISTER_POLYMORPHIC_RELATION(TKGEngine::Behaviour, TKGEngine::Animator)
@@ -15,6 +15,7 @@ namespace TKGEngine
 	struct MainData;
 	class ICamera;
 	class VertexBuffer;
+	class DynamicAABBTree;
 
 	/// <summary>
 	/// Management Light parameter.
@@ -209,9 +210,10 @@ namespace TKGEngine
 		/// </summary>
 		/// <param name="scene_objects">e`悷IuWFNgXg</param>
 		/// <param name="object_num">IuWFNgXg̃IuWFNg</param>
+		/// <param name="caster_tree">_[BVH</param>
 		/// <param name="camera">`撆̃J̎Q</param>
 		/// <returns>`搔</returns>
-		int CalculateShadowCaster(const std::vector<MainData>& scene_objects, int object_num, const std::shared_ptr<ICamera>& camera) const;
+		int CalculateShadowCaster(const std::vector<MainData>& scene_objects, int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera) const;
 
 		// e`悷IuWFNgȂfalse
 		bool IsRenderShadowCaster() const;
@@ -222,7 +224,7 @@ namespace TKGEngine
 		int GetSamplingCount() const;
 
 		// LightManagerĂԁAe`s
-		void RenderShadowCaster(ID3D11DeviceContext* context, VertexBuffer& instance_buffer) const;
+		void RenderShadowCaster(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects, VertexBuffer& instance_buffer) const;
 
 
 		// ==============================================
@@ -65,6 +65,7 @@ namespace TKGEngine
 
 		virtual void Awake() {}
 		virtual void Start() {}
+		// hŃI[o[ChRXgN^m_use_updateAm_use_late_updatetrueɂ
 		virtual void Update() {}
 		virtual void LateUpdate() {}
 
@@ -93,6 +94,8 @@ namespace TKGEngine
 		void CheckMonoBehaviourState(MonoBehaviourEventType type);
 		inline bool IsCalledAwake() const;
 		inline bool CanCallEveryFrameUpdate() const;
+		inline bool IsUseUpdate() const;
+		inline bool IsUseLateUpdate() const;
 
 		inline void SetStoreId(int id);
 		inline int GetStoreId() const;
@@ -109,6 +112,9 @@ namespace TKGEngine
 		// ==============================================
 		// t[XV֐Ăяoǂ
 		bool m_can_call_every_frame_update = true;
+		// UpdateALateUpdategp邩(Start̍XVXgւ̓o^ɔ肵AfalseȂo^Ȃ)
+		bool m_use_update = false;
+		bool m_use_late_update = false;
 
 
 	private:
@@ -181,6 +187,16 @@ namespace TKGEngine
 		return m_can_call_every_frame_update;
 	}
 
+	inline bool MonoBehaviour::IsUseUpdate() const
+	{
+		return m_use_update;
+	}
+
+	inline bool MonoBehaviour::IsUseLateUpdate() const
+	{
+		return m_use_late_update;
+	}
+
 	inline void MonoBehaviour::SetStoreId(int id)
 	{
 		m_store_list_id = id;
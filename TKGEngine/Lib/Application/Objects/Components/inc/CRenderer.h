@@ -181,6 +181,8 @@ namespace TKGEngine
 
 		inline void SetVisible(bool is_visible) override;
 		[[nodiscard]] virtual inline ShadowCastingMode GetShadowCastMode() const override;
+		[[nodiscard]] inline int GetCullingProxy() const override;
+		inline void SetCullingProxy(int proxy_id) override;
 
 		virtual void CalculateRenderParameter(const std::shared_ptr<ICamera>& camera) override;
 		[[nodiscard]] inline const MATRIX& GetWorldMatrix() const override;
@@ -206,6 +208,8 @@ namespace TKGEngine
 		bool m_is_enabled = true;
 		// JɉfĂ邩
 		bool m_is_visible = false;
+		// RendererManagerBVH̗tID
+		int m_culling_proxy = -1;
 
 		// Main
 		FileLoadStateData m_mesh_filedata;
@@ -295,6 +299,16 @@ namespace TKGEngine
 		m_is_visible = is_visible;
 	}
 
+	inline int Renderer::GetCullingProxy() const
+	{
+		return m_culling_proxy;
+	}
+
+	inline void Renderer::SetCullingProxy(const int proxy_id)
+	{
+		m_culling_proxy = proxy_id;
+	}
+
 	inline ShadowCastingMode Renderer::GetShadowCastMode() const
 	{
 		return m_shadow_casting_mode;
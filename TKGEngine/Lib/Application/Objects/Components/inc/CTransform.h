@@ -5,6 +5,10 @@
 #include "Application/Objects/inc/IGameObject.h"
 #include "Utility/inc/myfunc_vector.h"
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
 namespace TKGEngine
 {
 	/// <summary>
@@ -99,8 +103,10 @@ namespace TKGEngine
 		std::weak_ptr<Transform> FindFromChild(const std::string& name);
 		std::shared_ptr<Transform> GetChild(int index);
 		[[nodiscard]] int GetChildCount() const;
+		// gȉ̂ꂩ̎qXgύX邽тɐiޒl
+		[[nodiscard]] std::uint32_t GetSubtreeRevision() const;
 
-		const MATRIX& GetAffineTransform();
+		const MATRIX& GetAffineTransform() const;
 
 		MATRIX GetLocalToWorldMatrix();
 		MATRIX GetWorldToLocalMatrix();
@@ -118,6 +124,7 @@ namespace TKGEngine
 
 
 	private:
+		friend class TransformManager;
 		friend class cereal::access;
 		template <class Archive>
 		void load(Archive& archive, const std::uint32_t version)
@@ -202,18 +209,25 @@ namespace TKGEngine
 		// sړ̏
 		void OnTranslateSetPosition(const VECTOR3& translate);
 		// e擾pċAp֐
-		void RecurseOnRotation(const std::shared_ptr<Transform>& parent, Quaternion& rot) const;
 		void RecurseOnEulerAngles(const std::shared_ptr<Transform>& parent, VECTOR3& angles) const;
-		void RecurseOnScale(const std::shared_ptr<Transform>& parent, VECTOR3& scale) const;
-		void RecurseOnAxis(const std::shared_ptr<Transform>& parent, Quaternion& rot) const;
 		// SetParent̏V[ύXpċA
 		void RecurseOnSetScene(const std::shared_ptr<Transform>& child, const int scene_id) const;
-		// [hsċAIɌvZ
-		void RecurseOnCalculateWorldMatrix(const std::shared_ptr<Transform>& parent, MATRIX& matrix) const;
+
+		// [Jp[^̕ύXɍs蒼tO𗧂āA[h̃LbVj
+		inline void OnChangedParameter();
+		// gƎqȉ̃[h̃LbVj
+		void RecurseOnSetWorldChanged();
+		// [h̃LbVÂΐe珇ɍ蒼
+		// Wu瓯ɌĂ΂ĂA蒼1vfbNčs߈Sɓǂ߂
+		void UpdateWorldCache() const;
+		// LbV̍蒼Ɏgpmutex(AhX番UđI)
+		std::mutex& GetWorldCacheMutex() const;
 		// qIuWFNg̍ċA폜
 		void RecurseDestroy();
 		// eIuWFNg̎qIuWFNgXgIDč폜
 		void EraseFromParent(InstanceID id);
+		// qXg̕ύXgƑcɒʒm
+		void OnChangeChildren();
 
 		// fVACYGameObject̓o^T|[g
 		void OnDeserialize();
@@ -221,14 +235,27 @@ namespace TKGEngine
 		// ==============================================
 		// private variables
 		// ==============================================
-		// lύXꂽ烏[hs蒼߂̃tO
-		bool m_is_changed = true;
+		// lύXꂽ烍[Js蒼߂̃tO
+		// (̃tOĂm_is_world_changedKĂ̂ŁA[JsUpdateWorldCacheō蒼)
+		mutable bool m_is_changed = true;
+		// geȏ̒lύXꂽ烏[h̃LbV蒼߂̃tO
+		// (tOĂTransform̎qȉ͕KtOĂ)
+		// Ă΃LbV͏Ȃ̂ŁAbNɓǂ߂
+		mutable std::atomic<bool> m_is_world_changed = true;
 		// ejꂽAeqGameObject̔jċAIɂ邽߂ɎgptO
 		bool m_is_destroying = false;
 		// ċAIɔjĂ΂ꂽɃ[g𔻕ʂtO
 		bool m_is_root_deleter = false;
+		// TransformManagero^ꂽ(qGL[̔zɎcĂĂǂݔ΂)
+		std::atomic<bool> m_is_unregistered = false;
 
-		MATRIX m_affine_transform = MATRIX::Identity;
+		mutable MATRIX m_affine_transform = MATRIX::Identity;
+
+		// World cache
+		mutable MATRIX m_world_matrix = MATRIX::Identity;
+		mutable Quaternion m_world_rotation = Quaternion::Identity;
+		mutable VECTOR3 m_lossy_scale = VECTOR3::One;
+		// ~World cache
 
 		// Position
 		VECTOR3 m_local_position = VECTOR3::Zero;
@@ -247,9 +274,14 @@ namespace TKGEngine
 		int m_child_count = 0;
 		std::shared_ptr<Transform> m_parent;
 		std::list<std::weak_ptr<Transform>> m_children;
+		// gȉ̎qXgύXꂽ(Wuǂނatomic)
+		std::atomic<std::uint32_t> m_subtree_revision = 0;
 		// ~Hierarchy
 
 		std::weak_ptr<IGameObject> m_gameObject;
+
+		// TransformManagerɓo^ꂽID
+		int m_manager_id = 0;
 	};
 
 	// --------------------------------------------------------------
@@ -274,7 +306,7 @@ namespace TKGEngine
 	inline void Transform::LocalPosition(const VECTOR3& pos)
 	{
 		m_local_position = pos;
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	inline void Transform::LocalPosition(const float x, const float y, const float z)
@@ -291,7 +323,7 @@ namespace TKGEngine
 	{
 		m_local_rotation = quat;
 		m_local_euler_angle = quat.ToEulerAngles();
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	inline void Transform::EulerAngles(const float x, const float y, const float z)
@@ -308,7 +340,7 @@ namespace TKGEngine
 	{
 		m_local_euler_angle = angles;
 		m_local_rotation = Quaternion::EulerToQuaternion(angles);
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	inline void Transform::LocalEulerAngles(const float x, const float y, const float z)
@@ -324,7 +356,7 @@ namespace TKGEngine
 	inline void Transform::LocalScale(const VECTOR3& scale)
 	{
 		m_local_scale = scale;
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	inline void Transform::LocalScale(const float x, const float y, const float z)
@@ -337,6 +369,16 @@ namespace TKGEngine
 		return m_parent;
 	}
 
+	inline void Transform::OnChangedParameter()
+	{
+		m_is_changed = true;
+		// ɃtOĂΎqȉĂ
+		if (!m_is_world_changed)
+		{
+			RecurseOnSetWorldChanged();
+		}
+	}
+
 }// namespace TKGEngine
 
 CEREAL_CLASS_VERSION(TKGEngine::Transform, 1)
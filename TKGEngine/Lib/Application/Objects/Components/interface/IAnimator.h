@@ -33,8 +33,18 @@ namespace TKGEngine
 	public:
 		virtual CullingMode GetCullingMode() const = 0;
 
+		// LOD̔Ɏgp郏[hԂ̋擾AÕt[ŕ`悳ꂽԂ
+		virtual bool GetLODSphere(VECTOR3& center, float& radius) = 0;
+		// J̋Ɖʂ̍ɑ΂傫XViKIAXV𑱂邩Ԃ
+		virtual bool SelectUpdateTier(float distance, float screen_size, bool was_rendered) = 0;
+		// ̃t[Ń|[YXV邩𔻒肷(CXbhŌĂ)
+		virtual bool PrepareAnimationTransform() = 0;
+
 		virtual void ApplyAnimationTransform() = 0;
+		// XLjOsvZ(WuĂ΂)
 		virtual void UpdateAnimationMatrix() = 0;
+		// vZXLjOsCBufferɑ(CXbhŌĂ)
+		virtual void UploadAnimationMatrix() = 0;
 
 		virtual bool IsActiveAnimator() = 0;
 	};
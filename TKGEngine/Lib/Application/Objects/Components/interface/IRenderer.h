@@ -33,7 +33,6 @@ namespace TKGEngine
 	// C`Ɏgpf[^
 	struct MainData
 	{
-		bool do_render = false;
 		int queue;
 		unsigned mesh_hash;
 		unsigned material_hash;
@@ -98,6 +97,9 @@ namespace TKGEngine
 		virtual inline bool IsUsedTarget(int index) const = 0;
 		virtual inline void SetVisible(bool is_visible) = 0;
 		virtual inline ShadowCastingMode GetShadowCastMode() const = 0;
+		// RendererManagerBVH̗tID(o^-1)
+		virtual inline int GetCullingProxy() const = 0;
+		virtual inline void SetCullingProxy(int proxy_id) = 0;
 
 		virtual void CalculateRenderParameter(const std::shared_ptr<ICamera>& camera) = 0;
 		virtual inline const Bounds& GetRendererBounds() const = 0;
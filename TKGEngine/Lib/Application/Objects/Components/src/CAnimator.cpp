@@ -15,6 +15,7 @@
 
 #include "Utility/inc/myfunc_file.h"
 
+#include <algorithm>
 #include <functional>
 #include <cassert>
 
@@ -123,8 +124,22 @@ namespace TKGEngine
 					SetAvatar(filepath);
 				}
 			}
+			// Bone
+			bool write_back_all = m_write_back_all_bones;
+			if (ImGui::Checkbox("Write Back All Bones", &write_back_all))
+			{
+				SetWriteBackAllBones(write_back_all);
+			}
+			ImGui::SameLine();
+			ImGui::HelpMarker("If disabled, only bones that have attached children are written back to their Transform.");
 		}
 		ImGui::Unindent(ImGui::INDENT_VALUE);
+
+		// LOD
+		{
+			constexpr const char* tier_names[] = { "Full", "Reduced", "Minimum", "Frozen" };
+			ImGui::Text("Update Tier : %s", tier_names[static_cast<int>(m_update_tier)]);
+		}
 		
 		ImGui::PopID();
 	}
@@ -224,16 +239,27 @@ namespace TKGEngine
 		return m_bone_references;
 	}
 
+	void Animator::SetWriteBackAllBones(const bool write_back_all)
+	{
+		m_write_back_all_bones = write_back_all;
+		m_is_bone_write_back_dirty = true;
+	}
+
 	int Animator::GetParameterCount() const
 	{
 		return m_controller.GetParameterCount();
 	}
 
-	std::shared_ptr<Animations::AnimatorControllerParameter> Animator::GetParameter(const std::string& param_name)
+	Animations::AnimatorControllerParameter* Animator::GetParameter(const std::string& param_name)
 	{
 		return m_controller.GetParameter(param_name);
 	}
 
+	Animations::ParameterID Animator::GetParameterID(const std::string& param_name) const
+	{
+		return m_controller.GetParameterID(param_name);
+	}
+
 	void Animator::SetBool(const std::string& param_name, bool param)
 	{
 		m_controller.SetBool(param_name, param);
@@ -274,11 +300,66 @@ namespace TKGEngine
 		return m_controller.ResetTrigger(param_name);
 	}
 
+	void Animator::SetBool(const Animations::ParameterID id, bool param)
+	{
+		m_controller.SetBool(id, param);
+	}
+
+	void Animator::SetInteger(const Animations::ParameterID id, int param)
+	{
+		m_controller.SetInteger(id, param);
+	}
+
+	void Animator::SetFloat(const Animations::ParameterID id, float param)
+	{
+		m_controller.SetFloat(id, param);
+	}
+
+	void Animator::SetTrigger(const Animations::ParameterID id)
+	{
+		m_controller.SetTrigger(id);
+	}
+
+	bool Animator::GetBool(const Animations::ParameterID id)
+	{
+		return m_controller.GetBool(id);
+	}
+
+	int Animator::GetInteger(const Animations::ParameterID id)
+	{
+		return m_controller.GetInteger(id);
+	}
+
+	float Animator::GetFloat(const Animations::ParameterID id)
+	{
+		return m_controller.GetFloat(id);
+	}
+
+	void Animator::ResetTrigger(const Animations::ParameterID id)
+	{
+		m_controller.ResetTrigger(id);
+	}
+
 	void Animator::SetUpdateMode(UpdateMode mode)
 	{
 		m_update_mode = mode;
 	}
 
+	void Animator::OnRendered(const Bounds& bounds)
+	{
+		std::lock_guard<std::mutex> lock(m_lod_bounds_mutex);
+		// ̃_[ŕ`悳ꂽ獇
+		if (m_is_rendered)
+		{
+			m_rendered_bounds.Union(bounds);
+		}
+		else
+		{
+			m_rendered_bounds = bounds;
+			m_is_rendered = true;
+		}
+	}
+
 	void Animator::OnCreate(const std::shared_ptr<Object>& p_self)
 	{
 		const std::shared_ptr<Animator> anim = std::static_pointer_cast<Animator>(p_self);
@@ -293,7 +374,10 @@ namespace TKGEngine
 			// z̃TCY
 			const int enabled_bone_cnt = m_avatar.GetEnabledBoneCount();
 			m_current_key_data.resize(enabled_bone_cnt);
+			m_prev_key_data.resize(enabled_bone_cnt);
 			m_cb_matrix_data.resize(enabled_bone_cnt);
+			// {[̔z쐬
+			BuildBonePalette();
 			// CBuffer̍쐬
 			m_cb_model.Create(static_cast<int>(sizeof(MATRIX)) * MAX_BONES, true);
 		}
@@ -330,6 +414,7 @@ namespace TKGEngine
 		m_node_references.resize(bone_cnt);
 		const int enabled_bone_cnt = m_avatar.GetEnabledBoneCount();
 		m_current_key_data.resize(enabled_bone_cnt);
+		m_prev_key_data.resize(enabled_bone_cnt);
 		m_cb_matrix_data.resize(enabled_bone_cnt);
 		
 		// Root Bone珇Ƀ{[GameObjectƂč쐬
@@ -343,6 +428,8 @@ namespace TKGEngine
 				RecurseCreateFromBone(root, root_idx, go, true, counter);
 			}
 		}
+		// {[̔z쐬
+		BuildBonePalette();
 
 		// BoneCB쐬
 		// TODO : x̂߂ɉߏȃobt@TCYmۂĂ
@@ -359,6 +446,23 @@ namespace TKGEngine
 		m_node_references.shrink_to_fit();
 		m_current_key_data.clear();
 		m_current_key_data.shrink_to_fit();
+		m_prev_key_data.clear();
+		m_prev_key_data.shrink_to_fit();
+		m_bone_parents.clear();
+		m_bone_parents.shrink_to_fit();
+		m_bone_inverse_transforms.clear();
+		m_bone_inverse_transforms.shrink_to_fit();
+		m_bone_local_pose.clear();
+		m_bone_local_pose.shrink_to_fit();
+		m_bone_model_matrices.clear();
+		m_bone_model_matrices.shrink_to_fit();
+		m_bone_write_back.clear();
+		m_bone_write_back.shrink_to_fit();
+		m_bone_write_back_work.clear();
+		m_bone_write_back_work.shrink_to_fit();
+		m_bone_child_counts.clear();
+		m_bone_child_counts.shrink_to_fit();
+		m_is_matrix_updated = false;
 		const int root_cnt = static_cast<int>(m_root_bones.size());
 		for (int i = 0; i < root_cnt; ++i)
 		{
@@ -401,72 +505,266 @@ namespace TKGEngine
 		}
 	}
 
-	void Animator::RecurseCalculateAnimationMatrix(const Node* node, const int self_idx, const MATRIX& matrix)
+	void Animator::BuildBonePalette()
 	{
-		const int child_cnt = static_cast<int>(node->children_idx.size());
-		const int matrix_idx = m_node_references.at(self_idx);
+		const int bone_cnt = static_cast<int>(m_bone_references.size());
+		m_bone_parents.assign(bone_cnt, -1);
+		m_bone_inverse_transforms.resize(bone_cnt);
+		m_bone_local_pose.resize(bone_cnt);
+		m_bone_model_matrices.assign(bone_cnt, MATRIX::Identity);
+		m_bone_write_back.assign(bone_cnt, 0);
+		m_is_bone_write_back_dirty = true;
+		m_is_pose_updated = true;
+
+		// RecurseCreateFromBoneƓ[D揇œWJ
+		// first : avatarindex, second : e̗vfԍ
+		std::vector<std::pair<int, int>> node_stack;
+		int counter = 0;
+		const int root_cnt = static_cast<int>(m_root_index.size());
+		for (int i = 0; i < root_cnt; ++i)
+		{
+			node_stack.emplace_back(m_root_index.at(i), -1);
+			while (!node_stack.empty() && counter < bone_cnt)
+			{
+				const auto [node_idx, parent] = node_stack.back();
+				node_stack.pop_back();
+				const Node* node = m_avatar.GetNode(node_idx);
+
+				m_bone_parents.at(counter) = parent;
+				m_bone_inverse_transforms.at(counter) = node->inverse_transform;
+				// Nodȅʒuw
+				auto& pose = m_bone_local_pose.at(counter);
+				pose.translate = node->init_translate;
+				pose.rotate = node->init_rotate;
+				pose.scale = node->init_scale;
+
+				// 擪̎qo悤ɋtɐς
+				const auto& child_node_indices = node->children_idx;
+				for (auto itr = child_node_indices.rbegin(); itr != child_node_indices.rend(); ++itr)
+				{
+					node_stack.emplace_back(*itr, counter);
+				}
+				++counter;
+			}
+			node_stack.clear();
+		}
+	}
 
-		const MATRIX anim_matrix = m_bone_references.at(self_idx)->GetAffineTransform() * matrix;
+	void Animator::RefreshBoneWriteBack()
+	{
+		const int bone_cnt = static_cast<int>(m_bone_parents.size());
+		auto& write_back = m_bone_write_back_work;
+		write_back.assign(bone_cnt, m_write_back_all_bones ? 1 : 0);
+		if (!m_write_back_all_bones)
+		{
+			// Avatar̃{[ƂĂ̎q̐
+			auto& child_counts = m_bone_child_counts;
+			child_counts.assign(bone_cnt, 0);
+			for (int i = 0; i < bone_cnt; ++i)
+			{
+				const int parent = m_bone_parents.at(i);
+				if (parent != -1)
+				{
+					++child_counts.at(parent);
+				}
+			}
+			// {[ȊO̎q{[ƁA̐e߂(q͐eɂ)
+			for (int i = bone_cnt - 1; i >= 0; --i)
+			{
+				if (m_bone_references.at(i)->GetChildCount() > child_counts.at(i))
+				{
+					write_back.at(i) = 1;
+				}
+				const int parent = m_bone_parents.at(i);
+				if (write_back.at(i) && parent != -1)
+				{
+					write_back.at(parent) = 1;
+				}
+			}
+		}
 
-		if (matrix_idx != -1)
+		// V߂{[݂͌̃|[Yɍ킹
+		for (int i = 0; i < bone_cnt; ++i)
 		{
-			m_cb_matrix_data.at(matrix_idx) = node->inverse_transform * anim_matrix;
+			if (write_back.at(i) && !m_bone_write_back.at(i))
+			{
+				const auto& pose = m_bone_local_pose.at(i);
+				const auto& transform = m_bone_references.at(i);
+				transform->LocalPosition(pose.translate);
+				transform->LocalRotation(pose.rotate);
+				transform->LocalScale(pose.scale);
+			}
 		}
+		m_bone_write_back.swap(write_back);
+	}
 
-		const auto& child_node_indices = node->children_idx;
-		for (int i = 0; i < child_cnt; ++i)
+	void Animator::SetBoneTransforms(const float ratio)
+	{
+		const bool use_blend = ratio < 1.0f;
+		const int bone_cnt = static_cast<int>(m_bone_local_pose.size());
+		for (int i = 0; i < bone_cnt; ++i)
 		{
-			const int child_idx = child_node_indices.at(i);
-			RecurseCalculateAnimationMatrix(m_avatar.GetNode(child_idx), child_idx, anim_matrix);
+			const int bone_idx = m_node_references.at(i);
+			// Aj[VȂ{[
+			if (bone_idx == -1)
+				continue;
+
+			// {[̃|[YZbg
+			auto& pose = m_bone_local_pose.at(i);
+			const auto& key = m_current_key_data.at(bone_idx);
+			if (use_blend)
+			{
+				const auto& prev_key = m_prev_key_data.at(bone_idx);
+				pose.translate = VECTOR3::Lerp(prev_key.translate, key.translate, ratio);
+				pose.rotate = Quaternion::Slerp(prev_key.rotate, key.rotate, ratio);
+				pose.scale = VECTOR3::Lerp(prev_key.scale, key.scale, ratio);
+			}
+			else
+			{
+				pose = key;
+			}
+
+			// A^b`Ă{[̂Transformɏ߂
+			if (m_bone_write_back.at(i))
+			{
+				const auto& transform = m_bone_references.at(i);
+				transform->LocalPosition(pose.translate);
+				transform->LocalRotation(pose.rotate);
+				transform->LocalScale(pose.scale);
+			}
 		}
 	}
 
-	void Animator::ApplyAnimationTransform()
+	bool Animator::GetLODSphere(VECTOR3& center, float& radius)
+	{
+		bool was_rendered = false;
+		{
+			std::lock_guard<std::mutex> lock(m_lod_bounds_mutex);
+			was_rendered = m_is_rendered;
+			if (m_is_rendered)
+			{
+				m_lod_center = m_rendered_bounds.GetCenter();
+				m_lod_radius = m_rendered_bounds.GetExtents().Length();
+				m_is_rendered = false;
+			}
+		}
+		// `悳ĂȂƂ͍Ōɕ`悵Ƃ̑傫gp
+		center = was_rendered ? m_lod_center : GetTransform()->Position();
+		radius = m_lod_radius;
+		return was_rendered;
+	}
+
+	bool Animator::SelectUpdateTier(const float distance, const float screen_size, const bool was_rendered)
+	{
+		using Animations::AnimatorUpdateTier;
+
+		const auto& settings = m_controller.GetLODSettings();
+		AnimatorUpdateTier tier = AnimatorUpdateTier::Full;
+		if (settings.use_lod)
+		{
+			tier = settings.SelectTier(distance, screen_size);
+		}
+		// `悳ĂȂƂ̒iK̉
+		if (!was_rendered)
+		{
+			switch (m_culling_mode)
+			{
+				case CullingMode::AlwaysAnimation:
+					if (settings.use_lod)
+						tier = (std::max)(tier, settings.invisible_tier);
+					break;
+				case CullingMode::CullUpdateTransform:
+					tier = (std::max)(tier, AnimatorUpdateTier::Minimum);
+					break;
+				case CullingMode::CullCompletely:
+					tier = AnimatorUpdateTier::Frozen;
+					break;
+			}
+		}
+
+		switch (tier)
+		{
+			case AnimatorUpdateTier::Reduced:
+				m_lod_interval = (std::max)(settings.reduced_interval, 1);
+				break;
+			case AnimatorUpdateTier::Minimum:
+				m_lod_interval = (std::max)(settings.minimum_interval, 1);
+				break;
+			default:
+				m_lod_interval = 1;
+				break;
+		}
+		if (tier != m_update_tier)
+		{
+			// ~ĂԂ͐i߂Ȃ
+			if (m_update_tier == AnimatorUpdateTier::Frozen)
+			{
+				m_lod_elapsed_time = 0.0f;
+			}
+			// iKς玟̍XVłɕ]
+			m_lod_frame_count = m_lod_interval - 1;
+			m_update_tier = tier;
+		}
+		return tier != AnimatorUpdateTier::Frozen;
+	}
+
+	bool Animator::PrepareAnimationTransform()
 	{
 		// ^[
 		if (!m_avatar_filedata.HasData() || !m_controller.HasController())
-			return;
+			return false;
+
+		// LĂRg[̎QƂp[^̗vfԍ̓WůJnOɍXVĂ
+		m_controller.ResolveParameterIDs();
 
 		// UpdateModeɂoߎԂ̎擾
-		float elapsed_time = 0.0f;
 		switch (m_update_mode)
 		{
 			case UpdateMode::Normal:
-				elapsed_time = ITime::Get().DeltaTime();
+				m_lod_elapsed_time += ITime::Get().DeltaTime();
 				break;
 			case UpdateMode::UnscaledTime:
-				elapsed_time = ITime::Get().UnscaledDeltaTime();
+				m_lod_elapsed_time += ITime::Get().UnscaledDeltaTime();
 				break;
 		}
-		// KeyFramȅ擾
-		m_controller.ApplyAnimationTransform(
-			GetOwnerID(),
-			elapsed_time,
-			m_avatar.GetNodeIndex(),
-			m_node_references,
-			m_current_key_data
-		);
+		// ]̊ԊuɒB]
+		++m_lod_frame_count;
+		m_lod_evaluate = m_lod_frame_count >= m_lod_interval;
+		// Reduced͕]Ȃt[Ԃ|[YZbg
+		return m_lod_evaluate || m_update_tier == Animations::AnimatorUpdateTier::Reduced;
+	}
 
-		// Transform̍XV
-		const int tr_cnt = static_cast<int>(m_bone_references.size());
-		for (int i = 0; i < tr_cnt; ++i)
+	void Animator::ApplyAnimationTransform()
+	{
+		// ^[
+		if (!m_avatar_filedata.HasData() || !m_controller.HasController())
+			return;
+
+		const bool is_reduced = m_update_tier == Animations::AnimatorUpdateTier::Reduced;
+		if (m_lod_evaluate)
 		{
-			const int bone_idx = m_node_references.at(i);
-			// Aj[VȂ{[
-			if (bone_idx == -1)
+			// ԌƂđO̕]ʂc
+			if (is_reduced)
 			{
-				//const Node* node = m_avatar.GetNode(i);
-				//m_bone_references.at(i)->LocalPosition(node->init_translate);
-				//m_bone_references.at(i)->LocalRotation(node->init_rotate);
-				//m_bone_references.at(i)->LocalScale(node->init_scale);
-				continue;
+				std::copy(m_current_key_data.begin(), m_current_key_data.end(), m_prev_key_data.begin());
 			}
-
-			// {[TransformZbg
-			m_bone_references.at(i)->LocalPosition(m_current_key_data.at(bone_idx).translate);
-			m_bone_references.at(i)->LocalRotation(m_current_key_data.at(bone_idx).rotate);
-			m_bone_references.at(i)->LocalScale(m_current_key_data.at(bone_idx).scale);
+			// KeyFramȅ擾
+			m_controller.ApplyAnimationTransform(
+				GetOwnerID(),
+				m_lod_elapsed_time,
+				m_avatar,
+				m_node_references,
+				m_current_key_data
+			);
+			m_lod_elapsed_time = 0.0f;
+			m_lod_frame_count = 0;
+			m_lod_evaluate = false;
 		}
+
+		// Transform̍XV
+		// Reduced1ԊuxāAOƍ̕]ʂ̊ԂԂ
+		SetBoneTransforms(is_reduced ? static_cast<float>(m_lod_frame_count) / static_cast<float>(m_lod_interval) : 1.0f);
+		m_is_pose_updated = true;
 	}
 
 	void Animator::UpdateAnimationMatrix()
@@ -474,16 +772,66 @@ namespace TKGEngine
 		// ^[
 		if (!m_avatar_filedata.HasData())
 			return;
-		
-		// RootXVĂ
-		const int root_cnt = static_cast<int>(m_root_index.size());
-		for (int i = 0; i < root_cnt; ++i)
+
+		// Root Boneȉ̃qGL[ςĂ珑߂{[Iђ
+		// (l͒Pɑ̂ŁAvςȂ΂ǂRoot BoneȉςĂȂ)
+		std::uint32_t revision = 0;
+		for (const auto& root_bone : m_root_bones)
 		{
-			const int root_idx = m_root_index.at(i);
-			const Node* root = m_avatar.GetNode(root_idx);
-			// Animation Matrix̍ċA֐
-			RecurseCalculateAnimationMatrix(root, root_idx, MATRIX::Identity);
+			revision += root_bone->GetTransform()->GetSubtreeRevision();
 		}
+		if (m_is_bone_write_back_dirty || revision != m_bone_hierarchy_revision)
+		{
+			m_bone_hierarchy_revision = revision;
+			m_is_bone_write_back_dirty = false;
+			RefreshBoneWriteBack();
+		}
+
+		// ߂{[iĂƂAMinimumȉ̒iKł̓{[t[XV(XNvgɂ{[̒fȂ)
+		if (!m_write_back_all_bones && m_update_tier >= Animations::AnimatorUpdateTier::Minimum && !m_is_pose_updated)
+			return;
+		m_is_pose_updated = false;
+
+		// eqOɕł̂Ő擪珇1xvZ
+		using namespace DirectX;
+		const XMVECTOR zero = XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
+		const int bone_cnt = static_cast<int>(m_bone_local_pose.size());
+		for (int i = 0; i < bone_cnt; ++i)
+		{
+			auto& pose = m_bone_local_pose[i];
+			// ߂Ă{[̓XNvgɂ钲𔽉f
+			if (m_bone_write_back[i])
+			{
+				const auto& transform = m_bone_references[i];
+				pose.translate = transform->LocalPosition();
+				pose.rotate = transform->LocalRotation();
+				pose.scale = transform->LocalScale();
+			}
+
+			// MATRIX::CreateWorldƓ S * R * T
+			XMMATRIX model = XMMatrixAffineTransformation(XMLoadFloat3(&pose.scale), zero, XMLoadFloat4(&pose.rotate), XMLoadFloat3(&pose.translate));
+			const int parent = m_bone_parents[i];
+			if (parent != -1)
+			{
+				model = XMMatrixMultiply(model, XMLoadFloat4x4(&m_bone_model_matrices[parent]));
+			}
+			XMStoreFloat4x4(&m_bone_model_matrices[i], model);
+
+			const int matrix_idx = m_node_references[i];
+			if (matrix_idx != -1)
+			{
+				XMStoreFloat4x4(&m_cb_matrix_data[matrix_idx], XMMatrixMultiply(XMLoadFloat4x4(&m_bone_inverse_transforms[i]), model));
+			}
+		}
+		m_is_matrix_updated = true;
+	}
+
+	void Animator::UploadAnimationMatrix()
+	{
+		// ^[
+		if (!m_is_matrix_updated)
+			return;
+		m_is_matrix_updated = false;
 
 		// CBufferɑ
 		const auto context = IGraphics::Get().IC();
@@ -55,35 +55,17 @@ namespace TKGEngine
 
 	bool Behaviour::IsActiveAndEnabled()
 	{
-		const auto s_ptr = GetGameObject();
-		if (s_ptr == nullptr)
-		{
-			LOG_ASSERT("invalid shared pointer. Behaviour::IsActiveAndEnabled()");
-			return false;
-		}
-		return m_enabled && s_ptr->GetActiveHierarchy();
+		return m_enabled && IsOwnerActiveHierarchy();
 	}
 
 	bool Behaviour::IsActiveScene()
 	{
-		const auto s_ptr = GetGameObject();
-		if (s_ptr == nullptr)
-		{
-			LOG_ASSERT("invalid shared pointer. Behaviour::IsActiveScene()");
-			return false;
-		}
-		return SceneManager::GetActive(s_ptr->GetScene());
+		return IsOwnerActiveScene();
 	}
 
 	bool Behaviour::IsActiveBehaviour()
 	{
-		const auto s_ptr = GetGameObject();
-		if (s_ptr == nullptr)
-		{
-			LOG_ASSERT("invalid shared pointer. Behaviour::IsActiveBehaviour()");
-			return false;
-		}
-		return m_enabled && s_ptr->GetActiveHierarchy() && SceneManager::GetActive(s_ptr->GetScene());
+		return m_enabled && IsOwnerActiveHierarchy() && IsOwnerActiveScene();
 	}
 
 }// namespace TKGEngine
\ No newline at end of file
@@ -198,8 +198,9 @@ namespace TKGEngine
 			{
 				// prevɑ݂̂currentɑ݂邩`FbN
 				const auto itr_find = m_current_trigger_list.find(*itr);
-				// ColliderIDColliderR|[lg擾
-				auto other = std::static_pointer_cast<Collider>(collider_map->find(*itr)->second);
+				// ColliderIDColliderR|[lg擾(jς݂Ȃnullptr)
+				const auto* other_find = collider_map->Find(*itr);
+				auto other = other_find ? std::static_pointer_cast<Collider>(*other_find) : std::shared_ptr<Collider>();
 				// prevXgɑ݂AcurrentXgɑ݂Ȃ
 				if (itr_find != itr_current_end)
 				{
@@ -227,8 +228,9 @@ namespace TKGEngine
 		{
 			for (const auto& id : m_current_trigger_list)
 			{
-				// ColliderIDColliderR|[lg擾
-				auto other = std::static_pointer_cast<Collider>(collider_map->find(id)->second);
+				// ColliderIDColliderR|[lg擾(jς݂Ȃnullptr)
+				const auto* other_find = collider_map->Find(id);
+				auto other = other_find ? std::static_pointer_cast<Collider>(*other_find) : std::shared_ptr<Collider>();
 
 				// OnTriggerEnterĂ
 				MonoBehaviourManager::OnTriggerEnter(GetOwnerID(), other);
@@ -256,8 +258,9 @@ namespace TKGEngine
 			{
 				// prevɑ݂̂currentɑ݂邩`FbN
 				const auto itr_find = m_current_collision_list.find(*itr);
-				// ColliderIDColliderR|[lg擾
-				auto other = std::static_pointer_cast<Collider>(collider_map->find(*itr)->second);
+				// ColliderIDColliderR|[lg擾(jς݂Ȃnullptr)
+				const auto* other_find = collider_map->Find(*itr);
+				auto other = other_find ? std::static_pointer_cast<Collider>(*other_find) : std::shared_ptr<Collider>();
 				// prevXgɑ݂AcurrentXgɑ݂Ȃ
 				if (itr_find != itr_current_end)
 				{
@@ -285,8 +288,9 @@ namespace TKGEngine
 		{
 			for (const auto& id : m_current_collision_list)
 			{
-				// ColliderIDColliderR|[lg擾
-				auto other = std::static_pointer_cast<Collider>(collider_map->find(id)->second);
+				// ColliderIDColliderR|[lg擾(jς݂Ȃnullptr)
+				const auto* other_find = collider_map->Find(id);
+				auto other = other_find ? std::static_pointer_cast<Collider>(*other_find) : std::shared_ptr<Collider>();
 
 				// OnCollisionEnterĂ
 				MonoBehaviourManager::OnCollisionEnter(GetOwnerID(), other);
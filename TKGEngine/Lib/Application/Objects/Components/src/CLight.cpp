@@ -523,7 +523,7 @@ namespace TKGEngine
 		m_shadow_map.reset();
 	}
 
-	int Light::CalculateShadowCaster(const std::vector<MainData>& scene_objects, const int object_num, const std::shared_ptr<ICamera>& camera) const
+	int Light::CalculateShadowCaster(const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera) const
 	{
 		if (m_shadow_map == nullptr)
 			return 0;
@@ -543,7 +543,7 @@ namespace TKGEngine
 			light_data.far_plane = MyMath::Min(m_range, m_max_shadow_far_plane);
 		}
 		light_data.spot_angle = m_spot_angle_outer;
-		return m_shadow_map->CalculateShadowCaster(scene_objects, object_num, camera, light_data);
+		return m_shadow_map->CalculateShadowCaster(scene_objects, object_num, caster_tree, camera, light_data);
 	}
 
 	bool Light::IsRenderShadowCaster() const
@@ -578,11 +578,11 @@ namespace TKGEngine
 		return m_shadow_map->GetSamplingCount();
 	}
 
-	void Light::RenderShadowCaster(ID3D11DeviceContext* context, VertexBuffer& instance_buffer) const
+	void Light::RenderShadowCaster(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects, VertexBuffer& instance_buffer) const
 	{
 		if (m_shadow_map == nullptr)
 			return;
-		m_shadow_map->RenderShadow(context, instance_buffer);
+		m_shadow_map->RenderShadow(context, scene_objects, instance_buffer);
 	}
 
 }// namespace TKGEngine
\ No newline at end of file
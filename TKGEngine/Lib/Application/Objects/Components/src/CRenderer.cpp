@@ -617,14 +617,7 @@ namespace TKGEngine
 
 	bool Renderer::IsActiveAndEnabled()
 	{
-		const auto s_go = GetGameObject();
-		if (!s_go)
-		{
-			LOG_ASSERT("invalid shared pointer. Renderer::IsActiveAndEnabled()");
-			return false;
-		}
-
-		return m_is_enabled && s_go->GetActiveHierarchy() && SceneManager::GetActive(s_go->GetScene());
+		return m_is_enabled && IsOwnerActiveHierarchy() && IsOwnerActiveScene();
 	}
 
 	void Renderer::CalculateRenderParameter(const std::shared_ptr<ICamera>& camera)
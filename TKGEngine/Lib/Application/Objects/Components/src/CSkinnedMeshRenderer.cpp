@@ -354,6 +354,8 @@ namespace TKGEngine
 			if (m_animator)
 			{
 				m_animator->SetCB(compute_context, CBS_MODEL, true);
+				// `悳ꂽƂAj[VLOD̔ɒʒm
+				m_animator->OnRendered(m_bounds);
 			}
 			else
 			{
@@ -470,6 +472,8 @@ namespace TKGEngine
 			if (m_animator)
 			{
 				m_animator->SetCB(compute_context, CBS_MODEL, true);
+				// `悳ꂽƂAj[VLOD̔ɒʒm
+				m_animator->OnRendered(m_bounds);
 			}
 			else
 			{
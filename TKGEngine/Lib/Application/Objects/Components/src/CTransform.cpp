@@ -3,6 +3,7 @@
 
 #include "Managers/GameObjectManager.h"
 #include "Managers/SceneManager.h"
+#include "Managers/TransformManager.h"
 #include "Utility/inc/myfunc_math.h"
 
 #ifdef USE_IMGUI
@@ -10,12 +11,21 @@
 #endif // USE_IMGUI
 
 #include <iterator>
+#include <cstdint>
 #include <cassert>
 
 REGISTERCOMPONENT(TKGEngine::Transform);
 
 namespace TKGEngine
 {
+	namespace /* anonymous */
+	{
+		// [h̃LbV蒼ۂmutex
+		// TransformƂɎAAhX番UċL
+		constexpr size_t WORLD_CACHE_MUTEX_NUM = 64;
+		std::mutex g_world_cache_mutexes[WORLD_CACHE_MUTEX_NUM];
+	}/* anonymous */
+
 	////////////////////////////////////////////////////////
 	// Class Methods
 	////////////////////////////////////////////////////////
@@ -92,7 +102,7 @@ namespace TKGEngine
 		// ύXꍇATransformgGizmoɒm点
 		if (has_changed)
 		{
-			m_is_changed = true;
+			OnChangedParameter();
 			IGUI::Get().EnterControlTransform();
 		}
 		else
@@ -108,10 +118,13 @@ namespace TKGEngine
 		m_gameObject = GameObjectManager::GetGameObject(p_comp->GetOwnerID());
 		const auto p_transform = std::static_pointer_cast<Transform>(p_comp);
 		p_transform->SetTransform(p_transform);
+		m_manager_id = TransformManager::RegisterManager(p_transform);
 	}
 
 	void Transform::OnDestroy()
 	{
+		TransformManager::UnregisterManager(m_manager_id);
+
 		if (!m_is_destroying)
 		{
 			m_is_root_deleter = true;
@@ -132,17 +145,6 @@ namespace TKGEngine
 		}
 	}
 
-	void Transform::RecurseOnRotation(const std::shared_ptr<Transform>& parent, Quaternion& rot) const
-	{
-		// [J̉]|
-		rot *= parent->LocalRotation();
-		// e΍ċAIɌĂяo
-		if (parent->GetParent())
-		{
-			RecurseOnRotation(parent->GetParent(), rot);
-		}
-	}
-
 	void Transform::RecurseOnEulerAngles(const std::shared_ptr<Transform>& parent, VECTOR3& angles) const
 	{
 		// [J̃IC[pZ
@@ -154,28 +156,6 @@ namespace TKGEngine
 		}
 	}
 
-	void Transform::RecurseOnScale(const std::shared_ptr<Transform>& parent, VECTOR3& scale) const
-	{
-		// [J̃XP[|
-		scale *= parent->LocalScale();
-		// e΍ċAIɌĂяo
-		if (parent->GetParent())
-		{
-			RecurseOnScale(parent->GetParent(), scale);
-		}
-	}
-
-	void Transform::RecurseOnAxis(const std::shared_ptr<Transform>& parent, Quaternion& rot) const
-	{
-		// [J̉]|
-		rot *= parent->LocalRotation();
-		// e΍ċAIɌĂяo
-		if (parent->GetParent())
-		{
-			RecurseOnAxis(parent->GetParent(), rot);
-		}
-	}
-
 	void Transform::RecurseOnSetScene(const std::shared_ptr<Transform>& child, const int scene_id) const
 	{
 		const int child_cnt = child->GetChildCount();
@@ -191,20 +171,79 @@ namespace TKGEngine
 		child->GetGameObject()->SetScene(scene_id);
 	}
 
-	void Transform::RecurseOnCalculateWorldMatrix(const std::shared_ptr<Transform>& parent, MATRIX& matrix) const
+	void Transform::RecurseOnSetWorldChanged()
 	{
-		matrix *= parent->GetAffineTransform();
-		// e΍ċAIɌvZ
-		if (parent->GetParent())
+		m_is_world_changed = true;
+
+		if (m_child_count <= 0)
+			return;
+		for (auto&& child : m_children)
+		{
+			const auto s_ptr = child.lock();
+			// ɃtOĂ΂̎qȉĂ̂œ`Ȃ
+			if (s_ptr == nullptr || s_ptr->m_is_world_changed)
+				continue;
+			s_ptr->RecurseOnSetWorldChanged();
+		}
+	}
+
+	void Transform::UpdateWorldCache() const
+	{
+		// geȏɕύXȂ΃LbV̂܂܎g
+		if (!m_is_world_changed.load(std::memory_order_acquire))
+			return;
+
+		// ẽLbVɍXVĂ
+		// bN܂ܐe֐i܂Ȃ̂ŁAɕʂ̎qeǂĂfbhbNȂ
+		if (m_parent)
 		{
-			RecurseOnCalculateWorldMatrix(parent->GetParent(), matrix);
+			m_parent->UpdateWorldCache();
 		}
+
+		// Aj[V⃉Cg̃Wu瓯TransformɎQƂ邽߁A݂1Xbĥݍs
+		std::lock_guard<std::mutex> lock(GetWorldCacheMutex());
+		// ҂ĂԂɑ̃XbhXVIĂΉȂ
+		if (!m_is_world_changed.load(std::memory_order_relaxed))
+			return;
+
+		// p[^ɕύX̂݃[Js쐬
+		if (m_is_changed)
+		{
+			m_affine_transform = MATRIX::CreateWorld(m_local_position, m_local_rotation, m_local_scale);
+			m_is_changed = false;
+		}
+
+		// eȂ΃[J̒l̂܂܃[h̒lɂȂ
+		if (!m_parent)
+		{
+			m_world_matrix = m_affine_transform;
+			m_world_rotation = m_local_rotation;
+			m_lossy_scale = m_local_scale;
+		}
+		// e΍XVς݂̐ẽLbVɊ|
+		else
+		{
+			m_world_matrix = m_affine_transform * m_parent->m_world_matrix;
+			m_world_rotation = m_local_rotation * m_parent->m_world_rotation;
+			m_lossy_scale = m_local_scale * m_parent->m_lossy_scale;
+		}
+
+		// LbV̍XV(ȍ~̓bNɓǂ܂)
+		m_is_world_changed.store(false, std::memory_order_release);
+	}
+
+	std::mutex& Transform::GetWorldCacheMutex() const
+	{
+		// ʃrbg̓ACgőĂ̂Ŏ̂Ă
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(this);
+		return g_world_cache_mutexes[(address >> 6) % WORLD_CACHE_MUTEX_NUM];
 	}
 
 	void Transform::RecurseDestroy()
 	{
 		m_is_destroying = true;
 		m_parent.reset();
+		m_is_world_changed = true;
 
 		if (m_child_count > 0)
 		{
@@ -249,6 +288,16 @@ namespace TKGEngine
 
 			++itr;
 		}
+		OnChangeChildren();
+	}
+
+	void Transform::OnChangeChildren()
+	{
+		// qGL[̕ύX̓CXbĥ݂ōŝŁAcɒHĂ悢
+		for (Transform* transform = this; transform != nullptr; transform = transform->m_parent.get())
+		{
+			transform->m_subtree_revision.fetch_add(1, std::memory_order_relaxed);
+		}
 	}
 
 	void Transform::OnDeserialize()
@@ -267,6 +316,7 @@ namespace TKGEngine
 		{
 			const auto child_transform = child.lock();
 			child_transform->m_parent = transform;
+			child_transform->RecurseOnSetWorldChanged();
 		}
 	}
 
@@ -283,7 +333,7 @@ namespace TKGEngine
 			OnTranslateSetPosition(translation);
 		}
 
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	void Transform::Translate(float x, float y, float z, bool self_space)
@@ -304,7 +354,7 @@ namespace TKGEngine
 		m_local_rotation = m_local_rotation.Normalize();
 		m_local_euler_angle = m_local_rotation.ToEulerAngles();
 
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	void Transform::Rotate(const VECTOR3& eulers, bool self_space)
@@ -338,8 +388,9 @@ namespace TKGEngine
 		// eȂ΂̂܂ܕԂ
 		if (!m_parent)
 			return m_local_position;
-		// eΐẽ[hsgċ߂
-		return VECTOR3::TransformMatrix(m_local_position, m_parent->GetLocalToWorldMatrix());
+		// e΃LbV[hs񂩂狁߂
+		UpdateWorldCache();
+		return m_world_matrix.Translation();
 	}
 
 	void Transform::Position(const VECTOR3& pos)
@@ -385,7 +436,7 @@ namespace TKGEngine
 			m_local_position += VECTOR3::TransformRotate(translate, m_parent->Rotation().Inverse());
 		}
 
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	std::shared_ptr<Transform> Transform::OnFindRecurse(const std::string& obj_name, const std::shared_ptr<Transform>& transform)
@@ -467,7 +518,7 @@ namespace TKGEngine
 			m_local_position += translation;
 		}
 
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	Quaternion Transform::Rotation() const
@@ -475,11 +526,9 @@ namespace TKGEngine
 		if (m_parent == nullptr)
 			return m_local_rotation;
 
-		// g̊Kw̉]ċAIɊ|
-		Quaternion rot = m_local_rotation;
-		RecurseOnRotation(m_parent, rot);
-
-		return rot;
+		// g̊Kw̉]|LbVԂ
+		UpdateWorldCache();
+		return m_world_rotation;
 	}
 
 	void Transform::Rotation(const Quaternion& quat)
@@ -497,7 +546,7 @@ namespace TKGEngine
 		m_local_rotation = m_local_rotation.Normalize();
 		m_local_euler_angle = m_local_rotation.ToEulerAngles();
 
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	VECTOR3 Transform::EulerAngles() const
@@ -523,7 +572,7 @@ namespace TKGEngine
 		m_local_euler_angle.z = MyMath::Mod(m_local_euler_angle.z, 360.0f);
 		m_local_rotation = Quaternion::EulerAngles(m_local_euler_angle);
 
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	VECTOR3 Transform::LossyScale() const
@@ -531,11 +580,9 @@ namespace TKGEngine
 		if (m_parent == nullptr)
 			return m_local_scale;
 
-		// g̊Kw̃XP[ċAIɊ|
-		VECTOR3 scale = m_local_scale;
-		RecurseOnScale(m_parent, scale);
-
-		return scale;
+		// g̊Kw̃XP[|LbVԂ
+		UpdateWorldCache();
+		return m_lossy_scale;
 	}
 
 	VECTOR3 Transform::Right() const
@@ -543,11 +590,9 @@ namespace TKGEngine
 		if (m_parent == nullptr)
 			return m_local_rotation.ToRotationMatrix().Right();
 
-		// g̊Kw̉]ċAIɊ|
-		Quaternion rot = m_local_rotation;
-		RecurseOnAxis(m_parent, rot);
-
-		return rot.ToRotationMatrix().Right();
+		// g̊Kw̉]|LbV狁߂
+		UpdateWorldCache();
+		return m_world_rotation.ToRotationMatrix().Right();
 	}
 
 	void Transform::Right(const VECTOR3& right)
@@ -566,11 +611,9 @@ namespace TKGEngine
 		if (m_parent == nullptr)
 			return m_local_rotation.ToRotationMatrix().Up();
 
-		// g̊Kw̉]ċAIɊ|
-		Quaternion rot = m_local_rotation;
-		RecurseOnAxis(m_parent, rot);
-
-		return rot.ToRotationMatrix().Up();
+		// g̊Kw̉]|LbV狁߂
+		UpdateWorldCache();
+		return m_world_rotation.ToRotationMatrix().Up();
 	}
 
 	void Transform::Up(const VECTOR3& up)
@@ -589,11 +632,9 @@ namespace TKGEngine
 		if (m_parent == nullptr)
 			return m_local_rotation.ToRotationMatrix().Forward();
 
-		// g̊Kw̉]ċAIɊ|
-		Quaternion rot = m_local_rotation;
-		RecurseOnAxis(m_parent, rot);
-
-		return rot.ToRotationMatrix().Forward();
+		// g̊Kw̉]|LbV狁߂
+		UpdateWorldCache();
+		return m_world_rotation.ToRotationMatrix().Forward();
 	}
 
 	void Transform::Forward(const VECTOR3& forward)
@@ -641,7 +682,10 @@ namespace TKGEngine
 				break;
 			}
 		}
+		m_parent->OnChangeChildren();
 		m_parent.reset();
+		RecurseOnSetWorldChanged();
+		TransformManager::OnChangeHierarchy();
 
 		// V[̃[gɃZbg
 		{
@@ -726,12 +770,16 @@ namespace TKGEngine
 					break;
 				}
 			}
+			m_parent->OnChangeChildren();
 		}
 		// e̎qɎgZbg
 		parent->m_children.emplace_back(p_transform);
 		++parent->m_child_count;
+		parent->OnChangeChildren();
 		// g̐eparentZbg
 		p_transform->m_parent = parent;
+		RecurseOnSetWorldChanged();
+		TransformManager::OnChangeHierarchy();
 
 		// activeԂ̍XV
 		s_go->ApplyActiveInHierarchy(parent->GetGameObject()->GetActiveHierarchy(), SceneManager::GetActive(s_go->GetScene()));
@@ -780,30 +828,26 @@ namespace TKGEngine
 		return m_child_count;
 	}
 
-	const MATRIX& Transform::GetAffineTransform()
+	std::uint32_t Transform::GetSubtreeRevision() const
 	{
-		// p[^ɕύX̂ݍs쐬
-		if (!m_is_changed)
-		{
-			return m_affine_transform;
-		}
-
-		m_affine_transform = MATRIX::CreateWorld(m_local_position, m_local_rotation, m_local_scale);
+		return m_subtree_revision.load(std::memory_order_relaxed);
+	}
 
-		// s̍XV
-		m_is_changed = false;
+	const MATRIX& Transform::GetAffineTransform() const
+	{
+		// [Js̓[h̃LbVƈꏏɍ蒼
+		UpdateWorldCache();
 		return m_affine_transform;
 	}
 
 	MATRIX Transform::GetLocalToWorldMatrix()
 	{
-		MATRIX matrix = this->GetAffineTransform();
 		// eȂ΂̂܂ܕԂ
 		if (!m_parent)
-			return matrix;
-		// ċAIɌvZ
-		RecurseOnCalculateWorldMatrix(m_parent, matrix);
-		return matrix;
+			return GetAffineTransform();
+		// ύXKŵݍČvZ
+		UpdateWorldCache();
+		return m_world_matrix;
 	}
 
 	MATRIX Transform::GetWorldToLocalMatrix()
@@ -816,7 +860,7 @@ namespace TKGEngine
 		m.Decompose(m_local_scale, m_local_rotation, m_local_position);
 		m_local_euler_angle = m_local_rotation.ToEulerAngles();
 
-		m_is_changed = true;
+		OnChangedParameter();
 	}
 
 	void Transform::SetWorldMatrix(const MATRIX& m)
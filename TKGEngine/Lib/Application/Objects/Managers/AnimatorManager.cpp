@@ -1,7 +1,12 @@
 
 #include "AnimatorManager.h"
 
+#include "CameraManager.h"
 #include "Components/interface/IAnimator.h"
+#include "Utility/inc/cpu_profiler.h"
+
+#include <algorithm>
+#include <cfloat>
 
 namespace TKGEngine
 {
@@ -14,8 +19,6 @@ namespace TKGEngine
 	std::list<std::shared_ptr<IAnimator>> AnimatorManager::m_update_animator_list;
 
 	std::mutex AnimatorManager::m_mutex;
-	ThreadPool AnimatorManager::m_threads = ThreadPool(THREAD_NUM);
-	std::vector<std::future<void>> AnimatorManager::m_thread_result = std::vector<std::future<void>>(THREAD_NUM);
 
 
 	////////////////////////////////////////////////////////
@@ -38,18 +41,52 @@ namespace TKGEngine
 
 	void AnimatorManager::CheckUpdatable()
 	{
+		CPU_PROFILE_SCOPE("AnimatorManager::CheckUpdatable");
+
 		// Xg̃NA
 		m_update_animator_list.clear();
 
+		// Õt[ŕ`悵JLOD𔻒肷
+		const auto& view_points = CameraManager::GetLastViewPoints();
+
 		std::lock_guard<std::mutex> lock(m_mutex);
 		// 񓯊΍̍XV\񃊃Xgɂ
 		for (auto& anim_pair : m_animator_index)
 		{
 			const auto& animator = anim_pair.second;
 			// ANeBu`FbN
-			if (animator->IsActiveAnimator())
+			if (!animator->IsActiveAnimator())
+				continue;
+
+			// ł߂J̋ƁAł傫fʃTCY߂
+			VECTOR3 center = VECTOR3::Zero;
+			float radius = 0.0f;
+			const bool was_rendered = animator->GetLODSphere(center, radius);
+			float distance = 0.0f;
+			float screen_size = FLT_MAX;
+			if (!view_points.empty())
+			{
+				distance = FLT_MAX;
+				screen_size = 0.0f;
+				for (const auto& view_point : view_points)
+				{
+					const float center_distance = VECTOR3::Distance(center, view_point.position);
+					distance = (std::min)(distance, (std::max)(center_distance - radius, 0.0f));
+					const float size = view_point.is_orthographic ?
+						radius * view_point.projection_scale :
+						radius * view_point.projection_scale / (std::max)(center_distance, 1.0e-4f);
+					screen_size = (std::max)(screen_size, size);
+				}
+				// 傫Ȃ͉̂ʃTCYŔ肵Ȃ
+				if (radius <= 0.0f)
+				{
+					screen_size = FLT_MAX;
+				}
+			}
+
+			// ~ĂȂ΃Xgɒǉ
+			if (animator->SelectUpdateTier(distance, screen_size, was_rendered))
 			{
-				// ANeBuȂ烊Xgɒǉ
 				m_update_animator_list.emplace_back(animator);
 			}
 		}
@@ -57,34 +94,53 @@ namespace TKGEngine
 
 	void AnimatorManager::ApplyAnimationTransform()
 	{
+		CPU_PROFILE_SCOPE("AnimatorManager::ApplyAnimationTransform");
+
 		// Aj[VTransform̓Kp
+		JobCounter counter;
 		for (const auto& animator : m_update_animator_list)
 		{
-			// ANeBu`FbN
-			if (animator->IsActiveAnimator())
+			// ANeBuŁÃt[Ń|[YXV̂Wuɂ
+			if (animator->IsActiveAnimator() && animator->PrepareAnimationTransform())
 			{
-				m_thread_result.emplace_back(m_threads.Add([&]() {animator->ApplyAnimationTransform(); }));
+				IAnimator* p_animator = animator.get();
+				JobSystem::Run(counter, [p_animator]()
+					{
+						CPU_PROFILE_SCOPE("IAnimator::ApplyAnimationTransform");
+						p_animator->ApplyAnimationTransform();
+					});
 			}
 		}
-		// Thread̏Iҋ@
-		for(const auto& result : m_thread_result)
-		{
-			if (!result.valid())
-				continue;
-			result.wait();
-		}
-		m_thread_result.clear();
+		// WȕIҋ@
+		JobSystem::Wait(counter);
 	}
 
 	void AnimatorManager::UpdateAnimationMatrix()
 	{
+		// Aj[Vs̐AnimatorƂɃWuɕ
+		JobCounter counter;
 		for (const auto& animator : m_update_animator_list)
 		{
 			// ANeBu`FbN
 			if (animator->IsActiveAnimator())
 			{
-				// Aj[Vs̐
-				animator->UpdateAnimationMatrix();
+				IAnimator* p_animator = animator.get();
+				JobSystem::Run(counter, [p_animator]()
+					{
+						CPU_PROFILE_SCOPE("IAnimator::UpdateAnimationMatrix");
+						p_animator->UpdateAnimationMatrix();
+					});
+			}
+		}
+		// WȕIҋ@
+		JobSystem::Wait(counter);
+
+		// Immediate Contextgp̂ŃCXbhő
+		for (const auto& animator : m_update_animator_list)
+		{
+			if (animator->IsActiveAnimator())
+			{
+				animator->UploadAnimationMatrix();
 			}
 		}
 	}
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Utility/inc/template_thread.h"
+#include "Utility/inc/job_system.h"
 
 #include <unordered_map>
 #include <list>
@@ -57,9 +57,5 @@ namespace TKGEngine
 
 		// ̃}l[W[mutex
 		static std::mutex m_mutex;
-		// XVpthread
-		static constexpr int THREAD_NUM = 12;
-		static ThreadPool m_threads;
-		static std::vector<std::future<void>> m_thread_result;
 	};
 }// namespace TKGEngine
\ No newline at end of file
@@ -36,6 +36,7 @@ namespace TKGEngine
 	static constexpr int START_LIST_SIZE = 5;
 	static constexpr int ADD_SIZE = 5;
 	std::vector<std::shared_ptr<ICamera>> CameraManager::m_sorted_list;
+	std::vector<CameraManager::ViewPoint> CameraManager::m_view_points;
 	int CameraManager::m_current_count = 0;
 	int CameraManager::m_prev_count = 0;
 	int CameraManager::m_current_size = 0;
@@ -87,6 +88,8 @@ namespace TKGEngine
 
 	void CameraManager::Run()
 	{
+		m_view_points.clear();
+
 #ifdef USE_IMGUI
 		// V[r[
 		if (IGUI::Get().IsSceneView())
@@ -168,6 +171,11 @@ namespace TKGEngine
 		}
 	}
 
+	const std::vector<CameraManager::ViewPoint>& CameraManager::GetLastViewPoints()
+	{
+		return m_view_points;
+	}
+
 #ifdef USE_IMGUI
 	MATRIX CameraManager::GetSceneView()
 	{
@@ -237,6 +245,16 @@ namespace TKGEngine
 		IGraphics::Get().ClearBackBuffer();
 	}
 
+	void CameraManager::AddViewPoint(const std::shared_ptr<ICamera>& camera)
+	{
+		const MATRIX projection = camera->GetProjectionMatrix();
+		ViewPoint view_point;
+		view_point.position = camera->GetWorldPosition();
+		view_point.projection_scale = projection._22;
+		view_point.is_orthographic = projection._44 == 1.0f;
+		m_view_points.emplace_back(view_point);
+	}
+
 	void CameraManager::RenderAndUpdateCameras()
 	{
 		for (int i = 0; i < m_current_count; ++i)
@@ -248,6 +266,7 @@ namespace TKGEngine
 
 			// ݂TransformCameraXV
 			camera->Update(IGraphics::Get().IC());
+			AddViewPoint(camera);
 
 			// Effect̃JsXV
 			Effect::SetCameraParam(camera->GetWorldToViewMatrix(), camera->GetProjectionMatrix());
@@ -312,6 +331,7 @@ namespace TKGEngine
 		const std::shared_ptr<ICamera> camera = std::static_pointer_cast<ICamera>(m_debug_camera);
 		camera->ClearRTVs(IGraphics::Get().IC(), VECTOR4(0.0f, 0.0f, 0.3f, 1.0f));
 		camera->Update(IGraphics::Get().IC());
+		AddViewPoint(camera);
 
 		// Effect̃JsXV
 		Effect::SetCameraParam(camera->GetWorldToViewMatrix(), camera->GetProjectionMatrix());
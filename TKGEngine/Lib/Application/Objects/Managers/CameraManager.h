@@ -22,6 +22,21 @@ namespace TKGEngine
 	class CameraManager
 	{
 	public:
+		// ==============================================
+		// public struct
+		// ==============================================
+		/// <summary>
+		/// `悵J̎_
+		/// </summary>
+		struct ViewPoint
+		{
+			VECTOR3 position = VECTOR3::Zero;
+			// ˉes̏c̃XP[(eł͋ŊƉʂ̍ɑ΂䗦ɂȂ)
+			float projection_scale = 1.0f;
+			bool is_orthographic = false;
+		};
+
+
 		// ==============================================
 		// public methods
 		// ==============================================
@@ -34,6 +49,9 @@ namespace TKGEngine
 
 		static void OnResizeWindow();
 
+		// Õt[ŕ`悵J̎_(Aj[VLODȂǂ̔Ɏgp)
+		static const std::vector<ViewPoint>& GetLastViewPoints();
+
 #ifdef USE_IMGUI
 		static MATRIX GetSceneView();
 		static void SetSceneView(const MATRIX& view);
@@ -61,6 +79,8 @@ namespace TKGEngine
 
 		static void PresentAndClear();
 		static void RenderAndUpdateCameras();
+		// `悷J̎_L^
+		static void AddViewPoint(const std::shared_ptr<ICamera>& camera);
 #ifdef USE_IMGUI
 		static void RenderAndUpdateDebugCamera();
 #endif// #ifdef USE_IMGUI
@@ -83,6 +103,7 @@ namespace TKGEngine
 		static int m_management_camera_cnt;
 		static int m_current_id;
 		static std::vector<std::shared_ptr<ICamera>> m_sorted_list;
+		static std::vector<ViewPoint> m_view_points;
 		static int m_current_count;
 		static int m_prev_count;
 		static int m_current_size;
@@ -18,14 +18,15 @@ namespace TKGEngine
 	////////////////////////////////////////////////////////
 	std::unordered_map<std::string, ComponentTypeID> ComponentManager::m_typeName_id_index;
 	std::unordered_map<std::string, ComponentTypeID> ComponentManager::m_componentName_id_index;
-	std::unordered_map<ComponentTypeID, std::string> ComponentManager::m_componentTypeID_typeName_index;
+	std::vector<std::string> ComponentManager::m_typeID_typeName_list;
 	std::unordered_map<ComponentTypeID, std::function<std::shared_ptr<Component>(GameObjectID)>> ComponentManager::m_add_functions;
-	std::unordered_map<GameObjectID, std::unordered_map<std::string, std::weak_ptr<Component>>> ComponentManager::m_gameObject_components_typename_index;
+	std::vector<std::unique_ptr<ComponentManager::ComponentPool>> ComponentManager::m_component_pools;
+	HandleMap<std::vector<ComponentTypeID>> ComponentManager::m_gameObject_component_types;
 	std::unordered_map<GameObjectID, std::list<std::string>> ComponentManager::m_gameObject_attached_components_list;
 
 	const std::string ComponentManager::m_transform_class_name = "TKGEngine::Transform";
 	const std::string ComponentManager::m_transform_type_name = "class TKGEngine::Transform";
-	std::mutex ComponentManager::m_mutex;
+	std::shared_mutex ComponentManager::m_mutex;
 
 
 	////////////////////////////////////////////////////////
@@ -40,14 +41,11 @@ namespace TKGEngine
 #ifdef USE_IMGUI
 	void ComponentManager::OnGUI(GameObjectID goid)
 	{
-		// A^b`ꂽComponent}bv̎擾
-		const auto itr_map_find = m_gameObject_components_typename_index.find(goid);
-		if (itr_map_find == m_gameObject_components_typename_index.end())
+		// A^b`ꂽComponentΕ\Ȃ
+		if (!m_gameObject_component_types.Contains(goid))
 		{
 			return;
 		}
-		auto& components_map = itr_map_find->second;
-		const auto itr_map_end = components_map.end();
 		// A^b`ꂽComponentXg̎擾
 		const auto itr_name_list_find = m_gameObject_attached_components_list.find(goid);
 		if (itr_name_list_find == m_gameObject_attached_components_list.end())
@@ -65,12 +63,17 @@ namespace TKGEngine
 			for (; itr_name_find != itr_name_end; ++itr_name_find)
 			{
 				// OvComponent
-				auto itr_component_find = components_map.find(*itr_name_find);
+				const ComponentTypeID type_id = FindTypeID(*itr_name_find);
+				if (type_id == INVALID_TYPE_ID)
+					continue;
+				const auto* found = m_component_pools[type_id]->Find(goid);
 				// ^[
-				if (itr_component_find == itr_map_end)
+				if (!found)
 					continue;
 				// Component̎̎擾
-				auto component_ptr = itr_component_find->second.lock();
+				auto component_ptr = found->lock();
+				if (!component_ptr)
+					continue;
 				// class̔o
 				size_t start_pos = itr_name_find->find_last_of(':');
 				if (start_pos == std::string::npos)
@@ -212,7 +215,7 @@ namespace TKGEngine
 					im_filter.Draw("##component filter");
 
 					// owner_idGameObject̎R|[lgXg擾
-					const auto component_list = m_gameObject_components_typename_index.at(goid);
+					const auto component_list = *m_gameObject_component_types.Find(goid);
 					const auto itr_end = component_list.end();
 					auto itr = component_list.begin();
 					ImGuiTreeNodeFlags flags = 0;
@@ -222,7 +225,7 @@ namespace TKGEngine
 					for (; itr != itr_end; ++itr)
 					{
 						// \vf̏
-						const char* component_name = itr->first.c_str();
+						const char* component_name = m_typeID_typeName_list[*itr].c_str();
 						// Transform͍폜łȂ
 						if (component_name == m_transform_type_name)
 						{
@@ -319,14 +322,14 @@ namespace TKGEngine
 
 	std::shared_ptr<Component> ComponentManager::AddComponent(ComponentTypeID type_id, GameObjectID owner_id)
 	{
-		const auto itr_find = m_componentTypeID_typeName_index.find(type_id);
-		if (itr_find == m_componentTypeID_typeName_index.end())
+		const auto itr_find = m_add_functions.find(type_id);
+		if (itr_find == m_add_functions.end())
 		{
 			LOG_ASSERT("Can not find registered component ComponentManager::AddComponent()");
 			return std::shared_ptr<Component>();
 		}
 		// AddComponent<T>ĂOnCreate܂ōς܂QƂ炤
-		return m_add_functions.at(type_id)(owner_id);
+		return itr_find->second(owner_id);
 	}
 
 	std::shared_ptr<Component> ComponentManager::AddComponent(const std::string& component_name, GameObjectID owner_id)
@@ -342,27 +345,28 @@ namespace TKGEngine
 
 	void ComponentManager::AddComponentOnSerialize(GameObjectID owner_id, std::shared_ptr<Component>& component)
 	{
-		m_mutex.lock();
-
 		// R|[lg̎擾
 		const std::string type_name(typeid(*component.get()).name());
-		auto&& go_components_name_index = m_gameObject_components_typename_index[owner_id];
+		const ComponentTypeID type_id = FindTypeID(type_name);
+		if (type_id == INVALID_TYPE_ID)
 		{
-			// R|[lgłɑ݂邷Ȃo^Ȃ
-			const auto itr = go_components_name_index.find(type_name);
-			if (itr != go_components_name_index.end())
-			{
-				return;
-			}
+			LOG_ASSERT("The component (%s) is not registered component list.", type_name.c_str());
+			return;
+		}
+
+		m_mutex.lock();
+		// R|[lgłɑ݂邷Ȃo^Ȃ
+		if (m_component_pools[type_id]->Contains(owner_id))
+		{
+			m_mutex.unlock();
+			return;
 		}
 		// R|[lg̊ǗZbg
-		const auto itr = m_typeName_id_index.find(type_name);
-		assert(itr != m_typeName_id_index.end());
-		component->SetComponentTypeID(itr->second);
+		component->SetComponentTypeID(type_id);
 		component->SetOwnerIDAndTransform(owner_id);
 		// }l[WɃZbg
 		ObjectManager::Set(component);
-		go_components_name_index.emplace(type_name, component);
+		AttachComponent(type_id, owner_id, component);
 		m_mutex.unlock();
 		// 쐬̊֐
 		std::static_pointer_cast<Object>(component)->OnCreate(component);
@@ -376,86 +380,124 @@ namespace TKGEngine
 		const auto&& itr_end = registered_components.end();
 		for (auto itr = registered_components.begin(); itr != itr_end; ++itr)
 		{
-			ComponentTypeID id = std::hash<std::string>()(itr->first);
-			// Register TypeName, ComponentName and AddFunction
+			// GetTypeID<T>()Ɠ^œo^̂œIDɂȂ
+			const ComponentTypeID id = RegisterTypeID(itr->second.type_name);
+			// Register ComponentName and AddFunction
 			m_componentName_id_index.emplace(itr->first, id);
-			m_typeName_id_index.emplace(itr->second.type_name, id);
 			m_add_functions.emplace(id, itr->second.add_func);
-			m_componentTypeID_typeName_index.emplace(id, itr->second.type_name);
 		}
 	}
 
-	std::vector<std::weak_ptr<Component>> ComponentManager::GetComponents(GameObjectID owner_id)
+	ComponentTypeID ComponentManager::RegisterTypeID(const std::string& type_name)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::lock_guard<std::shared_mutex> lock(m_mutex);
 
-		// GameObject̏ComponentXg擾
-		auto&& component_index = m_gameObject_components_typename_index.at(owner_id);
+		const auto itr_find = m_typeName_id_index.find(type_name);
+		if (itr_find != m_typeName_id_index.end())
+		{
+			return itr_find->second;
+		}
+		// VIDƃv[쐬
+		const auto id = static_cast<ComponentTypeID>(m_typeID_typeName_list.size());
+		m_typeName_id_index.emplace(type_name, id);
+		m_typeID_typeName_list.emplace_back(type_name);
+		m_component_pools.emplace_back(std::make_unique<ComponentPool>());
+		return id;
+	}
 
-		// Ԃz錾
-		const size_t index_size = component_index.size();
-		std::vector<std::weak_ptr<Component>> component_vec(index_size);
+	ComponentTypeID ComponentManager::FindTypeID(const std::string& type_name)
+	{
+		std::shared_lock<std::shared_mutex> lock(m_mutex);
 
-		// ComponentXg̐擪珇ɔzɋlߍ
-		auto index_itr = component_index.begin();
-		for (size_t i = 0; i < index_size; ++i)
+		const auto itr_find = m_typeName_id_index.find(type_name);
+		if (itr_find == m_typeName_id_index.end())
 		{
-			component_vec.at(i) = index_itr->second;
-			++index_itr;
+			return INVALID_TYPE_ID;
 		}
+		return itr_find->second;
+	}
 
+	void ComponentManager::AttachComponent(const ComponentTypeID type_id, const GameObjectID owner_id, const std::shared_ptr<Component>& component)
+	{
+		m_component_pools[type_id]->Add(owner_id, component);
+		auto* types = m_gameObject_component_types.Find(owner_id);
+		if (!types)
+		{
+			m_gameObject_component_types.Emplace(owner_id, std::vector<ComponentTypeID>());
+			types = m_gameObject_component_types.Find(owner_id);
+		}
+		types->emplace_back(type_id);
+	}
+
+	void ComponentManager::DetachComponent(const ComponentTypeID type_id, const GameObjectID owner_id)
+	{
+		m_component_pools[type_id]->Remove(owner_id);
+
+		auto* found_types = m_gameObject_component_types.Find(owner_id);
+		if (!found_types)
+			return;
+		auto& types = *found_types;
+		const auto itr_type = std::find(types.begin(), types.end(), type_id);
+		if (itr_type != types.end())
+		{
+			types.erase(itr_type);
+		}
+	}
+
+	std::vector<std::weak_ptr<Component>> ComponentManager::GetComponents(GameObjectID owner_id)
+	{
+		std::vector<std::weak_ptr<Component>> component_vec;
+		GetComponents(owner_id, component_vec);
 		return component_vec;
 	}
 
 	void ComponentManager::GetComponents(GameObjectID owner_id, std::vector<std::weak_ptr<Component>>& vec)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::shared_lock<std::shared_mutex> lock(m_mutex);
 
-		// GameObject̏ComponentXg擾
-		auto&& component_index = m_gameObject_components_typename_index.at(owner_id);
+		// GameObject̏ComponentTypeIDXg擾
+		const auto* found_types = m_gameObject_component_types.Find(owner_id);
 
 		// lߍޔz
-		const size_t index_size = component_index.size();
 		vec.clear();
-		vec.resize(index_size);
+		if (!found_types)
+			return;
+		const auto& types = *found_types;
+		vec.reserve(types.size());
 
-		// ComponentXg̐擪珇ɔzɋlߍ
-		auto index_itr = component_index.begin();
-		for (size_t i = 0; i < index_size; ++i)
+		// A^b`ɔzɋlߍ
+		for (const auto type_id : types)
 		{
-			vec.at(i) = index_itr->second;
-			++index_itr;
+			const auto* found = m_component_pools[type_id]->Find(owner_id);
+			if (found)
+			{
+				vec.emplace_back(*found);
+			}
 		}
 	}
 
 	void ComponentManager::RemoveComponent(const std::string& component_type_name, GameObjectID owner_id)
 	{
-		// owner_idGameObject̂R|[lgXg擾
-		m_mutex.lock();
-		auto&& component_index = m_gameObject_components_typename_index.at(owner_id);
 		// TypeNameTransform̎͏Ȃ
 		if (component_type_name == m_transform_type_name)
 		{
-			m_mutex.unlock();
 			LOG_ASSERT("Transform component can not remove!");
 			return;
 		}
+		const ComponentTypeID type_id = FindTypeID(component_type_name);
 
-		const auto itr = component_index.find(component_type_name);
-
+		m_mutex.lock();
 		// A^b`ĂȂΑ^[
-		if (itr == component_index.end())
+		const auto* found = type_id == INVALID_TYPE_ID ? nullptr : m_component_pools[type_id]->Find(owner_id);
+		if (!found)
 		{
 			m_mutex.unlock();
 			assert(0 && "Invalid Component Type. This type is not attached this GameObject");
 			return;
 		}
 
-		const std::shared_ptr<Component> s_ptr = itr->second.lock();
-		if (!s_ptr)
-		{
-			component_index.erase(itr);
-		}
+		const std::shared_ptr<Component> s_ptr = found->lock();
+		DetachComponent(type_id, owner_id);
 		// ComponentOwner폜
 		{
 			auto& name_list = m_gameObject_attached_components_list.at(owner_id);
@@ -467,31 +509,43 @@ namespace TKGEngine
 		}
 		m_mutex.unlock();
 		// DEBUG : RemoveComponentŏ̂Immediateł͂ȂH
-		ObjectManager::Destroy(s_ptr->GetInstanceID(), -1.0f);
-
-		m_mutex.lock();
-		component_index.erase(itr);
-		m_mutex.unlock();
+		if (s_ptr)
+		{
+			ObjectManager::Destroy(s_ptr->GetInstanceID(), -1.0f);
+		}
 	}
 
 	void ComponentManager::RemoveAllComponent(GameObjectID owner_id)
 	{
-		auto&& components = m_gameObject_components_typename_index.at(owner_id);
-		const auto itr_end = components.end();
-		for (auto itr = components.begin(); itr != itr_end;)
+		// v[OĂj
+		std::vector<std::shared_ptr<Component>> components;
 		{
-			const auto s_ptr = itr->second.lock();
-			if (!s_ptr)
+			std::lock_guard<std::shared_mutex> lock(m_mutex);
+			const auto* types = m_gameObject_component_types.Find(owner_id);
+			if (types)
 			{
-				itr = components.erase(itr);
-				continue;
+				for (const auto type_id : *types)
+				{
+					auto& pool = *m_component_pools[type_id];
+					const auto* found = pool.Find(owner_id);
+					if (!found)
+						continue;
+					auto s_ptr = found->lock();
+					if (s_ptr)
+					{
+						components.emplace_back(std::move(s_ptr));
+					}
+					pool.Remove(owner_id);
+				}
+				// GameObjectIDœo^ꂽXg
+				m_gameObject_component_types.Erase(owner_id);
 			}
-			ObjectManager::Destroy(s_ptr->GetInstanceID(), -1.0f);
-			itr = components.erase(itr);
+			m_gameObject_attached_components_list.erase(owner_id);
+		}
+		for (const auto& component : components)
+		{
+			ObjectManager::Destroy(component->GetInstanceID(), -1.0f);
 		}
-		// GameObjectIDœo^ꂽXg
-		m_gameObject_components_typename_index.erase(owner_id);
-		m_gameObject_attached_components_list.erase(owner_id);
 	}
 
 	std::list<std::string>& ComponentManager::GetComponentNameList(GameObjectID owner_id)
@@ -499,4 +553,57 @@ namespace TKGEngine
 		return m_gameObject_attached_components_list[owner_id];
 	}
 
+
+	////////////////////////////////////////////////////////
+	// ComponentPool Methods
+	////////////////////////////////////////////////////////
+	void ComponentManager::ComponentPool::Add(const GameObjectID owner_id, const std::shared_ptr<Component>& component)
+	{
+		const unsigned slot = GetInstanceIDIndex(owner_id);
+		const size_t page = slot >> PAGE_SHIFT;
+		if (page >= m_sparse_pages.size())
+		{
+			m_sparse_pages.resize(page + 1);
+		}
+		if (!m_sparse_pages[page])
+		{
+			m_sparse_pages[page] = std::make_unique<int[]>(PAGE_SIZE);
+			std::fill_n(m_sparse_pages[page].get(), PAGE_SIZE, INVALID_INDEX);
+		}
+
+		// XbgɌÂ̂̂cĂΏ㏑
+		int& index = m_sparse_pages[page][slot & (PAGE_SIZE - 1)];
+		if (index != INVALID_INDEX)
+		{
+			m_dense_owners[index] = owner_id;
+			m_dense_components[index] = component;
+			return;
+		}
+		index = static_cast<int>(m_dense_components.size());
+		m_dense_owners.emplace_back(owner_id);
+		m_dense_components.emplace_back(component);
+	}
+
+	void ComponentManager::ComponentPool::Remove(const GameObjectID owner_id)
+	{
+		const int index = GetDenseIndex(owner_id);
+		if (index == INVALID_INDEX)
+			return;
+
+		// ̗vf폜ʒuɈړċl߂
+		const int last = static_cast<int>(m_dense_components.size()) - 1;
+		if (index != last)
+		{
+			const GameObjectID last_owner = m_dense_owners[last];
+			m_dense_owners[index] = last_owner;
+			m_dense_components[index] = std::move(m_dense_components[last]);
+			const unsigned last_slot = GetInstanceIDIndex(last_owner);
+			m_sparse_pages[last_slot >> PAGE_SHIFT][last_slot & (PAGE_SIZE - 1)] = index;
+		}
+		m_dense_owners.pop_back();
+		m_dense_components.pop_back();
+		const unsigned slot = GetInstanceIDIndex(owner_id);
+		m_sparse_pages[slot >> PAGE_SHIFT][slot & (PAGE_SIZE - 1)] = INVALID_INDEX;
+	}
+
 }//namespace TKGEngine 
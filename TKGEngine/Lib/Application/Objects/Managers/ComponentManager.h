@@ -5,6 +5,7 @@
 #include "Systems/inc/LogSystem.h"
 
 #include <string>
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 #include <deque>
@@ -17,6 +18,7 @@
 #include <cassert>
 #include <type_traits>
 #include <mutex>
+#include <shared_mutex>
 
 
 namespace TKGEngine
@@ -45,6 +47,11 @@ namespace TKGEngine
 		static void OnGUIRemoveComponent(GameObjectID goid);
 #endif // USE_IMGUI
 
+		// ^Ƃ0AԂŊUID
+		// ĂяoɌ^o^Aȍ~͕Ȃ
+		template<class T>
+		static ComponentTypeID GetTypeID();
+
 		// ComponentA^b`Ă邩
 		template<class T>
 		static bool HasComponent(GameObjectID owner_id);
@@ -63,6 +70,11 @@ namespace TKGEngine
 		static std::vector<std::weak_ptr<Component>> GetComponents(GameObjectID owner_id);
 		static void GetComponents(GameObjectID owner_id, std::vector<std::weak_ptr<Component>>& vec);
 
+		// ^T̑SĂComponentɑ΂func(const std::shared_ptr<T>&)Az̏ɌĂ
+		// funcComponent̒ǉA폜͂Ȃ
+		template<class T, class Func>
+		static void ForEachComponent(Func&& func);
+
 		// Component폜
 		template<class T>
 		static void RemoveComponent(GameObjectID owner_id);
@@ -76,75 +88,156 @@ namespace TKGEngine
 		// ==============================================
 		// public variables
 		// ==============================================
-		/* nothing */
+		static constexpr ComponentTypeID INVALID_TYPE_ID = INVALID_COMPONENT_TYPE_ID;
 
 
 	private:
+		// ==============================================
+		// private class
+		// ==============================================
+		/// <summary>
+		/// ^ƂComponent̃v[(sparse set)
+		/// GameObjectIDy[WaȔzŖȔz̃CfbNX
+		/// </summary>
+		class ComponentPool
+		{
+		public:
+			inline bool Contains(GameObjectID owner_id) const;
+			// Ȃnullptr
+			inline const std::weak_ptr<Component>* Find(GameObjectID owner_id) const;
+			void Add(GameObjectID owner_id, const std::shared_ptr<Component>& component);
+			void Remove(GameObjectID owner_id);
+
+			inline int Size() const;
+			inline const std::weak_ptr<Component>& GetComponent(int dense_index) const;
+
+		private:
+			static constexpr unsigned PAGE_SHIFT = 10;
+			static constexpr unsigned PAGE_SIZE = 1u << PAGE_SHIFT;
+			static constexpr int INVALID_INDEX = -1;
+
+			inline int GetDenseIndex(GameObjectID owner_id) const;
+
+			std::vector<std::unique_ptr<int[]>> m_sparse_pages;
+			std::vector<GameObjectID> m_dense_owners;
+			std::vector<std::weak_ptr<Component>> m_dense_components;
+		};
+
+
 		// ==============================================
 		// private methods
 		// ==============================================
 		static void RegisterComponentType();
 
+		// ^TypeID擾AΊUăv[쐬
+		static ComponentTypeID RegisterTypeID(const std::string& type_name);
+		// ^TypeID擾(o^ĂȂINVALID_TYPE_ID)
+		static ComponentTypeID FindTypeID(const std::string& type_name);
+
+		// m_mutexbNԂŌĂ
+		static void AttachComponent(ComponentTypeID type_id, GameObjectID owner_id, const std::shared_ptr<Component>& component);
+		static void DetachComponent(ComponentTypeID type_id, GameObjectID owner_id);
+
 		// ==============================================
 		// private variables
 		// ==============================================
 
-		// <typeid().name(), TypeID = nbVl>
+		// <typeid().name(), TypeID>
 		static std::unordered_map<std::string, ComponentTypeID> m_typeName_id_index;
 		// <component name, TypeID>
 		static std::unordered_map<std::string, ComponentTypeID> m_componentName_id_index;
-		// <TypeID, typeid().name()
-		static std::unordered_map<ComponentTypeID, std::string> m_componentTypeID_typeName_index;
+		// TypeIDCfbNXƂtypeid().name()
+		static std::vector<std::string> m_typeID_typeName_list;
 
 		// <ID, AddComponent Lambda>
 		static std::unordered_map<ComponentTypeID, std::function<std::shared_ptr<Component>(GameObjectID)>> m_add_functions;
-		// GameObjectɃA^b`ꂽR|[lgmap
-		static std::unordered_map<GameObjectID, std::unordered_map<std::string, std::weak_ptr<Component>>> m_gameObject_components_typename_index;
+		// TypeIDCfbNXƂ^ƂComponentv[
+		static std::vector<std::unique_ptr<ComponentPool>> m_component_pools;
+		// GameObjectɃA^b`ꂽR|[lgTypeIDXg(A^b`)
+		static HandleMap<std::vector<ComponentTypeID>> m_gameObject_component_types;
 		// GameObjectɃA^b`ꂽR|[lgXg(Ԉێp)
 		static std::unordered_map<GameObjectID, std::list<std::string>> m_gameObject_attached_components_list;
 
 		static const std::string m_transform_class_name;
 		static const std::string m_transform_type_name;
-		static std::mutex m_mutex;
+		// 擾͋LbNAǉƍ폜͔rbN
+		static std::shared_mutex m_mutex;
 	};
 
+	// ------------------------------------------
+	// inline
+	// ------------------------------------------
+	inline int ComponentManager::ComponentPool::GetDenseIndex(const GameObjectID owner_id) const
+	{
+		// ID̃XbgԍňAオႤÂID͌Ȃɂ
+		const unsigned slot = GetInstanceIDIndex(owner_id);
+		const size_t page = slot >> PAGE_SHIFT;
+		if (page >= m_sparse_pages.size() || !m_sparse_pages[page])
+			return INVALID_INDEX;
+		const int index = m_sparse_pages[page][slot & (PAGE_SIZE - 1)];
+		if (index == INVALID_INDEX || m_dense_owners[index] != owner_id)
+			return INVALID_INDEX;
+		return index;
+	}
+
+	inline bool ComponentManager::ComponentPool::Contains(const GameObjectID owner_id) const
+	{
+		return GetDenseIndex(owner_id) != INVALID_INDEX;
+	}
+
+	inline const std::weak_ptr<Component>* ComponentManager::ComponentPool::Find(const GameObjectID owner_id) const
+	{
+		const int index = GetDenseIndex(owner_id);
+		return index == INVALID_INDEX ? nullptr : &m_dense_components[index];
+	}
+
+	inline int ComponentManager::ComponentPool::Size() const
+	{
+		return static_cast<int>(m_dense_components.size());
+	}
+
+	inline const std::weak_ptr<Component>& ComponentManager::ComponentPool::GetComponent(const int dense_index) const
+	{
+		return m_dense_components[dense_index];
+	}
+
 	// ------------------------------------------
 	// template
 	// ------------------------------------------
+	template<class T>
+	ComponentTypeID ComponentManager::GetTypeID()
+	{
+		static_assert(std::is_base_of_v<Component, T>, "Type is not base of Component.");
+		static const ComponentTypeID type_id = RegisterTypeID(typeid(T).name());
+		return type_id;
+	}
+
 	template<class T>
 	bool ComponentManager::HasComponent(GameObjectID owner_id)
 	{
 		static_assert(std::is_base_of_v<Component, T>, "Type is not base of Component.");
-		std::lock_guard<std::mutex> lock(m_mutex);
-		// T
-		const std::string type_name(typeid(T).name());
-		auto&& component_index = m_gameObject_components_typename_index.at(owner_id);
-		const auto itr = component_index.find(type_name);
-		// A^b`ĂȂ
-		if (itr == component_index.end())
-			return false;
-		return true;
+		const ComponentTypeID type_id = GetTypeID<T>();
+		std::shared_lock<std::shared_mutex> lock(m_mutex);
+		return m_component_pools[type_id]->Contains(owner_id);
 	}
 
 	template<class T>
 	std::shared_ptr<T> ComponentManager::AddComponent(GameObjectID owner_id)
 	{
 		static_assert(std::is_base_of_v<Component, T>, "Type is not base of Component.");
+		const ComponentTypeID type_id = GetTypeID<T>();
 		m_mutex.lock();
 
 		//R|[lg̃A^b`łȂ悤ɌāAɑ݂炻Ԃ
-		const std::string type_name(typeid(T).name());
-		auto&& go_components_name_index = m_gameObject_components_typename_index[owner_id];
 		{
-			const auto itr = go_components_name_index.find(type_name);
-
+			const auto* found = m_component_pools[type_id]->Find(owner_id);
 			// ꍇ͂Ԃ
-			if (itr != go_components_name_index.end())
+			if (found)
 			{
-				const std::shared_ptr<Component> s_ptr = itr->second.lock();
+				const std::shared_ptr<Component> s_ptr = found->lock();
 				if (s_ptr == nullptr)
 				{
-					go_components_name_index.erase(itr);
+					DetachComponent(type_id, owner_id);
 				}
 				else
 				{
@@ -154,23 +247,22 @@ namespace TKGEngine
 			}
 		}
 		// ComponentREGISTERCOMPONENTɂēo^Ă邩
-		const auto itr = m_typeName_id_index.find(type_name);
-		if (itr == m_typeName_id_index.end())
+		if (m_add_functions.count(type_id) == 0)
 		{
 			m_mutex.unlock();
-			LOG_ASSERT("The component (%s) is not registered component list.", type_name.c_str());
+			LOG_ASSERT("The component (%s) is not registered component list.", typeid(T).name());
 			return std::shared_ptr<T>();
 		}
 		// Component̐
 		std::shared_ptr<T> s_ptr = std::make_shared<T>();
 		// ComponentGameObjectƃR|[lgID̃Zbg
-		s_ptr->SetComponentTypeID(itr->second);
+		s_ptr->SetComponentTypeID(type_id);
 		s_ptr->SetOwnerIDAndTransform(owner_id);
 		// GameObjectɃA^b`ꂽR|[lgXgɒǉ
-		m_gameObject_attached_components_list[owner_id].emplace_back(type_name);
+		m_gameObject_attached_components_list[owner_id].emplace_back(m_typeID_typeName_list[type_id]);
 		// ObjectComponent̃}l[Wɓo^
 		ObjectManager::Set(s_ptr);
-		go_components_name_index.emplace(type_name, s_ptr);
+		AttachComponent(type_id, owner_id, s_ptr);
 		m_mutex.unlock();
 		// eR|[lg̏쐬֐s
 		std::static_pointer_cast<Object>(s_ptr)->OnCreate(s_ptr);
@@ -181,36 +273,46 @@ namespace TKGEngine
 	std::shared_ptr<T> ComponentManager::GetComponent(GameObjectID owner_id)
 	{
 		static_assert(std::is_base_of_v<Component, T>, "Type is not base of Component.");
-		std::lock_guard<std::mutex> lock(m_mutex);
+		const ComponentTypeID type_id = GetTypeID<T>();
+		std::shared_lock<std::shared_mutex> lock(m_mutex);
 		// R|[lg
-		const std::string type_name(typeid(T).name());
-		auto&& component_index = m_gameObject_components_typename_index.at(owner_id);
-		const auto itr = component_index.find(type_name);
+		const auto* found = m_component_pools[type_id]->Find(owner_id);
 
 		// A^b`ĂȂȂnull
-		if (itr == component_index.end())
+		if (!found)
 		{
 			return std::shared_ptr<T>();
 		}
+		// jς݂Ȃnull(v[Removeɍ폜)
+		return std::static_pointer_cast<T>(found->lock());
+	}
 
-		const std::shared_ptr<Component> s_ptr = itr->second.lock();
-		if (s_ptr == nullptr)
+	template<class T, class Func>
+	void ComponentManager::ForEachComponent(Func&& func)
+	{
+		static_assert(std::is_base_of_v<Component, T>, "Type is not base of Component.");
+		const ComponentTypeID type_id = GetTypeID<T>();
+		std::shared_lock<std::shared_mutex> lock(m_mutex);
+		const auto& pool = *m_component_pools[type_id];
+		const int size = pool.Size();
+		for (int i = 0; i < size; ++i)
 		{
-			component_index.erase(itr);
-			return std::shared_ptr<T>();
+			const auto s_ptr = pool.GetComponent(i).lock();
+			if (s_ptr)
+			{
+				func(std::static_pointer_cast<T>(s_ptr));
+			}
 		}
-
-		std::shared_ptr<T> casted_s_ptr = std::static_pointer_cast<T>(s_ptr);
-		return casted_s_ptr;
 	}
 
 	template<class T>
 	void ComponentManager::RemoveComponent(GameObjectID owner_id)
 	{
 		static_assert(std::is_base_of_v<Component, T>, "Type is not base of Component.");
+		const ComponentTypeID type_id = GetTypeID<T>();
 		m_mutex.lock();
 
-		const std::string type_name(typeid(T).name());
+		const std::string& type_name = m_typeID_typeName_list[type_id];
 		// Transform͍폜łȂ
 		if (type_name == m_transform_type_name)
 		{
@@ -218,22 +320,16 @@ namespace TKGEngine
 			LOG_ASSERT("Transform component can not remove!");
 			return;
 		}
-		// owner_idGameObject̂R|[lgXg擾
-		auto&& component_index = m_gameObject_components_typename_index.at(owner_id);
-		const auto itr = component_index.find(type_name);
-
 		// A^b`ĂȂΑ^[
-		if (itr == component_index.end())
+		const auto* found = m_component_pools[type_id]->Find(owner_id);
+		if (!found)
 		{
 			m_mutex.unlock();
 			return;
 		}
 		// ComponentOwner폜
-		std::shared_ptr<Component> s_ptr = itr->second.lock();
-		if (!s_ptr)
-		{
-			component_index.erase(itr);
-		}
+		const std::shared_ptr<Component> s_ptr = found->lock();
+		DetachComponent(type_id, owner_id);
 		// ComponentOwner폜
 		{
 			auto& name_list = m_gameObject_attached_components_list.at(owner_id);
@@ -244,11 +340,10 @@ namespace TKGEngine
 			}
 		}
 		m_mutex.unlock();
-		ObjectManager::Destroy(std::static_pointer_cast<Object>(s_ptr)->GetInstanceID(), -1.0f);
-
-		m_mutex.lock();
-		component_index.erase(itr);
-		m_mutex.unlock();
+		if (s_ptr)
+		{
+			ObjectManager::Destroy(std::static_pointer_cast<Object>(s_ptr)->GetInstanceID(), -1.0f);
+		}
 	}
 
 }// namespace TKGEngine
@@ -10,6 +10,8 @@
 #include "Components/inc/CMeshRenderer.h"
 #include "Components/inc/CTransform.h"
 
+#include "Application/Resource/inc/Prefab.h"
+
 #include "Utility/inc/myfunc_file.h"
 
 namespace TKGEngine
@@ -17,12 +19,32 @@ namespace TKGEngine
 	////////////////////////////////////////////////////////
 	// Static variable declaration
 	////////////////////////////////////////////////////////
-	std::unordered_map<GameObjectID, std::weak_ptr<IGameObject>> GameObjectManager::m_gameObject_index;
+	HandleMap<std::weak_ptr<IGameObject>> GameObjectManager::m_gameObject_index;
 	std::mutex GameObjectManager::m_mutex;
 
 	namespace /* anonymous */
 	{
 		int gameObject_created_index = 0;
+
+		/// <summary>
+		/// Rs[Ƀ̃oCiǂݍނ߂̃Xg[obt@
+		/// </summary>
+		class MemoryStreamBuf
+			: public std::streambuf
+		{
+		public:
+			MemoryStreamBuf(const char* data, const size_t size)
+			{
+				char* begin = const_cast<char*>(data);
+				setg(begin, begin, begin + size);
+			}
+
+			// ǂݍ݈ʒu擪ɖ߂
+			void Rewind()
+			{
+				setg(eback(), eback(), egptr());
+			}
+		};
 	}/* anonymous */
 
 	////////////////////////////////////////////////////////
@@ -38,7 +60,7 @@ namespace TKGEngine
 		// InstanceIDŃ}l[WɃZbg
 		ObjectManager::Set(p_object);
 		// GameObject}l[WɃZbg
-		m_gameObject_index.emplace(p_go->GetGameObjectID(), p_go);
+		m_gameObject_index.Emplace(p_go->GetGameObjectID(), p_go);
 
 		m_mutex.unlock();
 
@@ -60,7 +82,7 @@ namespace TKGEngine
 		p_go->SetName(name);
 		const auto p_object = std::static_pointer_cast<Object>(p_go);
 		ObjectManager::Set(p_object);
-		m_gameObject_index.emplace(p_go->GetGameObjectID(), p_go);
+		m_gameObject_index.Emplace(p_go->GetGameObjectID(), p_go);
 
 		m_mutex.unlock();
 
@@ -82,7 +104,7 @@ namespace TKGEngine
 		p_go->SetName("GameObject" + std::to_string(gameObject_created_index++));
 		const auto p_object = std::static_pointer_cast<Object>(p_go);
 		ObjectManager::Set(p_object);
-		m_gameObject_index.emplace(p_go->GetGameObjectID(), p_go);
+		m_gameObject_index.Emplace(p_go->GetGameObjectID(), p_go);
 
 		m_mutex.unlock();
 
@@ -104,7 +126,7 @@ namespace TKGEngine
 		p_go->SetName(name);
 		const auto p_object = std::static_pointer_cast<Object>(p_go);
 		ObjectManager::Set(p_object);
-		m_gameObject_index.emplace(p_go->GetGameObjectID(), p_go);
+		m_gameObject_index.Emplace(p_go->GetGameObjectID(), p_go);
 
 		m_mutex.unlock();
 
@@ -341,16 +363,16 @@ namespace TKGEngine
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 
-		const auto itr = m_gameObject_index.find(id);
-		if (itr == m_gameObject_index.end())
+		const auto* found = m_gameObject_index.Find(id);
+		if (found == nullptr)
 		{
 			return std::shared_ptr<IGameObject>();
 		}
 
-		auto s_ptr = itr->second.lock();
+		auto s_ptr = found->lock();
 		if (s_ptr == nullptr)
 		{
-			m_gameObject_index.erase(itr);
+			m_gameObject_index.Erase(id);
 			return std::shared_ptr<IGameObject>();
 		}
 		return s_ptr;
@@ -360,20 +382,20 @@ namespace TKGEngine
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 
-		const auto itr_end = m_gameObject_index.end();
-		for (auto itr = m_gameObject_index.begin(); itr != itr_end;)
+		for (int i = 0; i < m_gameObject_index.Size();)
 		{
-			auto s_ptr = itr->second.lock();
+			auto s_ptr = m_gameObject_index.GetValue(i).lock();
 			if (s_ptr == nullptr)
 			{
-				itr = m_gameObject_index.erase(itr);
+				// ̗vfl߂̂œʒuxׂ
+				m_gameObject_index.Erase(m_gameObject_index.GetKey(i));
 				continue;
 			}
 			if (go_name == s_ptr->GetName())
 			{
 				return s_ptr;
 			}
-			++itr;
+			++i;
 		}
 		// Can not find
 		return std::shared_ptr<IGameObject>();
@@ -384,11 +406,7 @@ namespace TKGEngine
 		std::lock_guard<std::mutex> lock(m_mutex);
 
 		// Find from GameObjectIndex and Erase GOManager.
-		const auto itr = m_gameObject_index.find(id);
-		if (itr != m_gameObject_index.end())
-		{
-			m_gameObject_index.erase(itr);
-		}
+		m_gameObject_index.Erase(id);
 	}
 
 	std::shared_ptr<IGameObject> GameObjectManager::DuplicateGameObject(const std::shared_ptr<IGameObject>& gameobject)
@@ -464,6 +482,8 @@ namespace TKGEngine
 			cereal::BinaryOutputArchive ar(ofs);
 			ar(original_transform);
 		}
+		// t@CPrefabǂݍݍς݂Ȃ玟̃[hœǂݒ
+		Prefab::RemoveCache(filepath);
 		// Json
 #ifdef SAVE_JSON
 		{
@@ -516,13 +536,106 @@ namespace TKGEngine
 		return gameobject;
 	}
 
+	std::shared_ptr<IGameObject> GameObjectManager::InstantiateGameObject(const std::string& binary, const int scene_idx)
+	{
+		const auto transform = DeserializeTransform(binary);
+		if (!transform)
+		{
+			return std::shared_ptr<IGameObject>();
+		}
+		// V[ɓo^
+		auto gameobject = transform->GetGameObject();
+		gameobject->SetScene(scene_idx);
+		SceneManager::RegisterGameObjectToScene(gameobject->GetGameObjectID(), scene_idx);
+		// 쐬GameObject̃R|[lgL
+		ActivateLoadObject(transform);
+
+		return gameobject;
+	}
+
+	std::shared_ptr<IGameObject> GameObjectManager::InstantiateGameObject(const std::string& binary, const std::shared_ptr<IGameObject>& parent)
+	{
+		if (!parent)
+		{
+			return InstantiateGameObject(binary, SceneManager::GetMainSceneID());
+		}
+
+		const auto transform = DeserializeTransform(binary);
+		if (!transform)
+		{
+			return std::shared_ptr<IGameObject>();
+		}
+		// ParentƓV[ɓo^AParentchildrenɓo^
+		auto gameobject = transform->GetGameObject();
+		gameobject->SetScene(parent->GetScene());
+		transform->SetParent(parent->GetTransform(), false);
+		// 쐬GameObject̃R|[lgL
+		ActivateLoadObject(transform);
+
+		return gameobject;
+	}
+
+	void GameObjectManager::InstantiateGameObjects(const std::string& binary, const int count, const int scene_idx, std::vector<std::shared_ptr<IGameObject>>& dst)
+	{
+		if (count <= 0)
+		{
+			return;
+		}
+		dst.reserve(dst.size() + static_cast<size_t>(count));
+
+		// oCiǂݒ߂ɃXg[g܂킷
+		MemoryStreamBuf stream_buf(binary.data(), binary.size());
+		std::istream is(&stream_buf);
+		for (int i = 0; i < count; ++i)
+		{
+			stream_buf.Rewind();
+			is.clear();
+			std::shared_ptr<Transform> transform;
+			{
+				cereal::BinaryInputArchive ar(is);
+				ar(transform);
+			}
+			if (!transform)
+			{
+				assert(0 && "failed deserialize binary. GameObjectManager::InstantiateGameObjects()");
+				return;
+			}
+			// V[ɓo^
+			auto gameobject = transform->GetGameObject();
+			gameobject->SetScene(scene_idx);
+			SceneManager::RegisterGameObjectToScene(gameobject->GetGameObjectID(), scene_idx);
+			// 쐬GameObject̃R|[lgL
+			ActivateLoadObject(transform);
+
+			dst.emplace_back(std::move(gameobject));
+		}
+	}
+
 	void GameObjectManager::RegisterGameObjectOnDeserialize(const std::shared_ptr<IGameObject>& gameobject)
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 		// GameObjectGOManagerObjectManagerɓo^
 		const auto p_object = std::static_pointer_cast<Object>(gameobject);
 		ObjectManager::Set(p_object);
-		m_gameObject_index.emplace(gameobject->GetGameObjectID(), gameobject);
+		m_gameObject_index.Emplace(gameobject->GetGameObjectID(), gameobject);
+	}
+
+	std::shared_ptr<Transform> GameObjectManager::DeserializeTransform(const std::string& binary)
+	{
+		if (binary.empty())
+		{
+			assert(0 && "empty binary. GameObjectManager::DeserializeTransform()");
+			return std::shared_ptr<Transform>();
+		}
+
+		MemoryStreamBuf stream_buf(binary.data(), binary.size());
+		std::istream is(&stream_buf);
+		std::shared_ptr<Transform> transform;
+		{
+			cereal::BinaryInputArchive ar(is);
+			ar(transform);
+		}
+		return transform;
 	}
 
 	void GameObjectManager::ActivateLoadObject(const std::shared_ptr<Transform>& root_transform)
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "../../Objects/inc/IGameObject.h"
+#include "Utility/inc/template_HandleMap.h"
 
 #include <unordered_map>
+#include <vector>
+#include <string>
 #include <memory>
 #include <mutex>
 
@@ -66,6 +69,10 @@ namespace TKGEngine
 		static void SaveGameObject(GameObjectID goid, const std::string& filepath);
 		static std::shared_ptr<IGameObject> LoadGameObject(const std::string& filepath);
 		static std::shared_ptr<IGameObject> LoadGameObject(const std::string& filepath, const int scene_idx);
+		// .object̃oCiGameObject쐬(Prefab̃CX^XɎgp)
+		static std::shared_ptr<IGameObject> InstantiateGameObject(const std::string& binary, const int scene_idx);
+		static std::shared_ptr<IGameObject> InstantiateGameObject(const std::string& binary, const std::shared_ptr<IGameObject>& parent);
+		static void InstantiateGameObjects(const std::string& binary, const int count, const int scene_idx, std::vector<std::shared_ptr<IGameObject>>& dst);
 		// TransformGameObject̏炩ߗLɂ邽߂Ɏgp
 		static void RegisterGameObjectOnDeserialize(const std::shared_ptr<IGameObject>& gameobject);
 
@@ -81,6 +88,9 @@ namespace TKGEngine
 		// private methods
 		// ==============================================
 
+		// ̃oCiTransformfVACY
+		static std::shared_ptr<Transform> DeserializeTransform(const std::string& binary);
+
 		// [hAIuWFNgOnEnables
 		static void ActivateLoadObject(const std::shared_ptr<Transform>& root_transform);
 		// OnEnable[g珇ɍċAIɎs
@@ -89,7 +99,7 @@ namespace TKGEngine
 		// ==============================================
 		// private variables
 		// ==============================================
-		static std::unordered_map<GameObjectID, std::weak_ptr<IGameObject>> m_gameObject_index;
+		static HandleMap<std::weak_ptr<IGameObject>> m_gameObject_index;
 
 		static std::mutex m_mutex;
 	};
@@ -8,6 +8,8 @@
 #include "Systems/inc/LogSystem.h"
 #include "Systems/inc/IGraphics.h"
 
+#include <algorithm>
+
 namespace TKGEngine
 {
 	////////////////////////////////////////////////////////
@@ -18,6 +20,38 @@ namespace TKGEngine
 	static constexpr int START_SHADOW_BUFFER_SIZE = 1000;
 	static constexpr int ADD_SHADOW_BUFFER_SIZE = 500;
 
+	static constexpr int START_CLUSTER_LIGHT_BUFFER_SIZE = 64;
+	static constexpr int START_CLUSTER_INDEX_BUFFER_SIZE = 4096;
+
+
+	////////////////////////////////////////////////////////
+	// Local Methods
+	////////////////////////////////////////////////////////
+	// vfobt@𒴂ĂΔ{ɊgĂXV
+	template<typename T>
+	bool UpdateClusterBuffer(ID3D11DeviceContext* context, StructuredBuffer& buffer, const std::vector<T>& data)
+	{
+		const int count = static_cast<int>(data.size());
+		if (count <= 0)
+			return true;
+
+		if (count > buffer.GetRowCount())
+		{
+			int new_count = (std::max)(buffer.GetRowCount(), 1);
+			while (new_count < count)
+			{
+				new_count *= 2;
+			}
+			if (!buffer.Create(static_cast<int>(sizeof(T)), new_count, false, nullptr))
+			{
+				assert(0 && "failed StructuredBuffer::Create() LightManager::OnSetClusterBuffers()");
+				return false;
+			}
+		}
+		buffer.Update(context, data.data(), count);
+		return true;
+	}
+
 
 	////////////////////////////////////////////////////////
 	// Class Methods
@@ -73,19 +107,19 @@ namespace TKGEngine
 		}
 	}
 
-	void LightManager::CalculateSceneLight(const std::vector<MainData>& scene_objects, const int object_num, const std::shared_ptr<ICamera>& camera)
+	void LightManager::CalculateSceneLight(const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera)
 	{
 		if (m_instance)
 		{
-			m_instance->OnCalculateSceneLight(scene_objects, object_num, camera);
+			m_instance->OnCalculateSceneLight(scene_objects, object_num, caster_tree, camera);
 		}
 	}
 
-	void LightManager::RenderShadow(ID3D11DeviceContext* context)
+	void LightManager::RenderShadow(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects)
 	{
 		if (m_instance)
 		{
-			m_instance->OnRenderShadow(context);
+			m_instance->OnRenderShadow(context, scene_objects);
 		}
 	}
 
@@ -99,9 +133,6 @@ namespace TKGEngine
 
 	bool LightManager::Initialize()
 	{
-		// Xbh̃TCYm
-		m_thread_result.reserve(MAX_THREAD_NUM);
-
 		// CBuffer̍쐬
 		if (!m_cb_light.Create(sizeof(CB_Light), false))
 		{
@@ -120,6 +151,19 @@ namespace TKGEngine
 			assert(0 && "failed VertexBuffer::Create() LightManager::Initialize()");
 			return false;
 		}
+		// NX^[pStructuredBuffer̍쐬
+		{
+			const bool succeeded =
+				m_sb_point_lights.Create(static_cast<int>(sizeof(PointLight)), START_CLUSTER_LIGHT_BUFFER_SIZE, false, nullptr)
+				&& m_sb_spot_lights.Create(static_cast<int>(sizeof(SpotLight)), START_CLUSTER_LIGHT_BUFFER_SIZE, false, nullptr)
+				&& m_sb_cluster_ranges.Create(static_cast<int>(sizeof(ClusterRange)), CLUSTER_NUM, false, nullptr)
+				&& m_sb_cluster_light_indices.Create(static_cast<int>(sizeof(std::uint32_t)), START_CLUSTER_INDEX_BUFFER_SIZE, false, nullptr);
+			if (!succeeded)
+			{
+				assert(0 && "failed StructuredBuffer::Create() LightManager::Initialize()");
+				return false;
+			}
+		}
 
 		return true;
 	}
@@ -161,26 +205,11 @@ namespace TKGEngine
 					}
 					break;
 				case LightType::Point:
-					// |CgCg̍ő吔`FbN
-					if (m_point_list.size() >= MAX_POINTLIGHT)
-					{
-						LOG_ASSERT("There is no more than MAX_POINTLIGHT point light.");
-					}
-					else
-					{
-						m_point_list.emplace_back(light);
-					}
+					// |CgCgƃX|bgCg̐̓NX^[ŐȂ
+					m_point_list.emplace_back(light);
 					break;
 				case LightType::Spot:
-					// X|bgCg̍ő吔`FbN
-					if (m_spot_list.size() >= MAX_SPOTLIGHT)
-					{
-						LOG_ASSERT("There is no more than MAX_SPOTLIGHT spot light.");
-					}
-					else
-					{
-						m_spot_list.emplace_back(light);
-					}
+					m_spot_list.emplace_back(light);
 					break;
 			}
 		}
@@ -204,57 +233,99 @@ namespace TKGEngine
 				cb.directional = dir;
 				break;
 			}
-			// Spot
+			// NX^[
+			cb.cluster_depth_scale = m_light_cluster.GetDepthSliceScale();
+			cb.cluster_depth_bias = m_light_cluster.GetDepthSliceBias();
+			cb.point_light_num = static_cast<unsigned>(m_point_list.size());
+			cb.spot_light_num = static_cast<unsigned>(m_spot_list.size());
+			// p[^̍XV
+			m_cb_light.SetParam(&cb, sizeof(cb));
+		}
+
+		// StructuredBufferp̔zɃZbg
+		{
+			m_point_light_data.resize(m_point_list.size());
+			int index = 0;
+			for (const auto& point : m_point_list)
 			{
-				auto itr = m_spot_list.begin();
-				const auto itr_end = m_spot_list.end();
-				for (int i = 0; i < MAX_SPOTLIGHT; ++i)
-				{
-					if (itr == itr_end)
-						break;
-					// f[^Zbg
-					cb.spots[i] = *itr;
-					++itr;
-				}
+				m_point_light_data[index++] = point;
 			}
-			// Point
+		}
+		{
+			m_spot_light_data.resize(m_spot_list.size());
+			int index = 0;
+			for (const auto& spot : m_spot_list)
 			{
-				auto itr = m_point_list.begin();
-				const auto itr_end = m_point_list.end();
-				for (int i = 0; i < MAX_POINTLIGHT; ++i)
-				{
-					if (itr == itr_end)
-						break;
-					// f[^Zbg
-					cb.points[i] = *itr;
-					++itr;
-				}
+				m_spot_light_data[index++] = spot;
 			}
-			// p[^̍XV
-			m_cb_light.SetParam(&cb, sizeof(cb));
 		}
 	}
 
-	void LightManager::OnCalculateSceneLight(const std::vector<MainData>& scene_objects, const int object_num, const std::shared_ptr<ICamera>& camera)
+	void LightManager::OnBuildLightCluster(const std::shared_ptr<ICamera>& camera)
 	{
-		// CgƂɃXbh𗧂ĂCastervZ
+		// |CgCǧɃX|bgCgl߂
+		m_cluster_light_shapes.clear();
+		m_cluster_light_shapes.reserve(m_point_list.size() + m_spot_list.size());
+		for (const auto& point : m_point_list)
+		{
+			ClusterLightShape shape;
+			shape.position = point->GetTransform()->Position();
+			shape.range = point->GetRange();
+			shape.cone_cos = -1.0f;
+			m_cluster_light_shapes.emplace_back(shape);
+		}
+		for (const auto& spot : m_spot_list)
+		{
+			const auto transform = spot->GetTransform();
+			ClusterLightShape shape;
+			shape.position = transform->Position();
+			shape.range = spot->GetRange();
+			shape.direction = transform->Forward();
+			shape.cone_cos = cosf(MyMath::AngleToRadian(spot->GetSpotAngleOuter()) * 0.5f);
+			m_cluster_light_shapes.emplace_back(shape);
+		}
+
+		m_light_cluster.Build(
+			camera->GetWorldToViewMatrix(),
+			camera->GetProjectionMatrix(),
+			camera->GetNear(),
+			camera->GetFar(),
+			m_cluster_light_shapes
+		);
+	}
+
+	void LightManager::OnSetClusterBuffers(ID3D11DeviceContext* context)
+	{
+		// obt@̍XV
+		UpdateClusterBuffer(context, m_sb_point_lights, m_point_light_data);
+		UpdateClusterBuffer(context, m_sb_spot_lights, m_spot_light_data);
+		UpdateClusterBuffer(context, m_sb_cluster_ranges, m_light_cluster.GetClusterRanges());
+		UpdateClusterBuffer(context, m_sb_cluster_light_indices, m_light_cluster.GetLightIndices());
+
+		// pCvCɃZbg
+		m_sb_point_lights.SetSRV(context, TEXSLOT_CLUSTER_POINT_LIGHTS, ShaderVisibility::PS);
+		m_sb_spot_lights.SetSRV(context, TEXSLOT_CLUSTER_SPOT_LIGHTS, ShaderVisibility::PS);
+		m_sb_cluster_ranges.SetSRV(context, TEXSLOT_CLUSTER_RANGES, ShaderVisibility::PS);
+		m_sb_cluster_light_indices.SetSRV(context, TEXSLOT_CLUSTER_LIGHT_INDICES, ShaderVisibility::PS);
+	}
+
+	void LightManager::OnCalculateSceneLight(const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera)
+	{
+		// CgƂɃWuǉCastervZ
+		m_draw_instance_count = 0;
 		{
 			// Directional
-			OnCalculateCaster(m_directional_list, scene_objects, object_num, camera);
+			OnCalculateCaster(m_directional_list, scene_objects, object_num, caster_tree, camera);
 			// Spot
-			OnCalculateCaster(m_spot_list, scene_objects, object_num, camera);
+			OnCalculateCaster(m_spot_list, scene_objects, object_num, caster_tree, camera);
 			// Point
-			OnCalculateCaster(m_point_list, scene_objects, object_num, camera);
+			OnCalculateCaster(m_point_list, scene_objects, object_num, caster_tree, camera);
 		}
+		// VhELX^[̌vZɃJ̃NX^[փCg蓖Ă
+		OnBuildLightCluster(camera);
 		// vZIҋ@
-		int draw_instance_count = 0;
-		for (auto& result : m_thread_result)
-		{
-			if (!result.valid())
-				continue;
-			draw_instance_count += result.get();
-		}
-		m_thread_result.clear();
+		JobSystem::Wait(m_calculate_shadow_caster_counter);
+		const int draw_instance_count = m_draw_instance_count.load();
 
 		// CX^Xobt@̃TCY`FbN
 		{
@@ -279,7 +350,7 @@ namespace TKGEngine
 		OnApplyParameter();
 	}
 
-	void LightManager::OnCalculateCaster(const std::list<std::shared_ptr<Light>>& light_list, const std::vector<MainData>& scene_objects, const int object_num, const std::shared_ptr<ICamera>& camera)
+	void LightManager::OnCalculateCaster(const std::list<std::shared_ptr<Light>>& light_list, const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera)
 	{
 		for (const auto& light : light_list)
 		{
@@ -287,25 +358,30 @@ namespace TKGEngine
 			if (!light->GetRenderShadow())
 				continue;
 			// e`悷IuWFNǧvZ
-			const auto func = [&](const std::vector<MainData>& objs, const int num, const std::shared_ptr<ICamera>& cam) { return light->CalculateShadowCaster(objs, num, cam); };
-			m_thread_result.emplace_back(m_calculate_shadow_caster_thread.Add(func, scene_objects, object_num, camera));
+			Light* p_light = light.get();
+			std::atomic<int>* p_count = &m_draw_instance_count;
+			const auto func = [p_light, p_count, &scene_objects, object_num, &caster_tree, &camera]()
+			{
+				p_count->fetch_add(p_light->CalculateShadowCaster(scene_objects, object_num, caster_tree, camera));
+			};
+			JobSystem::Run(m_calculate_shadow_caster_counter, func);
 		}
 	}
 
-	void LightManager::OnRenderShadow(ID3D11DeviceContext* context)
+	void LightManager::OnRenderShadow(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects)
 	{
 		// CgƂɉe`悷
 		{
 			// Directional
-			OnRenderShadowCheckAndRender(m_directional_list, context);
+			OnRenderShadowCheckAndRender(m_directional_list, context, scene_objects);
 			// Spot
-			OnRenderShadowCheckAndRender(m_spot_list, context);
+			OnRenderShadowCheckAndRender(m_spot_list, context, scene_objects);
 			// Point
-			OnRenderShadowCheckAndRender(m_point_list, context);
+			OnRenderShadowCheckAndRender(m_point_list, context, scene_objects);
 		}
 	}
 
-	void LightManager::OnRenderShadowCheckAndRender(const std::list<std::shared_ptr<Light>>& light_list, ID3D11DeviceContext* context)
+	void LightManager::OnRenderShadowCheckAndRender(const std::list<std::shared_ptr<Light>>& light_list, ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects)
 	{
 		const auto itr_end = light_list.end();
 		for (auto itr = light_list.begin(); itr != itr_end; ++itr)
@@ -315,7 +391,7 @@ namespace TKGEngine
 			if (!light->IsRenderShadowCaster())
 				continue;
 			// e`̎s
-			light->RenderShadowCaster(context, m_instance_buffer);
+			light->RenderShadowCaster(context, scene_objects, m_instance_buffer);
 		}
 	}
 
@@ -324,6 +400,8 @@ namespace TKGEngine
 		// CBuffer̍XV
 		m_cb_light.SetVS(context, CBS_LIGHT);
 		m_cb_light.SetPS(context, CBS_LIGHT);
+		// NX^[ƃ|CgCgAX|bgCg̃p[^
+		OnSetClusterBuffers(context);
 
 		// ShadoweNX`ƃCg}XNeNX`̃Zbg
 		SetTexture(context, m_directional_list);
@@ -369,6 +447,9 @@ namespace TKGEngine
 
 	void LightManager::OnSetTextureSpot(ID3D11DeviceContext* context, const std::shared_ptr<Light>& light, const int index)
 	{
+		// VhE}bvƃCg}XÑXbgĂ̂MAX_SPOTLIGHT܂
+		if (index >= MAX_SPOTLIGHT)
+			return;
 		// VhẼZbg
 		light->SetSRV(context, TEXSLOT_SHADOWMAP_SPOT0 + index);
 		// }XNeNX`̃Zbg
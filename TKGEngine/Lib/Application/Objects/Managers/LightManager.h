@@ -4,12 +4,16 @@
 #include "Application/Resource/inc/Shader_Defined.h"
 #include "Application/Resource/inc/ConstantBuffer.h"
 #include "Application/Resource/inc/VertexBuffer.h"
+#include "Application/Resource/inc/StructuredBuffer.h"
 #include "Utility/inc/myfunc_vector.h"
-#include "Utility/inc/template_thread.h"
+#include "Utility/inc/job_system.h"
+#include "Utility/inc/light_cluster.h"
 
 #include <list>
+#include <vector>
 #include <unordered_map>
 #include <memory>
+#include <atomic>
 
 
 // ==============================================
@@ -21,6 +25,7 @@ namespace TKGEngine
 	class ICamera;
 	class Light;
 	class VertexBuffer;
+	class DynamicAABBTree;
 }
 
 namespace TKGEngine
@@ -47,10 +52,10 @@ namespace TKGEngine
 		static void SortSceneLight();
 
 		// CgƂɍXV̌vZ
-		static void CalculateSceneLight(const std::vector<MainData>& scene_objects, const int object_num, const std::shared_ptr<ICamera>& camera);
+		static void CalculateSceneLight(const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera);
 
 		// CgƂɉe`悷
-		static void RenderShadow(ID3D11DeviceContext* context);
+		static void RenderShadow(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects);
 
 		// CgpCvCɃZbg
 		static void SetPipeline(ID3D11DeviceContext* context);
@@ -140,11 +145,14 @@ namespace TKGEngine
 		};
 
 		// CBufferf[^p\
+		// |CgCgƃX|bgCgStructuredBufferŃNX^[ƂɎQƂ
 		struct CB_Light
 		{
 			DirectionalLight directional;
-			SpotLight spots[MAX_SPOTLIGHT];
-			PointLight points[MAX_POINTLIGHT];
+			float cluster_depth_scale = 0.0f;	// [xNX^[̃XCX߂W log(depth) * scale + bias
+			float cluster_depth_bias = 0.0f;
+			unsigned point_light_num = 0;		// CgCfbNX菬΃|CgCg
+			unsigned spot_light_num = 0;
 		};
 
 	private:
@@ -158,20 +166,23 @@ namespace TKGEngine
 		void Finalize();
 
 		// ݃ANeBuȃCg^CvƂɃ\[g
-		// TODO : LȃCgő吔𒴂Ăꍇ̓J̋ɂđI
 		void SortLightType();
 
-		// J󂯎ċLȓICg̑Is
+		// Cg̃p[^CBufferStructuredBufferp̔zɋl߂
 		void OnApplyParameter();
+		// J̎NX^[ɕă|CgCgƃX|bgCg蓖Ă
+		void OnBuildLightCluster(const std::shared_ptr<ICamera>& camera);
+		// NX^[ƃCgStructuredBufferXVăZbg
+		void OnSetClusterBuffers(ID3D11DeviceContext* context);
 
 		// CgƂɍXV̌vZ
-		void OnCalculateSceneLight(const std::vector<MainData>& scene_objects, const int object_num, const std::shared_ptr<ICamera>& camera);
+		void OnCalculateSceneLight(const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera);
 		// e`悷IuWFNǧvZCgƂɎs
-		void OnCalculateCaster(const std::list<std::shared_ptr<Light>>& light_list, const std::vector<MainData>& scene_objects, int object_num, const std::shared_ptr<ICamera>& camera);
+		void OnCalculateCaster(const std::list<std::shared_ptr<Light>>& light_list, const std::vector<MainData>& scene_objects, int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera);
 		// CgƂɉe`悷
-		void OnRenderShadow(ID3D11DeviceContext* context);
+		void OnRenderShadow(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects);
 		// CgƂɉe`悷邩`FbNAs
-		void OnRenderShadowCheckAndRender(const std::list<std::shared_ptr<Light>>& light_list, ID3D11DeviceContext* context);
+		void OnRenderShadowCheckAndRender(const std::list<std::shared_ptr<Light>>& light_list, ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects);
 		// pCvCɃZbg
 		void OnSetPipeline(ID3D11DeviceContext* context);
 		// pCvCɃZbgɃCg}XNƃVhE}bvZbg
@@ -195,14 +206,28 @@ namespace TKGEngine
 
 		// Light CBuffer
 		ConstantBuffer m_cb_light;
+
+		// NX^[Ɋ蓖Ă郉Cǧ`(|CgCǧɃX|bgCgl߂)
+		std::vector<ClusterLightShape> m_cluster_light_shapes;
+		LightCluster m_light_cluster;
+		// StructuredBufferɓnCg̃p[^
+		std::vector<PointLight> m_point_light_data;
+		std::vector<SpotLight> m_spot_light_data;
+		// Cg̃p[^
+		StructuredBuffer m_sb_point_lights;
+		StructuredBuffer m_sb_spot_lights;
+		// NX^[Ƃ(offset, count)ƃCgCfbNXXg
+		StructuredBuffer m_sb_cluster_ranges;
+		StructuredBuffer m_sb_cluster_light_indices;
+
 		// ShadowCX^Xobt@
 		VertexBuffer m_instance_buffer;
 		int m_current_buffer_size = 0;
 
-		// VhELX^[vZpXbh
-		static constexpr int MAX_THREAD_NUM = 1 + MAX_POINTLIGHT + MAX_SPOTLIGHT;
-		ThreadPool m_calculate_shadow_caster_thread = ThreadPool(MAX_THREAD_NUM);
-		std::vector<std::future<int>> m_thread_result = std::vector< std::future<int>>();
+		// VhELX^[vZWů҂p
+		JobCounter m_calculate_shadow_caster_counter;
+		// eCg̕`CX^X̍v
+		std::atomic<int> m_draw_instance_count = 0;
 		
 	};
 
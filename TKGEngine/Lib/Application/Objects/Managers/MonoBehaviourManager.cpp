@@ -6,6 +6,10 @@
 
 #include "SceneManager.h"
 
+#include "Utility/inc/cpu_profiler.h"
+
+#include <algorithm>
+
 #ifdef USE_IMGUI
 #include <Systems/inc/IGUI.h>
 #endif // USE_IMGUI
@@ -21,9 +25,9 @@ namespace TKGEngine
 	int MonoBehaviourManager::m_current_index = 0;
 	std::unordered_map<int, std::shared_ptr<MonoBehaviour>> MonoBehaviourManager::m_store_list;
 	bool MonoBehaviourManager::m_start_list_changed = false;
-	std::list<std::shared_ptr<MonoBehaviour>> MonoBehaviourManager::m_start_list;
-	bool MonoBehaviourManager::m_update_list_changed = false;
-	std::list<std::shared_ptr<MonoBehaviour>> MonoBehaviourManager::m_update_list;
+	std::vector<std::shared_ptr<MonoBehaviour>> MonoBehaviourManager::m_start_list;
+	std::vector<MonoBehaviourManager::UpdateBucket> MonoBehaviourManager::m_update_buckets;
+	std::vector<MonoBehaviourManager::UpdateBucket> MonoBehaviourManager::m_late_update_buckets;
 
 	std::unique_ptr<MonoBehaviourManager::EventFunctionManager> MonoBehaviourManager::m_event_func_manager;
 
@@ -122,6 +126,8 @@ namespace TKGEngine
 
 	void MonoBehaviourManager::Run()
 	{
+		CPU_PROFILE_SCOPE("MonoBehaviourManager::Run");
+
 		// StartXgɃZbgꂽ̂sUpdateXgɈڂ
 		ExecuteStart();
 		ExecuteUpdate();
@@ -414,108 +420,146 @@ namespace TKGEngine
 		// ǉꂽƂ̓\[gȂ
 		if (m_start_list_changed)
 		{
-			m_start_list.sort([](const std::shared_ptr<MonoBehaviour>& l, const std::shared_ptr<MonoBehaviour>& r) {return l->Priority() < r->Priority(); });
+			std::stable_sort(m_start_list.begin(), m_start_list.end(), [](const std::shared_ptr<MonoBehaviour>& l, const std::shared_ptr<MonoBehaviour>& r) {return l->Priority() < r->Priority(); });
 			m_start_list_changed = false;
 		}
 
-		// StartĂ΂𖞂Ȃ΃Xg폜UpdateListɈړ
-		const auto itr_end = m_start_list.end();
-		for (auto itr = m_start_list.begin(); itr != itr_end;)
+		// StartĂ΂𖞂Ȃ΃Xg폜UpdateoPbgɈړ
+		// StartŃXgɒǉ邱Ƃ邽߁ATCY͖擾
+		size_t keep_num = 0;
+		for (size_t i = 0; i < m_start_list.size(); ++i)
 		{
+			// ǉɂĊmۂɔăRs[
+			const std::shared_ptr<MonoBehaviour> mono_behaviour = m_start_list[i];
+
 			// Check object existence.
-			if (!(*itr)->IsExist())
+			if (!mono_behaviour->IsExist())
 			{
-				itr = m_start_list.erase(itr);
 				continue;
 			}
 
 			// Check Active and Enable.
-			if (!(*itr)->IsActiveAndEnabled() || !(*itr)->IsActiveScene())
+			if (!mono_behaviour->IsActiveBehaviour())
 			{
-				++itr;
+				m_start_list[keep_num++] = mono_behaviour;
 				continue;
 			}
 
 			// Do func.
-			(*itr)->CheckMonoBehaviourState(MonoBehaviour::MonoBehaviourEventType::OnStart);
-			(*itr)->Start();
+			mono_behaviour->CheckMonoBehaviourState(MonoBehaviour::MonoBehaviourEventType::OnStart);
+			mono_behaviour->Start();
 
 			// t[XVsScript`FbN
-			if ((*itr)->CanCallEveryFrameUpdate())
+			if (mono_behaviour->CanCallEveryFrameUpdate())
 			{
 				// Add Update list.
-				m_update_list.emplace_back(*itr);
-				m_update_list_changed = true;
+				if (mono_behaviour->IsUseUpdate())
+				{
+					AddUpdateBucket(m_update_buckets, mono_behaviour);
+				}
+				if (mono_behaviour->IsUseLateUpdate())
+				{
+					AddUpdateBucket(m_late_update_buckets, mono_behaviour);
+				}
 			}
-
-			itr = m_start_list.erase(itr);
 		}
+		m_start_list.resize(keep_num);
 	}
 
 	void MonoBehaviourManager::ExecuteUpdate()
 	{
-		// ǉꂽƂ̓\[gȂ
-		if (m_update_list_changed)
+		// Priority̏oPbg珇ɌĂł
+		for (auto& bucket : m_update_buckets)
 		{
-			m_update_list.sort([](const std::shared_ptr<MonoBehaviour>& l, const std::shared_ptr<MonoBehaviour>& r) {return l->Priority() < r->Priority(); });
-			m_update_list_changed = false;
-		}
-
-		// Ԃ`FbNȂ珇ɌĂł
-		const auto itr_end = m_update_list.end();
-		for (auto itr = m_update_list.begin(); itr != itr_end;)
-		{
-			// Check object existence.
-			if (!(*itr)->IsExist())
+			auto& scripts = bucket.scripts;
+			const size_t script_num = scripts.size();
+			for (size_t i = 0; i < script_num; ++i)
 			{
-				itr = m_update_list.erase(itr);
-				continue;
-			}
+				MonoBehaviour* mono_behaviour = scripts[i].get();
 
-			// Check Active and Enable.
-			if (!(*itr)->IsActiveAndEnabled() || !(*itr)->IsActiveScene())
-			{
-				++itr;
-				continue;
-			}
+				// Check object existence.
+				if (!mono_behaviour->IsExist())
+				{
+					scripts[i].reset();
+					++bucket.removed_num;
+					continue;
+				}
 
-			// Do func.
-			(*itr)->Update();
-			++itr;
+				// Check Active and Enable.
+				if (!mono_behaviour->IsActiveBehaviour())
+				{
+					continue;
+				}
+
+				// Do func.
+				mono_behaviour->Update();
+			}
+			CompactUpdateBucket(bucket);
 		}
 	}
 
 	void MonoBehaviourManager::ExecuteLateUpdate()
 	{
-		// ǉꂽƂ̓\[gȂ
-		if (m_update_list_changed)
+		// Priority̏oPbg珇ɌĂł
+		for (auto& bucket : m_late_update_buckets)
 		{
-			m_update_list.sort([](const std::shared_ptr<MonoBehaviour>& l, const std::shared_ptr<MonoBehaviour>& r) {return l->Priority() < r->Priority(); });
-			m_update_list_changed = false;
-		}
-
-		// Ԃ`FbNȂ珇ɌĂł
-		const auto itr_end = m_update_list.end();
-		for (auto itr = m_update_list.begin(); itr != itr_end;)
-		{
-			// Check object existence.
-			if (!(*itr)->IsExist())
+			auto& scripts = bucket.scripts;
+			const size_t script_num = scripts.size();
+			for (size_t i = 0; i < script_num; ++i)
 			{
-				itr = m_update_list.erase(itr);
-				continue;
-			}
+				MonoBehaviour* mono_behaviour = scripts[i].get();
 
-			// Check Active and Enable.
-			if (!(*itr)->IsActiveAndEnabled() || !(*itr)->IsActiveScene())
-			{
-				++itr;
-				continue;
+				// Check object existence.
+				if (!mono_behaviour->IsExist())
+				{
+					scripts[i].reset();
+					++bucket.removed_num;
+					continue;
+				}
+
+				// Check Active and Enable.
+				if (!mono_behaviour->IsActiveBehaviour())
+				{
+					continue;
+				}
+
+				// Do func.
+				mono_behaviour->LateUpdate();
 			}
+			CompactUpdateBucket(bucket);
+		}
+	}
 
-			// Do func.
-			(*itr)->LateUpdate();
-			++itr;
+	void MonoBehaviourManager::AddUpdateBucket(std::vector<UpdateBucket>& buckets, const std::shared_ptr<MonoBehaviour>& monoBehaviour)
+	{
+		const int priority = monoBehaviour->Priority();
+		// PrioritỹoPbgT
+		const auto itr = std::lower_bound(
+			buckets.begin(), buckets.end(), priority,
+			[](const UpdateBucket& bucket, const int value) {return bucket.priority < value; }
+		);
+		if (itr != buckets.end() && itr->priority == priority)
+		{
+			itr->scripts.emplace_back(monoBehaviour);
+			return;
 		}
+		// ݂ȂΏۂč쐬
+		const auto itr_new = buckets.emplace(itr);
+		itr_new->priority = priority;
+		itr_new->scripts.emplace_back(monoBehaviour);
+	}
+
+	void MonoBehaviourManager::CompactUpdateBucket(UpdateBucket& bucket)
+	{
+		if (bucket.removed_num <= 0)
+		{
+			return;
+		}
+
+		// Prioritył͓o^ɌĂԂ߁Aтɋl߂
+		auto& scripts = bucket.scripts;
+		scripts.erase(std::remove(scripts.begin(), scripts.end(), nullptr), scripts.end());
+		bucket.removed_num = 0;
 	}
 
 	// ------------------------------------------------------------
@@ -3,6 +3,7 @@
 #include "../../Objects/inc/IGameObject.h"
 
 #include <list>
+#include <vector>
 #include <unordered_map>
 
 #include <memory>
@@ -128,14 +129,31 @@ namespace TKGEngine
 		};
 
 
+		/// <summary>
+		/// sDxScript܂Ƃ߂XVXg
+		/// </summary>
+		struct UpdateBucket
+		{
+			int priority = 0;
+			std::vector<std::shared_ptr<MonoBehaviour>> scripts;
+			// sɊOnullptrɂȂvf(sɂ܂Ƃ߂ċl߂)
+			int removed_num = 0;
+		};
+
+
 		// ==============================================
 		// private methods
 		// ==============================================
-		// ꂼsOPriority\[gs
+		// Start͎sOPriority\[gs
 		static void ExecuteStart();
 		static void ExecuteUpdate();
 		static void ExecuteLateUpdate();
 
+		// PriorityɑΉoPbgɒǉ
+		static void AddUpdateBucket(std::vector<UpdateBucket>& buckets, const std::shared_ptr<MonoBehaviour>& monoBehaviour);
+		// nullptrɂȂvfsۂ܂܍폜
+		static void CompactUpdateBucket(UpdateBucket& bucket);
+
 
 		// ==============================================
 		// private variables
@@ -150,10 +168,10 @@ namespace TKGEngine
 		static std::unordered_map<int, std::shared_ptr<MonoBehaviour>> m_store_list;
 		// StartĂԗ\̃XgɕύX
 		static bool m_start_list_changed;
-		static std::list<std::shared_ptr<MonoBehaviour>> m_start_list;
-		// UpdateĂԗ\̃XgɕύX
-		static bool m_update_list_changed;
-		static std::list<std::shared_ptr<MonoBehaviour>> m_update_list;
+		static std::vector<std::shared_ptr<MonoBehaviour>> m_start_list;
+		// Priority̏ɕUpdateALateUpdateĂԃoPbg
+		static std::vector<UpdateBucket> m_update_buckets;
+		static std::vector<UpdateBucket> m_late_update_buckets;
 		
 		// Aj[VCxgǗp}l[W
 		static std::unique_ptr<EventFunctionManager> m_event_func_manager;
@@ -1,16 +1,36 @@
 
 #include "ObjectManager.h"
 
+#include <algorithm>
+
 namespace TKGEngine
 {
 	////////////////////////////////////////////////////////
 	// Static variable declaration
 	////////////////////////////////////////////////////////
-	std::unordered_map<InstanceID, std::shared_ptr<Object>> ObjectManager::m_object_index;
-	std::list<ObjectManager::DeletionData> ObjectManager::m_deletion_list;
-	std::deque<InstanceID> ObjectManager::m_empty_id_pool;
-	std::mutex ObjectManager::m_id_pool_mutex;
-	InstanceID ObjectManager::m_current_id = 0;
+	std::vector<ObjectManager::ObjectSlot> ObjectManager::m_object_slots;
+	std::deque<unsigned> ObjectManager::m_empty_slot_pool;
+	std::mutex ObjectManager::m_slot_mutex;
+	std::vector<ObjectManager::DeletionData> ObjectManager::m_deletion_heap;
+	HandleMap<ObjectManager::DeletionData> ObjectManager::m_deletion_index;
+	std::uint64_t ObjectManager::m_deletion_serial = 0;
+	std::mutex ObjectManager::m_deletion_mutex;
+	double ObjectManager::m_current_time = 0.0;
+
+	namespace /* anonymous */
+	{
+		// 폜̂擪ɂq[v̔r֐
+		struct DeletionLater
+		{
+			template <class T>
+			bool operator()(const T& l, const T& r) const
+			{
+				if (l.time != r.time)
+					return l.time > r.time;
+				return l.serial > r.serial;
+			}
+		};
+	}/* anonymous */
 
 
 	////////////////////////////////////////////////////////
@@ -18,51 +38,32 @@ namespace TKGEngine
 	////////////////////////////////////////////////////////
 	void ObjectManager::FrameUpdate(float elapsed_time)
 	{
-		// Sort Deletion Data from time is most early.
-		m_deletion_list.sort(
-			[](const ObjectManager::DeletionData& l, const ObjectManager::DeletionData& r)
-			{
-				return l.first < r.first;
-			});
-
-		// If time is less equal 0, call OnDestroy.
-		const auto itr_end = m_deletion_list.end();
-		for (auto itr = m_deletion_list.begin(); itr != itr_end;)
+		// 폜߂̂oOnDestroyĂ
+		// OnDestroyœo^ꂽ폜\q[vɓ邽߁A؂Ȃ瓯t[ŏ
+		// OnDestroyDestroyĂ΂邽߁AbN͎o̊Ԃێ
+		while (true)
 		{
-			if (itr->first <= 0.0f)
-			{
-				{
-					const int dest_id = itr->second;
-					auto&& inst = m_object_index.at(dest_id);
-					// nullptr`FbN
-					if (inst)
-					{
-						inst->OnDestroy();
-						inst->Object::OnDestroy();
-					}
-					// destroyXg
-					m_object_index.erase(dest_id);
-					// InstanceID̎g܂킵Xgɓ
-					std::lock_guard<std::mutex> lock(m_id_pool_mutex);
-					m_empty_id_pool.push_back(dest_id);
-				}
-				itr = m_deletion_list.erase(itr);
-			}
-			else
+			DeletionData data{};
 			{
-				// SortĂ̂łȍ~͊mFsv
-				// DEBUG : OnDestroyŃXgɓo^ꍇ\[gʂɂȂ
-				break;
+				std::lock_guard<std::mutex> lock(m_deletion_mutex);
+				if (m_deletion_heap.empty() || m_deletion_heap.front().time > m_current_time)
+					break;
+
+				std::pop_heap(m_deletion_heap.begin(), m_deletion_heap.end(), DeletionLater());
+				data = m_deletion_heap.back();
+				m_deletion_heap.pop_back();
+
+				// Aēo^ꂽ͖̂
+				if (!IsValidDeletion(data))
+					continue;
 			}
-		}
 
-		// Caluclate time with elapsed time.
-		for (auto&& pair : m_deletion_list)
-		{
-			pair.first -= elapsed_time;
+			DestroyObject(data.id);
 		}
 
-		return;
+		// Caluclate time with elapsed time.
+		std::lock_guard<std::mutex> lock(m_deletion_mutex);
+		m_current_time += static_cast<double>(elapsed_time);
 	}
 
 	std::weak_ptr<Object> ObjectManager::Set(const std::shared_ptr<Object>& p_obj)
@@ -70,11 +71,15 @@ namespace TKGEngine
 		const InstanceID obj_id = p_obj->GetInstanceID();
 		std::weak_ptr<Object> weak;
 
-		const auto ret_val = m_object_index.emplace(obj_id, p_obj);
-		if (!ret_val.second)
 		{
-			assert(0 && "failed Insert ObjectManager Index ObjectManager::Set()");
-			return weak;
+			std::lock_guard<std::mutex> lock(m_slot_mutex);
+			auto* slot = FindSlot(obj_id);
+			if (!slot || *slot)
+			{
+				assert(0 && "failed Insert ObjectManager Index ObjectManager::Set()");
+				return weak;
+			}
+			*slot = p_obj;
 		}
 		weak = p_obj;
 		return weak;
@@ -88,45 +93,128 @@ namespace TKGEngine
 			return;
 		}
 
-		m_deletion_list.emplace_back(delay, id);
+		// [h̃V[Ă΂邽߁A폜\̑̓bNčs
+		std::lock_guard<std::mutex> lock(m_deletion_mutex);
+		const double time = m_current_time + static_cast<double>(delay);
+		// ɓo^Ăꍇ͑c
+		auto* registered = m_deletion_index.Find(id);
+		if (registered && registered->time <= time)
+			return;
+
+		const DeletionData data{ time, ++m_deletion_serial, id };
+		if (registered)
+		{
+			*registered = data;
+		}
+		else
+		{
+			m_deletion_index.Emplace(id, data);
+		}
+		m_deletion_heap.push_back(data);
+		std::push_heap(m_deletion_heap.begin(), m_deletion_heap.end(), DeletionLater());
+	}
+
+	void ObjectManager::CancelDestroy(InstanceID id)
+	{
+		// q[v̗vf͎oɓǂݔ΂
+		std::lock_guard<std::mutex> lock(m_deletion_mutex);
+		m_deletion_index.Erase(id);
 	}
 
 	void ObjectManager::DestroyImmediate(InstanceID id)
 	{
+		DestroyObject(id);
+	}
+
+	void ObjectManager::DestroyObject(InstanceID id)
+	{
+		// x폜̗\肪Ύ
 		{
-			const auto itr = m_object_index.find(id);
-			if (itr != m_object_index.end())
-			{
-				itr->second->OnDestroy();
-				itr->second->Object::OnDestroy();
-				m_object_index.erase(itr);
-			}
+			std::lock_guard<std::mutex> lock(m_deletion_mutex);
+			m_deletion_index.Erase(id);
+		}
+
+		// Ăяoɔz񂪕ύX邽ߎQƂێ
+		std::shared_ptr<Object> inst;
+		{
+			std::lock_guard<std::mutex> lock(m_slot_mutex);
+			const auto* slot = FindSlot(id);
+			if (!slot)
+				return;
+			inst = *slot;
+		}
+		// nullptr`FbN
+		if (inst)
+		{
+			inst->OnDestroy();
+			inst->Object::OnDestroy();
 		}
-		std::lock_guard<std::mutex> lock(m_id_pool_mutex);
-		m_empty_id_pool.push_back(id);
+		// XbgĐi߂(ÂID͈ȍ~ɂȂ)
+		std::lock_guard<std::mutex> lock(m_slot_mutex);
+		const unsigned index = GetInstanceIDIndex(id);
+		auto& slot = m_object_slots[index];
+		if (slot.generation != GetInstanceIDGeneration(id))
+			return;
+		slot.object.reset();
+		slot.generation = slot.generation >= INSTANCE_ID_GENERATION_MAX ? 1 : slot.generation + 1;
+		// Xbg̎g܂킵Xgɓ
+		m_empty_slot_pool.push_back(index);
+	}
+
+	bool ObjectManager::IsValidDeletion(const DeletionData& data)
+	{
+		const auto* registered = m_deletion_index.Find(data.id);
+		return registered && registered->serial == data.serial;
+	}
+
+	std::shared_ptr<Object>* ObjectManager::FindSlot(InstanceID id)
+	{
+		const unsigned index = GetInstanceIDIndex(id);
+		if (index >= m_object_slots.size())
+			return nullptr;
+		auto& slot = m_object_slots[index];
+		if (slot.generation != GetInstanceIDGeneration(id))
+			return nullptr;
+		return &slot.object;
 	}
 
 	InstanceID ObjectManager::AttachID()
 	{
-		std::lock_guard<std::mutex> lock(m_id_pool_mutex);
-		if (m_empty_id_pool.empty())
+		std::lock_guard<std::mutex> lock(m_slot_mutex);
+		if (m_empty_slot_pool.empty())
 		{
-			return ++m_current_id;
+			const unsigned index = static_cast<unsigned>(m_object_slots.size());
+			if (index > INSTANCE_ID_INDEX_MASK)
+			{
+				assert(0 && "slot overflow. ObjectManager::AttachID()");
+				return INVALID_ID;
+			}
+			m_object_slots.emplace_back();
+			return MakeInstanceID(index, m_object_slots.back().generation);
 		}
 		else
 		{
-			const InstanceID ret_id = m_empty_id_pool.front();
-			m_empty_id_pool.pop_front();
-			return ret_id;
+			// ꂽXbg͐i߂Ă̂ŁAȑOIDƂ͈vȂ
+			const unsigned index = m_empty_slot_pool.front();
+			m_empty_slot_pool.pop_front();
+			return MakeInstanceID(index, m_object_slots[index].generation);
 		}
-		// No reached
-		assert(0);
 	}
 
 	std::weak_ptr<Object> ObjectManager::GetInstance(InstanceID id)
 	{
-		std::weak_ptr<Object> ret_ptr = m_object_index.at(id);
-		return ret_ptr;
+		std::lock_guard<std::mutex> lock(m_slot_mutex);
+		const auto* slot = FindSlot(id);
+		if (!slot)
+			return std::weak_ptr<Object>();
+		return *slot;
+	}
+
+	bool ObjectManager::IsValid(InstanceID id)
+	{
+		std::lock_guard<std::mutex> lock(m_slot_mutex);
+		const auto* slot = FindSlot(id);
+		return slot && *slot;
 	}
 
-}//namespace TKGEngine 
\ No newline at end of file
+}//namespace TKGEngine
@@ -1,13 +1,15 @@
 #pragma once
 
 #include "../inc/Object.h"
+#include "Utility/inc/template_HandleMap.h"
 
 #include <unordered_map>
-#include <list>
+#include <vector>
 #include <deque>
-#include <utility>
+#include <cstdint>
 
 #include <memory>
+#include <mutex>
 
 namespace TKGEngine
 {
@@ -16,7 +18,15 @@ namespace TKGEngine
 	/// </summary>
 	class ObjectManager
 	{
-		using DeletionData = std::pair<float/*time[s]*/, InstanceID>;
+		/// <summary>
+		/// 폜\f[^(폜̑Ɏoq[v̗vf)
+		/// </summary>
+		struct DeletionData
+		{
+			double time;	// 폜鎞[s]
+			std::uint64_t serial;	// o^(͐ɓo^̂폜Aɂgp)
+			InstanceID id;
+		};
 
 	public:
 		// ==============================================
@@ -34,9 +44,13 @@ namespace TKGEngine
 
 		// delay < 0.0fȂ炻̏ō폜
 		static void Destroy(InstanceID id, float delay = 0.0f);
+		// x폜̗\
+		static void CancelDestroy(InstanceID id);
 
 		static InstanceID AttachID();
 		static std::weak_ptr<Object> GetInstance(InstanceID id);
+		// IDݑ݂IuWFNgwĂ邩(jς݁AėpꂽXbǧÂIDȂfalse)
+		static bool IsValid(InstanceID id);
 
 
 		// ==============================================
@@ -50,16 +64,41 @@ namespace TKGEngine
 		// private methods
 		// ==============================================
 		static void DestroyImmediate(InstanceID id);
+		// OnDestroyĂсAXbg
+		static void DestroyObject(InstanceID id);
+		// 폜\̃q[v̐擪Lȗ\肩ǂ(m_deletion_mutexbNԂŌĂ)
+		static bool IsValidDeletion(const DeletionData& data);
+		// オvXbgԂ(m_slot_mutexbNԂŌĂ)
+		static std::shared_ptr<Object>* FindSlot(InstanceID id);
 
 
 		// ==============================================
 		// private variables
 		// ==============================================
-		static std::unordered_map<InstanceID, std::shared_ptr<Object>> m_object_index;	// object instance map
-		static std::list<DeletionData> m_deletion_list;
-		static std::deque<InstanceID> m_empty_id_pool;	// Empty pooling ID
-		static std::mutex m_id_pool_mutex;
-		static InstanceID m_current_id;
+		/// <summary>
+		/// InstanceID̃XbgԍňIuWFNg̊i[ꏊ
+		/// </summary>
+		struct ObjectSlot
+		{
+			std::shared_ptr<Object> object;
+			// 邽тɐi߂鐢
+			unsigned generation = 1;
+		};
+
+		// InstanceID̃XbgԍYɂIuWFNgz
+		static std::vector<ObjectSlot> m_object_slots;
+		static std::deque<unsigned> m_empty_slot_pool;	// Empty pooling slot index
+		static std::mutex m_slot_mutex;
+		// 폜̑̃q[v(ꂽ͎̂oɓǂݔ΂)
+		static std::vector<DeletionData> m_deletion_heap;
+		// InstanceIDƂ̗Lȍ폜\
+		static HandleMap<DeletionData> m_deletion_index;
+		static std::uint64_t m_deletion_serial;
+		// FrameUpdateŐi߂oߎ[s]
+		static double m_current_time;
+		// 폜\(q[vACfbNXAʂԍAoߎ)ی삷
+		// [h̃V[̔jŃ[J[Xbh삳
+		static std::mutex m_deletion_mutex;
 
 	};
 
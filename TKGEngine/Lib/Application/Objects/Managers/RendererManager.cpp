@@ -13,10 +13,12 @@
 #include "Systems/inc/IGUI.h"
 #include "Systems/inc/Graphics_Defined.h"
 #include "Systems/inc/StateManager.h"
+#include "Utility/inc/cpu_profiler.h"
 
 #include <iterator>
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #include <d3d11.h>
 
@@ -35,6 +37,22 @@ namespace TKGEngine
 	static constexpr int START_UI_LIST_SIZE = 50;
 	static constexpr int ADD_UI_LIST_SIZE = 50;
 
+	// 1WuŔ肷AABB(SIMD̔{)
+	static constexpr int CULLING_BATCH_SIZE = 256;
+
+	// MainpX̃\[gL[̃rbgzu(ʂ)
+	// s : Queue(13) | ob`\(1) | Material(24) | Mesh(16) | Subset(10)
+	//  : Queue(13) | ̍~(32) | 0(19)
+	static constexpr int SORT_KEY_QUEUE_SHIFT = 51;
+	static constexpr int SORT_KEY_BATCHING_SHIFT = 50;
+	static constexpr int SORT_KEY_MATERIAL_SHIFT = 26;
+	static constexpr int SORT_KEY_MESH_SHIFT = 10;
+	static constexpr int SORT_KEY_DISTANCE_SHIFT = 19;
+	static constexpr std::uint64_t SORT_KEY_QUEUE_MASK = (1ull << 13) - 1;
+	static constexpr std::uint64_t SORT_KEY_MATERIAL_MASK = (1ull << 24) - 1;
+	static constexpr std::uint64_t SORT_KEY_MESH_MASK = (1ull << 16) - 1;
+	static constexpr std::uint64_t SORT_KEY_SUBSET_MASK = (1ull << 10) - 1;
+
 	// UI path
 	std::mutex RendererManager::UIPath::m_mutex;
 	std::list<std::shared_ptr<IRenderer>> RendererManager::UIPath::m_renderer_list;
@@ -51,6 +69,14 @@ namespace TKGEngine
 	std::vector<MainData> RendererManager::m_main_path_list;
 	std::vector<UIData> RendererManager::m_UI_path_list;
 
+	std::vector<const std::shared_ptr<IRenderer>*> RendererManager::m_culling_candidates;
+	MyFunc::PackedBounds RendererManager::m_culling_bounds;
+	std::vector<std::uint8_t> RendererManager::m_culling_results;
+	JobCounter RendererManager::m_culling_counter;
+	std::vector<MyFunc::SortKey> RendererManager::m_main_sort_keys;
+	std::vector<MyFunc::SortKey> RendererManager::m_main_sort_work;
+	DynamicAABBTree RendererManager::m_renderer_tree;
+
 	int RendererManager::m_path_current_data_sizes[static_cast<int>(RenderPath::MAX_RENDER_PATH)] = {};
 	int RendererManager::m_path_current_data_counts[static_cast<int>(RenderPath::MAX_RENDER_PATH)] = {};
 	int RendererManager::m_path_prev_data_counts[static_cast<int>(RenderPath::MAX_RENDER_PATH)] = {};
@@ -110,7 +136,7 @@ namespace TKGEngine
 			UIPath::FrameBegin(camera);
 
 		// Cg̍XV
-		LightManager::CalculateSceneLight(m_shadow_path_list, m_path_current_data_counts[static_cast<int>(RenderPath::Shadow)], camera);
+		LightManager::CalculateSceneLight(m_shadow_path_list, m_path_current_data_counts[static_cast<int>(RenderPath::Shadow)], m_renderer_tree, camera);
 		// `pXs
 		{
 			UpdateShadow(camera);
@@ -152,6 +178,13 @@ namespace TKGEngine
 		}
 
 		std::lock_guard<std::mutex> lock(m_mutex);
+		// BVH菜
+		const int proxy_id = (*itr)->GetCullingProxy();
+		if (proxy_id != DynamicAABBTree::NULL_NODE)
+		{
+			m_renderer_tree.DestroyProxy(proxy_id);
+			(*itr)->SetCullingProxy(DynamicAABBTree::NULL_NODE);
+		}
 		m_renderer_list.erase(itr);
 	}
 
@@ -162,6 +195,9 @@ namespace TKGEngine
 		const VECTOR3 camera_pos = camera->GetWorldPosition();
 		const auto end_itr = m_renderer_list.end();
 
+		// `̎WAABB̍XV
+		m_culling_candidates.clear();
+		m_culling_bounds.Resize(static_cast<int>(m_renderer_list.size()));
 		for (auto itr = m_renderer_list.begin(); itr != end_itr; ++itr)
 		{
 			auto& renderer = *itr;
@@ -170,41 +206,81 @@ namespace TKGEngine
 			// fĂ邩̃tO
 			renderer->SetVisible(false);
 
+			const int proxy_id = renderer->GetCullingProxy();
+
 			// GameObjectAV[A_[SĂANeBu`FbN
 			if (!renderer->IsActiveAndEnabled())
 			{
+				// ANeBůԂBVHOĂ
+				if (proxy_id != DynamicAABBTree::NULL_NODE)
+				{
+					m_renderer_tree.DestroyProxy(proxy_id);
+					renderer->SetCullingProxy(DynamicAABBTree::NULL_NODE);
+				}
 				continue;
 			}
 
 			// Check Culling layer
-			if ((culling_layer & (1 << static_cast<int>(renderer->GetLayer()))) > 0)
+			// JƂɕς邽ߗt͎cĒTΏۂO
+			if ((culling_layer & (1 << static_cast<int>(renderer->GetLayer()))) > 0 || renderer->GetSubsetCount() <= 0)
 			{
+				if (proxy_id != DynamicAABBTree::NULL_NODE)
+				{
+					m_renderer_tree.SetUserData(proxy_id, -1);
+				}
 				continue;
 			}
 
-			// Set data list
+			// _[Ƃ̍sAAABBȂǂ̌vZAXV
+			renderer->CalculateRenderParameter(camera);
+
+			// BVH̍XV
+			const Bounds& bounds = renderer->GetRendererBounds();
+			if (proxy_id == DynamicAABBTree::NULL_NODE)
+			{
+				renderer->SetCullingProxy(m_renderer_tree.CreateProxy(bounds, -1));
+			}
+			else
 			{
-				const int subset_cnt = renderer->GetSubsetCount();
+				m_renderer_tree.MoveProxy(proxy_id, bounds);
+			}
 
-				if (subset_cnt <= 0)
-				{
-					continue;
-				}
+			m_culling_bounds.Set(static_cast<int>(m_culling_candidates.size()), bounds);
+			m_culling_candidates.emplace_back(&renderer);
+		}
 
-				// _[Ƃ̍sAAABBȂǂ̌vZAXV
-				renderer->CalculateRenderParameter(camera);
+		// JO
+		CullCandidates(camera);
+
+		// ĉXgɐU蕪
+		const int candidate_num = static_cast<int>(m_culling_candidates.size());
+		for (int i = 0; i < candidate_num; ++i)
+		{
+			const auto& renderer = *m_culling_candidates[i];
+			const int subset_cnt = renderer->GetSubsetCount();
 
-				// TODO : gpLOD̋敪Ȃǂs
-				const float sq_dist = VECTOR3::DistanceSq(camera_pos, renderer->GetWorldPosition());
+			// TODO : gpLOD̋敪Ȃǂs
+			const float sq_dist = VECTOR3::DistanceSq(camera_pos, renderer->GetWorldPosition());
 
-				// `̗LŃXgU蕪
-				// Shadow
-				if (renderer->GetShadowCastMode() != ShadowCastingMode::OFF)
+			// `̗LŃXgU蕪
+			// Shadow
+			// e̓JÕIuWFNgƂ߃CgBVHgăJO
+			int shadow_start = -1;
+			if (renderer->GetShadowCastMode() != ShadowCastingMode::OFF)
+			{
+				const int prev_shadow_cnt = m_path_current_data_counts[static_cast<int>(RenderPath::Shadow)];
+				AddShadowData(subset_cnt, sq_dist, renderer);
+				if (m_path_current_data_counts[static_cast<int>(RenderPath::Shadow)] > prev_shadow_cnt)
 				{
-					AddShadowData(subset_cnt, sq_dist, renderer);
+					shadow_start = prev_shadow_cnt;
 				}
-				// Main
-				if (renderer->GetShadowCastMode() != ShadowCastingMode::ShadowsOnly)
+			}
+			m_renderer_tree.SetUserData(renderer->GetCullingProxy(), shadow_start);
+			// Main
+			if (renderer->GetShadowCastMode() != ShadowCastingMode::ShadowsOnly)
+			{
+				// p[eBN͔͈͂ŝߎJO͂Ȃ
+				if (m_culling_results[i] != 0 || renderer->IsThroughFrustumCulling())
 				{
 					AddMainData(subset_cnt, sq_dist, renderer);
 				}
@@ -212,6 +288,27 @@ namespace TKGEngine
 		}
 	}
 
+	void RendererManager::CullCandidates(const std::shared_ptr<ICamera>& camera)
+	{
+		const int candidate_num = static_cast<int>(m_culling_candidates.size());
+		if (m_culling_results.size() < static_cast<size_t>(candidate_num))
+		{
+			m_culling_results.resize(candidate_num);
+		}
+		if (candidate_num <= 0)
+		{
+			return;
+		}
+
+		const Frustum& frustum = camera->GetFrustum();
+		JobSystem::ParallelFor(m_culling_counter, candidate_num, CULLING_BATCH_SIZE,
+			[&frustum](const int begin, const int end)
+			{
+				MyFunc::FrustumCulling(frustum, m_culling_bounds, begin, end, m_culling_results.data());
+			});
+		JobSystem::Wait(m_culling_counter);
+	}
+
 	void RendererManager::AddShadowData(int subset_count, float distance, const std::shared_ptr<IRenderer>& renderer)
 	{
 		constexpr int path_idx = static_cast<int>(RenderPath::Shadow);
@@ -314,6 +411,8 @@ namespace TKGEngine
 	// /////////////////////////////////////////////////////////////////////
 	void RendererManager::UpdateMain(const std::shared_ptr<ICamera>& camera)
 	{
+		CPU_PROFILE_SCOPE("RendererManager::UpdateMain");
+
 		constexpr int path_idx = static_cast<int>(RenderPath::Main);
 		const int count = m_path_current_data_counts[path_idx];
 
@@ -353,46 +452,22 @@ namespace TKGEngine
 			return;
 		}
 
-		const auto itr_begin = m_main_path_list.begin();
-		auto itr_end = itr_begin;
-		std::advance(itr_end, count);
-		auto itr_current = itr_begin;
-
 		auto& draw_list = m_draw_data_list;
 		int& draw_cnt = m_current_draw_data_count;
 
-		// tX^JO
-		// OPTIMIZE : tX^AABBƂăJOɎgp邱Ƃł
-		//auto frustum_aabb = camera->GetFrustum().GetAABB();
-		for (auto itr = itr_begin; itr != itr_end; ++itr)
-		{
-			const auto& ref_renderer = itr->renderer;
-			// p[eBN͔͈͂ŝߎJO͂Ȃ
-			if (ref_renderer->IsThroughFrustumCulling())
-			{
-				itr->do_render = true;
-				continue;
-			}
-			itr->do_render = ref_renderer->GetRendererBounds().ContainsBy(camera->GetFrustum());
-		}
-
-		// Sort DoRender
-		std::sort(itr_begin, itr_end, SortMain_DoRender);
-		while (itr_current != itr_end)
+		// JOSetDataListōςł̂őSĕ`悷
+		// MainDatashared_ptr̂œAL[ƃCfbNX̑g\[g
+		if (m_main_sort_keys.size() < static_cast<size_t>(count))
 		{
-			if (itr_current->do_render)
-				break;
-			++itr_current;
+			m_main_sort_keys.resize(count);
+			m_main_sort_work.resize(count);
 		}
-		if (itr_current == itr_end)
+		for (int i = 0; i < count; ++i)
 		{
-			return;
+			m_main_sort_keys[i].key = CreateMainSortKey(m_main_path_list[i]);
+			m_main_sort_keys[i].index = i;
 		}
-
-		auto itr_same_queue_end = itr_current;		// QueuȅI[
-		auto itr_same_material_end = itr_current;	// Material̏I[
-		auto itr_same_mesh_end = itr_current;		// Mesh̏I[
-		auto itr_same_subset_end = itr_current;		// Subset̏I[
+		const MyFunc::SortKey* sorted = MyFunc::RadixSort(m_main_sort_keys.data(), m_main_sort_work.data(), count);
 
 		// InstanceBufferMap
 		MainInstance* instance = nullptr;
@@ -403,144 +478,40 @@ namespace TKGEngine
 			return;
 		}
 
-		// Queue\[g
-		std::sort(itr_current, itr_end, SortMain_Queue);
-
-		// I[܂Ń[v
-		while (itr_current != itr_end)
+		// \[gς݂̏1̑DrawDataɋlߍ
+		int current = 0;
+		while (current < count)
 		{
-			// Queueend擾
-			while (true)
-			{
-				if (itr_same_queue_end == itr_end)
-				{
-					break;
-				}
-				if (itr_same_queue_end->queue != itr_current->queue)
-				{
-					break;
-				}
-				++itr_same_queue_end;
-			}
-
-			// s
-			if (itr_begin->queue < RenderQueue::Transparent)
-			{
-				// ob`\\[g
-				std::sort(itr_current, itr_same_queue_end, SortMain_Batching);
-
-				while (itr_current != itr_same_queue_end)
-				{
-					// ob`\܂1ZbgĂ
-					if (!itr_current->can_batching)
-					{
-						auto&& draw_data = draw_list.at(draw_cnt++);
-						draw_data = *itr_current;
-						draw_data.start_idx = instance_count++;
-						draw_data.instance_cnt = 1;
-						itr_current->renderer->SetInstance(instance++);
-
-						++itr_current;
-					}
-					// ob`\ɂȂbreak
-					else
-					{
-						itr_same_material_end = itr_current;
-						itr_same_mesh_end = itr_current;
-						itr_same_subset_end = itr_current;
-						break;
-					}
-				}
-
-				// Material\[g
-				std::sort(itr_current, itr_same_queue_end, SortMain_Material);
-
-				while (itr_current != itr_same_queue_end)
-				{
-					// }eA͈̔͂擾
-					while (itr_same_material_end != itr_same_queue_end)
-					{
-						if (itr_current->material_hash != itr_same_material_end->material_hash)
-						{
-							break;
-						}
-						++itr_same_material_end;
-					}
-
-					// Mesh\[g
-					std::sort(itr_current, itr_same_material_end, SortMain_Mesh);
-
-					while (itr_current != itr_same_material_end)
-					{
-						// ꃁbV͈̔͂擾
-						while (itr_same_mesh_end != itr_same_material_end)
-						{
-							if (itr_current->mesh_hash != itr_same_mesh_end->mesh_hash)
-							{
-								break;
-							}
-							++itr_same_mesh_end;
-						}
-
-						// Subset_Idx\[g
-						std::sort(itr_current, itr_same_mesh_end, SortMain_Subset);
-
-						while (itr_current != itr_same_mesh_end)
-						{
-							// TuZbgIdx͈̔͂擾
-							while (itr_same_subset_end != itr_same_mesh_end)
-							{
-								if (itr_current->subset_idx != itr_same_subset_end->subset_idx)
-								{
-									break;
-								}
-								++itr_same_subset_end;
-							}
-
-							// DrawDataɋlߍ
-							if (itr_current != itr_same_subset_end)
-							{
-								// ʃf[^lߍ
-								auto&& draw_data = draw_list.at(draw_cnt);
-								draw_data = *itr_current;
-								draw_data.start_idx = instance_count;
-								draw_data.instance_cnt = 0;
-
-								// CX^X̃f[^lߍ
-								while (itr_current != itr_same_subset_end)
-								{
-									++instance_count;
-									++draw_data.instance_cnt;
-									itr_current->renderer->SetInstance(instance++);
-
-									++itr_current;
-								}
-							}
-
-							++draw_cnt;
-						}
-
-					}// while same material.
-				}// while same queue.
-			}// if opaque.
-			// 
-			else
+			const MainData& head = m_main_path_list[sorted[current].index];
+
+			// ʃf[^lߍ
+			auto&& draw_data = draw_list.at(draw_cnt++);
+			draw_data = head;
+			draw_data.start_idx = instance_count;
+			draw_data.instance_cnt = 0;
+
+			// sob`\Ȃ瓯Queue, Material, Mesh, Subset͈̔͂܂Ƃ߂
+			// L[̓lł̓nbV̏Փ˂̂Ō̒lŔr
+			const bool is_batch = head.queue < RenderQueue::Transparent && head.can_batching;
+			do
 			{
-				// Transparent̋\[g
-				std::sort(itr_current, itr_same_queue_end, SortMain_Distance);
+				++instance_count;
+				++draw_data.instance_cnt;
+				m_main_path_list[sorted[current].index].renderer->SetInstance(instance++);
 
-				while (itr_current != itr_same_queue_end)
-				{
-					auto&& draw_data = draw_list.at(draw_cnt++);
-					draw_data = *itr_current;
-					draw_data.start_idx = instance_count++;
-					draw_data.instance_cnt = 1;
-					itr_current->renderer->SetInstance(instance++);
+				++current;
+				if (!is_batch || current >= count)
+					break;
 
-					++itr_current;
-				}
-			}
-		}// I[܂Ń[v
+				const MainData& next = m_main_path_list[sorted[current].index];
+				if (next.queue != head.queue ||
+					!next.can_batching ||
+					next.material_hash != head.material_hash ||
+					next.mesh_hash != head.mesh_hash ||
+					next.subset_idx != head.subset_idx)
+					break;
+			} while (true);
+		}
 
 		// Unmap
 		m_instance_buffer.Unmap(dc_z);
@@ -587,7 +558,7 @@ namespace TKGEngine
 
 		ID3D11DeviceContext* dc_shadow = IGraphics::Get().DC(0, Graphics::DC_RENDER_PATH::DC_RP_SHADOW);
 		// `悳郉Cg̉e`悷
-		LightManager::RenderShadow(dc_shadow);
+		LightManager::RenderShadow(dc_shadow, m_shadow_path_list);
 	}
 
 	// --------------------------------------------------------------------------
@@ -595,33 +566,35 @@ namespace TKGEngine
 	// --------------------------------------------------------------------------
 	// https://wp.kazto.dev/2018/05/08/stdsort%E3%81%AB%E6%B8%A1%E3%81%99%E6%AF%94%E8%BC%83%E9%96%A2%E6%95%B0%E3%81%AE%E3%80%8Cstrict-weak-ordering%E3%80%8D%E3%83%AB%E3%83%BC%E3%83%AB%E3%81%AB%E3%81%A4%E3%81%84%E3%81%A6/
 #pragma region Sort func
-	bool RendererManager::SortMain_DoRender(const MainData& left, const MainData& right)
-	{
-		return left.do_render == false && right.do_render == true;
-	}
-	bool RendererManager::SortMain_Queue(const MainData& left, const MainData& right)
-	{
-		return left.queue < right.queue;
-	}
-	bool RendererManager::SortMain_Distance(const MainData& left, const MainData& right)
+	std::uint64_t RendererManager::CreateMainSortKey(const MainData& data)
 	{
-		return left.distance > right.distance;
-	}
-	bool RendererManager::SortMain_Material(const MainData& left, const MainData& right)
-	{
-		return left.material_hash < right.material_hash;
-	}
-	bool RendererManager::SortMain_Mesh(const MainData& left, const MainData& right)
-	{
-		return left.mesh_hash < right.mesh_hash;
-	}
-	bool RendererManager::SortMain_Subset(const MainData& left, const MainData& right)
-	{
-		return left.subset_idx < right.subset_idx;
-	}
-	bool RendererManager::SortMain_Batching(const MainData& left, const MainData& right)
-	{
-		return left.can_batching == false && right.can_batching == true;
+		const std::uint64_t queue = static_cast<std::uint64_t>((std::min)(data.queue, static_cast<int>(SORT_KEY_QUEUE_MASK)));
+		std::uint64_t key = queue << SORT_KEY_QUEUE_SHIFT;
+
+		// ͉`悷邽ߋ̍~
+		if (data.queue >= RenderQueue::Transparent)
+		{
+			// float̓rbĝ܂ܔrĂ召ςȂ
+			std::uint32_t distance_bits = 0;
+			const float distance = (std::max)(data.distance, 0.0f);
+			std::memcpy(&distance_bits, &distance, sizeof(distance_bits));
+			key |= static_cast<std::uint64_t>(~distance_bits) << SORT_KEY_DISTANCE_SHIFT;
+			return key;
+		}
+
+		// ob`s̂̂ɕ`悷
+		if (data.can_batching)
+		{
+			key |= 1ull << SORT_KEY_BATCHING_SHIFT;
+		}
+		// nbV͏ʃrbgݍŋl߂
+		const std::uint64_t material = (data.material_hash ^ (data.material_hash >> 24)) & SORT_KEY_MATERIAL_MASK;
+		const std::uint64_t mesh = (data.mesh_hash ^ (data.mesh_hash >> 16)) & SORT_KEY_MESH_MASK;
+		const std::uint64_t subset = (std::min)(static_cast<std::uint64_t>(data.subset_idx), SORT_KEY_SUBSET_MASK);
+		key |= material << SORT_KEY_MATERIAL_SHIFT;
+		key |= mesh << SORT_KEY_MESH_SHIFT;
+		key |= subset;
+		return key;
 	}
 
 	bool RendererManager::SortUI_Depth(const UIData& left, const UIData& right)
@@ -5,6 +5,10 @@
 #include "Application/Objects/Components/interface/IRenderer.h"
 #include "Application/Resource/inc/VertexBuffer.h"
 #include "Utility/inc/template_thread.h"
+#include "Utility/inc/myfunc_collision.h"
+#include "Utility/inc/myfunc_sort.h"
+#include "Utility/inc/dynamic_aabb_tree.h"
+#include "Utility/inc/job_system.h"
 
 #include <list>
 #include <vector>
@@ -113,6 +117,8 @@ namespace TKGEngine
 		// private methods
 		// ==============================================
 		static void SetDataList(const std::shared_ptr<ICamera>& camera);
+		// AABBƈꊇ肷
+		static void CullCandidates(const std::shared_ptr<ICamera>& camera);
 		static void AddShadowData(int subset_count, float distance, const std::shared_ptr<IRenderer>& renderer);
 		static void AddMainData(int subset_count, float distance, const std::shared_ptr<IRenderer>& renderer);
 
@@ -123,13 +129,8 @@ namespace TKGEngine
 		// --------------------------------------------------------------------------
 		// Sort Func
 	// --------------------------------------------------------------------------
-		static bool SortMain_DoRender(const MainData& left, const MainData& right);
-		static bool SortMain_Queue(const MainData& left, const MainData& right);
-		static bool SortMain_Distance(const MainData& left, const MainData& right);
-		static bool SortMain_Material(const MainData& left, const MainData& right);
-		static bool SortMain_Mesh(const MainData& left, const MainData& right);
-		static bool SortMain_Subset(const MainData& left, const MainData& right);
-		static bool SortMain_Batching(const MainData& left, const MainData& right);
+		// Queue, ob`\, Material, Mesh, Subset(Queue, )̏ɕ64bit̃L[쐬
+		static std::uint64_t CreateMainSortKey(const MainData& data);
 
 		static bool SortUI_Depth(const UIData& left, const UIData& right);
 		static bool SortUI_Material(const UIData& left, const UIData& right);
@@ -156,6 +157,20 @@ namespace TKGEngine
 		static std::vector<MainData> m_main_path_list;
 		static std::vector<UIData> m_UI_path_list;
 
+		// JOp̌⃊Xg
+		static std::vector<const std::shared_ptr<IRenderer>*> m_culling_candidates;
+		static MyFunc::PackedBounds m_culling_bounds;
+		static std::vector<std::uint8_t> m_culling_results;
+		static JobCounter m_culling_counter;
+
+		// MainpX̃\[gL[Ɗ\[g̍Ɨpobt@
+		static std::vector<MyFunc::SortKey> m_main_sort_keys;
+		static std::vector<MyFunc::SortKey> m_main_sort_work;
+
+		// `̃_[BVH
+		// tuser_datam_shadow_path_list̐擪CfbNX(ẽXgɖ-1)
+		static DynamicAABBTree m_renderer_tree;
+
 		static int m_path_current_data_sizes[static_cast<int>(RenderPath::MAX_RENDER_PATH)];
 		static int m_path_current_data_counts[static_cast<int>(RenderPath::MAX_RENDER_PATH)];
 		static int m_path_prev_data_counts[static_cast<int>(RenderPath::MAX_RENDER_PATH)];
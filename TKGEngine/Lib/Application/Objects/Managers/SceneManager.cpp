@@ -630,7 +630,9 @@ namespace TKGEngine
 			// L[e[uɃZbg
 			m_key_table.emplace(m_current_unique_id, filepath);
 			// V[Xgɓo^
-			m_scene_list.emplace(filepath, std::move(p_new_scene));
+			const auto& scene = m_scene_list.emplace(filepath, std::move(p_new_scene)).first->second;
+			// [h̓V[XgɖANeBuƂĈĂ̂ōXV
+			scene->ApplyActiveToGameObjects();
 		}
 		// [hV[SingleȂ烁CV[ɂ鏈
 		if (!additive)
@@ -1034,6 +1036,14 @@ namespace TKGEngine
 		return m_loading_scene_list.size();
 	}
 
+	bool SceneManager::IsLoadingScene(SceneID scene_id)
+	{
+		const auto itr_find = m_key_table.find(scene_id);
+		if (itr_find == m_key_table.end())
+			return false;
+		return m_loading_scene_list.count(itr_find->second) != 0;
+	}
+
 	int SceneManager::GetUnloadingSceneNum()
 	{
 		return m_unloading_scene_list.size();
@@ -1112,7 +1122,9 @@ namespace TKGEngine
 				const auto loaded_scene_id = itr->second->GetSceneID();
 				const std::string loaded_scene_name = itr->first;
 				// V[Xgmove
-				m_scene_list.emplace(itr->first, std::move(itr->second));
+				const auto& loaded_scene = m_scene_list.emplace(itr->first, std::move(itr->second)).first->second;
+				// [h̓V[XgɖANeBuƂĈĂ̂ōXV
+				loaded_scene->ApplyActiveToGameObjects();
 				// [hXg폜
 				itr = m_loading_scene_list.erase(itr);
 				// CV[ɐݒ
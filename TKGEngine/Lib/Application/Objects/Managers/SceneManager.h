@@ -102,6 +102,8 @@ namespace TKGEngine
 
 		// [hAA[h̃V[
 		static int GetLoadingSceneNum();
+		// 񓯊[h̃V[(fVACYGameObjectQƂȂ悤ɂ̂Ɏgp)
+		static bool IsLoadingScene(SceneID scene_id);
 		static int GetUnloadingSceneNum();
 
 
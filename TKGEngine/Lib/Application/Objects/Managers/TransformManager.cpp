@@ -0,0 +1,319 @@
+#include "TransformManager.h"
+
+#include "Components/inc/CTransform.h"
+#include "Application/Objects/inc/IGameObject.h"
+#include "SceneManager.h"
+
+#ifdef USE_IMGUI
+#include "Systems/inc/IGUI.h"
+#endif // USE_IMGUI
+
+#include <chrono>
+
+namespace TKGEngine
+{
+	////////////////////////////////////////////////////////
+	// Static member definition
+	////////////////////////////////////////////////////////
+	std::unordered_map<int, std::weak_ptr<Transform>> TransformManager::m_transform_index;
+	int TransformManager::m_current_id = 0;
+	bool TransformManager::m_is_hierarchy_changed = true;
+
+	std::shared_ptr<const TransformManager::HierarchyOrder> TransformManager::m_hierarchy_order;
+	int TransformManager::m_dead_transform_num = 0;
+
+	std::mutex TransformManager::m_mutex;
+
+	TransformManager::BenchmarkResult TransformManager::m_benchmark_result;
+
+
+	////////////////////////////////////////////////////////
+	// Class Methods
+	////////////////////////////////////////////////////////
+	int TransformManager::RegisterManager(const std::shared_ptr<Transform>& p_transform)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_transform_index.emplace(++m_current_id, p_transform);
+		m_is_hierarchy_changed = true;
+		return m_current_id;
+	}
+
+	void TransformManager::UnregisterManager(const int id)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const auto itr = m_transform_index.find(id);
+		if (itr == m_transform_index.end())
+			return;
+		// z͍蒼Avfǂݔ΂悤Ɉ
+		// o^ꂽvfUpdateWorldMatricesł܂Ƃ߂ċlߒ
+		const auto s_ptr = itr->second.lock();
+		if (s_ptr)
+		{
+			s_ptr->m_is_unregistered.store(true, std::memory_order_relaxed);
+		}
+		m_transform_index.erase(itr);
+		++m_dead_transform_num;
+	}
+
+	void TransformManager::OnChangeHierarchy()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_is_hierarchy_changed = true;
+	}
+
+	void TransformManager::UpdateWorldMatrices()
+	{
+		// WuWaitɎs鑼̃WuRegisterĂłfbhbNȂ悤ɁA
+		// z̎QƂ擾烍bN
+		std::shared_ptr<const HierarchyOrder> order;
+		bool need_rebuild = false;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			// eq֌WςAo^ꂽvfג
+			need_rebuild =
+				m_is_hierarchy_changed || !m_hierarchy_order ||
+				(m_dead_transform_num > 0 && m_dead_transform_num * COMPACT_DEAD_RATIO >= static_cast<int>(m_hierarchy_order->transforms.size()));
+			order = m_hierarchy_order;
+		}
+		if (need_rebuild)
+		{
+			// Âz̎QƂĂ(RebuildHierarchyOrderŃbN̊Oōs)
+			order.reset();
+			RebuildHierarchyOrder();
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			order = m_hierarchy_order;
+		}
+
+		const int transform_num = static_cast<int>(order->transforms.size());
+		// Ȃ΃WuɕɍXV
+		if (transform_num <= MIN_PARALLEL_TRANSFORM_NUM)
+		{
+			UpdateRange(*order, 0, transform_num);
+			return;
+		}
+
+		// ؒPʂŗvf悻ϓɂȂ悤ɃWuɊU
+		const int thread_num = JobSystem::GetThreadNum();
+		const int chunk_size = (transform_num + thread_num - 1) / thread_num;
+		const HierarchyOrder* p_order = order.get();
+		JobCounter counter;
+		int chunk_begin = 0;
+		for (const auto& range : order->subtree_ranges)
+		{
+			if (range.second - chunk_begin < chunk_size && range.second != transform_num)
+				continue;
+
+			const int begin = chunk_begin;
+			const int end = range.second;
+			JobSystem::Run(counter, [p_order, begin, end]() { UpdateRange(*p_order, begin, end); });
+			chunk_begin = end;
+		}
+		// WȕIҋ@
+		JobSystem::Wait(counter);
+	}
+
+	void TransformManager::RebuildHierarchyOrder()
+	{
+		// [g̎Ŵ݃bNčs
+		std::vector<std::shared_ptr<Transform>> roots;
+		size_t transform_num = 0;
+		int dead_num = 0;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			transform_num = m_transform_index.size();
+			for (const auto& transform_pair : m_transform_index)
+			{
+				auto s_ptr = transform_pair.second.lock();
+				if (s_ptr == nullptr || s_ptr->m_parent != nullptr)
+					continue;
+				roots.emplace_back(std::move(s_ptr));
+			}
+			// WɋNύX͎̃t[ŕג
+			m_is_hierarchy_changed = false;
+			dead_num = m_dead_transform_num;
+		}
+
+		// GameObjectManagerSceneManager̃bNTransformManager̃bNɎȂ悤ɁAbN̊Oŕׂ
+		auto order = std::make_shared<HierarchyOrder>();
+		order->transforms.reserve(transform_num);
+		bool has_loading_root = false;
+		for (const auto& root : roots)
+		{
+			// [h̃V[̃IuWFNg̓[_[XbhqXg쐬̉\
+			const auto s_go = root->GetGameObject();
+			const SceneID scene_id = s_go ? s_go->GetScene() : SceneManager::INVALID_SCENE_INDEX;
+			if (scene_id == SceneManager::INVALID_SCENE_INDEX || SceneManager::IsLoadingScene(scene_id))
+			{
+				has_loading_root = true;
+				continue;
+			}
+
+			// [g畔؂ƂɘAĕׂ
+			const int begin = static_cast<int>(order->transforms.size());
+			RecurseOnPushHierarchy(*order, root);
+			order->subtree_ranges.emplace_back(begin, static_cast<int>(order->transforms.size()));
+		}
+
+		// Âz̉̓bN̊Oōs
+		std::shared_ptr<const HierarchyOrder> released_order;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			released_order = std::move(m_hierarchy_order);
+			m_hierarchy_order = std::move(order);
+			// W_܂łɓo^ꂽ̂͐VzɊ܂܂Ȃ
+			m_dead_transform_num -= dead_num;
+			// [h̃[g΁A[hɊ܂߂邽ߎ̃t[łג
+			m_is_hierarchy_changed = m_is_hierarchy_changed || has_loading_root;
+		}
+	}
+
+	void TransformManager::RecurseOnPushHierarchy(HierarchyOrder& order, const std::shared_ptr<Transform>& transform)
+	{
+		// o^ς݂͎̂̂qȉjȂ̂Ŋ܂߂Ȃ
+		if (transform->m_is_unregistered.load(std::memory_order_relaxed))
+			return;
+		order.transforms.emplace_back(transform);
+
+		if (transform->m_child_count <= 0)
+			return;
+		for (const auto& child : transform->m_children)
+		{
+			const auto s_ptr = child.lock();
+			if (s_ptr == nullptr)
+				continue;
+			RecurseOnPushHierarchy(order, s_ptr);
+		}
+	}
+
+	void TransformManager::UpdateRange(const HierarchyOrder& order, const int begin, const int end)
+	{
+		// eɍXVĂ̂ŁAevf͐ẽLbVQƂ邾ōς
+		for (int i = begin; i < end; ++i)
+		{
+			const auto& transform = order.transforms[i];
+			// o^ς݂̗vf͋lߒ܂œǂݔ΂
+			if (transform->m_is_unregistered.load(std::memory_order_relaxed))
+				continue;
+			transform->UpdateWorldCache();
+		}
+	}
+
+	MATRIX TransformManager::RecurseOnWorldMatrix(const std::shared_ptr<Transform>& transform)
+	{
+		if (!transform->m_parent)
+			return transform->GetAffineTransform();
+		return transform->GetAffineTransform() * RecurseOnWorldMatrix(transform->m_parent);
+	}
+
+	void TransformManager::RunBenchmark()
+	{
+		constexpr int CHAIN_DEPTH = 100;
+		constexpr int FLAT_NUM = 5000;
+		constexpr int LOOP_NUM = 100;
+
+		// 100Kw̐eq`F[({[Kwz)
+		std::vector<std::shared_ptr<Transform>> chain;
+		chain.reserve(CHAIN_DEPTH);
+		for (int i = 0; i < CHAIN_DEPTH; ++i)
+		{
+			const auto transform = IGameObject::Create("Benchmark Chain")->GetTransform();
+			transform->LocalPosition(0.0f, 0.1f, 0.0f);
+			transform->LocalEulerAngles(0.0f, 3.6f, 0.0f);
+			if (!chain.empty())
+			{
+				transform->SetParent(chain.back(), false);
+			}
+			chain.emplace_back(transform);
+		}
+		// eȂ5000Transform(ʓIȃV[z)
+		std::vector<std::shared_ptr<Transform>> flat;
+		flat.reserve(FLAT_NUM);
+		for (int i = 0; i < FLAT_NUM; ++i)
+		{
+			const auto transform = IGameObject::Create("Benchmark Flat")->GetTransform();
+			transform->LocalPosition(static_cast<float>(i), 0.0f, 0.0f);
+			flat.emplace_back(transform);
+		}
+		// rOɃLbVĂ
+		UpdateWorldMatrices();
+
+		// lɕύXȂԂőSvf̃[hsLOOP_NUM擾A1񂠂̎
+		using clock = std::chrono::steady_clock;
+		float sink = 0.0f;
+		const auto measure = [&sink](const std::vector<std::shared_ptr<Transform>>& transforms, const auto& func)
+		{
+			const auto begin = clock::now();
+			for (int loop = 0; loop < LOOP_NUM; ++loop)
+			{
+				for (const auto& transform : transforms)
+				{
+					sink += func(transform)._41;
+				}
+			}
+			const double elapsed_ns = std::chrono::duration<double, std::nano>(clock::now() - begin).count();
+			return elapsed_ns / (static_cast<double>(transforms.size()) * LOOP_NUM);
+		};
+		const auto cached = [](const std::shared_ptr<Transform>& transform) { return transform->GetLocalToWorldMatrix(); };
+		const auto recursive = [](const std::shared_ptr<Transform>& transform) { return RecurseOnWorldMatrix(transform); };
+
+		m_benchmark_result.chain_cached_ns = measure(chain, cached);
+		m_benchmark_result.chain_recursive_ns = measure(chain, recursive);
+		m_benchmark_result.flat_cached_ns = measure(flat, cached);
+		m_benchmark_result.flat_recursive_ns = measure(flat, recursive);
+		// œKŌvZȂ悤Ɍʂc
+		m_benchmark_result.checksum = sink;
+		m_benchmark_result.is_valid = true;
+
+		// 쐬IuWFNgj(`F[̓[g̔jŎqj)
+		chain.front()->GetGameObject()->Destroy(-1.0f);
+		for (const auto& transform : flat)
+		{
+			transform->GetGameObject()->Destroy(-1.0f);
+		}
+	}
+
+#ifdef USE_IMGUI
+	void TransformManager::OnGUI()
+	{
+		ImGui::SetNextWindowSize(ImVec2(320.0f, 140.0f), ImGuiCond_FirstUseEver);
+		if (ImGui::Begin("Transform Benchmark"))
+		{
+			if (ImGui::Button("Run"))
+			{
+				RunBenchmark();
+			}
+			if (m_benchmark_result.is_valid && ImGui::BeginTable("##Transform Benchmark", 3, ImGuiTableFlags_RowBg))
+			{
+				ImGui::TableSetupColumn("Scene");
+				ImGui::TableSetupColumn("Cached(ns)");
+				ImGui::TableSetupColumn("Recursive(ns)");
+				ImGui::TableHeadersRow();
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted("Chain 100");
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", m_benchmark_result.chain_cached_ns);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", m_benchmark_result.chain_recursive_ns);
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted("Flat 5000");
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", m_benchmark_result.flat_cached_ns);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", m_benchmark_result.flat_recursive_ns);
+				ImGui::EndTable();
+			}
+		}
+		ImGui::End();
+	}
+#endif // USE_IMGUI
+
+}// namespace TKGEngine
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Utility/inc/job_system.h"
+#include "Utility/inc/myfunc_vector.h"
+
+#include <unordered_map>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <mutex>
+
+
+namespace TKGEngine
+{
+	class Transform;
+
+	/// <summary>
+	/// Management Transform hierarchy order and batched world matrix update.
+	/// </summary>
+	class TransformManager
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		static int RegisterManager(const std::shared_ptr<Transform>& p_transform);
+		static void UnregisterManager(int id);
+
+		// eq֌WύXꂽqGL[̔z蒼
+		static void OnChangeHierarchy();
+
+		// qGL[ɕׂz𑖍ă[hsꊇXV
+		// z擾烍bNĂWusAҋ@
+		static void UpdateWorldMatrices();
+
+		// 100Kw̐eq`F[5000̐eȂTransformŁALbVg擾Ɛeǂ擾r
+		static void RunBenchmark();
+#ifdef USE_IMGUI
+		static void OnGUI();
+#endif // USE_IMGUI
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		/* nothing */
+
+
+	private:
+		// ==============================================
+		// private struct
+		// ==============================================
+		/// <summary>
+		/// qGL[ɕׂTransformz(쐬͕ύXȂ)
+		/// </summary>
+		struct HierarchyOrder
+		{
+			// eqOɗ悤ɕׂTransformz
+			// XVɓo^ĂQƂ؂Ȃ悤ɏL
+			std::vector<std::shared_ptr<Transform>> transforms;
+			// ݂ɓƗ([gP)͈̔ [begin, end)
+			std::vector<std::pair<int, int>> subtree_ranges;
+		};
+
+		/// <summary>
+		/// RunBenchmarǩ(1̎擾[ns])
+		/// </summary>
+		struct BenchmarkResult
+		{
+			double chain_cached_ns = 0.0;
+			double chain_recursive_ns = 0.0;
+			double flat_cached_ns = 0.0;
+			double flat_recursive_ns = 0.0;
+			// vZœKŏȂ悤ɕێ
+			float checksum = 0.0f;
+			bool is_valid = false;
+		};
+
+
+		// ==============================================
+		// private methods
+		// ==============================================
+		// eqOɗ悤Ƀ[g[Dŕג
+		// [h̃V[̃[g͊܂߂Ãt[ōĂѕג
+		// [g̎Ŵ݃bNčsAGameObjectV[̎QƂ̓bN̊Oōs
+		static void RebuildHierarchyOrder();
+		static void RecurseOnPushHierarchy(HierarchyOrder& order, const std::shared_ptr<Transform>& transform);
+		// [begin, end)͈̔͂̃[hs擪珇ɍXV
+		static void UpdateRange(const HierarchyOrder& order, int begin, int end);
+		// LbVg킸ɐeǂă[hs߂(RunBenchmark̔rp)
+		static MATRIX RecurseOnWorldMatrix(const std::shared_ptr<Transform>& transform);
+
+
+		//==============================================
+		//private variables
+		//==============================================
+		// Transform̎QƃXg
+		static std::unordered_map<int, std::weak_ptr<Transform>> m_transform_index;
+		// unique ID
+		static int m_current_id;
+		// qGL[̔z̍蒼Kv
+		static bool m_is_hierarchy_changed;
+
+		// qGL[̔z(XV̂̂͌ĂяoQƂێ)
+		static std::shared_ptr<const HierarchyOrder> m_hierarchy_order;
+		// zɎcĂo^ς݂̗vf(̊𒴂lߒ)
+		static int m_dead_transform_num;
+
+		// ̃}l[W[mutex
+		static std::mutex m_mutex;
+		// ̐ȉȂWuɕɍXV
+		static constexpr int MIN_PARALLEL_TRANSFORM_NUM = 1024;
+		// z̗vfɑ΂ēo^ς݂̗vf̊(1/n)ȏɂȂlߒ
+		static constexpr int COMPACT_DEAD_RATIO = 4;
+
+		// ORunBenchmarǩ
+		static BenchmarkResult m_benchmark_result;
+	};
+}// namespace TKGEngine
@@ -1,6 +1,7 @@
 #include "DirectionalLightShadow.h"
 
 #include "Utility/inc/myfunc_collision.h"
+#include "Utility/inc/dynamic_aabb_tree.h"
 
 #include "Components/interface/IRenderer.h"
 
@@ -9,16 +10,16 @@ namespace TKGEngine
 	void DirectionalLightShadow::FindCasters(
 		const std::vector<MainData>& scene_objects,
 		const int object_num,
+		const DynamicAABBTree& caster_tree,
 		const std::shared_ptr<ICamera>& camera,
 		const LightShadowData& data,
 		const Frustum& frustum,
 		bool test_accurate,
-		std::vector<MainData>& casters
+		std::vector<std::uint32_t>& casters
 	)
 	{
-		// ̃NAƃTCY
+		// Ot[̗eʂ͂̂܂܎g
 		casters.clear();
-		casters.reserve(object_num);
 
 		// GcȔ莞ɎgptX^AABB
 		Bounds frustum_aabb;
@@ -27,30 +28,42 @@ namespace TKGEngine
 			frustum_aabb = frustum.GetAABB();
 		}
 
-		for (int i = 0; i < object_num; ++i)
+		// eXg
+		const auto sweep_test = [&](const Bounds& aabb)
 		{
-			const auto& obj = scene_objects.at(i);
-
-			// nullptr`FbN
-			if (!obj.renderer)
-				continue;
-
-			// eXg
+			// AABB vs Frustum
 			if (test_accurate)
+				return MyFunc::SweepIntersectionTest(aabb, frustum, data.light_direction);
+			// AABB vs Frustum.AABB
+			return MyFunc::SweepIntersectionTest(aabb, frustum_aabb, data.light_direction);
+		};
+
+		// m[hAABB͎q܂̂ŁAm[hŊOꂽ؂͑SĊO
+		caster_tree.Query(
+			sweep_test,
+			[&](const int start, const Bounds&)
 			{
-				// AABB vs Frustum
-				if (!MyFunc::SweepIntersectionTest(obj.renderer->GetRendererBounds(), frustum, data.light_direction))
-					continue;
-			}
-			else
-			{
-				// AABB vs Frustum.AABB
-				if (!MyFunc::SweepIntersectionTest(obj.renderer->GetRendererBounds(), frustum_aabb, data.light_direction))
-					continue;
+				// t[̃Xgɖ_[
+				if (start < 0 || start >= object_num)
+					return;
+
+				const auto& renderer = scene_objects[start].renderer;
+				// nullptr`FbN
+				if (!renderer)
+					return;
+
+				// tfat AABBȂ̂ŐmAABBōăeXg
+				if (!sweep_test(renderer->GetRendererBounds()))
+					return;
+
+				// _[̃TuZbg͘Aċl߂Ă
+				// MainDataRs[shared_ptr̎QƃJEgXbhԂŒD̂ŃCfbNX
+				for (int i = start; i < object_num && scene_objects[i].renderer == renderer; ++i)
+				{
+					casters.emplace_back(static_cast<std::uint32_t>(i));
+				}
 			}
-			// ̂l߂
-			casters.emplace_back(obj);
-		}
+		);
 	}
 
 }
@@ -28,15 +28,16 @@ namespace TKGEngine
 		/// <param name="data">eoCg̏</param>
 		/// <param name="frustum">tX^</param>
 		/// <param name="test_accurate">eXg̐m</param>
-		/// <param name="casters">e𗎂ƂIuWFNgXg</param>
+		/// <param name="casters">e𗎂ƂIuWFNgscene_objectsCfbNX</param>
 		virtual void FindCasters(
 			const std::vector<MainData>&scene_objects,
 			const int object_num,
+			const DynamicAABBTree& caster_tree,
 			const std::shared_ptr<ICamera>&camera,
 			const LightShadowData& data,
 			const Frustum& frustum,
 			bool test_accurate,
-			std::vector<MainData>& casters
+			std::vector<std::uint32_t>& casters
 		) override;
 		
 
@@ -3,6 +3,9 @@
 #include "Systems/inc/TKGEngine_Defined.h"
 #include "Application/Objects/inc/Light_Defined.h"
 
+#include <vector>
+#include <cstdint>
+
 struct ID3D11DeviceContext;
 
 namespace TKGEngine
@@ -10,6 +13,7 @@ namespace TKGEngine
 	struct MainData;
 	class ICamera;
 	class Frustum;
+	class DynamicAABBTree;
 
 	/// <summary>
 	/// LightނɉVhĚvZ񋟂x[XNX
@@ -30,19 +34,21 @@ namespace TKGEngine
 		/// </summary>
 		/// <param name="scene_objects">e`悷IuWFNgXg</param>
 		/// <param name="object_num">IuWFNgXg̃IuWFNg</param>
+		/// <param name="caster_tree">_[BVH(tscene_objects̐擪CfbNX)</param>
 		/// <param name="camera">`撆̃J̎Q</param>
 		/// <param name="data">eoCg̏</param>
 		/// <param name="frustum">tX^</param>
 		/// <param name="test_accurate">eXg̐m</param>
-		/// <param name="casters">e𗎂ƂIuWFNgXg</param>
+		/// <param name="casters">e𗎂ƂIuWFNgscene_objectsCfbNX(eʂ͍ėp)</param>
 		virtual void FindCasters(
 			const std::vector<MainData>& scene_objects,
 			const int object_num,
+			const DynamicAABBTree& caster_tree,
 			const std::shared_ptr<ICamera>& camera,
 			const LightShadowData& data,
 			const Frustum& frustum,
 			bool test_accurate,
-			std::vector<MainData>& casters
+			std::vector<std::uint32_t>& casters
 		) = 0;
 
 
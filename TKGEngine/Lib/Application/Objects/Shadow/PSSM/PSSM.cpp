@@ -1,10 +1,12 @@
 #include "PSSM.h"
 
 #include "Components/interface/ICamera.h"
+#include "Utility/inc/dynamic_aabb_tree.h"
 #include "Systems/inc/IGraphics.h"
 
 #include "Application/Resource/inc/VertexBuffer.h"
 #include "Systems/inc/IGUI.h"
+#include "Utility/inc/cpu_profiler.h"
 
 // VhE}bv̉𑜓x
 static constexpr unsigned SHADOW_TEXTURE_SIZE[MAX_CASCADE] = { 2048, 1024, 512, 512 };
@@ -15,8 +17,7 @@ namespace TKGEngine
 	PSSM::PSSM(LightType type)
 		: ShadowMapBase(type)
 	{
-		// Xbh̃TCYm
-		m_thread_result.reserve(MAX_CASCADE);
+		/* nothing */
 	}
 
 #ifdef USE_IMGUI
@@ -140,7 +141,7 @@ namespace TKGEngine
 		}
 	}
 
-	int PSSM::CalculateShadowCaster(const std::vector<MainData>& scene_objects, const int object_num, const std::shared_ptr<ICamera>& camera, const LightShadowData& data)
+	int PSSM::CalculateShadowCaster(const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera, const LightShadowData& data)
 	{
 		// evZpNXȂΑ^[
 		if (m_light_shadow_calculator == nullptr)
@@ -160,10 +161,8 @@ namespace TKGEngine
 
 			// Ot[̏ێ
 			m_is_rendered_target[i] = caster.empty() ? false : true;
-			// IuWFNgXg̃NA
+			// IuWFNgXg̃NA(eʂ͎̃t[łg)
 			caster.clear();
-			// XgTCYIuWFNg̍ő吔ɍ킹
-			caster.reserve(object_num);
 		}
 
 		// Cgr[s̍쐬
@@ -172,23 +171,19 @@ namespace TKGEngine
 		CalculateSplitPosition(camera->GetNear(), data.far_plane);
 		// ̃tX^Ƃɕ`悳IuWFNgXg̍쐬SplitViewProjectioňvZ
 		{
-			const auto calculate_func =
-				[&](int index, const MATRIX& LV, const std::vector<MainData>& objs, int num, const std::shared_ptr<ICamera>& cam, const LightShadowData& d)
-			{
-				CalculateSplitLVP(index, LV, objs, num, cam, d);
-			};
-			for (int i = 0; i < m_cascade_num; ++i)
-			{
-				m_thread_result.emplace_back(m_calculate_split_LVP_thread.Add(calculate_func, i, light_view, scene_objects, object_num, camera, data));
-			}
+			// ƂɃWuƂČvZ
+			JobCounter counter;
+			JobSystem::ParallelFor(counter, m_cascade_num, 1,
+				[this, &light_view, &scene_objects, object_num, &caster_tree, &camera, &data](const int begin, const int end)
+				{
+					CPU_PROFILE_SCOPE("PSSM::CalculateSplitLVP");
+					for (int i = begin; i < end; ++i)
+					{
+						CalculateSplitLVP(i, light_view, scene_objects, object_num, caster_tree, camera, data);
+					}
+				});
 			// Iҋ@
-			for (const auto& result : m_thread_result)
-			{
-				if (!result.valid())
-					continue;
-				result.wait();
-			}
-			m_thread_result.clear();
+			JobSystem::Wait(counter);
 		}
 		// LVPCBufferXV
 		for (int i = 0; i < MAX_CASCADE; ++i)
@@ -214,7 +209,7 @@ namespace TKGEngine
 		return instance_count;
 	}
 
-	void PSSM::RenderShadow(ID3D11DeviceContext* context, VertexBuffer& instance_buffer)
+	void PSSM::RenderShadow(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects, VertexBuffer& instance_buffer)
 	{
 		// RTVZbg
 		{
@@ -235,9 +230,9 @@ namespace TKGEngine
 			// CasterɎ擾ăCX^Xl߂
 			for (const auto& casters : m_casters)
 			{
-				for (const auto& data : casters)
+				for (const auto caster_idx : casters)
 				{
-					data.renderer->SetInstance(instance++);
+					scene_objects[caster_idx].renderer->SetInstance(instance++);
 				}
 			}
 			// Unmap
@@ -263,8 +258,9 @@ namespace TKGEngine
 				// RTṼZbg
 				context->OMSetRenderTargets(1, &rtv, m_depth_targets[i]->GetDSV());
 				// Caster`
-				for (const auto& data : casters)
+				for (const auto caster_idx : casters)
 				{
+					const auto& data = scene_objects[caster_idx];
 					data.renderer->RenderShadow(context, data.subset_idx, instance_count++, 1, instance_buffer);
 				}
 			}
@@ -399,7 +395,7 @@ namespace TKGEngine
 		m_split_positions[m_cascade_num] = far_plane;
 	}
 
-	Bounds PSSM::CalculateCasterAABBInLightViewSpace(const std::vector<MainData>& casters, const Frustum& frustum, const MATRIX& light_view)
+	Bounds PSSM::CalculateCasterAABBInLightViewSpace(const std::vector<MainData>& scene_objects, const std::vector<std::uint32_t>& casters, const Frustum& frustum, const MATRIX& light_view)
 	{
 		Bounds casters_aabb;
 
@@ -413,12 +409,7 @@ namespace TKGEngine
 		else
 		{
 			// Cgr[ԂɂCasterAABB̍
-			casters_aabb = casters.at(0).renderer->GetRendererBounds().Transform(light_view);
-			const size_t caster_num = casters.size();
-			for (size_t i = 1; i < caster_num; ++i)
-			{
-				casters_aabb.Union(casters.at(i).renderer->GetRendererBounds().Transform(light_view));
-			}
+			casters_aabb = UnionCasterBounds(scene_objects, casters, light_view);
 		}
 
 		return casters_aabb;
@@ -449,7 +440,7 @@ namespace TKGEngine
 		return light_proj;
 	}
 
-	void PSSM::FixLightViewProjectionMatrix(const Frustum& split_frustum, const std::vector<MainData>& casters, MATRIX& view, MATRIX& proj, MATRIX& view_proj)
+	void PSSM::FixLightViewProjectionMatrix(const Frustum& split_frustum, const std::vector<MainData>& scene_objects, const std::vector<std::uint32_t>& casters, MATRIX& view, MATRIX& proj, MATRIX& view_proj)
 	{
 		const MATRIX LVP = view * proj;
 
@@ -464,12 +455,7 @@ namespace TKGEngine
 			return;
 		}
 		// CasterLVPϊAABB߂
-		Bounds caster_aabb = casters.at(0).renderer->GetRendererBounds().Transform(LVP);
-		const size_t caster_num = casters.size();
-		for (size_t i = 1; i < caster_num; ++i)
-		{
-			caster_aabb.Union(casters.at(i).renderer->GetRendererBounds().Transform(LVP));
-		}
+		Bounds caster_aabb = UnionCasterBounds(scene_objects, casters, LVP);
 		// CasterAABBX,Y0̎͗]
 		{
 			constexpr float EXTENT_EPSILON = 0.1f;
@@ -559,47 +545,69 @@ namespace TKGEngine
 		view_proj = view * proj;
 	}
 
-	void PSSM::CalculateCastersWithLVP(const std::vector<MainData>& scene_objects, const int object_num, std::vector<MainData>& casters, MATRIX& view, MATRIX& proj, MATRIX& LVP)
+	void PSSM::CalculateCastersWithLVP(const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, std::vector<std::uint32_t>& casters, MATRIX& view, MATRIX& proj, MATRIX& LVP)
 	{
 		// ݂̃LX^[NA
 		casters.clear();
 		
-		// V[̃IuWFNgSă`FbN
-		bool need_fix = false;
-		float crop_min_z = 0.0f;
-		for (int i = 0; i < object_num; ++i)
+		// NbsOԂ͈͓̔`FbN
+		const auto clip_test = [&LVP](const Bounds& aabb, VECTOR3& min)
 		{
-			const auto& obj = scene_objects.at(i);
-
-			// nullptr`FbN
-			if (!obj.renderer)
-				continue;
-
-			// IuWFNgAABBLVPŕϊ
-			const Bounds obj_aabb = obj.renderer->GetRendererBounds().Transform(LVP);
-			// NbsOԂ͈͓̔`FbN
-			const VECTOR3 center = obj_aabb.GetCenter();
-			const VECTOR3 half_size = obj_aabb.GetExtents();
-			const VECTOR3 min = center - half_size;
+			// AABBLVPŕϊ
+			const Bounds clip_aabb = aabb.Transform(LVP);
+			const VECTOR3 center = clip_aabb.GetCenter();
+			const VECTOR3 half_size = clip_aabb.GetExtents();
+			min = center - half_size;
 			const VECTOR3 max = center + half_size;
 			// X : ( -1.0, +1.0)
 			if (max.x < -1.0f || min.x > 1.0f)
-				continue;
+				return false;
 			// Y : ( -1.0, +1.0)
 			if (max.y < -1.0f || min.y > 1.0f)
-				continue;
+				return false;
 			// Z : ( 0.0, 1.0)
 			if (min.z > 1.0f)
-				continue;
-			// Z0.0菬ꍇ͍sCKv
-			if (min.z < 0.0f)
+				return false;
+			return true;
+		};
+
+		// BVHŔ͈͓̃IuWFNg`FbN
+		bool need_fix = false;
+		float crop_min_z = 0.0f;
+		caster_tree.Query(
+			[&clip_test](const Bounds& node_aabb)
 			{
-				need_fix = true;
-				crop_min_z = MyMath::Min(crop_min_z, min.z);
+				VECTOR3 min;
+				return clip_test(node_aabb, min);
+			},
+			[&](const int start, const Bounds&)
+			{
+				// t[̃Xgɖ_[
+				if (start < 0 || start >= object_num)
+					return;
+
+				const auto& renderer = scene_objects[start].renderer;
+				// nullptr`FbN
+				if (!renderer)
+					return;
+
+				// tfat AABBȂ̂ŐmAABBōăeXg
+				VECTOR3 min;
+				if (!clip_test(renderer->GetRendererBounds(), min))
+					return;
+				// Z0.0菬ꍇ͍sCKv
+				if (min.z < 0.0f)
+				{
+					need_fix = true;
+					crop_min_z = MyMath::Min(crop_min_z, min.z);
+				}
+				// ͈͓Ȃ̂ŃLX^[ɒǉ(_[̃TuZbg͘AĂ)
+				for (int i = start; i < object_num && scene_objects[i].renderer == renderer; ++i)
+				{
+					casters.emplace_back(static_cast<std::uint32_t>(i));
+				}
 			}
-			// ͈͓Ȃ̂ŃLX^[ɒǉ
-			casters.emplace_back(obj);
-		}
+		);
 		// sCKvȂC
 		if(need_fix)
 		{
@@ -610,24 +618,41 @@ namespace TKGEngine
 		}
 	}
 
-	void PSSM::CalculateSplitLVP(const int index, const MATRIX& light_view, const std::vector<MainData>& scene_objects, const int object_num, const std::shared_ptr<ICamera>& camera, const LightShadowData& data)
+	Bounds PSSM::UnionCasterBounds(const std::vector<MainData>& scene_objects, const std::vector<std::uint32_t>& casters, const MATRIX& matrix)
+	{
+		const IRenderer* prev_renderer = scene_objects[casters.front()].renderer.get();
+		Bounds union_aabb = prev_renderer->GetRendererBounds().Transform(matrix);
+		const size_t caster_num = casters.size();
+		for (size_t i = 1; i < caster_num; ++i)
+		{
+			// TuZbg͓_[ŘAĂ̂ŁAς
+			const IRenderer* renderer = scene_objects[casters[i]].renderer.get();
+			if (renderer == prev_renderer)
+				continue;
+			union_aabb.Union(renderer->GetRendererBounds().Transform(matrix));
+			prev_renderer = renderer;
+		}
+		return union_aabb;
+	}
+
+	void PSSM::CalculateSplitLVP(const int index, const MATRIX& light_view, const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera, const LightShadowData& data)
 	{
 		// ̃tX^
 		const Frustum split_frustum = camera->GetFrustum(m_split_positions[index], m_split_positions[index + 1]);
 		// ̃tX^ɉe𗎂ƂIuWFNgXgT
-		m_light_shadow_calculator->FindCasters(scene_objects, object_num, camera, data, split_frustum, m_test_accurate, m_casters[index]);
+		m_light_shadow_calculator->FindCasters(scene_objects, object_num, caster_tree, camera, data, split_frustum, m_test_accurate, m_casters[index]);
 		// Cgr[Ԃł̃LX^[AABBvZ
-		const Bounds caster_aabb = CalculateCasterAABBInLightViewSpace(m_casters[index], split_frustum, light_view);
+		const Bounds caster_aabb = CalculateCasterAABBInLightViewSpace(scene_objects, m_casters[index], split_frustum, light_view);
 		// Cgr[vWFNVvZ
 		m_split_view_matrices[index] = light_view;
 		m_split_projection_matrices[index] = CalculateLightProjectionMatrix(caster_aabb, data);
 		// NbvsgăCgr[vWFNVsC
-		FixLightViewProjectionMatrix(split_frustum, m_casters[index], m_split_view_matrices[index], m_split_projection_matrices[index], m_split_view_projection_matrices[index]);
+		FixLightViewProjectionMatrix(split_frustum, scene_objects, m_casters[index], m_split_view_matrices[index], m_split_projection_matrices[index], m_split_view_projection_matrices[index]);
 		// LX^[LVP쐬Ăꍇ
 		if (!m_casters[index].empty())
 		{
 			// ŏIILVPŃLX^[TĕKvview,projectionC
-			CalculateCastersWithLVP(scene_objects, object_num, m_casters[index], m_split_view_matrices[index], m_split_projection_matrices[index], m_split_view_projection_matrices[index]);
+			CalculateCastersWithLVP(scene_objects, object_num, caster_tree, m_casters[index], m_split_view_matrices[index], m_split_projection_matrices[index], m_split_view_projection_matrices[index]);
 		}
 		// Reversed-ZKp
 		m_split_projection_matrices[index] *= MATRIX::Reversed_Z;
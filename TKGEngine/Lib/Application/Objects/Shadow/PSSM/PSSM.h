@@ -4,7 +4,7 @@
 #include "Application/Resource/inc/Shader_Defined.h"
 #include "Application/Resource/inc/ITarget.h"
 #include "Application/Resource/inc/ConstantBuffer.h"
-#include "Utility/inc/template_thread.h"
+#include "Utility/inc/job_system.h"
 
 namespace TKGEngine
 {
@@ -29,9 +29,9 @@ namespace TKGEngine
 		virtual void Create() override;
 
 		// e`悷IuWFNgvZ
-		virtual int CalculateShadowCaster(const std::vector<MainData>& scene_objects, int object_num, const std::shared_ptr<ICamera>& camera, const LightShadowData& data) override;
+		virtual int CalculateShadowCaster(const std::vector<MainData>& scene_objects, int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera, const LightShadowData& data) override;
 		// Shadow`
-		virtual void RenderShadow(ID3D11DeviceContext* context, VertexBuffer& instance_buffer) override;
+		virtual void RenderShadow(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects, VertexBuffer& instance_buffer) override;
 		// \[XZbg
 		virtual void SetSRV(ID3D11DeviceContext* context, int slot, int index = 0) const override;
 		// CgsԂ
@@ -92,7 +92,8 @@ namespace TKGEngine
 		void CalculateSplitPosition(float near_plane, float far_plane);
 		// Cgr[Ԃł̉e𗎂ƂIuWFNgŏŎ܂AABBvZ (IuWFNg݂ȂȂtX^AABBԂ)
 		Bounds CalculateCasterAABBInLightViewSpace(
-			const std::vector<MainData>& casters,
+			const std::vector<MainData>& scene_objects,
+			const std::vector<std::uint32_t>& casters,
 			const Frustum& frustum,
 			const MATRIX& light_view
 		);
@@ -100,13 +101,15 @@ namespace TKGEngine
 		MATRIX CalculateLightProjectionMatrix(const Bounds& caster_aabb, const LightShadowData& data);
 
 		// NbvAABBɓK悤ɃCgr[sƃCgvWFNVsC
-		void FixLightViewProjectionMatrix(const Frustum& split_frustum, const std::vector<MainData>& casters, MATRIX& view, MATRIX& proj, MATRIX& LVP);
+		void FixLightViewProjectionMatrix(const Frustum& split_frustum, const std::vector<MainData>& scene_objects, const std::vector<std::uint32_t>& casters, MATRIX& view, MATRIX& proj, MATRIX& LVP);
 		// NbvAABBɍ悤ɍsC
 		void AdjustCropAABB(const Bounds& crop_aabb, MATRIX& view, MATRIX& proj, MATRIX& LVP);
 		// ŏIILVPŃLX^[߂
-		void CalculateCastersWithLVP(const std::vector<MainData>& scene_objects, const int object_num, std::vector<MainData>& casters, MATRIX& view, MATRIX& proj, MATRIX& LVP);
+		void CalculateCastersWithLVP(const std::vector<MainData>& scene_objects, const int object_num, const DynamicAABBTree& caster_tree, std::vector<std::uint32_t>& casters, MATRIX& view, MATRIX& proj, MATRIX& LVP);
+		// LX^[AABBsŕϊč(_[̃TuZbg1񂾂ϊ)
+		static Bounds UnionCasterBounds(const std::vector<MainData>& scene_objects, const std::vector<std::uint32_t>& casters, const MATRIX& matrix);
 		// ͈͂ƂLVP߂
-		void CalculateSplitLVP(int index, const MATRIX& light_view, const std::vector<MainData>& scene_objects, int object_num, const std::shared_ptr<ICamera>& camera, const LightShadowData& data);
+		void CalculateSplitLVP(int index, const MATRIX& light_view, const std::vector<MainData>& scene_objects, int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera, const LightShadowData& data);
 
 
 		// ==============================================
@@ -122,8 +125,8 @@ namespace TKGEngine
 		std::unique_ptr<IDepthTarget> m_depth_targets[MAX_CASCADE];
 		// LVPpCBuffer
 		ConstantBuffer m_cb_LVPs[MAX_CASCADE];
-		// ̉e𗎂ƂIuWFNgXg
-		std::vector<MainData> m_casters[MAX_CASCADE];
+		// ̉e𗎂ƂIuWFNgscene_objectsCfbNX(t[ׂŗeʂėp)
+		std::vector<std::uint32_t> m_casters[MAX_CASCADE];
 		// ̃Cgs
 		MATRIX m_split_view_projection_matrices[MAX_CASCADE];
 		MATRIX m_split_view_matrices[MAX_CASCADE];
@@ -144,10 +147,6 @@ namespace TKGEngine
 		// TvO
 		float m_sampling_radius_uv = 1.0f;
 		int m_sampling_count = 1;
-
-		// SplitƂɌvZ邽߂̃Xbh
-		ThreadPool m_calculate_split_LVP_thread = ThreadPool(MAX_CASCADE);
-		std::vector<std::future<void>> m_thread_result = std::vector<std::future<void>>();
 	};
 }
 
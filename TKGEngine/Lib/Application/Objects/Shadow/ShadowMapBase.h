@@ -10,6 +10,7 @@ struct ID3D11DeviceContext;
 namespace TKGEngine
 {
 	class ICamera;
+	class DynamicAABBTree;
 
 	/// <summary>
 	/// ShadowMap̃x[XNX
@@ -35,9 +36,9 @@ namespace TKGEngine
 		virtual void Create() = 0;
 
 		// e`悷IuWFNgvZA`JEgԂ
-		virtual int CalculateShadowCaster(const std::vector<MainData>& scene_objects, int object_num, const std::shared_ptr<ICamera>& camera, const LightShadowData& data) = 0;
-		// Shadow`
-		virtual void RenderShadow(ID3D11DeviceContext* context, VertexBuffer& instance_buffer) = 0;
+		virtual int CalculateShadowCaster(const std::vector<MainData>& scene_objects, int object_num, const DynamicAABBTree& caster_tree, const std::shared_ptr<ICamera>& camera, const LightShadowData& data) = 0;
+		// Shadow`(scene_objectsCalculateShadowCasterɓn̂ƓXg)
+		virtual void RenderShadow(ID3D11DeviceContext* context, const std::vector<MainData>& scene_objects, VertexBuffer& instance_buffer) = 0;
 		// \[XZbg
 		virtual void SetSRV(ID3D11DeviceContext* context, int slot, int index = 0) const = 0;
 		// CgsԂ
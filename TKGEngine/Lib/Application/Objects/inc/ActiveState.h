@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+
+namespace TKGEngine
+{
+	// ==============================================
+	// GameObject̎IȃANeBu
+	// GameObjectLAA^b`ꂽComponentLĎQƂ
+	// ݂SetActiveAV[̃ANeBu؂ւ݂̂ŁAǂݍ݂̓bNȂ
+	// ==============================================
+	struct ActiveState
+	{
+		// GameObject::GetActiveHierarchy()Ɠl
+		std::atomic<bool> is_active_hierarchy = true;
+		// V[ANeBu
+		std::atomic<bool> is_active_scene = false;
+
+		bool IsActiveHierarchy() const
+		{
+			return is_active_hierarchy.load(std::memory_order_relaxed);
+		}
+		bool IsActiveScene() const
+		{
+			return is_active_scene.load(std::memory_order_relaxed);
+		}
+		bool IsActive() const
+		{
+			return IsActiveHierarchy() && IsActiveScene();
+		}
+	};
+
+}
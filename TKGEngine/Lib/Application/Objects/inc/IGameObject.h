@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Object.h"
+#include "ActiveState.h"
 #include "Managers/ComponentManager.h"
 
 #include "Application/inc/ProjectSetting.h"
@@ -63,6 +64,8 @@ namespace TKGEngine
 		virtual void SetActive(bool is_active) = 0;
 		virtual bool GetActiveSelf() const = 0;
 		virtual bool GetActiveHierarchy() const = 0;
+		// ComponentƋLANeBu
+		virtual const std::shared_ptr<ActiveState>& GetActiveState() const = 0;
 
 		virtual Tag GetTag() const = 0;
 		virtual void SetTag(Tag tag) = 0;
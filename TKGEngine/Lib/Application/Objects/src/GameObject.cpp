@@ -42,6 +42,7 @@ namespace TKGEngine
 		void SetActive(bool is_active) override;
 		bool GetActiveSelf() const override;
 		bool GetActiveHierarchy() const override;
+		const std::shared_ptr<ActiveState>& GetActiveState() const override;
 
 		void SetTag(Tag tag) override;
 		Tag GetTag() const override;
@@ -74,6 +75,7 @@ namespace TKGEngine
 					CEREAL_NVP(m_tag),
 					CEREAL_NVP(m_layer)
 				);
+				m_active_state->is_active_hierarchy.store(m_is_active, std::memory_order_relaxed);
 				// A^b`ꂽComponentXgManagerɓo^
 				archive(
 					cereal::make_nvp("ComponentNameList", ComponentManager::GetComponentNameList(GetGameObjectID()))
@@ -128,6 +130,8 @@ namespace TKGEngine
 		bool m_active_self = true;
 		bool m_active_hierarchy = true;
 		bool m_is_active = true;
+		// ComponentbNɎQƂ邽߂̏
+		std::shared_ptr<ActiveState> m_active_state = std::make_shared<ActiveState>();
 
 		GameObjectID m_gameObject_id = 0;
 		std::weak_ptr<Transform> m_transform;
@@ -465,6 +469,7 @@ namespace TKGEngine
 		}
 		// Vis_activeZbg
 		m_is_active = new_active;
+		m_active_state->is_active_hierarchy.store(new_active, std::memory_order_relaxed);
 		
 		// V[ANeBuȂOnEnable,OnDisableĂ
 		if(is_scene_active)
@@ -521,6 +526,11 @@ namespace TKGEngine
 		return m_is_active;
 	}
 
+	const std::shared_ptr<ActiveState>& GameObject::GetActiveState() const
+	{
+		return m_active_state;
+	}
+
 	void GameObject::SetTag(Tag tag)
 	{
 		m_tag = tag;
@@ -553,6 +563,7 @@ namespace TKGEngine
 			return;
 		// g̏V[ύX
 		m_scene_id = scene_id;
+		m_active_state->is_active_scene.store(SceneManager::GetActive(scene_id), std::memory_order_relaxed);
 		// gȉ̏V[ύX
 		const auto p_tr = GetTransform();
 		RecurseOnSetScene(p_tr, scene_id);
@@ -577,6 +588,7 @@ namespace TKGEngine
 	void GameObject::RecurseSetScene(SceneID scene_id)
 	{
 		m_scene_id = scene_id;
+		m_active_state->is_active_scene.store(SceneManager::GetActive(scene_id), std::memory_order_relaxed);
 	}
 
 }// namespace TKGEngine
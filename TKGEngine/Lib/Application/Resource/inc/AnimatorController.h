@@ -4,6 +4,7 @@
 #include "../src/AnimatorController/Animation_Defined.h"
 #include "../src/AnimatorController/Animator_State.h"
 #include "../src/AnimatorController/Animator_ControllerLayer.h"
+#include "../src/AnimatorController/Animator_Instance.h"
 
 #include <string>
 #include <vector>
@@ -13,7 +14,11 @@
 namespace TKGEngine
 {
 	class IResAnimatorController;
+	class Avatar;
 
+	/// <summary>
+	/// t@C̃Rg[[͋LAp[^ƍĐԂ̓CX^XƂɎ
+	/// </summary>
 	class AnimatorController
 	{
 	public:
@@ -29,6 +34,8 @@ namespace TKGEngine
 		void OnGUI(const GameObjectID goid, const std::vector<std::string>* bone_names);
 #endif // USE_IMGUI
 
+		static void RemoveUnused();
+
 		void Create();	// \[X}l[W[ɃZbgȂ쐬
 		void LoadAsync(const std::string& filename);
 		void Load(const std::string& filename);
@@ -40,7 +47,15 @@ namespace TKGEngine
 		int GetParameterCount() const;
 		void AddParameter(const std::string& param_name, Animations::AnimatorControllerParameter::Type type);
 		void RemoveParameter(const std::string& param_name);
-		std::shared_ptr<Animations::AnimatorControllerParameter> GetParameter(const std::string& param_name);
+		// p[^Ɋ蓖ĂID(XNvgŕێĖȎɎgpł)
+		// ̃p[^̒ǉA폜▼OA^̕ύXł͕ς炸A폜ꂽp[^ID͖ɂȂ
+		// 񓯊[h܂łINVALID_PARAMETER_IDԂ߁A
+		// ێꍇ͖lȂ擾
+		Animations::ParameterID GetParameterID(const std::string& param_name) const;
+		// ̃CX^X̃p[^(Ȃnullptr)
+		// p[^̒ǉA폜AO̕ύXō蒼邽߁A|C^̓t[܂ŕێȂ
+		Animations::AnimatorControllerParameter* GetParameter(const std::string& param_name);
+		Animations::AnimatorControllerParameter* GetParameter(Animations::ParameterID id);
 
 		std::shared_ptr<Animations::AnimatorControllerLayer> AddLayer(const std::string& layer_name);
 		void RemoveLayer(const std::string& layer_name);
@@ -58,6 +73,20 @@ namespace TKGEngine
 		float GetFloat(const std::string& param_name);
 		void ResetTrigger(const std::string& param_name);
 
+		// IDwp[^̌^قȂƂ͏܂Ȃ
+		void SetBool(Animations::ParameterID id, bool param);
+		void SetInteger(Animations::ParameterID id, int param);
+		void SetFloat(Animations::ParameterID id, float param);
+		void SetTrigger(Animations::ParameterID id);
+
+		bool GetBool(Animations::ParameterID id);
+		int GetInteger(Animations::ParameterID id);
+		float GetFloat(Animations::ParameterID id);
+		void ResetTrigger(Animations::ParameterID id);
+
+		// Jڏuhc[QƂp[^̗vfԍXV(CXbhŌĂ)
+		void ResolveParameterIDs();
+
 		bool IsLoaded() const;
 		bool HasController() const;
 		const char* GetName() const;
@@ -65,10 +94,13 @@ namespace TKGEngine
 
 		unsigned GetHash() const;
 
+		// Aj[VLOD̐ݒ(Rg[Ȃ΃ftHgl)
+		const Animations::AnimatorLODSettings& GetLODSettings() const;
+
 		void ApplyAnimationTransform(
 			const GameObjectID goid,
 			const float elapsed_time,
-			const std::unordered_map<std::string, int>* node_index,
+			const Avatar& avatar,
 			const std::vector<int>& enable_nodes,
 			std::vector<Animations::KeyData>& data
 		);
@@ -82,12 +114,15 @@ namespace TKGEngine
 		// ==============================================
 		// private methods
 		// ==============================================
-
+		// ĐԂLRg[[̍\ɍ킹
+		bool SyncInstance();
 
 		// ==============================================
 		// private variables
 		// ==============================================
 		std::shared_ptr<IResAnimatorController> m_res_controller = nullptr;
+		// AnimatorControllerŗL̃p[^ƍĐ
+		std::shared_ptr<Animations::AnimatorControllerInstance> m_instance = nullptr;
 	};
 
 }	// namespace TKGEngine
\ No newline at end of file
@@ -5,7 +5,20 @@
 namespace TKGEngine
 {
 	static constexpr int g_max_num_system_deque_size = 2000;
-	static constexpr int g_max_num_asset_load_threads = 1;
+	// [hXbh̏ (ۂ̐̓n[hEFAɍ킹Č߂)
+	static constexpr int g_max_num_asset_load_threads = 8;
+
+	/// <summary>
+	/// Enumurate priority of async loading asset data
+	/// </summary>
+	enum class ASSET_LOAD_PRIORITY
+	{
+		ASSET_LOAD_PRIORITY_VISIBLE = 0,	// ɕ\Ɏg
+		ASSET_LOAD_PRIORITY_PREFETCH,		// ǂ
+		ASSET_LOAD_PRIORITY_BACKGROUND,		// }Ȃ
+
+		ASSET_LOAD_PRIORITY_MAX
+	};
 
 	/// <summary>
 	/// Enumurate state of async loading asset data
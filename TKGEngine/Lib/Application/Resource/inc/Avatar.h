@@ -43,6 +43,8 @@ namespace TKGEngine
 		const Node* GetNode(const std::string& bone_name);
 		const std::unordered_map<std::string, int>* GetNodeIndex() const;
 		const std::vector<std::string>* GetAlignedBoneNames() const;
+		// リソースの生存期間と結びついた識別子(保持している間は他のAvatarと一致しない)
+		std::weak_ptr<const void> GetIdentity() const;
 
 		bool IsLoaded() const;
 		bool HasAvatar() const;
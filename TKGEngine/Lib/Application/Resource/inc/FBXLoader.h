@@ -53,6 +53,8 @@ namespace TKGEngine
 			bool load_avatar = true;
 			bool load_mesh = true;
 			bool load_motion = true;
+			// [Vkďo
+			bool compress_motion = false;
 
 			struct MeshData
 			{
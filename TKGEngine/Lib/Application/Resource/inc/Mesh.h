@@ -35,9 +35,13 @@ namespace TKGEngine
 		void operator=(const Mesh&);
 
 		static void RemoveUnused();
+#ifdef USE_IMGUI
+		// `.mesht@Cϊ
+		static bool ConvertBinary(const std::string& filepath);
+#endif// USE_IMGUI
 
 		void Load(const std::string& filename);
-		void LoadAsync(const std::string& filename);
+		void LoadAsync(const std::string& filename, ASSET_LOAD_PRIORITY priority = ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_PREFETCH);
 		void Create();
 
 		void Release();
@@ -6,12 +6,14 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
 
 #include <memory>
 
 namespace TKGEngine::Animations
 {
 	struct KeyData;
+	struct AvatarBinding;
 }// namespace TKGEngine::Animations
 
 namespace TKGEngine
@@ -33,7 +35,7 @@ namespace TKGEngine
 		static void RemoveUnused();
 
 		void Load(const std::string& filename);
-		void LoadAsync(const std::string& filename);
+		void LoadAsync(const std::string& filename, ASSET_LOAD_PRIORITY priority = ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_PREFETCH);
 
 		void Release();
 
@@ -49,7 +51,11 @@ namespace TKGEngine
 		unsigned GetHash() const;
 
 		std::vector<Animations::KeyData>* GetKeyFrame(const int frame) const;
+		void SampleKeyFrame(float key, const std::vector<std::int16_t>& remap_table, std::vector<Animations::KeyData>& dst) const;
+		const std::vector<Animations::KeyData>* GetReferenceKeyFrame() const;
+		bool IsCompressed() const;
 		std::unordered_map<std::string, int>* GetKeyIndex() const;
+		const std::vector<std::int16_t>* GetRemapTable(const Animations::AvatarBinding& avatar) const;
 		
 
 		// ==============================================
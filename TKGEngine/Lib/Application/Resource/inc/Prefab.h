@@ -0,0 +1,75 @@
+#pragma once
+#include "Systems/inc/TKGEngine_Defined.h"
+
+#include "Application/Resource/inc/Asset_Defined.h"
+
+#include <string>
+#include <vector>
+
+#include <memory>
+
+namespace TKGEngine
+{
+	class IResPrefab;
+	class IGameObject;
+
+	/// <summary>
+	/// .objectt@CJԂGameObject쐬邽߂̃ev[g
+	/// </summary>
+	class Prefab
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		Prefab(const Prefab&) = delete;
+
+		Prefab() = default;
+		virtual ~Prefab() = default;
+		Prefab& operator=(const Prefab&);
+
+		static void RemoveUnused();
+		// .objectt@C̏㏑ɌĂсAȍ~̃[hœǂݒ
+		static void RemoveCache(const std::string& filename);
+
+		void Load(const std::string& filename);
+		void LoadAsync(const std::string& filename, ASSET_LOAD_PRIORITY priority = ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_PREFETCH);
+
+		void Release();
+
+		// CV[ɍ쐬
+		std::shared_ptr<IGameObject> Instantiate() const;
+		std::shared_ptr<IGameObject> Instantiate(const int scene_idx) const;
+		// parent̎qƂč쐬
+		std::shared_ptr<IGameObject> Instantiate(const std::shared_ptr<IGameObject>& parent) const;
+		// count܂Ƃ߂č쐬Adst̖ɒǉ
+		void InstantiateMany(const int count, std::vector<std::shared_ptr<IGameObject>>& dst) const;
+		void InstantiateMany(const int count, const int scene_idx, std::vector<std::shared_ptr<IGameObject>>& dst) const;
+
+		bool IsLoaded() const;
+		bool HasPrefab() const;
+		const char* GetName() const;
+		const char* GetFilepath() const;
+
+		unsigned GetHash() const;
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+
+
+	private:
+		// ==============================================
+		// private methods
+		// ==============================================
+
+
+		// ==============================================
+		// private variables
+		// ==============================================
+		std::shared_ptr<IResPrefab> m_res_prefab = nullptr;
+	};
+
+
+}	// namespace TKGEngine
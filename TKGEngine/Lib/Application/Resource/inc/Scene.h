@@ -47,6 +47,8 @@ namespace TKGEngine
 
 		[[nodiscard]] bool GetActive() const;
 		void SetActive(bool is_active) const;
+		// GameObject̃V[̃ANeBuԂXV
+		void ApplyActiveToGameObjects() const;
 
 		SceneID GetSceneID() const;
 
@@ -33,8 +33,13 @@ namespace TKGEngine
 #define MAX_BONES (200)
 #define MAX_BONE_INFLUENCES (4)
 	// Cgݒ
+	// VhE}bvƃCg}XÑXbgĂX|bgCg
 #define MAX_SPOTLIGHT (8)
-#define MAX_POINTLIGHT (8)
+	// Cg蓖ĂNX^[̕(XY͉ʂ̃^CAZ͐[x̎w)
+#define CLUSTER_NUM_X (16)
+#define CLUSTER_NUM_Y (9)
+#define CLUSTER_NUM_Z (24)
+#define CLUSTER_NUM (CLUSTER_NUM_X * CLUSTER_NUM_Y * CLUSTER_NUM_Z)
 	// VhEݒ
 #define MAX_CASCADE (4)
 
@@ -197,6 +202,12 @@ namespace TKGEngine
 #define TEXSLOT_SPOT_MASK6		76
 #define TEXSLOT_SPOT_MASK7		77
 
+// Clustered Light
+#define TEXSLOT_CLUSTER_POINT_LIGHTS	80
+#define TEXSLOT_CLUSTER_SPOT_LIGHTS		81
+#define TEXSLOT_CLUSTER_RANGES			82
+#define TEXSLOT_CLUSTER_LIGHT_INDICES	83
+
 // ==================================================================
 // Skinning
 // ==================================================================
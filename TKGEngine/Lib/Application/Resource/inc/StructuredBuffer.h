@@ -34,6 +34,9 @@ namespace TKGEngine
 		void Release();
 
 		//bool Resize(int stride_size, int row_count, const void* p_data);
+		// 先頭からrow_count個の要素を書き換える
+		void Update(ID3D11DeviceContext* p_context, const void* p_data, int row_count);
+		int GetRowCount() const;
 
 		void SetSRV(ID3D11DeviceContext* p_context, int slot, ShaderVisibility visibility);
 		void SetUAV(ID3D11DeviceContext* p_context, int slot);
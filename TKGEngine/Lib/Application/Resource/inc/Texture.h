@@ -3,6 +3,7 @@
 #include "Systems/inc/TKGEngine_Defined.h"
 #include "Application/Resource/inc/Shader_Defined.h"
 #include "Texture_Defined.h"
+#include "Asset_Defined.h"
 
 #include <memory>
 #include <string>
@@ -37,7 +38,7 @@ namespace TKGEngine
 		void OnGUI();
 #endif // USE_IMGUI
 
-		void LoadAsync(const std::string& filename, bool force_srgb = false);
+		void LoadAsync(const std::string& filename, bool force_srgb = false, ASSET_LOAD_PRIORITY priority = ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_PREFETCH);
 		void Load(const std::string& filename, bool force_srgb = false);
 		void SetForceSRGB(bool force_srgb);
 		bool GetForceSRGB() const;
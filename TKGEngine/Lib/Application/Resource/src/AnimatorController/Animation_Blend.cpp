@@ -0,0 +1,123 @@
+
+#include "Animation_Blend.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace TKGEngine::Animations
+{
+	void BlendKeyFrame(const std::vector<KeyData>& v1, const std::vector<KeyData>& v2, const float ratio, std::vector<KeyData>& dst, const bool use_nlerp)
+	{
+		using namespace DirectX;
+
+		const size_t v1_size = v1.size();
+		const size_t v2_size = v2.size();
+		assert(v1_size == v2_size);
+		assert(v1_size <= dst.size());
+
+		const KeyData* p_key_1 = v1.data();
+		const KeyData* p_key_2 = v2.data();
+		KeyData* p_dst = dst.data();
+
+		// sړƃXP[VECTOR3::LerpƓNvȂ
+		const XMVECTOR T = XMVectorReplicate(ratio);
+		// ]Quaternion::SlerpƓ0 ~ 1ɃNv
+		const XMVECTOR T_ROT = XMVectorSaturate(T);
+
+		// ʕ(VECTOR3::Lerp, Quaternion::SlerpƓʂɂȂ)
+		if (!use_nlerp)
+		{
+			for (size_t i = 0; i < v1_size; ++i)
+			{
+				// dstv1, v2z̏ꍇ̂őSēǂݍł珑
+				const XMVECTOR T1 = XMLoadFloat3(&p_key_1[i].translate);
+				const XMVECTOR T2 = XMLoadFloat3(&p_key_2[i].translate);
+				const XMVECTOR S1 = XMLoadFloat3(&p_key_1[i].scale);
+				const XMVECTOR S2 = XMLoadFloat3(&p_key_2[i].scale);
+				const XMVECTOR R1 = XMLoadFloat4(&p_key_1[i].rotate);
+				const XMVECTOR R2 = XMLoadFloat4(&p_key_2[i].rotate);
+
+				XMStoreFloat3(&p_dst[i].translate, XMVectorLerpV(T1, T2, T));
+				XMStoreFloat3(&p_dst[i].scale, XMVectorLerpV(S1, S2, T));
+				XMStoreFloat4(&p_dst[i].rotate, XMQuaternionNormalize(XMQuaternionSlerpV(R1, R2, T_ROT)));
+			}
+		}
+		// K`
+		else
+		{
+			const XMVECTOR ZERO = XMVectorZero();
+			for (size_t i = 0; i < v1_size; ++i)
+			{
+				const XMVECTOR T1 = XMLoadFloat3(&p_key_1[i].translate);
+				const XMVECTOR T2 = XMLoadFloat3(&p_key_2[i].translate);
+				const XMVECTOR S1 = XMLoadFloat3(&p_key_1[i].scale);
+				const XMVECTOR S2 = XMLoadFloat3(&p_key_2[i].scale);
+				const XMVECTOR R1 = XMLoadFloat4(&p_key_1[i].rotate);
+				XMVECTOR R2 = XMLoadFloat4(&p_key_2[i].rotate);
+				// ŒZoHŕԂ悤ɕ킹
+				R2 = XMVectorSelect(R2, XMVectorNegate(R2), XMVectorLess(XMVector4Dot(R1, R2), ZERO));
+
+				XMStoreFloat3(&p_dst[i].translate, XMVectorLerpV(T1, T2, T));
+				XMStoreFloat3(&p_dst[i].scale, XMVectorLerpV(S1, S2, T));
+				XMStoreFloat4(&p_dst[i].rotate, XMQuaternionNormalize(XMVectorLerpV(R1, R2, T_ROT)));
+			}
+		}
+	}
+
+	void BlendKeyFrameWeighted(
+		const std::vector<KeyData>* const* src,
+		const float* weights,
+		const int src_num,
+		std::vector<KeyData>& dst
+	)
+	{
+		using namespace DirectX;
+
+		assert(src_num > 0);
+		const size_t key_num = src[0]->size();
+		assert(key_num <= dst.size());
+
+		// d݂̍vŐK
+		float total_weight = 0.0f;
+		for (int n = 0; n < src_num; ++n)
+		{
+			assert(src[n]->size() == key_num);
+			total_weight += weights[n];
+		}
+		if (total_weight <= 0.0f)
+		{
+			std::copy(src[0]->begin(), src[0]->end(), dst.begin());
+			return;
+		}
+		const float rcp_total_weight = 1.0f / total_weight;
+
+		const XMVECTOR ZERO = XMVectorZero();
+		const KeyData* p_src_0 = src[0]->data();
+		KeyData* p_dst = dst.data();
+		for (size_t i = 0; i < key_num; ++i)
+		{
+			// 1ڂ̃f[^̉]ɍŒZoHɂȂ悤킹
+			const XMVECTOR R0 = XMLoadFloat4(&p_src_0[i].rotate);
+
+			XMVECTOR T = ZERO;
+			XMVECTOR S = ZERO;
+			XMVECTOR R = ZERO;
+			for (int n = 0; n < src_num; ++n)
+			{
+				const KeyData& key = (*src[n])[i];
+				const XMVECTOR W = XMVectorReplicate(weights[n] * rcp_total_weight);
+
+				T = XMVectorMultiplyAdd(XMLoadFloat3(&key.translate), W, T);
+				S = XMVectorMultiplyAdd(XMLoadFloat3(&key.scale), W, S);
+				XMVECTOR Rn = XMLoadFloat4(&key.rotate);
+				Rn = XMVectorSelect(Rn, XMVectorNegate(Rn), XMVectorLess(XMVector4Dot(R0, Rn), ZERO));
+				R = XMVectorMultiplyAdd(Rn, W, R);
+			}
+
+			XMStoreFloat3(&p_dst[i].translate, T);
+			XMStoreFloat3(&p_dst[i].scale, S);
+			XMStoreFloat4(&p_dst[i].rotate, XMQuaternionNormalize(R));
+		}
+	}
+
+}// namespace TKGEngine::Animations
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Animation_Defined.h"
+
+#include <vector>
+
+namespace TKGEngine::Animations
+{
+	/// <summary>
+	/// 2̃Aj[VŃuh
+	/// use_nlerpfalseȂVECTOR3::Lerp, Quaternion::SlerpƓʂɂȂ
+	/// use_nlerptrueȂ]ʕԂ̑ɐK`Ԃŋߎ(ŒZoHɂȂ悤킹)
+	/// </summary>
+	void BlendKeyFrame(
+		const std::vector<KeyData>& v1,
+		const std::vector<KeyData>& v2,
+		const float ratio,
+		std::vector<KeyData>& dst,
+		const bool use_nlerp = false
+	);
+
+	/// <summary>
+	/// ̃Aj[Vd݂1xɃuh(]͐K`)
+	/// d݂͍vŐK
+	/// </summary>
+	void BlendKeyFrameWeighted(
+		const std::vector<KeyData>* const* src,
+		const float* weights,
+		const int src_num,
+		std::vector<KeyData>& dst
+	);
+
+}// namespace TKGEngine::Animations
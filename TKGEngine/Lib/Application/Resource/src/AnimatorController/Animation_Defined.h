@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <memory>
+#include <cfloat>
 
 namespace TKGEngine::Animations
 {
@@ -17,6 +19,26 @@ namespace TKGEngine::Animations
 	// ubNwȂ̃ubNindex
 	constexpr int INVALID_BLOCK_INDEX = -1;
 
+	// Rg[̃p[^wID(ʂXbgԍAʂXbg̐)
+	// Xbg̓p[^̒ǉɊ蓖ĂAO^ύXĂςȂ
+	// 폜ꂽXbg͐i߂čėp邽߁A폜OIDʂ̃p[^wƂ͂Ȃ
+	using ParameterID = int;
+	// p[^wȂID
+	constexpr ParameterID INVALID_PARAMETER_ID = -1;
+
+	constexpr unsigned PARAMETER_ID_SLOT_BITS = 16;
+	constexpr ParameterID PARAMETER_ID_SLOT_MASK = (1 << PARAMETER_ID_SLOT_BITS) - 1;
+	constexpr std::uint32_t PARAMETER_ID_GENERATION_MASK = (1u << (31 - PARAMETER_ID_SLOT_BITS)) - 1;
+
+	constexpr ParameterID MakeParameterID(const int slot, const std::uint32_t generation)
+	{
+		return static_cast<ParameterID>((generation & PARAMETER_ID_GENERATION_MASK) << PARAMETER_ID_SLOT_BITS) | (slot & PARAMETER_ID_SLOT_MASK);
+	}
+	constexpr int GetParameterSlot(const ParameterID id)
+	{
+		return id & PARAMETER_ID_SLOT_MASK;
+	}
+
 	// {[̃f[^1
 	struct KeyData
 	{
@@ -80,6 +102,23 @@ namespace TKGEngine::Animations
 		}
 	};
 
+	/// <summary>
+	/// ĐɎgpAvatar({[ϊe[u̍쐬ƌɎgp)
+	/// </summary>
+	struct AvatarBinding
+	{
+		// Avatar̃\[X(weak_ptrŕێĂԂ͑AvatarƈvȂʎqɂȂ)
+		std::weak_ptr<const void> owner;
+		// {[Avatar̃m[hԍւmap
+		const std::unordered_map<std::string, int>* node_index = nullptr;
+
+		// AvatarwĂ邩
+		bool IsSame(const std::weak_ptr<const void>& other) const
+		{
+			return !owner.owner_before(other) && !other.owner_before(owner);
+		}
+	};
+
 	/// <summary>
 	/// XNvgƃRg[Ԃ̘AgɎgpf[^\
 	/// </summary>
@@ -97,6 +136,7 @@ namespace TKGEngine::Animations
 		bool default_bool = false;
 		float default_float = 0.0f;
 		int default_int = 0;
+		ParameterID id = INVALID_PARAMETER_ID;	//!< 蓖ĂꂽID(VACYȂ)
 
 #ifdef USE_IMGUI
 		void OnGUI()
@@ -180,6 +220,38 @@ namespace TKGEngine::Animations
 		}
 	};
 
+	// Op[^IDT(ȂINVALID_PARAMETER_ID)
+	inline ParameterID FindParameterID(const std::unordered_map<std::string, ParameterID>& parameter_ids, const std::string& name)
+	{
+		const auto itr_find = parameter_ids.find(name);
+		return itr_find == parameter_ids.end() ? INVALID_PARAMETER_ID : itr_find->second;
+	}
+
+	// IDwp[^擾(͈͊OA폜ĐオقȂȂnullptr)
+	inline AnimatorControllerParameter* GetParameterByID(std::vector<AnimatorControllerParameter>& parameters, const ParameterID id)
+	{
+		if (id < 0 || GetParameterSlot(id) >= static_cast<int>(parameters.size()))
+			return nullptr;
+		AnimatorControllerParameter& param = parameters[GetParameterSlot(id)];
+		return param.id == id ? &param : nullptr;
+	}
+	inline const AnimatorControllerParameter* GetParameterByID(const std::vector<AnimatorControllerParameter>& parameters, const ParameterID id)
+	{
+		if (id < 0 || GetParameterSlot(id) >= static_cast<int>(parameters.size()))
+			return nullptr;
+		const AnimatorControllerParameter& param = parameters[GetParameterSlot(id)];
+		return param.id == id ? &param : nullptr;
+	}
+
+	// IDwFloatp[^̒l擾(Ȃ^ႤƂdefault_value)
+	inline float GetFloatParameter(const std::vector<AnimatorControllerParameter>& parameters, const ParameterID id, const float default_value)
+	{
+		const AnimatorControllerParameter* param = GetParameterByID(parameters, id);
+		if (!param || param->type != AnimatorControllerParameter::Type::Float)
+			return default_value;
+		return param->default_float;
+	}
+
 	/// <summary>
 	/// AnimationJڂwp\
 	/// </summary>
@@ -209,6 +281,7 @@ namespace TKGEngine::Animations
 		Mode mode = Mode::If;		//!< ̃[h
 		float threshold = 0.0f;		//!< trueɂȂ邽߂AnimatorParameter臒l
 		std::string parameter_name;	//!< JڏŎgpp[^
+		ParameterID parameter_id = INVALID_PARAMETER_ID;	//!< parameter_name犄蓖ĂꂽID(VACYȂ)
 
 		AnimatorCondition() = default;
 		AnimatorCondition(Mode mode_, float threshold_, const std::string& name_)
@@ -257,6 +330,105 @@ namespace TKGEngine::Animations
 		Max_WrapMode
 	};
 
+	/// <summary>
+	/// Animator̍XViK(Aj[VLOD)
+	/// </summary>
+	enum class AnimatorUpdateTier
+	{
+		Full,		// t[]
+		Reduced,	// Ԋuĕ]AԂ̃t[͕Ԃ
+		Minimum,	// Ԋuĕ]A]t[|[YƃAj[VsXV
+		Frozen,		// ]s̍XVȂ
+		Max_AnimatorUpdateTier
+	};
+
+	/// <summary>
+	/// Rg[Ƃ̃Aj[VLOD̐ݒ
+	/// J̋ƉʃTCŶAႢ̒iKgp
+	/// </summary>
+	struct AnimatorLODSettings
+	{
+		bool use_lod = false;
+		// eiKɂȂJ̋
+		float reduced_distance = 20.0f;
+		float minimum_distance = 50.0f;
+		float frozen_distance = 150.0f;
+		// eiKɂȂʂ̍ɑ΂傫(菬Ƃ̒iKɂȂ)
+		float reduced_screen_size = 0.2f;
+		float minimum_screen_size = 0.05f;
+		float frozen_screen_size = 0.005f;
+		// Rg[]Ԋu(t[)
+		int reduced_interval = 2;
+		int minimum_interval = 4;
+		// Õt[ŕ`悳ȂƂ̒iK̉
+		AnimatorUpdateTier invisible_tier = AnimatorUpdateTier::Minimum;
+
+		// ƉʃTCYiKI
+		AnimatorUpdateTier SelectTier(const float distance, const float screen_size) const
+		{
+			AnimatorUpdateTier tier = AnimatorUpdateTier::Full;
+			if (distance >= frozen_distance || screen_size < frozen_screen_size)
+				tier = AnimatorUpdateTier::Frozen;
+			else if (distance >= minimum_distance || screen_size < minimum_screen_size)
+				tier = AnimatorUpdateTier::Minimum;
+			else if (distance >= reduced_distance || screen_size < reduced_screen_size)
+				tier = AnimatorUpdateTier::Reduced;
+			return tier;
+		}
+
+#ifdef USE_IMGUI
+		void OnGUI()
+		{
+			ImGui::PushID(this);
+			ImGui::Checkbox("Use LOD", &use_lod);
+			if (use_lod)
+			{
+				ImGui::Text("Distance");
+				ImGui::DragFloat("Reduced##Distance", &reduced_distance, 0.1f, 0.0f, FLT_MAX);
+				ImGui::DragFloat("Minimum##Distance", &minimum_distance, 0.1f, reduced_distance, FLT_MAX);
+				ImGui::DragFloat("Frozen##Distance", &frozen_distance, 0.1f, minimum_distance, FLT_MAX);
+				ImGui::Text("Screen Size");
+				ImGui::DragFloat("Reduced##Screen", &reduced_screen_size, 0.001f, minimum_screen_size, 1.0f);
+				ImGui::DragFloat("Minimum##Screen", &minimum_screen_size, 0.001f, frozen_screen_size, reduced_screen_size);
+				ImGui::DragFloat("Frozen##Screen", &frozen_screen_size, 0.001f, 0.0f, minimum_screen_size);
+				ImGui::Text("Interval(frame)");
+				ImGui::DragInt("Reduced##Interval", &reduced_interval, 0.05f, 1, 30);
+				ImGui::DragInt("Minimum##Interval", &minimum_interval, 0.05f, reduced_interval, 60);
+				ImGui::Text("Invisible");
+				constexpr const char* tier_names[] = { "Full", "Reduced", "Minimum", "Frozen" };
+				int current_tier = static_cast<int>(invisible_tier);
+				if (ImGui::Combo("##Invisible tier", &current_tier, tier_names, static_cast<int>(AnimatorUpdateTier::Max_AnimatorUpdateTier)))
+				{
+					invisible_tier = static_cast<AnimatorUpdateTier>(current_tier);
+				}
+			}
+			ImGui::PopID();
+		}
+#endif // USE_IMGUI
+
+	private:
+		friend class cereal::access;
+		template <class Archive>
+		void serialize(Archive& archive, const std::uint32_t version)
+		{
+			//if (version > 0)
+			{
+				archive(
+					CEREAL_NVP(use_lod),
+					CEREAL_NVP(reduced_distance),
+					CEREAL_NVP(minimum_distance),
+					CEREAL_NVP(frozen_distance),
+					CEREAL_NVP(reduced_screen_size),
+					CEREAL_NVP(minimum_screen_size),
+					CEREAL_NVP(frozen_screen_size),
+					CEREAL_NVP(reduced_interval),
+					CEREAL_NVP(minimum_interval),
+					CEREAL_NVP(invisible_tier)
+				);
+			}
+		}
+	};
+
 
 
 }// namespace TKGEngine::Animations
@@ -269,4 +441,6 @@ CEREAL_CLASS_VERSION(TKGEngine::Animations::Animation, 1)
 
 CEREAL_CLASS_VERSION(TKGEngine::Animations::AnimatorControllerParameter, 1)
 
-CEREAL_CLASS_VERSION(TKGEngine::Animations::AnimatorCondition, 1)
\ No newline at end of file
+CEREAL_CLASS_VERSION(TKGEngine::Animations::AnimatorCondition, 1)
+
+CEREAL_CLASS_VERSION(TKGEngine::Animations::AnimatorLODSettings, 1)
\ No newline at end of file
@@ -2,6 +2,9 @@
 #include "../../inc/AnimatorController.h"
 
 #include "IResAnimatorController.h"
+#include "../../inc/Avatar.h"
+
+#include <cassert>
 
 namespace TKGEngine
 {
@@ -12,29 +15,38 @@ namespace TKGEngine
 	void AnimatorController::OnGUI(const GameObjectID goid, const std::vector<std::string>* bone_names)
 	{
 		if (m_res_controller)
-			m_res_controller->OnGUI(goid, bone_names);
+			m_res_controller->OnGUI(goid, bone_names, m_instance.get());
 	}
 #endif // USE_IMGUI
 
 	AnimatorController& AnimatorController::operator=(const AnimatorController& anim_controller)
 	{
 		m_res_controller = anim_controller.m_res_controller;
+		m_instance = anim_controller.m_instance;
 		return *this;
 	}
 
+	void AnimatorController::RemoveUnused()
+	{
+		IResAnimatorController::RemoveUnused();
+	}
+
 	void AnimatorController::Create()
 	{
 		m_res_controller = IResAnimatorController::Create();
+		m_instance = std::make_shared<Animations::AnimatorControllerInstance>();
 	}
 
 	void AnimatorController::LoadAsync(const std::string& filename)
 	{
 		m_res_controller = IResAnimatorController::LoadAsync(filename);
+		m_instance = std::make_shared<Animations::AnimatorControllerInstance>();
 	}
 
 	void AnimatorController::Load(const std::string& filename)
 	{
 		m_res_controller = IResAnimatorController::Load(filename);
+		m_instance = std::make_shared<Animations::AnimatorControllerInstance>();
 	}
 
 	void AnimatorController::Release()
@@ -44,6 +56,7 @@ namespace TKGEngine
 			m_res_controller->Release();
 		}
 		m_res_controller.reset();
+		m_instance.reset();
 	}
 
 	std::shared_ptr<Animations::AnimatorState> AnimatorController::AddMotion(const std::string& motion_filepath)
@@ -68,9 +81,22 @@ namespace TKGEngine
 			m_res_controller->RemoveParameter(param_name);
 	}
 
-	std::shared_ptr<Animations::AnimatorControllerParameter> AnimatorController::GetParameter(const std::string& param_name)
+	Animations::ParameterID AnimatorController::GetParameterID(const std::string& param_name) const
 	{
-		return m_res_controller == nullptr ? nullptr : m_res_controller->GetParameter(param_name);
+		return m_res_controller == nullptr ? Animations::INVALID_PARAMETER_ID : m_res_controller->GetParameterID(param_name);
+	}
+
+	Animations::AnimatorControllerParameter* AnimatorController::GetParameter(const std::string& param_name)
+	{
+		return GetParameter(GetParameterID(param_name));
+	}
+
+	Animations::AnimatorControllerParameter* AnimatorController::GetParameter(const Animations::ParameterID id)
+	{
+		if (!SyncInstance())
+			return nullptr;
+
+		return Animations::GetParameterByID(m_instance->parameters, id);
 	}
 
 	std::shared_ptr<Animations::AnimatorControllerLayer> AnimatorController::AddLayer(const std::string& layer_name)
@@ -102,47 +128,150 @@ namespace TKGEngine
 
 	void AnimatorController::SetBool(const std::string& param_name, bool param)
 	{
-		if (m_res_controller)
-			m_res_controller->SetBool(param_name, param);
+		SetBool(GetParameterID(param_name), param);
 	}
 
 	void AnimatorController::SetInteger(const std::string& param_name, int param)
 	{
-		if (m_res_controller)
-			m_res_controller->SetInteger(param_name, param);
+		SetInteger(GetParameterID(param_name), param);
 	}
 
 	void AnimatorController::SetFloat(const std::string& param_name, float param)
 	{
-		if (m_res_controller)
-			m_res_controller->SetFloat(param_name, param);
+		SetFloat(GetParameterID(param_name), param);
 	}
 
 	void AnimatorController::SetTrigger(const std::string& param_name)
 	{
-		if (m_res_controller)
-			m_res_controller->SetTrigger(param_name);
+		SetTrigger(GetParameterID(param_name));
 	}
 
 	bool AnimatorController::GetBool(const std::string& param_name)
 	{
-		return m_res_controller == nullptr ? false : m_res_controller->GetBool(param_name);
+		return GetBool(GetParameterID(param_name));
 	}
 
 	int AnimatorController::GetInteger(const std::string& param_name)
 	{
-		return m_res_controller == nullptr ? 0 : m_res_controller->GetInteger(param_name);
+		return GetInteger(GetParameterID(param_name));
 	}
 
 	float AnimatorController::GetFloat(const std::string& param_name)
 	{
-		return m_res_controller == nullptr ? 0.f : m_res_controller->GetFloat(param_name);
+		return GetFloat(GetParameterID(param_name));
 	}
 
 	void AnimatorController::ResetTrigger(const std::string& param_name)
 	{
-		if (m_res_controller)
-			m_res_controller->ResetTrigger(param_name);
+		ResetTrigger(GetParameterID(param_name));
+	}
+
+	void AnimatorController::SetBool(const Animations::ParameterID id, bool param)
+	{
+		const auto parameter = GetParameter(id);
+		if (!parameter)
+			return;
+		// ^̈Ⴄp[^ɂ͏܂Ȃ
+		if (parameter->type != Animations::AnimatorControllerParameter::Type::Bool)
+		{
+			assert(0 && "type mismatch AnimatorController::SetBool()");
+			return;
+		}
+		parameter->default_bool = param;
+	}
+
+	void AnimatorController::SetInteger(const Animations::ParameterID id, int param)
+	{
+		const auto parameter = GetParameter(id);
+		if (!parameter)
+			return;
+		// ^̈Ⴄp[^ɂ͏܂Ȃ
+		if (parameter->type != Animations::AnimatorControllerParameter::Type::Int)
+		{
+			assert(0 && "type mismatch AnimatorController::SetInteger()");
+			return;
+		}
+		parameter->default_int = param;
+	}
+
+	void AnimatorController::SetFloat(const Animations::ParameterID id, float param)
+	{
+		const auto parameter = GetParameter(id);
+		if (!parameter)
+			return;
+		// ^̈Ⴄp[^ɂ͏܂Ȃ
+		if (parameter->type != Animations::AnimatorControllerParameter::Type::Float)
+		{
+			assert(0 && "type mismatch AnimatorController::SetFloat()");
+			return;
+		}
+		parameter->default_float = param;
+	}
+
+	void AnimatorController::SetTrigger(const Animations::ParameterID id)
+	{
+		const auto parameter = GetParameter(id);
+		if (!parameter)
+			return;
+		// ^̈Ⴄp[^ɂ͏܂Ȃ
+		if (parameter->type != Animations::AnimatorControllerParameter::Type::Trigger)
+		{
+			assert(0 && "type mismatch AnimatorController::SetTrigger()");
+			return;
+		}
+		parameter->default_bool = true;
+	}
+
+	bool AnimatorController::GetBool(const Animations::ParameterID id)
+	{
+		const auto parameter = GetParameter(id);
+		if (!parameter)
+		{
+			assert(0 && "invalid argument AnimatorController::GetBool()");
+			return false;
+		}
+		return parameter->default_bool;
+	}
+
+	int AnimatorController::GetInteger(const Animations::ParameterID id)
+	{
+		const auto parameter = GetParameter(id);
+		if (!parameter)
+		{
+			assert(0 && "invalid argument AnimatorController::GetInteger()");
+			return 0;
+		}
+		return parameter->default_int;
+	}
+
+	float AnimatorController::GetFloat(const Animations::ParameterID id)
+	{
+		const auto parameter = GetParameter(id);
+		if (!parameter)
+		{
+			assert(0 && "invalid argument AnimatorController::GetFloat()");
+			return 0.0f;
+		}
+		return parameter->default_float;
+	}
+
+	void AnimatorController::ResetTrigger(const Animations::ParameterID id)
+	{
+		const auto parameter = GetParameter(id);
+		if (!parameter)
+		{
+			assert(0 && "invalid argument AnimatorController::ResetTrigger()");
+			return;
+		}
+		parameter->default_bool = false;
+	}
+
+	void AnimatorController::ResolveParameterIDs()
+	{
+		if (!m_res_controller || !m_res_controller->HasResource())
+			return;
+
+		m_res_controller->ResolveParameterIDs();
 	}
 
 	bool AnimatorController::IsLoaded() const
@@ -174,20 +303,46 @@ namespace TKGEngine
 		return m_res_controller == nullptr ? 0 : m_res_controller->GetHash();
 	}
 
+	const Animations::AnimatorLODSettings& AnimatorController::GetLODSettings() const
+	{
+		static const Animations::AnimatorLODSettings default_settings;
+		return m_res_controller == nullptr ? default_settings : m_res_controller->GetLODSettings();
+	}
+
 	void AnimatorController::ApplyAnimationTransform(
 		const GameObjectID goid,
 		const float elapsed_time,
-		const std::unordered_map<std::string, int>* node_index,
+		const Avatar& avatar,
 		const std::vector<int>& enable_nodes,
 		std::vector<Animations::KeyData>& data
 	)
 	{
+		Animations::AvatarBinding binding;
+		binding.node_index = avatar.GetNodeIndex();
+		binding.owner = avatar.GetIdentity();
 		// ^[
-		if (!node_index)
+		if (!binding.node_index)
 			return;
 
-		if (m_res_controller)
-			m_res_controller->ApplyAnimationTransform(goid, elapsed_time, node_index, enable_nodes, data);
+		if (!SyncInstance())
+			return;
+
+		m_res_controller->ApplyAnimationTransform(goid, elapsed_time, binding, enable_nodes, *m_instance, data);
+	}
+
+	// ==================================================
+	// private methods
+	// ==================================================
+	bool AnimatorController::SyncInstance()
+	{
+		if (!m_res_controller || !m_instance)
+			return false;
+		// [h͍\m肵ĂȂ
+		if (!m_res_controller->HasResource())
+			return false;
+
+		m_res_controller->SyncInstance(*m_instance);
+		return true;
 	}
 
 }// namespace TKGEngine
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Animator_BlendTree.h"
 
 #include "Animator_StateMachine.h"
+#include "Animation_Blend.h"
 #include "Application/Resource/inc/Shader_Defined.h"
 #include "Systems/inc/LogSystem.h"
 #include "Utility/inc/myfunc_file.h"
@@ -13,34 +14,27 @@ namespace TKGEngine::Animations
 	BlendTree::BlendTree()
 		: AnimatorBlockBase(BlockType::BlendTree)
 	{
-		// {[̗vfm
-		for (auto& calc_keyframe : m_calc_child_keyframes)
-		{
-			calc_keyframe.resize(MAX_BONES);
-		}
+		/* nothing */
 	}
 
 	BlendTree::BlendTree(const char* name)
 		: AnimatorBlockBase(BlockType::BlendTree, name)
 	{
-		// {[̗vfm
-		for (auto& calc_keyframe : m_calc_child_keyframes)
-		{
-			calc_keyframe.resize(MAX_BONES);
-		}
+		/* nothing */
 	}
 
 #ifdef USE_IMGUI
 	int BlendTree::OnGUI(
 		const GameObjectID goid,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+		const LayerInstance* layer_instance,
 		std::unordered_map<std::string, std::shared_ptr<Animations::AnimatorControllerParameter>>& parameters
 	)
 	{
 		ImGui::IDWrapped id(this);
 
 		// BlockBaseOnGUI(ubNύXƕ\)
-		AnimatorBlockBase::OnGUI(goid, blocks, parameters);
+		AnimatorBlockBase::OnGUI(goid, blocks, layer_instance, parameters);
 
 		// Blend Type
 		ImGui::Text("Blend Type");
@@ -199,6 +193,12 @@ namespace TKGEngine::Animations
 				break;
 			}
 		}
+		// Blend(K`Ԃ͍AʕԂƂ͌ʂقȂ)
+		{
+			ImGui::Text("Fast Blend (nlerp)");
+			ImGui::AlignedSameLine(0.5f);
+			ImGui::Checkbox("##Fast Blend", &m_use_nlerp);
+		}
 		// Speed
 		{
 			ImGui::Text("Speed");
@@ -274,17 +274,31 @@ namespace TKGEngine::Animations
 						RemoveChild(i);
 						break;
 					}
+					// Đ̃uh
+					float weight = 0.0f;
+					if (layer_instance)
+					{
+						for (const auto& data : layer_instance->GetBlendTree(m_self_block_index).blend_data)
+						{
+							// I[܂ŗ甭łȂ
+							if (data.child_index == INVALID_CHILD_INDEX)
+								break;
+							// g̃CfbNXƈvd݂Ԃ
+							if (data.child_index == static_cast<int>(i))
+							{
+								weight = data.weight;
+								break;
+							}
+						}
+					}
 					// ChildClip::GUI
 					ImGui::SameLine();
-					m_children.at(i).OnGUI(m_blend_tree_type, m_blend_data, i);
+					m_children.at(i).OnGUI(m_blend_tree_type, weight);
 				}
 				// Add{^
 				if (ImGui::Button("Add##ChildClip"))
 				{
 					m_children.emplace_back();
-					const auto child_num = m_children.size();
-					m_blend_data.resize(child_num);
-					m_influences.resize(child_num);
 				}
 			}
 		}
@@ -340,6 +354,15 @@ namespace TKGEngine::Animations
 		m_parameter_z = parameter_z;
 	}
 
+	void BlendTree::ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids)
+	{
+		AnimatorBlockBase::ResolveParameterIDs(parameter_ids);
+		m_parameter_id = FindParameterID(parameter_ids, m_parameter);
+		m_parameter_y_id = FindParameterID(parameter_ids, m_parameter_y);
+		m_parameter_z_id = FindParameterID(parameter_ids, m_parameter_z);
+		m_speed_parameter_id = FindParameterID(parameter_ids, m_speed_parameter);
+	}
+
 	void BlendTree::AddChild(const std::string& motion_filepath)
 	{
 		AddChild(motion_filepath, VECTOR2::Zero);
@@ -357,12 +380,6 @@ namespace TKGEngine::Animations
 		auto& child = m_children.emplace_back();
 		child.threshold = position;
 		child.clip.AddMotion(motion_filepath);
-
-		const auto child_num = m_children.size();
-		// uhɎgpf[^̕ύX
-		m_blend_data.resize(child_num);
-		// exobt@̃TCYύX
-		m_influences.resize(child_num);
 	}
 
 	void BlendTree::RemoveChild(const int index)
@@ -370,11 +387,6 @@ namespace TKGEngine::Animations
 		if (index < 0 || index >= static_cast<int>(m_children.size()))
 			return;
 		m_children.erase(m_children.begin() + index);
-
-		// uhɎgpf[^̕ύX
-		m_blend_data.pop_back();
-		// exobt@̃TCYύX
-		m_influences.pop_back();
 	}
 
 	void BlendTree::SetBlendTreeType(const BlendTreeType type)
@@ -423,6 +435,14 @@ namespace TKGEngine::Animations
 	}
 
 	// Clip̎擾XV͂Ȃ̂Ŗ߂lfalse
+	void BlendTree::InitializeInstance(BlockInstance& instance) const
+	{
+		instance.executed_events.assign(m_events.size(), false);
+		// uhvZp̃obt@q̐mۂ
+		instance.blend_tree = std::make_unique<BlendTreeInstance>();
+		instance.blend_tree->Resize(m_children.size());
+	}
+
 	bool BlendTree::UpdateBlock(
 		const GameObjectID goid,
 		const bool is_root_layer,
@@ -433,8 +453,9 @@ namespace TKGEngine::Animations
 		const float elapsed_time,
 		const float normalize_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-		const std::unordered_map<std::string, int>* node_index
+		LayerInstance& layer_instance,
+		std::vector<AnimatorControllerParameter>& parameters,
+		const AvatarBinding& avatar
 	)
 	{
 		// TransitionɂJڃ`FbN
@@ -448,7 +469,7 @@ namespace TKGEngine::Animations
 			{
 				// Jڐ悪Xe[g}V̑Jڃf[^Zbg
 				const int next_block_owner_index = blocks.at(next)->GetOwnerStateMachineIndex();
-				std::static_pointer_cast<AnimatorStateMachine>(blocks.at(next_block_owner_index))->SetNextData(goid, next, duration, offset, blocks);
+				std::static_pointer_cast<AnimatorStateMachine>(blocks.at(next_block_owner_index))->SetNextData(goid, next, duration, offset, blocks, layer_instance);
 			}
 		}
 		// Cxg̔΃`FbN
@@ -457,18 +478,26 @@ namespace TKGEngine::Animations
 			if (event_num == 0)
 				return false;
 
+			auto& block_instance = layer_instance.blocks[m_self_block_index];
+			auto& executed_events = block_instance.executed_events;
+			// GUIł̃CxgǉA폜ɍ킹
+			if (executed_events.size() != event_num)
+			{
+				executed_events.resize(event_num, false);
+			}
+
 			// 0 ~ 1.0ɂ܂߂K
 			const float wrapped_time = normalize_time - static_cast<int>(normalize_time);
-			const float prev_wrapped_time = m_prev_normalize_time - static_cast<int>(m_prev_normalize_time);
+			const float prev_wrapped_time = block_instance.prev_normalize_time - static_cast<int>(block_instance.prev_normalize_time);
 
 			// 1ĂȂSẴCxgs
 			const bool is_next_loop = (wrapped_time < prev_wrapped_time) ? true : false;
 			// CxgƂɃ`FbNȂs
 			for (size_t i = 0; i < event_num; ++i)
 			{
-				auto& event = m_events.at(i);
+				const auto& event = m_events.at(i);
 				// sς݃tO̊mF
-				if (event.IsExecutedEvent())
+				if (executed_events[i])
 				{
 					continue;
 				}
@@ -478,6 +507,7 @@ namespace TKGEngine::Animations
 				{
 					// s
 					event.ExecuteEvent(goid);
+					executed_events[i] = true;
 				}
 				// wrapĂȂȂoߎԂ̊mF
 				else
@@ -486,6 +516,7 @@ namespace TKGEngine::Animations
 					{
 						// s
 						event.ExecuteEvent(goid);
+						executed_events[i] = true;
 					}
 				}
 			}
@@ -493,14 +524,11 @@ namespace TKGEngine::Animations
 			// 1CxgtOZbg
 			if (is_next_loop)
 			{
-				for (auto& event : m_events)
-				{
-					event.ResetExecutedFlag();
-				}
+				executed_events.assign(event_num, false);
 			}
 
 			// wrap1.0Ȃ邽߂ɒlێ
-			m_prev_normalize_time = normalize_time;
+			block_instance.prev_normalize_time = normalize_time;
 		}
 
 		return false;
@@ -511,12 +539,15 @@ namespace TKGEngine::Animations
 		const bool is_additive,
 		const float normalize_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, int>* node_index,
+		LayerInstance& layer_instance,
+		const AvatarBinding& avatar,
 		std::vector<KeyData>& dst_keydata
 	)
 	{
+		auto& blend_instance = layer_instance.GetBlendTree(m_self_block_index);
+
 		// QƃCfbNX̃`FbN
-		if (m_blend_data_num == 0 || m_blend_data.at(0).child_index == INVALID_CHILD_INDEX)
+		if (blend_instance.blend_data_num == 0 || blend_instance.blend_data.at(0).child_index == INVALID_CHILD_INDEX)
 		{
 			// keydata̎擾Ɏs
 			return false;
@@ -542,145 +573,153 @@ namespace TKGEngine::Animations
 		}
 
 		// 1QƂĂȂƂ
-		if (m_blend_data_num == 1 || m_blend_data.at(1).child_index == INVALID_CHILD_INDEX)
+		if (blend_instance.blend_data_num == 1 || blend_instance.blend_data.at(1).child_index == INVALID_CHILD_INDEX)
 		{
-			const auto& clip = m_children.at(m_blend_data.at(0).child_index).clip;
+			const int child_index = blend_instance.blend_data.at(0).child_index;
+			const auto& clip = m_children.at(child_index).clip;
+			// Avatar̃m[hւ̕ϊe[u
+			const auto* remap_table = GetRemapTable(clip, avatar, layer_instance.blocks[m_self_block_index], child_index);
+			if (!remap_table)
+			{
+				// keydata̎擾Ɏs
+				return false;
+			}
 			const float length = clip.GetLength();
 			const float rate = clip.GetSampleRate();
 			// Aj[VԂ̖[
 			if (is_clamped)
 			{
 				const int frame = static_cast<int>(length * rate);
-				auto clip_keyframe = clip.GetKeyFrame(frame);
-				AlignKeyFrame(*clip_keyframe, clip.GetKeyIndex(), node_index, dst_keydata);
+				clip.SampleKeyFrame(static_cast<float>(frame), *remap_table, dst_keydata);
 			}
 			else
 			{
 				// t[ڂkey
 				const float key = wrapped_normalize_time * length * rate;
-				GetFrameBlendKey(clip, key, node_index, dst_keydata);
+				GetFrameBlendKey(clip, key, *remap_table, dst_keydata);
 			}
 
 			// ZC[͍߂
 			if (!is_root_layer && is_additive)
 			{
-				GetKeyDifference(dst_keydata, *clip.GetKeyFrame(0), clip.GetKeyIndex(), node_index, dst_keydata);
+				GetKeyDifference(dst_keydata, *clip.GetReferenceKeyFrame(), *remap_table, dst_keydata);
 			}
 		}
 		// 2ȏ̃uĥƂ
 		else
 		{
-			float total_weight = 0.0f;
-
-			// n߂̃f[^擾
+			// uhq̐obt@mۂ
+			if (static_cast<int>(blend_instance.calc_child_keyframes.size()) < blend_instance.blend_data_num)
 			{
-				const auto& first_blend_data = m_blend_data.at(0);
-				const auto& clip = m_children.at(first_blend_data.child_index).clip;
-				const float length = clip.GetLength();
-				const float rate = clip.GetSampleRate();
-				// Aj[VԂ̖[
-				if (is_clamped)
-				{
-					const int frame = static_cast<int>(length * rate);
-					auto clip_keyframe = clip.GetKeyFrame(frame);
-					AlignKeyFrame(*clip_keyframe, clip.GetKeyIndex(), node_index, m_calc_child_keyframes[0]);
-				}
-				else
-				{
-					const float key = wrapped_normalize_time * clip.GetLength() * clip.GetSampleRate();
-					GetFrameBlendKey(clip, key, node_index, m_calc_child_keyframes[0]);
-				}
-
-				// ZC[͍߂
-				if (!is_root_layer && is_additive)
-				{
-					GetKeyDifference(m_calc_child_keyframes[0], *clip.GetKeyFrame(0), clip.GetKeyIndex(), node_index, m_calc_child_keyframes[0]);
-				}
-
-				// WeightZ
-				total_weight += first_blend_data.weight;
+				blend_instance.calc_child_keyframes.resize(blend_instance.blend_data_num, std::vector<KeyData>(MAX_BONES));
+				blend_instance.blend_sources.resize(blend_instance.blend_data_num);
+				blend_instance.blend_weights.resize(blend_instance.blend_data_num);
 			}
 
-			// BlendData.child_index == INVALID_CHILD_INDEXɂȂ܂Ńuh
-			int data_index = 1;
-			while (true)
+			// BlendData.child_index == INVALID_CHILD_INDEXɂȂ܂Ŋeq̃L[擾
+			int data_index = 0;
+			for (; data_index < blend_instance.blend_data_num; ++data_index)
 			{
-				// CfbNX͈̔͂ƗLl`FbN
-				if (m_blend_data_num <= data_index || m_blend_data.at(data_index).child_index == INVALID_CHILD_INDEX)
-				{
+				const auto& blend_data = blend_instance.blend_data.at(data_index);
+				if (blend_data.child_index == INVALID_CHILD_INDEX)
 					break;
-				}
-				const auto& blend_data = m_blend_data.at(data_index);
 
 				// data_indexɈʒu擾
+				auto& calc_keyframe = blend_instance.calc_child_keyframes[data_index];
 				const auto& clip = m_children.at(blend_data.child_index).clip;
+				// [V̂Ȃq͏d0Ńuh
+				const auto* remap_table = GetRemapTable(clip, avatar, layer_instance.blocks[m_self_block_index], blend_data.child_index);
+				if (!remap_table)
+				{
+					blend_instance.blend_sources[data_index] = &calc_keyframe;
+					blend_instance.blend_weights[data_index] = 0.0f;
+					continue;
+				}
 				const float length = clip.GetLength();
 				const float rate = clip.GetSampleRate();
 				// Aj[VԂ̖[
 				if (is_clamped)
 				{
 					const int frame = static_cast<int>(length * rate);
-					auto clip_keyframe = clip.GetKeyFrame(frame);
-					AlignKeyFrame(*clip_keyframe, clip.GetKeyIndex(), node_index, m_calc_child_keyframes[1]);
+					clip.SampleKeyFrame(static_cast<float>(frame), *remap_table, calc_keyframe);
 				}
 				else
 				{
-					const float key = wrapped_normalize_time * clip.GetLength() * clip.GetSampleRate();
-					GetFrameBlendKey(clip, key, node_index, m_calc_child_keyframes[1]);
+					const float key = wrapped_normalize_time * length * rate;
+					GetFrameBlendKey(clip, key, *remap_table, calc_keyframe);
 				}
 
 				// ZC[͍߂
 				if (!is_root_layer && is_additive)
 				{
-					GetKeyDifference(m_calc_child_keyframes[1], *clip.GetKeyFrame(0), clip.GetKeyIndex(), node_index, m_calc_child_keyframes[1]);
+					GetKeyDifference(calc_keyframe, *clip.GetReferenceKeyFrame(), *remap_table, calc_keyframe);
 				}
 
-				// WeightZ
-				const float prev_total_weight = total_weight;
-				total_weight += blend_data.weight;
-
-				// d݂Ńuh
-				BlendKeyFrame(m_calc_child_keyframes[1], m_calc_child_keyframes[0], prev_total_weight / total_weight, m_calc_child_keyframes[0]);
+				blend_instance.blend_sources[data_index] = &calc_keyframe;
+				blend_instance.blend_weights[data_index] = blend_data.weight;
+			}
 
-				// QƂCfbNX1ɐi߂
-				++data_index;
+			// 2JԂuhɁASĂ̎qd݂1xɐK`ԂŃuh
+			if (m_use_nlerp)
+			{
+				BlendKeyFrameWeighted(blend_instance.blend_sources.data(), blend_instance.blend_weights.data(), data_index, dst_keydata);
+			}
+			// d݂ݐςȂ1ڂ̎q̃obt@2ʕԂŃuh
+			else
+			{
+				auto& accumulated = blend_instance.calc_child_keyframes[0];
+				float total_weight = blend_instance.blend_weights[0];
+				for (int i = 1; i < data_index; ++i)
+				{
+					const float prev_total_weight = total_weight;
+					total_weight += blend_instance.blend_weights[i];
+					if (total_weight <= 0.0f)
+						continue;
+					BlendKeyFrame(*blend_instance.blend_sources[i], accumulated, prev_total_weight / total_weight, accumulated);
+				}
+				std::copy(accumulated.begin(), accumulated.end(), dst_keydata.begin());
 			}
-			std::copy(m_calc_child_keyframes[0].begin(), m_calc_child_keyframes[0].end(), dst_keydata.begin());
 		}
 
 		// keydata̎擾ł
 		return true;
 	}
 
-	void BlendTree::OnReady(const float offset)
+	void BlendTree::OnReady(const float offset, LayerInstance& layer_instance)
 	{
+		auto& block_instance = layer_instance.blocks[m_self_block_index];
 		// O̍ĐԂ
-		m_prev_normalize_time = offset;
+		block_instance.prev_normalize_time = offset;
 		// CxgtOׂăZbg
-		for (auto& event : m_events)
-		{
-			event.ResetExecutedFlag();
-		}
+		block_instance.executed_events.assign(m_events.size(), false);
 	}
 
 	void BlendTree::GetNormalizeTime(
 		const float elapsed_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+		LayerInstance& layer_instance,
+		std::vector<AnimatorControllerParameter>& parameters,
 		float& weighted_normalize_time,
 		float& normalize_time
 	)
 	{
+		auto& blend_instance = layer_instance.GetBlendTree(m_self_block_index);
+		// GUIł̎q̒ǉA폜ɍ킹
+		if (blend_instance.blend_data.size() != m_children.size())
+		{
+			blend_instance.Resize(m_children.size());
+		}
+
 		// Ot[̏̃NA
-		m_blend_data_num = 0;
-		for (auto& data : m_blend_data)
+		blend_instance.blend_data_num = 0;
+		for (auto& data : blend_instance.blend_data)
 		{
 			data.Clear();
 		}
 		if (m_blend_tree_type == BlendTreeType::FreeformCartesian2D ||
 			m_blend_tree_type == BlendTreeType::FreeformCartesian3D)
 		{
-			for (auto& influence : m_influences)
+			for (auto& influence : blend_instance.influences)
 			{
 				influence = 0.0f;
 			}
@@ -690,22 +729,22 @@ namespace TKGEngine::Animations
 		switch (m_blend_tree_type)
 		{
 			case BlendTreeType::Simple1D:
-				CalculateBlendRatioSimple1D(parameters);
+				CalculateBlendRatioSimple1D(parameters, blend_instance);
 				break;
 			case BlendTreeType::Simple2D:
-				CalculateBlendRatioSimple2D(parameters);
+				CalculateBlendRatioSimple2D(parameters, blend_instance);
 				break;
 			case BlendTreeType::FreeformCartesian2D:
-				CalculateBlendRatioFreeformCartesian2D(parameters);
+				CalculateBlendRatioFreeformCartesian2D(parameters, blend_instance);
 				break;
 			case BlendTreeType::FreeformCartesian3D:
-				CalculateBlendRatioFreeformCartesian3D(parameters);
+				CalculateBlendRatioFreeformCartesian3D(parameters, blend_instance);
 				break;
 		}
 		// KoߎԂ̌vZ
 		{
 			// uhNbv݂Ȃ
-			if (m_blend_data_num == 0 || m_blend_data.at(0).child_index == INVALID_CHILD_INDEX)
+			if (blend_instance.blend_data_num == 0 || blend_instance.blend_data.at(0).child_index == INVALID_CHILD_INDEX)
 			{
 				// children݂Ȃ
 				weighted_normalize_time = 0.0f;
@@ -717,25 +756,17 @@ namespace TKGEngine::Animations
 			float speed_param = 1.0f;
 			if (m_use_speed_parameter)
 			{
-				// p[^猟
-				const auto itr_find = parameters.find(m_speed_parameter);
-				if (itr_find != parameters.end())
-				{
-					// Floatł邱ƂmF
-					if (itr_find->second->type == AnimatorControllerParameter::Type::Float)
-					{
-						speed_param = MyMath::Max(itr_find->second->default_float, 0.0f);
-					}
-				}
+				// FloatłȂΏZȂ
+				speed_param = MyMath::Max(GetFloatParameter(parameters, m_speed_parameter_id, 1.0f), 0.0f);
 			}
 			// SpeedZ
 			speed_param *= m_speed;
 
 			// 1gp
-			if (m_blend_data_num == 1 || m_blend_data.at(1).child_index == INVALID_CHILD_INDEX)
+			if (blend_instance.blend_data_num == 1 || blend_instance.blend_data.at(1).child_index == INVALID_CHILD_INDEX)
 			{
 				// children1QƂȂ
-				const float rcp_length = m_children.at(m_blend_data.at(0).child_index).clip.GetRCPLength();
+				const float rcp_length = m_children.at(blend_instance.blend_data.at(0).child_index).clip.GetRCPLength();
 				weighted_normalize_time = rcp_length * elapsed_time * speed_param;
 				normalize_time = rcp_length * elapsed_time;
 				return;
@@ -747,18 +778,18 @@ namespace TKGEngine::Animations
 			{
 				float total_weight = 0.0f;
 				// n߂̃f[^oĂ
-				total_multiply_value += m_children.at(m_blend_data.at(0).child_index).clip.GetRCPLength();
-				total_weight += m_blend_data.at(0).weight;
+				total_multiply_value += m_children.at(blend_instance.blend_data.at(0).child_index).clip.GetRCPLength();
+				total_weight += blend_instance.blend_data.at(0).weight;
 				// BlendData.child_index == INVALID_CHILD_INDEXɂȂ܂Ńuh
 				int data_index = 1;
 				while (true)
 				{
 					// CfbNX͈̔͂ƗLl`FbN
-					if (m_blend_data_num <= data_index || m_blend_data.at(data_index).child_index == INVALID_CHILD_INDEX)
+					if (blend_instance.blend_data_num <= data_index || blend_instance.blend_data.at(data_index).child_index == INVALID_CHILD_INDEX)
 					{
 						break;
 					}
-					const auto& blend_data = m_blend_data.at(data_index);
+					const auto& blend_data = blend_instance.blend_data.at(data_index);
 
 					// Wuh
 					const float prev_weight = total_weight;
@@ -785,7 +816,7 @@ namespace TKGEngine::Animations
 		OnRemoveBlockAllFixAndErase(removed_index, blocks);
 	}
 
-	void BlendTree::CalculateBlendRatioSimple1D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters)
+	void BlendTree::CalculateBlendRatioSimple1D(const std::vector<AnimatorControllerParameter>& parameters, BlendTreeInstance& blend_instance) const
 	{
 		// Children1ȉ̏ꍇ͑^[
 		const size_t child_num = m_children.size();
@@ -797,9 +828,9 @@ namespace TKGEngine::Animations
 		{
 			if (m_children.at(0).clip.HasMotion())
 			{
-				m_blend_data.at(0).child_index = 0;
-				m_blend_data.at(0).weight = 1.0f;
-				m_blend_data_num = 1;
+				blend_instance.blend_data.at(0).child_index = 0;
+				blend_instance.blend_data.at(0).weight = 1.0f;
+				blend_instance.blend_data_num = 1;
 
 				return;
 			}
@@ -860,16 +891,16 @@ namespace TKGEngine::Animations
 			// less,greater݂̈ȂƂ݂͑̂100%Kp
 			if (less_index == INVALID_CHILD_INDEX)
 			{
-				m_blend_data.at(0).child_index = greater_index;
-				m_blend_data.at(0).weight = 1.0f;
-				m_blend_data_num = 1;
+				blend_instance.blend_data.at(0).child_index = greater_index;
+				blend_instance.blend_data.at(0).weight = 1.0f;
+				blend_instance.blend_data_num = 1;
 				return;
 			}
 			else if (greater_index == INVALID_CHILD_INDEX)
 			{
-				m_blend_data.at(0).child_index = less_index;
-				m_blend_data.at(0).weight = 1.0f;
-				m_blend_data_num = 1;
+				blend_instance.blend_data.at(0).child_index = less_index;
+				blend_instance.blend_data.at(0).weight = 1.0f;
+				blend_instance.blend_data_num = 1;
 				return;
 			}
 			// childparam̋uhvZ
@@ -882,27 +913,27 @@ namespace TKGEngine::Animations
 			// length0̑Ή
 			if (MyMath::Approximately(length, 0.0f))
 			{
-				m_blend_data.at(0).child_index = less_index;
-				m_blend_data.at(0).weight = 1.0f;
-				m_blend_data_num = 1;
+				blend_instance.blend_data.at(0).child_index = less_index;
+				blend_instance.blend_data.at(0).weight = 1.0f;
+				blend_instance.blend_data_num = 1;
 			}
 			else
 			{
 				// less̃f[^
-				auto& less_data = m_blend_data.at(0);
+				auto& less_data = blend_instance.blend_data.at(0);
 				less_data.child_index = less_index;
 				less_data.weight = (greater_param - param) / length;
 				// greater̃f[^
-				auto& greater_data = m_blend_data.at(1);
+				auto& greater_data = blend_instance.blend_data.at(1);
 				greater_data.child_index = greater_index;
 				greater_data.weight = (param - less_param) / length;
 				// uhf[^
-				m_blend_data_num = 2;
+				blend_instance.blend_data_num = 2;
 			}
 		}
 	}
 
-	void BlendTree::CalculateBlendRatioSimple2D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters)
+	void BlendTree::CalculateBlendRatioSimple2D(const std::vector<AnimatorControllerParameter>& parameters, BlendTreeInstance& blend_instance) const
 	{
 		// Children1ȉ̏ꍇ͑^[
 		const size_t child_num = m_children.size();
@@ -914,9 +945,9 @@ namespace TKGEngine::Animations
 		{
 			if (m_children.at(0).clip.HasMotion())
 			{
-				m_blend_data.at(0).child_index = 0;
-				m_blend_data.at(0).weight = 1.0f;
-				m_blend_data_num = 1;
+				blend_instance.blend_data.at(0).child_index = 0;
+				blend_instance.blend_data.at(0).weight = 1.0f;
+				blend_instance.blend_data_num = 1;
 
 				return;
 			}
@@ -972,9 +1003,9 @@ namespace TKGEngine::Animations
 				// 1̏ꍇ
 				else
 				{
-					m_blend_data.at(0).child_index = near_indices[0];
-					m_blend_data.at(0).weight = 1.0f;
-					m_blend_data_num = 1;
+					blend_instance.blend_data.at(0).child_index = near_indices[0];
+					blend_instance.blend_data.at(0).weight = 1.0f;
+					blend_instance.blend_data_num = 1;
 
 					return;
 				}
@@ -997,9 +1028,9 @@ namespace TKGEngine::Animations
 			// ς̎[0]100%
 			if (dot_0P_to_01 <= 0.0f)
 			{
-				m_blend_data.at(0).child_index = near_indices[0];
-				m_blend_data.at(0).weight = 1.0f;
-				m_blend_data_num = 1;
+				blend_instance.blend_data.at(0).child_index = near_indices[0];
+				blend_instance.blend_data.at(0).weight = 1.0f;
+				blend_instance.blend_data_num = 1;
 
 				return;
 			}
@@ -1014,18 +1045,18 @@ namespace TKGEngine::Animations
 				ratio = dot_0P_to_01 / length_0_to_1;
 			}
 			// l̕ۑ
-			auto& first_data = m_blend_data.at(0);
+			auto& first_data = blend_instance.blend_data.at(0);
 			first_data.child_index = near_indices[0];
 			first_data.weight = 1.0f - ratio;
-			auto& second_data = m_blend_data.at(1);
+			auto& second_data = blend_instance.blend_data.at(1);
 			second_data.child_index = near_indices[1];
 			second_data.weight = ratio;
 			// uhf[^
-			m_blend_data_num = 2;
+			blend_instance.blend_data_num = 2;
 		}
 	}
 
-	void BlendTree::CalculateBlendRatioFreeformCartesian2D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters)
+	void BlendTree::CalculateBlendRatioFreeformCartesian2D(const std::vector<AnimatorControllerParameter>& parameters, BlendTreeInstance& blend_instance) const
 	{
 		// Children1ȉ̏ꍇ͑^[
 		const int child_num = static_cast<int>(m_children.size());
@@ -1037,9 +1068,9 @@ namespace TKGEngine::Animations
 		{
 			if (m_children.at(0).clip.HasMotion())
 			{
-				m_blend_data.at(0).child_index = 0;
-				m_blend_data.at(0).weight = 1.0f;
-				m_blend_data_num = 1;
+				blend_instance.blend_data.at(0).child_index = 0;
+				blend_instance.blend_data.at(0).weight = 1.0f;
+				blend_instance.blend_data_num = 1;
 
 				return;
 			}
@@ -1058,12 +1089,12 @@ namespace TKGEngine::Animations
 				continue;
 
 			// exvZ
-			m_influences.at(i) = CalculateClipInfluence(param, i);
+			blend_instance.influences.at(i) = CalculateClipInfluence(param, i);
 		}
 		// a߂
 		float sum_influence = 0.0f;
 		{
-			for (const float influence : m_influences)
+			for (const float influence : blend_instance.influences)
 			{
 				sum_influence += influence;
 			}
@@ -1073,22 +1104,22 @@ namespace TKGEngine::Animations
 		for (int i = 0; i < child_num; ++i)
 		{
 			// 0ȉ̉ex͉̂̂e󂯂Ȃ
-			if (MyMath::Approximately(m_influences.at(i), 0.0f))
+			if (MyMath::Approximately(blend_instance.influences.at(i), 0.0f))
 			{
 				continue;
 			}
 
 			// uhvfɃZbg
-			m_blend_data.at(m_blend_data_num).child_index = i;
+			blend_instance.blend_data.at(blend_instance.blend_data_num).child_index = i;
 			// d݂𐳋K
-			m_blend_data.at(m_blend_data_num).weight = m_influences.at(i) / sum_influence;
+			blend_instance.blend_data.at(blend_instance.blend_data_num).weight = blend_instance.influences.at(i) / sum_influence;
 
 			// Zbgꏊړ
-			++m_blend_data_num;
+			++blend_instance.blend_data_num;
 		}
 	}
 
-	void BlendTree::CalculateBlendRatioFreeformCartesian3D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters)
+	void BlendTree::CalculateBlendRatioFreeformCartesian3D(const std::vector<AnimatorControllerParameter>& parameters, BlendTreeInstance& blend_instance) const
 	{
 		// Children1ȉ̏ꍇ͑^[
 		const int child_num = static_cast<int>(m_children.size());
@@ -1100,9 +1131,9 @@ namespace TKGEngine::Animations
 		{
 			if (m_children.at(0).clip.HasMotion())
 			{
-				m_blend_data.at(0).child_index = 0;
-				m_blend_data.at(0).weight = 1.0f;
-				m_blend_data_num = 1;
+				blend_instance.blend_data.at(0).child_index = 0;
+				blend_instance.blend_data.at(0).weight = 1.0f;
+				blend_instance.blend_data_num = 1;
 
 				return;
 			}
@@ -1121,12 +1152,12 @@ namespace TKGEngine::Animations
 				continue;
 
 			// exvZ
-			m_influences.at(i) = CalculateClipInfluence(param, i);
+			blend_instance.influences.at(i) = CalculateClipInfluence(param, i);
 		}
 		// a߂
 		float sum_influence = 0.0f;
 		{
-			for (const float influence : m_influences)
+			for (const float influence : blend_instance.influences)
 			{
 				sum_influence += influence;
 			}
@@ -1136,22 +1167,22 @@ namespace TKGEngine::Animations
 		for (int i = 0; i < child_num; ++i)
 		{
 			// 0ȉ̉ex͉̂̂e󂯂Ȃ
-			if (MyMath::Approximately(m_influences.at(i), 0.0f))
+			if (MyMath::Approximately(blend_instance.influences.at(i), 0.0f))
 			{
 				continue;
 			}
 
 			// uhvfɃZbg
-			m_blend_data.at(m_blend_data_num).child_index = i;
+			blend_instance.blend_data.at(blend_instance.blend_data_num).child_index = i;
 			// d݂𐳋K
-			m_blend_data.at(m_blend_data_num).weight = m_influences.at(i) / sum_influence;
+			blend_instance.blend_data.at(blend_instance.blend_data_num).weight = blend_instance.influences.at(i) / sum_influence;
 
 			// Zbgꏊړ
-			++m_blend_data_num;
+			++blend_instance.blend_data_num;
 		}
 	}
 
-	float BlendTree::CalculateClipInfluence(const VECTOR2& param, const int child_idx)
+	float BlendTree::CalculateClipInfluence(const VECTOR2& param, const int child_idx) const
 	{
 		const int child_num = static_cast<int>(m_children.size());
 		const VECTOR2 child_threshold = VECTOR2(m_children.at(child_idx).threshold.x, m_children.at(child_idx).threshold.y);
@@ -1195,7 +1226,7 @@ namespace TKGEngine::Animations
 		return MyMath::Max(0.0f, min_influence);
 	}
 
-	float BlendTree::CalculateClipInfluence(const VECTOR3& param, const int child_idx)
+	float BlendTree::CalculateClipInfluence(const VECTOR3& param, const int child_idx) const
 	{
 		const int child_num = static_cast<int>(m_children.size());
 		const VECTOR3 child_threshold = m_children.at(child_idx).threshold;
@@ -1239,145 +1270,33 @@ namespace TKGEngine::Animations
 		return MyMath::Max(0.0f, min_influence);
 	}
 
-	float BlendTree::GetParameter1D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters) const
+	float BlendTree::GetParameter1D(const std::vector<AnimatorControllerParameter>& parameters) const
 	{
-		float param = 0.0f;
-		// mapT
-		const auto itr_find = parameters.find(m_parameter);
-		if (itr_find == parameters.end())
-		{
-			param = 0.0f;
-		}
-		else
-		{
-			// ParameterTypeFloatłȂƂparam = 0.0
-			if (itr_find->second->type != AnimatorControllerParameter::Type::Float)
-			{
-				param = 0.0f;
-			}
-			else
-			{
-				// Parameter̒l擾
-				param = itr_find->second->default_float;
-			}
-		}
-
-		return param;
+		// ParameterTypeFloatłȂƂparam = 0.0
+		return GetFloatParameter(parameters, m_parameter_id, 0.0f);
 	}
 
-	VECTOR2 BlendTree::GetParameter2D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters) const
+	VECTOR2 BlendTree::GetParameter2D(const std::vector<AnimatorControllerParameter>& parameters) const
 	{
-		VECTOR2 param = VECTOR2::Zero;
-		// mapT
-		const auto itr_find_x = parameters.find(m_parameter);
-		const auto itr_find_y = parameters.find(m_parameter_y);
-		// X
-		if (itr_find_x == parameters.end())
-		{
-			param.x = 0.0f;
-		}
-		else
-		{
-			// ParameterTypeFloatłȂƂparam = 0.0
-			if (itr_find_x->second->type != AnimatorControllerParameter::Type::Float)
-			{
-				param.x = 0.0f;
-			}
-			else
-			{
-				// Parameter̒l擾
-				param.x = itr_find_x->second->default_float;
-			}
-		}
-		// Y
-		if (itr_find_y == parameters.end())
-		{
-			param.y = 0.0f;
-		}
-		else
-		{
-			// ParameterTypeFloatłȂƂparam = 0.0
-			if (itr_find_y->second->type != AnimatorControllerParameter::Type::Float)
-			{
-				param.y = 0.0f;
-			}
-			else
-			{
-				// Parameter̒l擾
-				param.y = itr_find_y->second->default_float;
-			}
-		}
-
-		return param;
+		// ParameterTypeFloatłȂƂparam = 0.0
+		return VECTOR2(
+			GetFloatParameter(parameters, m_parameter_id, 0.0f),
+			GetFloatParameter(parameters, m_parameter_y_id, 0.0f)
+		);
 	}
 
-	VECTOR3 BlendTree::GetParameter3D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters) const
+	VECTOR3 BlendTree::GetParameter3D(const std::vector<AnimatorControllerParameter>& parameters) const
 	{
-		VECTOR3 param = VECTOR3::Zero;
-		// mapT
-		const auto itr_find_x = parameters.find(m_parameter);
-		const auto itr_find_y = parameters.find(m_parameter_y);
-		const auto itr_find_z = parameters.find(m_parameter_z);
-		// X
-		if (itr_find_x == parameters.end())
-		{
-			param.x = 0.0f;
-		}
-		else
-		{
-			// ParameterTypeFloatłȂƂparam = 0.0
-			if (itr_find_x->second->type != AnimatorControllerParameter::Type::Float)
-			{
-				param.x = 0.0f;
-			}
-			else
-			{
-				// Parameter̒l擾
-				param.x = itr_find_x->second->default_float;
-			}
-		}
-		// Y
-		if (itr_find_y == parameters.end())
-		{
-			param.y = 0.0f;
-		}
-		else
-		{
-			// ParameterTypeFloatłȂƂparam = 0.0
-			if (itr_find_y->second->type != AnimatorControllerParameter::Type::Float)
-			{
-				param.y = 0.0f;
-			}
-			else
-			{
-				// Parameter̒l擾
-				param.y = itr_find_y->second->default_float;
-			}
-		}
-		// Z
-		if (itr_find_z == parameters.end())
-		{
-			param.z = 0.0f;
-		}
-		else
-		{
-			// ParameterTypeFloatłȂƂparam = 0.0
-			if (itr_find_z->second->type != AnimatorControllerParameter::Type::Float)
-			{
-				param.z = 0.0f;
-			}
-			else
-			{
-				// Parameter̒l擾
-				param.z = itr_find_z->second->default_float;
-			}
-		}
-
-		return param;
+		// ParameterTypeFloatłȂƂparam = 0.0
+		return VECTOR3(
+			GetFloatParameter(parameters, m_parameter_id, 0.0f),
+			GetFloatParameter(parameters, m_parameter_y_id, 0.0f),
+			GetFloatParameter(parameters, m_parameter_z_id, 0.0f)
+		);
 	}
 
 #ifdef USE_IMGUI
-	void BlendTree::BlendChildClip::OnGUI(const BlendTreeType blend_type, const std::vector<BlendData>& blend_data, const int self_index)
+	void BlendTree::BlendChildClip::OnGUI(const BlendTreeType blend_type, const float weight)
 	{
 		// Threshold
 		switch (blend_type)
@@ -1425,22 +1344,6 @@ namespace TKGEngine::Animations
 		{
 			// Blend ratio, Clip name
 			{
-				// Find self weight
-				float weight = 0.0f;
-				{
-					for (const auto& data : blend_data)
-					{
-						// I[܂ŗ甭łȂ
-						if (data.child_index == INVALID_CHILD_INDEX)
-							break;
-						// g̃CfbNXƈvd݂Ԃ
-						if (data.child_index == self_index)
-						{
-							weight = data.weight;
-							break;
-						}
-					}
-				}
 				// vOXo[ŏd˂ĕ\
 				ImGui::SameLine();
 				const float cursor_pos = ImGui::GetCursorPosX();
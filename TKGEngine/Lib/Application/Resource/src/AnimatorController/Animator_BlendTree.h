@@ -15,7 +15,6 @@ namespace TKGEngine::Animations
 	class BlendTree
 		: public AnimatorBlockBase
 	{
-		struct BlendData;
 	public:
 		// ==============================================
 		// public enum
@@ -46,6 +45,8 @@ namespace TKGEngine::Animations
 		void SetParameter(const std::string& parameter);
 		void SetParameterY(const std::string& parameter_y);
 		void SetParameterZ(const std::string& parameter_z);
+		// QƂp[^ƑJڏ̃p[^vfԍ蓖Ă
+		void ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids) override;
 
 		// q[V̒ǉ
 		void AddChild(const std::string& motion_filepath);
@@ -94,7 +95,7 @@ namespace TKGEngine::Animations
 			AnimationClip clip;
 
 #ifdef USE_IMGUI
-			void OnGUI(BlendTreeType blend_type, const std::vector<BlendData>& blend_data, const int self_index);
+			void OnGUI(BlendTreeType blend_type, const float weight);
 #endif// #ifdef USE_IMGUI
 
 		private:
@@ -110,7 +111,24 @@ namespace TKGEngine::Animations
 		template <class Archive>
 		void load(Archive& archive, const std::uint32_t version)
 		{
-			if (version == 1)
+			if (version == 2)
+			{
+				archive(
+					cereal::base_class<AnimatorBlockBase>(this),
+					CEREAL_NVP(m_parameter),
+					CEREAL_NVP(m_parameter_y),
+					CEREAL_NVP(m_parameter_z),
+					CEREAL_NVP(m_blend_tree_type),
+					CEREAL_NVP(m_wrap_mode),
+					CEREAL_NVP(m_speed),
+					CEREAL_NVP(m_use_speed_parameter),
+					CEREAL_NVP(m_speed_parameter),
+					CEREAL_NVP(m_children),
+					CEREAL_NVP(m_events),
+					CEREAL_NVP(m_use_nlerp)
+				);
+			}
+			else if (version == 1)
 			{
 				archive(
 					cereal::base_class<AnimatorBlockBase>(this),
@@ -126,16 +144,11 @@ namespace TKGEngine::Animations
 					CEREAL_NVP(m_events)
 				);
 			}
-			const auto child_num = m_children.size();
-			// uhf[^zTCY
-			m_blend_data.resize(child_num);
-			// exobt@̃TCYύX
-			m_influences.resize(child_num);
 		}
 		template <class Archive>
 		void save(Archive& archive, const std::uint32_t version) const
 		{
-			if (version == 1)
+			if (version == 2)
 			{
 				archive(
 					cereal::base_class<AnimatorBlockBase>(this),
@@ -148,7 +161,8 @@ namespace TKGEngine::Animations
 					CEREAL_NVP(m_use_speed_parameter),
 					CEREAL_NVP(m_speed_parameter),
 					CEREAL_NVP(m_children),
-					CEREAL_NVP(m_events)
+					CEREAL_NVP(m_events),
+					CEREAL_NVP(m_use_nlerp)
 				);
 			}
 		}
@@ -160,10 +174,13 @@ namespace TKGEngine::Animations
 		int OnGUI(
 			const GameObjectID goid,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+			const LayerInstance* layer_instance,
 			std::unordered_map<std::string, std::shared_ptr<Animations::AnimatorControllerParameter>>& parameters
 		) override;
 #endif// #ifdef USE_IMGUI
 
+		void InitializeInstance(BlockInstance& instance) const override;
+
 		bool UpdateBlock(
 			const GameObjectID goid,
 			const bool is_root_layer,
@@ -174,24 +191,27 @@ namespace TKGEngine::Animations
 			const float elapsed_time,
 			const float normalize_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-			const std::unordered_map<std::string, int>* node_index
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
+			const AvatarBinding& avatar
 		) override;
 		bool UpdateKeyFrame(
 			const bool is_root_layer,
 			const bool is_additive,
 			const float normalize_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, int>* node_index,
+			LayerInstance& layer_instance,
+			const AvatarBinding& avatar,
 			std::vector<KeyData>& dst_keydata
 		) override;
-		void OnReady(const float offset) override;
+		void OnReady(const float offset, LayerInstance& layer_instance) override;
 
 		// ̃ubNspeedlengthlt[KoߎԂƁAspeedlȂKoߎԂԂ
 		void GetNormalizeTime(
 			const float elapsed_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
 			float& weighted_normalize_time,
 			float& normalize_time
 		) override;
@@ -200,33 +220,37 @@ namespace TKGEngine::Animations
 		void OnRemoveBlock(int removed_index, std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks) override;
 
 		// Simple 1D̃uhvZ
-		void CalculateBlendRatioSimple1D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters);
+		void CalculateBlendRatioSimple1D(const std::vector<AnimatorControllerParameter>& parameters, BlendTreeInstance& blend_instance) const;
 		// Simple 2D̃uhvZ
-		void CalculateBlendRatioSimple2D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters);
+		void CalculateBlendRatioSimple2D(const std::vector<AnimatorControllerParameter>& parameters, BlendTreeInstance& blend_instance) const;
 		// FreeformCartesian2D̃uhvZ
-		void CalculateBlendRatioFreeformCartesian2D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters);
+		void CalculateBlendRatioFreeformCartesian2D(const std::vector<AnimatorControllerParameter>& parameters, BlendTreeInstance& blend_instance) const;
 		// FreeformCartesian3D̃uhvZ
-		void CalculateBlendRatioFreeformCartesian3D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters);
+		void CalculateBlendRatioFreeformCartesian3D(const std::vector<AnimatorControllerParameter>& parameters, BlendTreeInstance& blend_instance) const;
 		// zohԂɂeNbv̉e߂
-		float CalculateClipInfluence(const VECTOR2& param, const int child_idx);
-		float CalculateClipInfluence(const VECTOR3& param, const int child_idx);
+		float CalculateClipInfluence(const VECTOR2& param, const int child_idx) const;
+		float CalculateClipInfluence(const VECTOR3& param, const int child_idx) const;
 
-		// p[^f[^TA擾p
-		float GetParameter1D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters) const;
-		VECTOR2 GetParameter2D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters) const;
-		VECTOR3 GetParameter3D(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters) const;
+		// p[^f[^擾p
+		float GetParameter1D(const std::vector<AnimatorControllerParameter>& parameters) const;
+		VECTOR2 GetParameter2D(const std::vector<AnimatorControllerParameter>& parameters) const;
+		VECTOR3 GetParameter3D(const std::vector<AnimatorControllerParameter>& parameters) const;
 
 
 		// ==============================================
 		// private variables
 		// ==============================================
 		// sChildren̎QƃCfbNX
-		static constexpr int INVALID_CHILD_INDEX = -1;
+		static constexpr int INVALID_CHILD_INDEX = BlendTreeInstance::INVALID_CHILD_INDEX;
 
 		// QƂp[^
 		std::string m_parameter;
 		std::string m_parameter_y;
 		std::string m_parameter_z;
+		// QƂp[^犄蓖Ăvfԍ
+		ParameterID m_parameter_id = INVALID_PARAMETER_ID;
+		ParameterID m_parameter_y_id = INVALID_PARAMETER_ID;
+		ParameterID m_parameter_z_id = INVALID_PARAMETER_ID;
 		// uhc[̎
 		BlendTreeType m_blend_tree_type = BlendTreeType::Simple1D;
 		// JԂ
@@ -237,42 +261,21 @@ namespace TKGEngine::Animations
 		bool m_use_speed_parameter = false;
 		// SpeedɏZp[^
 		std::string m_speed_parameter;
+		ParameterID m_speed_parameter_id = INVALID_PARAMETER_ID;
 		// Aj[VNbv܂ރc[̎q
 		std::vector<BlendChildClip> m_children;
 		// Cxg
 		std::vector<AnimatorEvent> m_events;
-
-		// Cxgwrapɂ锭΃~XȂ߂ɑOt[normalize_timeێ
-		float m_prev_normalize_time = 0.0f;
-
-		/// <summary>
-		/// uhf[^
-		/// </summary>
-		struct BlendData
-		{
-			int child_index = INVALID_CHILD_INDEX;
-			float weight = 0.0f;
-
-			void Clear()
-			{
-				child_index = INVALID_CHILD_INDEX;
-				weight = 0.0f;
-			}
-		};
-		std::vector<BlendData> m_blend_data = std::vector<BlendData>();
-		// uhf[^
-		int m_blend_data_num = 0;
-		// zohԎɉexĂobt@
-		std::vector<float> m_influences = std::vector<float>();
-		// q[Vf[^擾Aj[Vuh邽߂̃obt@
-		std::vector<KeyData> m_calc_child_keyframes[2];
+		// trueȂSĂ̎qd݂1xɐK`ԂŃuh
+		// falseȂd݂ݐςȂ2ʕԂŃuh(]̌ʂƈv)
+		bool m_use_nlerp = false;
 	};
 
 }// namespace TKGEngine::Animations
 
 // BlendTree
 CEREAL_REGISTER_TYPE(TKGEngine::Animations::BlendTree)
-CEREAL_CLASS_VERSION(TKGEngine::Animations::BlendTree, 1)
+CEREAL_CLASS_VERSION(TKGEngine::Animations::BlendTree, 2)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(TKGEngine::Animations::AnimatorBlockBase, TKGEngine::Animations::BlendTree)
 // archiveload savegpB
 CEREAL_SPECIALIZE_FOR_ALL_ARCHIVES(TKGEngine::Animations::BlendTree, cereal::specialization::member_load_save)
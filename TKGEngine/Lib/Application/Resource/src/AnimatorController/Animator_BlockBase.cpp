@@ -26,6 +26,7 @@ namespace TKGEngine::Animations
 	int AnimatorBlockBase::OnGUI(
 		const GameObjectID goid,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+		const LayerInstance* layer_instance,
 		std::unordered_map<std::string, std::shared_ptr<Animations::AnimatorControllerParameter>>& parameters
 	)
 	{
@@ -313,6 +314,14 @@ namespace TKGEngine::Animations
 		return &m_transitions;
 	}
 
+	void AnimatorBlockBase::ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids)
+	{
+		for (const auto& transition : m_transitions)
+		{
+			transition->ResolveParameterIDs(parameter_ids);
+		}
+	}
+
 	const char* AnimatorBlockBase::GetName() const
 	{
 		return m_name.c_str();
@@ -327,7 +336,7 @@ namespace TKGEngine::Animations
 		const bool state_transitioning,
 		const float normalized_time,
 		const int owner_index,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+		std::vector<AnimatorControllerParameter>& parameters,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
 		float& duration,
 		float& offset
@@ -371,115 +380,48 @@ namespace TKGEngine::Animations
 		MonoBehaviourManager::ExecuteFunction(goid, m_exit_class_name, m_exit_func_name);
 	}
 
-	void AnimatorBlockBase::BlendKeyFrame(const std::vector<KeyData>& v1, const std::vector<KeyData>& v2, const float ratio, std::vector<KeyData>& dst)
+	void AnimatorBlockBase::GetFrameBlendKey(const AnimationClip& clip, const float key, const std::vector<std::int16_t>& remap_table, std::vector<KeyData>& dst)
 	{
-		const size_t v1_size = v1.size();
-		const size_t v2_size = v2.size();
-		assert(v1_size == v2_size);
-
-		for (size_t i = 0; i < v1_size; ++i)
-		{
-			const auto& key_1 = v1.at(i);
-			const auto& key_2 = v2.at(i);
-
-			dst.at(i).translate = VECTOR3::Lerp(key_1.translate, key_2.translate, ratio);
-			dst.at(i).scale = VECTOR3::Lerp(key_1.scale, key_2.scale, ratio);
-			dst.at(i).rotate = Quaternion::Slerp(key_1.rotate, key_2.rotate, ratio);
-		}
+		clip.SampleKeyFrame(key, remap_table, dst);
 	}
 
-	void AnimatorBlockBase::BlendKeyFrameAndAlign(
-		const std::vector<KeyData>& v1,
-		const std::vector<KeyData>& v2,
-		const float ratio,
-		const std::unordered_map<std::string, int>* key_index,
-		const std::unordered_map<std::string, int>* node_index,
-		std::vector<KeyData>& dst
-	)
+	const std::vector<std::int16_t>* AnimatorBlockBase::GetRemapTable(const AnimationClip& clip, const AvatarBinding& avatar, BlockInstance& block_instance, const int clip_index) const
 	{
-		const size_t v1_size = v1.size();
-		const size_t v2_size = v2.size();
-		assert(v1_size == v2_size && "The number of elements does not match. AnimatorBlockBase::BlendKeyFrameAndAlign()");
-
-		// Motioñ{[Avatar̃{[̏ԂɒĂ
-		const auto itr_end = node_index->end();
-		const auto itr_find_end = key_index->end();
-		for (auto itr = node_index->begin(); itr != itr_end; ++itr)
+		// uhc[̎q̒ǉɍ킹Ċg
+		auto& caches = block_instance.remap_tables;
+		if (static_cast<int>(caches.size()) <= clip_index)
 		{
-			auto itr_find = key_index->find(itr->first);
-			if (itr_find == itr_find_end)
-				continue;
-
-			const int dst_idx = itr->second;
-			const int key_idx = itr_find->second;
-
-			const auto& key_1 = v1.at(key_idx);
-			const auto& key_2 = v2.at(key_idx);
-
-			dst.at(dst_idx).translate = VECTOR3::Lerp(key_1.translate, key_2.translate, ratio);
-			dst.at(dst_idx).scale = VECTOR3::Lerp(key_1.scale, key_2.scale, ratio);
-			dst.at(dst_idx).rotate = Quaternion::Slerp(key_1.rotate, key_2.rotate, ratio);
+			caches.resize(static_cast<size_t>(clip_index) + 1);
 		}
-	}
 
-	void AnimatorBlockBase::AlignKeyFrame(
-		const std::vector<KeyData>& v,
-		const std::unordered_map<std::string, int>* key_index,
-		const std::unordered_map<std::string, int>* node_index,
-		std::vector<KeyData>& dst
-	)
-	{
-		// Motioñ{[Avatar̃{[̏ԂɒĂ
-		const auto itr_end = node_index->end();
-		const auto itr_find_end = key_index->end();
-		for (auto itr = node_index->begin(); itr != itr_end; ++itr)
+		auto& cache = caches[clip_index];
+		const std::uint32_t motion_serial = clip.GetMotionSerial();
+		if (cache.table == nullptr || cache.motion_serial != motion_serial)
 		{
-			auto itr_find = key_index->find(itr->first);
-			if (itr_find == itr_find_end)
-				continue;
-
-			const int dst_idx = itr->second;
-			const int key_idx = itr_find->second;
-
-			dst.at(dst_idx).translate = v.at(key_idx).translate;
-			dst.at(dst_idx).scale = v.at(key_idx).scale;
-			dst.at(dst_idx).rotate = v.at(key_idx).rotate;
+			cache.table = clip.GetRemapTable(avatar);
+			cache.motion_serial = motion_serial;
 		}
-	}
-
-	void AnimatorBlockBase::GetFrameBlendKey(const AnimationClip& clip, const float key, const std::unordered_map<std::string, int>* node_index, std::vector<KeyData>& dst)
-	{
-		// L[͂ރt[擾
-		const int frame_1 = static_cast<int>(key);
-		const int frame_2 = frame_1 + 1;
-		// uh銄
-		const float blend_ratio = key - static_cast<float>(frame_1); // 0 ~ 1
-		// uh̎s
-		const auto clip_1 = clip.GetKeyFrame(frame_1);
-		const auto clip_2 = clip.GetKeyFrame(frame_2);
-		BlendKeyFrameAndAlign(*clip_1, *clip_2, blend_ratio, clip.GetKeyIndex(), node_index, dst);
+		return cache.table;
 	}
 
 	void AnimatorBlockBase::GetKeyDifference(
 		const std::vector<KeyData>& v,
 		const std::vector<KeyData>& clip,
-		const std::unordered_map<std::string, int>* key_index,
-		const std::unordered_map<std::string, int>* node_index,
+		const std::vector<std::int16_t>& remap_table,
 		std::vector<KeyData>& dst
 	)
 	{
-		// Motioñ{[Avatar̃{[̏ԂɒĂ
-		const auto itr_end = node_index->end();
-		const auto itr_find_end = key_index->end();
-		for (auto itr = node_index->begin(); itr != itr_end; ++itr)
+		// o͐ƃL[͈̔͊O͎QƂȂ
+		const size_t node_num = (std::min)({ remap_table.size(), v.size(), dst.size() });
+		const int key_num = static_cast<int>(clip.size());
+
+		// Avatar̃{[̏ԂMotioñf[^Ƃ̍߂Ă
+		for (size_t dst_idx = 0; dst_idx < node_num; ++dst_idx)
 		{
-			auto itr_find = key_index->find(itr->first);
-			if (itr_find == itr_find_end)
+			const int key_idx = remap_table[dst_idx];
+			if (key_idx < 0 || key_idx >= key_num)
 				continue;
 
-			const int dst_idx = itr->second;
-			const int key_idx = itr_find->second;
-
 			// TODO : ǂ̂悤ɍ߂邩
 			//dst.at(dst_idx).translate = v.at(dst_idx).translate - clip.at(key_idx).translate;
 			//dst.at(dst_idx).scale = v.at(dst_idx).scale / clip.at(key_idx).scale;
@@ -2,6 +2,7 @@
 
 #include "Animation_Defined.h"
 #include "Animator_Transition.h"
+#include "Animator_Instance.h"
 
 #include <string>
 #include <vector>
@@ -54,6 +55,7 @@ namespace TKGEngine::Animations
 		virtual int OnGUI(
 			const GameObjectID goid,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+			const LayerInstance* layer_instance,
 			std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters
 		);
 		void OnGUITransition(const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks, std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters);
@@ -75,10 +77,16 @@ namespace TKGEngine::Animations
 		// ubN̎TransitionԂ
 		std::vector<std::shared_ptr<AnimatorTransition>>* GetTransitions();
 
+		// ubNQƂp[^vfԍ蓖Ă
+		virtual void ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids);
+
 		// O
 		const char* GetName() const;
 		void SetName(const std::string& name);
 
+		// AnimatorƂ̍ĐԂ̏
+		virtual void InitializeInstance(BlockInstance& instance) const = 0;
+
 		// ubN̏Ԃ̍XV(clipȂfalse)
 		virtual bool UpdateBlock(
 			const GameObjectID goid,
@@ -90,8 +98,9 @@ namespace TKGEngine::Animations
 			const float elapsed_time,
 			const float normalize_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-			const std::unordered_map<std::string, int>* node_index
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
+			const AvatarBinding& avatar
 		) = 0;
 		// Aj[V̏̍XV(clipȂfalse)
 		virtual bool UpdateKeyFrame(
@@ -99,7 +108,8 @@ namespace TKGEngine::Animations
 			const bool is_additive,
 			const float normalize_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, int>* node_index,
+			LayerInstance& layer_instance,
+			const AvatarBinding& avatar,
 			std::vector<KeyData>& dst_keydata
 		) = 0;
 
@@ -107,14 +117,15 @@ namespace TKGEngine::Animations
 		virtual void GetNormalizeTime(
 			const float elapsed_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
 			float& weighted_normalize_time,
 			float& normalize_time
 		) = 0;
 		// C[̂ꂩBlock폜ɃubNƂɍ폜̏s
 		virtual void OnRemoveBlock(int removed_index, std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks) = 0;
 		// ubN̊Jn̏
-		virtual void OnReady(const float offset) = 0;
+		virtual void OnReady(const float offset, LayerInstance& layer_instance) = 0;
 		/// <summary>
 		/// Aj[VJڂ邩`FbN
 		/// StateȂExit Timeł̑Jڂl
@@ -124,7 +135,7 @@ namespace TKGEngine::Animations
 		/// <param name="state_transitioning">Jڒǂ</param>
 		/// <param name="normalized_time">o߂K</param>
 		/// <param name="owner_index">gǗXe[g}ṼCfbNX</param>
-		/// <param name="parameters">Jڃp[^̃}bv</param>
+		/// <param name="parameters">p[^̒l̔z(ParameterID̏)</param>
 		/// <param name="blocks">ubNXg</param>
 		/// <param name="duration">Jڂɂ鐳KԂԂ</param>
 		/// <param name="offset">Jڐ̊JnK</param>
@@ -134,7 +145,7 @@ namespace TKGEngine::Animations
 			const bool state_transitioning,
 			const float normalized_time,
 			const int owner_index,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+			std::vector<AnimatorControllerParameter>& parameters,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
 			float& duration,
 			float& offset
@@ -155,40 +166,16 @@ namespace TKGEngine::Animations
 		// ==============================================
 		// protected methods
 		// ==============================================
-		// 2̃Aj[VŃuh
-		void BlendKeyFrame(
-			const std::vector<KeyData>& v1,
-			const std::vector<KeyData>& v2,
-			const float ratio,
-			std::vector<KeyData>& dst
-		);
-		// 2̃Aj[VŃuhȂAAvatar̃f[^ɒ
-		void BlendKeyFrameAndAlign(
-			const std::vector<KeyData>& v1,
-			const std::vector<KeyData>& v2,
-			const float ratio,
-			const std::unordered_map<std::string, int>* key_index,	// Motionf[^̔zT
-			const std::unordered_map<std::string, int>* node_index,	// Avatarf[^̔zT
-			std::vector<KeyData>& dst
-		);
-
-		// Avatar̃f[^ɒ
-		void AlignKeyFrame(
-			const std::vector<KeyData>& v,
-			const std::unordered_map<std::string, int>* key_index,	// Motionf[^̔zT
-			const std::unordered_map<std::string, int>* node_index,	// Avatarf[^̔zT
-			std::vector<KeyData>& dst
-		);
-
-		//t[Ԃ̕ԂL[擾
-		void GetFrameBlendKey(const AnimationClip& clip, const float key, const std::unordered_map<std::string, int>* node_index, std::vector<KeyData>& dst);
+		//t[Ԃ̕ԂL[擾(kς݂̃[V͑ÕL[fR[h)
+		void GetFrameBlendKey(const AnimationClip& clip, const float key, const std::vector<std::int16_t>& remap_table, std::vector<KeyData>& dst);
+		// AnimatorƂɕێNbv̕ϊe[u擾([VύXĂΉ)
+		const std::vector<std::int16_t>* GetRemapTable(const AnimationClip& clip, const AvatarBinding& avatar, BlockInstance& block_instance, int clip_index) const;
 
 		// 2̃L[f[^̍(v - clip)߂
 		void GetKeyDifference(
 			const std::vector<KeyData>& v,
 			const std::vector<KeyData>& clip,
-			const std::unordered_map<std::string, int>* key_index,	// Motionf[^̔zT
-			const std::unordered_map<std::string, int>* node_index,	// Avatarf[^̔zT
+			const std::vector<std::int16_t>& remap_table,	// Avatar̃m[hɕׂMotionf[^̃CfbNX
 			std::vector<KeyData>& dst
 		);
 
@@ -206,9 +193,6 @@ namespace TKGEngine::Animations
 		// ==============================================
 		// protected variables
 		// ==============================================
-		// ubN̎s
-		BlockState m_block_state = BlockState::Ready;
-
 		// g̃ubNID
 		int m_self_block_index = INVALID_BLOCK_INDEX;
 		// Xe[g}ṼubNID
@@ -2,6 +2,8 @@
 #include "Animator_Clip.h"
 #include "Utility/inc/myfunc_math.h"
 
+#include <atomic>
+
 namespace TKGEngine::Animations
 {
 	AnimationClip::AnimationClip()
@@ -15,6 +17,7 @@ namespace TKGEngine::Animations
 		m_sample_rate = clip.m_sample_rate;
 		m_length = clip.m_length;
 		m_rcp_length = clip.m_rcp_length;
+		m_motion_serial = clip.m_motion_serial;
 	}
 
 	AnimationClip& AnimationClip::operator=(const AnimationClip& clip)
@@ -24,6 +27,7 @@ namespace TKGEngine::Animations
 		m_sample_rate = clip.m_sample_rate;
 		m_length = clip.m_length;
 		m_rcp_length = clip.m_rcp_length;
+		m_motion_serial = clip.m_motion_serial;
 		return *this;
 	}
 
@@ -53,6 +57,7 @@ namespace TKGEngine::Animations
 
 	void AnimationClip::AddMotion(const std::string& motion_filepath)
 	{
+		m_motion_serial = IssueMotionSerial();
 		m_motion.Load(motion_filepath);
 		if (m_motion.HasMotion())
 		{
@@ -73,6 +78,7 @@ namespace TKGEngine::Animations
 
 	void AnimationClip::AddMotion(const Motion& motion)
 	{
+		m_motion_serial = IssueMotionSerial();
 		m_motion = motion;
 		if (m_motion.HasMotion())
 		{
@@ -126,9 +132,36 @@ namespace TKGEngine::Animations
 		return m_motion.GetKeyFrame(frame);
 	}
 
+	void AnimationClip::SampleKeyFrame(const float key, const std::vector<std::int16_t>& remap_table, std::vector<KeyData>& dst) const
+	{
+		m_motion.SampleKeyFrame(key, remap_table, dst);
+	}
+
+	const std::vector<KeyData>* AnimationClip::GetReferenceKeyFrame() const
+	{
+		return m_motion.GetReferenceKeyFrame();
+	}
+
 	std::unordered_map<std::string, int>* AnimationClip::GetKeyIndex() const
 	{
 		return m_motion.GetKeyIndex();
 	}
 
+	const std::vector<std::int16_t>* AnimationClip::GetRemapTable(const AvatarBinding& avatar) const
+	{
+		return m_motion.GetRemapTable(avatar);
+	}
+
+	std::uint32_t AnimationClip::GetMotionSerial() const
+	{
+		return m_motion_serial;
+	}
+
+	std::uint32_t AnimationClip::IssueMotionSerial()
+	{
+		// 0̓[VȂ\̂1甭s
+		static std::atomic<std::uint32_t> s_serial = 0;
+		return s_serial.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
 }// namespace TKGEngine::Animations
@@ -37,8 +37,17 @@ namespace TKGEngine::Animations
 
 		// t[̃L[f[^擾
 		std::vector<KeyData>* GetKeyFrame(const int frame) const;
+		// wt[ʒu(ŕԂ)̃L[f[^Avatar̃m[hɎ擾
+		void SampleKeyFrame(float key, const std::vector<std::int16_t>& remap_table, std::vector<KeyData>& dst) const;
+		// ZC[̍̊ƂȂL[f[^
+		const std::vector<KeyData>* GetReferenceKeyFrame() const;
 		// Motionf[^̐񏇃}bv
 		std::unordered_map<std::string, int>* GetKeyIndex() const;
+		// Avatar̃m[hMotionf[^̃CfbNXւ̕ϊe[u([VȂnullptr)
+		// Nbv͕AnimatorŋL̂ŁAʂAnimatorƂɕێ
+		const std::vector<std::int16_t>* GetRemapTable(const AvatarBinding& avatar) const;
+		// [Vݒ肷邽тɕς鎯ʔԍ(0̓[VȂ)
+		std::uint32_t GetMotionSerial() const;
 
 		// ==============================================
 		// public variables
@@ -76,7 +85,8 @@ namespace TKGEngine::Animations
 		// ==============================================
 		// private methods
 		// ==============================================
-		/* nothing */
+		// Vʔԍ𔭍s
+		static std::uint32_t IssueMotionSerial();
 
 		// ==============================================
 		// private variables
@@ -89,6 +99,9 @@ namespace TKGEngine::Animations
 		// Kgpplengtht
 		float m_rcp_length = 0.0f;
 
+		// ݒ蒆̃[V̎ʔԍ
+		std::uint32_t m_motion_serial = 0;
+
 	};
 }// namespace TKGEngine::Animations
 
@@ -23,7 +23,7 @@ namespace TKGEngine::Animations
 	}
 
 #ifdef USE_IMGUI
-	void AnimatorControllerLayer::OnGUIStateMachine(const GameObjectID goid, std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters)
+	void AnimatorControllerLayer::OnGUIStateMachine(const GameObjectID goid, const LayerInstance* layer_instance, std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters)
 	{
 		// Entry̐ݒ
 		std::static_pointer_cast<AnimatorStateMachine>(m_blocks.at(m_gui_current_select_state_machine_index))->OnGUIEntry(m_blocks, parameters);
@@ -89,7 +89,7 @@ namespace TKGEngine::Animations
 						}
 					}
 					// I𒆃Xe[g}VGUI\
-					const int select_sm_index = std::static_pointer_cast<AnimatorStateMachine>(m_blocks.at(m_gui_current_select_state_machine_index))->OnGUIStateMachine(goid, m_blocks, parameters);
+					const int select_sm_index = std::static_pointer_cast<AnimatorStateMachine>(m_blocks.at(m_gui_current_select_state_machine_index))->OnGUIStateMachine(goid, m_blocks, (layer_instance && IsValidInstance(*layer_instance)) ? layer_instance : nullptr, parameters);
 					// ݑIĂXe[g}ṼCfbNXXV
 					if (select_sm_index != INVALID_BLOCK_INDEX)
 					{
@@ -171,6 +171,7 @@ namespace TKGEngine::Animations
 		std::static_pointer_cast<AnimatorStateMachine>(m_blocks.at(state->GetOwnerStateMachineIndex()))->AddChildStateAndTree(new_block_index);
 		// BlockXgɒǉ
 		m_blocks.emplace_back(state);
+		++m_revision;
 
 		return state;
 	}
@@ -190,6 +191,7 @@ namespace TKGEngine::Animations
 		std::static_pointer_cast<AnimatorStateMachine>(m_blocks.at(state->GetOwnerStateMachineIndex()))->AddChildStateAndTree(new_block_index);
 		// BlockXgɒǉ
 		m_blocks.emplace_back(state);
+		++m_revision;
 
 		return state;
 	}
@@ -209,6 +211,7 @@ namespace TKGEngine::Animations
 		std::static_pointer_cast<AnimatorStateMachine>(m_blocks.at(tree->GetOwnerStateMachineIndex()))->AddChildStateAndTree(new_block_index);
 		// BlockXgɒǉ
 		m_blocks.emplace_back(tree);
+		++m_revision;
 
 		return tree;
 	}
@@ -249,6 +252,7 @@ namespace TKGEngine::Animations
 		// 폜̏s
 		const auto& removed_block = m_blocks.at(index);
 		removed_block->OnRemoveBlock(index, m_blocks);
+		++m_revision;
 	}
 
 	void AnimatorControllerLayer::SetAvatarMask(const AvatarMask& mask)
@@ -271,12 +275,41 @@ namespace TKGEngine::Animations
 		m_layer_name = name;
 	}
 
+	void AnimatorControllerLayer::CreateInstance(LayerInstance& instance) const
+	{
+		instance.layer = this;
+		instance.revision = m_revision;
+		// ubNƓтōĐԂmۂ
+		const size_t block_num = m_blocks.size();
+		instance.blocks.clear();
+		instance.blocks.resize(block_num);
+		for (size_t i = 0; i < block_num; ++i)
+		{
+			m_blocks[i]->InitializeInstance(instance.blocks[i]);
+		}
+	}
+
+	bool AnimatorControllerLayer::IsValidInstance(const LayerInstance& instance) const
+	{
+		return instance.layer == this && instance.revision == m_revision;
+	}
+
+	void AnimatorControllerLayer::ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids)
+	{
+		m_weight_parameter_id = FindParameterID(parameter_ids, m_weight_parameter);
+		for (const auto& block : m_blocks)
+		{
+			block->ResolveParameterIDs(parameter_ids);
+		}
+	}
+
 	void AnimatorControllerLayer::ApplyAnimation(
 		const GameObjectID goid,
 		const float elapsed_time,
 		const bool is_root,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-		const std::unordered_map<std::string, int>* node_index,
+		LayerInstance& layer_instance,
+		std::vector<AnimatorControllerParameter>& parameters,
+		const AvatarBinding& avatar,
 		const std::vector<int>& enable_nodes,
 		std::vector<KeyData>& data
 	)
@@ -291,16 +324,8 @@ namespace TKGEngine::Animations
 		float weight_param = 1.0f;
 		if (m_use_weight_parameter)
 		{
-			// p[^猟
-			const auto itr_find = parameters.find(m_weight_parameter);
-			if (itr_find != parameters.end())
-			{
-				// Floatł邱ƂmF
-				if (itr_find->second->type == AnimatorControllerParameter::Type::Float)
-				{
-					weight_param = MyMath::Clamp(itr_find->second->default_float, 0.0f, 1.0f);
-				}
-			}
+			// FloatłȂΏZȂ
+			weight_param = MyMath::Clamp(GetFloatParameter(parameters, m_weight_parameter_id, 1.0f), 0.0f, 1.0f);
 		}
 		// RootXe[g}VKeydataɓKp
 		root_statemachine->ApplyKeyFrameData
@@ -313,8 +338,9 @@ namespace TKGEngine::Animations
 			m_avatar_mask.GetWeights(),
 			m_avatar_mask.GetMasks(),
 			m_blocks,
+			layer_instance,
 			parameters,
-			node_index,
+			avatar,
 			enable_nodes,
 			data
 		);
@@ -24,7 +24,7 @@ namespace TKGEngine::Animations
 		AnimatorControllerLayer& operator=(const AnimatorControllerLayer&) = delete;
 
 #ifdef USE_IMGUI
-		void OnGUIStateMachine(const GameObjectID goid, std::unordered_map<std::string, std::shared_ptr<Animations::AnimatorControllerParameter>>& parameters);
+		void OnGUIStateMachine(const GameObjectID goid, const LayerInstance* layer_instance, std::unordered_map<std::string, std::shared_ptr<Animations::AnimatorControllerParameter>>& parameters);
 		void OnGUIMask(const std::vector<std::string>* bone_names, std::unordered_map<std::string, std::shared_ptr<Animations::AnimatorControllerParameter>>& parameters);
 #endif // USE_IMGUI
 
@@ -51,13 +51,21 @@ namespace TKGEngine::Animations
 		// C[
 		const char* GetName() const;
 		void SetName(const std::string& name);
+		// AnimatorƂ̍ĐԂ쐬
+		void CreateInstance(LayerInstance& instance) const;
+		// ĐԂ݂̃C[̍\쐬ꂽ̂
+		bool IsValidInstance(const LayerInstance& instance) const;
+		// C[ŎQƂp[^vfԍ蓖Ă
+		void ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids);
+
 		// ݂̃L[t[f[^vZĕԂ
 		void ApplyAnimation(
 			const GameObjectID goid,
 			const float elapsed_time,
 			const bool is_root,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-			const std::unordered_map<std::string, int>* node_index,
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
+			const AvatarBinding& avatar,
 			const std::vector<int>& enable_nodes,
 			std::vector<KeyData>& data
 		);
@@ -102,6 +110,7 @@ namespace TKGEngine::Animations
 		bool m_use_weight_parameter = false;
 		// WeightɏZp[^
 		std::string m_weight_parameter;
+		ParameterID m_weight_parameter_id = INVALID_PARAMETER_ID;
 		// C[
 		std::string m_layer_name;
 		// C[̃}XNf[^
@@ -111,6 +120,8 @@ namespace TKGEngine::Animations
 
 		// C[ɑ݂SẴAj[VubN
 		std::vector<std::shared_ptr<AnimatorBlockBase>> m_blocks;
+		// ubN̒ǉA폜̉(ĐԂ̍蒼̔Ɏgp)
+		std::uint32_t m_revision = 0;
 	};
 
 
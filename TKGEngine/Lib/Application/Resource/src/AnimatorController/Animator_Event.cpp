@@ -195,7 +195,7 @@ namespace TKGEngine::Animations
 		return false;
 	}
 
-	void AnimatorEvent::ExecuteEvent(GameObjectID goid)
+	void AnimatorEvent::ExecuteEvent(GameObjectID goid) const
 	{
 		// Ήp[^nāA֐s
 		switch (m_event_parameter_type)
@@ -210,8 +210,6 @@ namespace TKGEngine::Animations
 				MonoBehaviourManager::ExecuteFunction(goid, m_class_type_name, m_function_name, m_float_parameter);
 				break;
 		}
-		// sς݃tO𗧂Ă
-		m_is_called = true;
 	}
 
 
@@ -59,11 +59,6 @@ namespace TKGEngine::Animations
 		void SetEventTime(const float time);
 		inline float GetEventTime() const;
 
-		// sς݃tO̎擾
-		inline bool IsExecutedEvent() const;
-		// sς݃tÕZbg
-		inline void ResetExecutedFlag();
-
 		/// <summary>
 		/// Cxg΂鎞Ԃ`FbN
 		/// </summary>
@@ -72,7 +67,8 @@ namespace TKGEngine::Animations
 		bool CheckTime(const float normalized_time) const;
 
 		// Cxgs
-		void ExecuteEvent(GameObjectID goid);
+		// sς݃tOAnimatorƂ̍ĐԂŊǗ
+		void ExecuteEvent(GameObjectID goid) const;
 
 
 		// ==============================================
@@ -117,8 +113,6 @@ namespace TKGEngine::Animations
 
 		// Cxg̈̌^
 		EventParameterType m_event_parameter_type = EventParameterType::Void;
-		// ݂̃[vŊ֐Ă΂ꂽ
-		bool m_is_called = false;
 
 		// NX
 		std::string m_class_type_name;
@@ -154,16 +148,6 @@ namespace TKGEngine::Animations
 		return m_time;
 	}
 
-	inline bool AnimatorEvent::IsExecutedEvent() const
-	{
-		return m_is_called;
-	}
-
-	inline void AnimatorEvent::ResetExecutedFlag()
-	{
-		m_is_called = false;
-	}
-
 
 }// namespace TKGEngine::Animations
 
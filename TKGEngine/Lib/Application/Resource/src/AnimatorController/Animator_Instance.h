@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Animation_Defined.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <memory>
+#include <cstdint>
+
+namespace TKGEngine::Animations
+{
+	class AnimatorControllerLayer;
+
+	/// <summary>
+	/// Xe[g}V̍XV
+	/// </summary>
+	enum class StateMachineState
+	{
+		Entry,
+		Play,
+		Transition,
+		InterruptTransition
+	};
+
+	/// <summary>
+	/// AnimatorƂɎXe[g}V̍Đ
+	/// </summary>
+	struct StateMachineInstance
+	{
+		// Xe[g}V̌
+		StateMachineState state = StateMachineState::Entry;
+		// ݂̃ubN
+		int current_block_index = INVALID_BLOCK_INDEX;
+		float current_normalize_time = 0.0f;
+		// 荞ݑJڂꂽƂ̑Jڐ̃ubNCfbNX
+		int interrupted_next_block_index = INVALID_BLOCK_INDEX;
+		// Jڐ̃ubN
+		int next_block_index = INVALID_BLOCK_INDEX;
+		float next_normalize_time = 0.0f;
+		// Transition̎cJڐK
+		float duration_normalize_timer = 0.0f;
+		// Transition̑Jڎ
+		float duration_start_time = 0.0f;
+
+		// Jڂt[
+		bool on_transition_frame = false;
+		// s̃ubN̍XVLǂ
+		bool current_valid_update = false;
+		bool next_valid_update = false;
+
+		// o͂錻݂̃Aj[V
+		std::vector<KeyData> keyframe;
+		// vZɎgpAj[V
+		std::vector<KeyData> use_calc_keyframes[2];
+	};
+
+	/// <summary>
+	/// AnimatorƂɎuhc[̌vZpf[^
+	/// </summary>
+	struct BlendTreeInstance
+	{
+		// sChildren̎QƃCfbNX
+		static constexpr int INVALID_CHILD_INDEX = -1;
+
+		/// <summary>
+		/// uhf[^
+		/// </summary>
+		struct BlendData
+		{
+			int child_index = INVALID_CHILD_INDEX;
+			float weight = 0.0f;
+
+			void Clear()
+			{
+				child_index = INVALID_CHILD_INDEX;
+				weight = 0.0f;
+			}
+		};
+
+		// q̐ɍ킹ăobt@TCYύX
+		void Resize(const size_t child_num)
+		{
+			blend_data.resize(child_num);
+			influences.resize(child_num);
+		}
+
+		std::vector<BlendData> blend_data;
+		// uhf[^
+		int blend_data_num = 0;
+		// zohԎɉexĂobt@
+		std::vector<float> influences;
+		// q[Vf[^擾Aj[Vuh邽߂̃obt@(uhq)
+		std::vector<std::vector<KeyData>> calc_child_keyframes;
+		// 1xɃuh邽߂̃obt@̎QƂƏd
+		std::vector<const std::vector<KeyData>*> blend_sources;
+		std::vector<float> blend_weights;
+	};
+
+	/// <summary>
+	/// AnimatorƂɉNbṽ{[ϊe[u
+	/// </summary>
+	struct RemapTableCache
+	{
+		// ̃Nbṽ[V̎ʔԍ([VύXꂽ)
+		std::uint32_t motion_serial = 0;
+		// ResMotionێAAnimatorControllerInstance::remap_avatarɑ΂e[u
+		const std::vector<std::int16_t>* table = nullptr;
+	};
+
+	/// <summary>
+	/// AnimatorƂɎubN̍Đ
+	/// </summary>
+	struct BlockInstance
+	{
+		// Cxgwrapɂ锭΃~XȂ߂ɑOt[normalize_timeێ
+		float prev_normalize_time = 0.0f;
+		// CxgƂ̎sς݃tO
+		std::vector<bool> executed_events;
+		// ubN̎ނɉĊmۂ
+		std::unique_ptr<StateMachineInstance> state_machine;
+		std::unique_ptr<BlendTreeInstance> blend_tree;
+		// NbvƂ̕ϊe[u(Xe[g1Auhc[͎q̏)
+		std::vector<RemapTableCache> remap_tables;
+	};
+
+	/// <summary>
+	/// AnimatorƂɎC[̍Đ
+	/// </summary>
+	struct LayerInstance
+	{
+		// 쐬̃C[ƁA쐬̃C[̍\̍XV
+		const AnimatorControllerLayer* layer = nullptr;
+		std::uint32_t revision = 0;
+		// C[̃ubNƓт̍Đ
+		std::vector<BlockInstance> blocks;
+
+		inline StateMachineInstance& GetStateMachine(const int block_index);
+		inline const StateMachineInstance& GetStateMachine(const int block_index) const;
+		inline BlendTreeInstance& GetBlendTree(const int block_index);
+		inline const BlendTreeInstance& GetBlendTree(const int block_index) const;
+	};
+
+	/// <summary>
+	/// LAnimatorControllerɑ΂āAAnimatorƂɎĐ
+	/// </summary>
+	struct AnimatorControllerInstance
+	{
+		// 쐬̃p[^̍XV
+		std::uint32_t parameter_revision = 0;
+		// AnimatorƂ̃p[^̒l(ParameterID̃Xbgԍ̏A󂫃XbgidINVALID_PARAMETER_ID)
+		std::vector<AnimatorControllerParameter> parameters;
+		// C[Ƃ̍Đ
+		std::vector<LayerInstance> layers;
+		// ϊe[uAvatar(ςSẴubÑe[u)
+		std::weak_ptr<const void> remap_avatar;
+	};
+
+	// --------------------------------------------------------------
+	// inline
+	// --------------------------------------------------------------
+	inline StateMachineInstance& LayerInstance::GetStateMachine(const int block_index)
+	{
+		return *blocks[block_index].state_machine;
+	}
+
+	inline const StateMachineInstance& LayerInstance::GetStateMachine(const int block_index) const
+	{
+		return *blocks[block_index].state_machine;
+	}
+
+	inline BlendTreeInstance& LayerInstance::GetBlendTree(const int block_index)
+	{
+		return *blocks[block_index].blend_tree;
+	}
+
+	inline const BlendTreeInstance& LayerInstance::GetBlendTree(const int block_index) const
+	{
+		return *blocks[block_index].blend_tree;
+	}
+
+}// namespace TKGEngine::Animations
@@ -26,13 +26,14 @@ namespace TKGEngine::Animations
 	int AnimatorState::OnGUI(
 		const GameObjectID goid,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+		const LayerInstance* layer_instance,
 		std::unordered_map<std::string, std::shared_ptr<Animations::AnimatorControllerParameter>>& parameters
 	)
 	{
 		ImGui::IDWrapped id(this);
 
 		// BlockBaseOnGUI(ubNύXƕ\)
-		AnimatorBlockBase::OnGUI(goid, blocks, parameters);
+		AnimatorBlockBase::OnGUI(goid, blocks, layer_instance, parameters);
 
 		// Clip
 		{
@@ -217,7 +218,18 @@ namespace TKGEngine::Animations
 		m_events.erase(m_events.begin() + index);
 	}
 
+	void AnimatorState::ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids)
+	{
+		AnimatorBlockBase::ResolveParameterIDs(parameter_ids);
+		m_speed_parameter_id = FindParameterID(parameter_ids, m_speed_parameter);
+	}
+
 	// Clip̎擾XV͂Ȃ̂Ŗ߂lfalse
+	void AnimatorState::InitializeInstance(BlockInstance& instance) const
+	{
+		instance.executed_events.assign(m_events.size(), false);
+	}
+
 	bool AnimatorState::UpdateBlock(
 		const GameObjectID goid,
 		const bool is_root_layer,
@@ -228,8 +240,9 @@ namespace TKGEngine::Animations
 		const float elapsed_time,
 		const float normalize_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-		const std::unordered_map<std::string, int>* node_index
+		LayerInstance& layer_instance,
+		std::vector<AnimatorControllerParameter>& parameters,
+		const AvatarBinding& avatar
 	)
 	{
 		// TransitionɂJڃ`FbN
@@ -243,7 +256,7 @@ namespace TKGEngine::Animations
 			{
 				// Jڐ悪Xe[g}V̑Jڃf[^Zbg
 				const int next_block_owner_index = blocks.at(next)->GetOwnerStateMachineIndex();
-				std::static_pointer_cast<AnimatorStateMachine>(blocks.at(next_block_owner_index))->SetNextData(goid, next, duration, offset, blocks);
+				std::static_pointer_cast<AnimatorStateMachine>(blocks.at(next_block_owner_index))->SetNextData(goid, next, duration, offset, blocks, layer_instance);
 			}
 		}
 		// Cxg̔΃`FbN
@@ -252,18 +265,26 @@ namespace TKGEngine::Animations
 			if (event_num == 0)
 				return false;
 
+			auto& block_instance = layer_instance.blocks[m_self_block_index];
+			auto& executed_events = block_instance.executed_events;
+			// GUIł̃CxgǉA폜ɍ킹
+			if (executed_events.size() != event_num)
+			{
+				executed_events.resize(event_num, false);
+			}
+
 			// 0 ~ 1.0ɂ܂߂K
 			const float wrapped_time = normalize_time - static_cast<int>(normalize_time);
-			const float prev_wrapped_time = m_prev_normalize_time - static_cast<int>(m_prev_normalize_time);
+			const float prev_wrapped_time = block_instance.prev_normalize_time - static_cast<int>(block_instance.prev_normalize_time);
 
 			// 1ĂȂSẴCxgs
 			const bool is_next_loop = (wrapped_time < prev_wrapped_time) ? true : false;
 			// CxgƂɃ`FbNȂs
 			for (size_t i = 0; i < event_num; ++i)
 			{
-				auto& event = m_events.at(i);
+				const auto& event = m_events.at(i);
 				// sς݃tO̊mF
-				if (event.IsExecutedEvent())
+				if (executed_events[i])
 				{
 					continue;
 				}
@@ -273,6 +294,7 @@ namespace TKGEngine::Animations
 				{
 					// s
 					event.ExecuteEvent(goid);
+					executed_events[i] = true;
 				}
 				// wrapĂȂȂoߎԂ̊mF
 				else
@@ -281,6 +303,7 @@ namespace TKGEngine::Animations
 					{
 						// s
 						event.ExecuteEvent(goid);
+						executed_events[i] = true;
 					}
 				}
 			}
@@ -288,14 +311,11 @@ namespace TKGEngine::Animations
 			// 1CxgtOZbg
 			if (is_next_loop)
 			{
-				for (auto& event : m_events)
-				{
-					event.ResetExecutedFlag();
-				}
+				executed_events.assign(event_num, false);
 			}
 
 			// wrap1.0Ȃ邽߂ɒlێ
-			m_prev_normalize_time = normalize_time;
+			block_instance.prev_normalize_time = normalize_time;
 		}
 
 		return false;
@@ -306,7 +326,8 @@ namespace TKGEngine::Animations
 		const bool is_additive,
 		const float normalize_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, int>* node_index,
+		LayerInstance& layer_instance,
+		const AvatarBinding& avatar,
 		std::vector<KeyData>& dst_keydata
 	)
 	{
@@ -315,6 +336,12 @@ namespace TKGEngine::Animations
 		{
 			return false;
 		}
+		// Avatar̃m[hւ̕ϊe[u
+		const auto* remap_table = GetRemapTable(m_clip, avatar, layer_instance.blocks[m_self_block_index], 0);
+		if (!remap_table)
+		{
+			return false;
+		}
 
 		const float length = m_clip.GetLength();
 		const float rate = m_clip.GetSampleRate();
@@ -378,42 +405,40 @@ namespace TKGEngine::Animations
 		if (key_time >= length)
 		{
 			const int frame = static_cast<int>(length * rate);
-			auto clip = m_clip.GetKeyFrame(frame);
-			AlignKeyFrame(*clip, m_clip.GetKeyIndex(), node_index, dst_keydata);
+			m_clip.SampleKeyFrame(static_cast<float>(frame), *remap_table, dst_keydata);
 		}
 		// 鎞Ԃ͂2̃Aj[Vsuh
 		else
 		{
 			// t[ڂkey
 			const float key = key_time * rate;
-			GetFrameBlendKey(m_clip, key, node_index, dst_keydata);
+			GetFrameBlendKey(m_clip, key, *remap_table, dst_keydata);
 		}
 
 		// ZC[͍߂
 		if (!is_root_layer && is_additive)
 		{
-			GetKeyDifference(dst_keydata, *m_clip.GetKeyFrame(0), m_clip.GetKeyIndex(), node_index, dst_keydata);
+			GetKeyDifference(dst_keydata, *m_clip.GetReferenceKeyFrame(), *remap_table, dst_keydata);
 		}
 
 		// keydata̎擾ł
 		return true;
 	}
 
-	void AnimatorState::OnReady(const float offset)
+	void AnimatorState::OnReady(const float offset, LayerInstance& layer_instance)
 	{
+		auto& block_instance = layer_instance.blocks[m_self_block_index];
 		// O̍ĐԂ
-		m_prev_normalize_time = offset;
+		block_instance.prev_normalize_time = offset;
 		// CxgtOׂăZbg
-		for(auto& event : m_events)
-		{
-			event.ResetExecutedFlag();
-		}
+		block_instance.executed_events.assign(m_events.size(), false);
 	}
 
 	void AnimatorState::GetNormalizeTime(
 		const float elapsed_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+		LayerInstance& layer_instance,
+		std::vector<AnimatorControllerParameter>& parameters,
 		float& weighted_normalize_time,
 		float& normalize_time
 	)
@@ -422,16 +447,8 @@ namespace TKGEngine::Animations
 		float speed_param = 1.0f;
 		if(m_use_speed_parameter)
 		{
-			// p[^猟
-			const auto itr_find = parameters.find(m_speed_parameter);
-			if(itr_find != parameters.end())
-			{
-				// Floatł邱ƂmF
-				if(itr_find->second->type == AnimatorControllerParameter::Type::Float)
-				{
-					speed_param = MyMath::Max(itr_find->second->default_float, 0.0f);
-				}
-			}
+			// FloatłȂΏZȂ
+			speed_param = MyMath::Max(GetFloatParameter(parameters, m_speed_parameter_id, 1.0f), 0.0f);
 		}
 		// SpeedZ
 		speed_param *= m_speed;
@@ -42,6 +42,9 @@ namespace TKGEngine::Animations
 		void AddEvent(const std::string& class_type_name, const std::string& func_name, const float normalize_time, float parameter);
 		void RemoveEvent(int index);
 
+		// SpeedɏZp[^ƑJڏ̃p[^vfԍ蓖Ă
+		void ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids) override;
+
 		// ==============================================
 		// public variables
 		// ==============================================
@@ -73,10 +76,13 @@ namespace TKGEngine::Animations
 		int OnGUI(
 			const GameObjectID goid,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+			const LayerInstance* layer_instance,
 			std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters
 		) override;
 #endif// #ifdef USE_IMGUI
 
+		void InitializeInstance(BlockInstance& instance) const override;
+
 		bool UpdateBlock(
 			const GameObjectID goid,
 			const bool is_root_layer,
@@ -87,24 +93,27 @@ namespace TKGEngine::Animations
 			const float elapsed_time,
 			const float normalize_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-			const std::unordered_map<std::string, int>* node_index
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
+			const AvatarBinding& avatar
 		) override;
 		bool UpdateKeyFrame(
 			const bool is_root_layer,
 			const bool is_additive,
 			const float normalize_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, int>* node_index,
+			LayerInstance& layer_instance,
+			const AvatarBinding& avatar,
 			std::vector<KeyData>& dst_keydata
 		) override;
-		void OnReady(const float offset) override;
+		void OnReady(const float offset, LayerInstance& layer_instance) override;
 
 		// ̃ubNspeedlengthlt[KoߎԂƁAspeedlȂKoߎԂԂ
 		void GetNormalizeTime(
 			const float elapsed_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
 			float& weighted_normalize_time,
 			float& normalize_time
 		) override;
@@ -124,12 +133,11 @@ namespace TKGEngine::Animations
 		bool m_use_speed_parameter = false;
 		// SpeedɏZp[^
 		std::string m_speed_parameter;
+		ParameterID m_speed_parameter_id = INVALID_PARAMETER_ID;
 		// JԂ
 		WrapMode m_wrap_mode = WrapMode::Loop;
 		// Cxg
 		std::vector<AnimatorEvent> m_events;
-		// Cxgwrapɂ锭΃~XȂ߂ɑOt[normalize_timeێ
-		float m_prev_normalize_time = 0.0f;
 	};
 
 }// namespace TKGEngine::Animations
@@ -2,6 +2,7 @@
 #include "Animator_StateMachine.h"
 
 #include "Animator_State.h"
+#include "Animation_Blend.h"
 
 #include "Systems/inc/ITime.h"
 #include "Systems/inc/LogSystem.h"
@@ -14,23 +15,13 @@ namespace TKGEngine::Animations
 	AnimatorStateMachine::AnimatorStateMachine()
 		: AnimatorBlockBase(BlockType::StateMachine)
 	{
-		// {[̗vfm
-		m_keyframe.resize(MAX_BONES);
-		for (auto& calc_keyframe : m_use_calc_keyframes)
-		{
-			calc_keyframe.resize(MAX_BONES);
-		}
+		/* nothing */
 	}
 
 	AnimatorStateMachine::AnimatorStateMachine(const char* name)
 		: AnimatorBlockBase(BlockType::StateMachine, name)
 	{
-		// {[̗vfm
-		m_keyframe.resize(MAX_BONES);
-		for (auto& calc_keyframe : m_use_calc_keyframes)
-		{
-			calc_keyframe.resize(MAX_BONES);
-		}
+		/* nothing */
 	}
 
 #ifdef USE_IMGUI
@@ -53,6 +44,7 @@ namespace TKGEngine::Animations
 	int AnimatorStateMachine::OnGUIStateMachine(
 		const GameObjectID goid,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+		const LayerInstance* layer_instance,
 		std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters
 	)
 	{
@@ -68,13 +60,15 @@ namespace TKGEngine::Animations
 			OnGUISelectBlock(im_filter, blocks, m_gui_current_select_block_index);
 		}
 		// Đ̃ubN\
+		if (layer_instance)
 		{
+			const auto& sm_instance = layer_instance->GetStateMachine(m_self_block_index);
 			if (ImGui::BeginChild("Playing State data", ImVec2(0.0f, 80.0f), true))
 			{
 				// State
 				ImGui::Text("State : ");
 				ImGui::AlignedSameLine(0.7f);
-				switch (m_state_machine_state)
+				switch (sm_instance.state)
 				{
 					case StateMachineState::Entry:
 						ImGui::Text("Entry");
@@ -93,20 +87,20 @@ namespace TKGEngine::Animations
 				// current
 				ImGui::Text("Current : ");
 				ImGui::AlignedSameLine(0.7f);
-				std::string current_data = (m_current_block_index != INVALID_BLOCK_INDEX) ? blocks.at(m_current_block_index)->GetName() : "";
-				current_data += " (" + std::to_string(m_current_normalize_time) + ')';
+				std::string current_data = (sm_instance.current_block_index != INVALID_BLOCK_INDEX) ? blocks.at(sm_instance.current_block_index)->GetName() : "";
+				current_data += " (" + std::to_string(sm_instance.current_normalize_time) + ')';
 				ImGui::Text(current_data.c_str());
 				// next
 				ImGui::Text("Next : ");
 				ImGui::AlignedSameLine(0.7f);
-				if (m_next_block_index == INVALID_BLOCK_INDEX)
+				if (sm_instance.next_block_index == INVALID_BLOCK_INDEX)
 				{
 					ImGui::Text("");
 				}
 				else
 				{
-					std::string next_data = blocks.at(m_next_block_index)->GetName();
-					next_data += " (" + std::to_string(m_next_normalize_time) + ')';
+					std::string next_data = blocks.at(sm_instance.next_block_index)->GetName();
+					next_data += " (" + std::to_string(sm_instance.next_normalize_time) + ')';
 					ImGui::Text(next_data.c_str());
 				}
 
@@ -119,7 +113,7 @@ namespace TKGEngine::Animations
 		{
 			if (m_gui_current_select_block_index != INVALID_BLOCK_INDEX)
 			{
-				next_state_machine_index = blocks.at(m_gui_current_select_block_index)->OnGUI(goid, blocks, parameters);
+				next_state_machine_index = blocks.at(m_gui_current_select_block_index)->OnGUI(goid, blocks, layer_instance, parameters);
 				blocks.at(m_gui_current_select_block_index)->OnGUIEventFunction(goid);
 			}
 			ImGui::EndChild();
@@ -130,6 +124,7 @@ namespace TKGEngine::Animations
 	int AnimatorStateMachine::OnGUI(
 		const GameObjectID goid,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+		const LayerInstance* layer_instance,
 		std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters
 	)
 	{
@@ -142,7 +137,7 @@ namespace TKGEngine::Animations
 		if (m_self_block_index != ROOT_STATEMACHINE_BLOCK_INDEX)
 		{
 			// BlockBaseOnGUI(ubNύXƕ\)
-			AnimatorBlockBase::OnGUI(goid, blocks, parameters);
+			AnimatorBlockBase::OnGUI(goid, blocks, layer_instance, parameters);
 		}
 		else
 		{
@@ -317,8 +312,17 @@ namespace TKGEngine::Animations
 		return tr;
 	}
 
+	void AnimatorStateMachine::ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids)
+	{
+		AnimatorBlockBase::ResolveParameterIDs(parameter_ids);
+		for (const auto& transition : m_entry_transitions)
+		{
+			transition->ResolveParameterIDs(parameter_ids);
+		}
+	}
+
 	int AnimatorStateMachine::CheckEntryTransition(
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+		std::vector<AnimatorControllerParameter>& parameters,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
 		float& offset
 	)
@@ -342,42 +346,45 @@ namespace TKGEngine::Animations
 		const int next,
 		const float duration,
 		const float offset,
-		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks
+		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+		LayerInstance& layer_instance
 	)
 	{
+		auto& sm_instance = layer_instance.GetStateMachine(m_self_block_index);
+
 		// ݂̑JڐƎ̑Jڐ悪ȂXLbv
-		if (m_next_block_index == next)
+		if (sm_instance.next_block_index == next)
 			return;
 
 		// JڒɑJڂꍇ
-		if (m_state_machine_state == StateMachineState::Transition || m_state_machine_state == StateMachineState::InterruptTransition)
+		if (sm_instance.state == StateMachineState::Transition || sm_instance.state == StateMachineState::InterruptTransition)
 		{
 			// 荞ݑJڑȎJڐێ
-			if (m_state_machine_state == StateMachineState::Transition)
+			if (sm_instance.state == StateMachineState::Transition)
 			{
-				m_interrupted_next_block_index = m_next_block_index;
+				sm_instance.interrupted_next_block_index = sm_instance.next_block_index;
 				// 荞ݑJڑȎJڐubNExitĂ
-				blocks.at(m_next_block_index)->ExecuteExitFunction(goid);
+				blocks.at(sm_instance.next_block_index)->ExecuteExitFunction(goid);
 			}
 			// ݂̑JڒKeyDataێĎgp
-			std::copy(m_keyframe.begin(), m_keyframe.end(), m_use_calc_keyframes[0].begin());
+			std::copy(sm_instance.keyframe.begin(), sm_instance.keyframe.end(), sm_instance.use_calc_keyframes[0].begin());
 			// 荞ݏZbg
-			m_state_machine_state = StateMachineState::InterruptTransition;
+			sm_instance.state = StateMachineState::InterruptTransition;
 		}
 		else
 		{
 			// JڏԂɂ
-			m_state_machine_state = StateMachineState::Transition;
+			sm_instance.state = StateMachineState::Transition;
 		}
 		// Jڐ̃ubNԂɂ
-		blocks.at(next)->OnReady(offset);
+		blocks.at(next)->OnReady(offset, layer_instance);
 		// nextubNEnterĂ
 		blocks.at(next)->ExecuteEnterFunction(goid);
 		// JڐƑJڂ̏Zbg
-		m_next_block_index = next;
-		m_next_normalize_time = offset;
-		m_duration_normalize_timer = duration;
-		m_duration_start_time = m_duration_normalize_timer;
+		sm_instance.next_block_index = next;
+		sm_instance.next_normalize_time = offset;
+		sm_instance.duration_normalize_timer = duration;
+		sm_instance.duration_start_time = sm_instance.duration_normalize_timer;
 	}
 
 	void AnimatorStateMachine::AddChildStateAndTree(const int index)
@@ -400,9 +407,9 @@ namespace TKGEngine::Animations
 		m_statemachines.erase(index);
 	}
 
-	const std::vector<KeyData>* AnimatorStateMachine::GetKeyFrame() const
+	const std::vector<KeyData>* AnimatorStateMachine::GetKeyFrame(const LayerInstance& layer_instance) const
 	{
-		return &m_keyframe;
+		return &layer_instance.GetStateMachine(m_self_block_index).keyframe;
 	}
 
 	void AnimatorStateMachine::ApplyKeyFrameData(
@@ -414,16 +421,29 @@ namespace TKGEngine::Animations
 		const float(&weights)[MAX_BONES],
 		const bool(&masks)[MAX_BONES],
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-		const std::unordered_map<std::string, int>* node_index,
+		LayerInstance& layer_instance,
+		std::vector<AnimatorControllerParameter>& parameters,
+		const AvatarBinding& avatar,
 		const std::vector<int>& enable_nodes,
 		std::vector<KeyData>& dst_data
 	)
 	{
 		// Xe[g}VŊǗubNXV
-		UpdateBlock(goid, is_root_layer, is_additive, false, false, false, elapsed_time, 0.0f, blocks, parameters, node_index);
+		UpdateBlock(goid, is_root_layer, is_additive, false, false, false, elapsed_time, 0.0f, blocks, layer_instance, parameters, avatar);
 		// RootXe[g}VԂKeyDatadstɓKp鏈
-		ApplyRootKeyData(is_root_layer, is_additive, layer_weight, weights, masks, enable_nodes, dst_data);
+		ApplyRootKeyData(is_root_layer, is_additive, layer_weight, weights, masks, enable_nodes, layer_instance.GetStateMachine(m_self_block_index), dst_data);
+	}
+
+	void AnimatorStateMachine::InitializeInstance(BlockInstance& instance) const
+	{
+		instance.state_machine = std::make_unique<StateMachineInstance>();
+		// {[̗vfm
+		auto& sm_instance = *instance.state_machine;
+		sm_instance.keyframe.resize(MAX_BONES);
+		for (auto& calc_keyframe : sm_instance.use_calc_keyframes)
+		{
+			calc_keyframe.resize(MAX_BONES);
+		}
 	}
 
 	bool AnimatorStateMachine::UpdateBlock(
@@ -436,126 +456,129 @@ namespace TKGEngine::Animations
 		const float elapsed_time,
 		const float normalize_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-		const std::unordered_map<std::string, int>* node_index
+		LayerInstance& layer_instance,
+		std::vector<AnimatorControllerParameter>& parameters,
+		const AvatarBinding& avatar
 	)
 	{
+		auto& sm_instance = layer_instance.GetStateMachine(m_self_block_index);
+
 		// t[
-		m_current_valid_update = false;
-		m_next_valid_update = false;
-		m_on_transition_frame = false;
+		sm_instance.current_valid_update = false;
+		sm_instance.next_valid_update = false;
+		sm_instance.on_transition_frame = false;
 
 		// Xe[g}V̊Jn
-		if (m_state_machine_state == StateMachineState::Entry)
+		if (sm_instance.state == StateMachineState::Entry)
 		{
 			// EntryubÑCfbNXT
 			float offset = 0.0f;
-			m_current_block_index = CheckEntryTransition(parameters, blocks, offset);
+			sm_instance.current_block_index = CheckEntryTransition(parameters, blocks, offset);
 			// 쐬ȂǂɂEntryݒ̂
-			if (m_current_block_index == INVALID_BLOCK_INDEX)
+			if (sm_instance.current_block_index == INVALID_BLOCK_INDEX)
 			{
 				return false;
 			}
-			m_current_normalize_time = offset;
-			m_state_machine_state = StateMachineState::Play;
+			sm_instance.current_normalize_time = offset;
+			sm_instance.state = StateMachineState::Play;
 			// EntryubNEnterĂ
-			blocks.at(m_current_block_index)->ExecuteEnterFunction(goid);
+			blocks.at(sm_instance.current_block_index)->ExecuteEnterFunction(goid);
 		}
 
 		// ݂̃ubNɂ鎞Ԃ̍XV
 		// StatePlaỹubNʂ̃Xe[g}V̏ꍇ
-		if (m_state_machine_state == StateMachineState::Play || m_next_block_index == INVALID_BLOCK_INDEX)
+		if (sm_instance.state == StateMachineState::Play || sm_instance.next_block_index == INVALID_BLOCK_INDEX)
 		{
 			// current
 			float weighted_norm_time, norm_time;
-			blocks.at(m_current_block_index)->GetNormalizeTime(elapsed_time, blocks, parameters, weighted_norm_time, norm_time);
-			m_current_normalize_time += weighted_norm_time;
+			blocks.at(sm_instance.current_block_index)->GetNormalizeTime(elapsed_time, blocks, layer_instance, parameters, weighted_norm_time, norm_time);
+			sm_instance.current_normalize_time += weighted_norm_time;
 		}
 		else if (
-			m_state_machine_state == StateMachineState::Transition ||
-			m_state_machine_state == StateMachineState::InterruptTransition
+			sm_instance.state == StateMachineState::Transition ||
+			sm_instance.state == StateMachineState::InterruptTransition
 			)
 		{
 			float weighted_norm_time, norm_time;
-			blocks.at(m_current_block_index)->GetNormalizeTime(elapsed_time, blocks, parameters, weighted_norm_time, norm_time);
+			blocks.at(sm_instance.current_block_index)->GetNormalizeTime(elapsed_time, blocks, layer_instance, parameters, weighted_norm_time, norm_time);
 			// current
-			if (m_state_machine_state != StateMachineState::InterruptTransition)
+			if (sm_instance.state != StateMachineState::InterruptTransition)
 			{
 				// 荞ݑJڒ͌̃[V͓Ȃ
-				m_current_normalize_time += weighted_norm_time;
+				sm_instance.current_normalize_time += weighted_norm_time;
 			}
 			// next
 			{
 				float weighted_next_norm_time, next_norm_time;
-				blocks.at(m_next_block_index)->GetNormalizeTime(elapsed_time, blocks, parameters, weighted_next_norm_time, next_norm_time);
-				m_next_normalize_time += weighted_next_norm_time;
+				blocks.at(sm_instance.next_block_index)->GetNormalizeTime(elapsed_time, blocks, layer_instance, parameters, weighted_next_norm_time, next_norm_time);
+				sm_instance.next_normalize_time += weighted_next_norm_time;
 			}
 			// duration
-			m_duration_normalize_timer -= norm_time;
+			sm_instance.duration_normalize_timer -= norm_time;
 
 			// JڊcurrentubNړ
-			if (m_duration_normalize_timer <= 0.0f)
+			if (sm_instance.duration_normalize_timer <= 0.0f)
 			{
 				// currentubNExitĂ
-				blocks.at(m_current_block_index)->ExecuteExitFunction(goid);
+				blocks.at(sm_instance.current_block_index)->ExecuteExitFunction(goid);
 				// next̏currentɃRs[
-				m_state_machine_state = StateMachineState::Play;
-				m_current_block_index = m_next_block_index;
-				m_next_block_index = INVALID_BLOCK_INDEX;
-				m_interrupted_next_block_index = INVALID_BLOCK_INDEX;
-				m_current_normalize_time = m_next_normalize_time;
-				m_duration_normalize_timer = 0.0f;
+				sm_instance.state = StateMachineState::Play;
+				sm_instance.current_block_index = sm_instance.next_block_index;
+				sm_instance.next_block_index = INVALID_BLOCK_INDEX;
+				sm_instance.interrupted_next_block_index = INVALID_BLOCK_INDEX;
+				sm_instance.current_normalize_time = sm_instance.next_normalize_time;
+				sm_instance.duration_normalize_timer = 0.0f;
 			}
 		}
 		// ubN̍XV
 		// StatePlaỹubNʂ̃Xe[g}V̏ꍇ
-		if (m_state_machine_state == StateMachineState::Play || m_next_block_index == INVALID_BLOCK_INDEX)
+		if (sm_instance.state == StateMachineState::Play || sm_instance.next_block_index == INVALID_BLOCK_INDEX)
 		{
 			// current
-			m_current_valid_update = blocks.at(m_current_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, true, false, elapsed_time, m_current_normalize_time, blocks, parameters, node_index);
-			m_current_valid_update |= blocks.at(m_current_block_index)->UpdateKeyFrame(is_root_layer, is_additive, m_current_normalize_time, blocks, node_index, m_keyframe);
+			sm_instance.current_valid_update = blocks.at(sm_instance.current_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, true, false, elapsed_time, sm_instance.current_normalize_time, blocks, layer_instance, parameters, avatar);
+			sm_instance.current_valid_update |= blocks.at(sm_instance.current_block_index)->UpdateKeyFrame(is_root_layer, is_additive, sm_instance.current_normalize_time, blocks, layer_instance, avatar, sm_instance.keyframe);
 			// XVđJڏԂɂȂ
-			if (m_state_machine_state == StateMachineState::Transition)
+			if (sm_instance.state == StateMachineState::Transition)
 			{
-				m_on_transition_frame = true;
+				sm_instance.on_transition_frame = true;
 			}
 		}
-		else if (m_state_machine_state == StateMachineState::Transition)
+		else if (sm_instance.state == StateMachineState::Transition)
 		{
 			// current
-			m_current_valid_update = blocks.at(m_current_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, true, true, elapsed_time, m_current_normalize_time, blocks, parameters, node_index);
+			sm_instance.current_valid_update = blocks.at(sm_instance.current_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, true, true, elapsed_time, sm_instance.current_normalize_time, blocks, layer_instance, parameters, avatar);
 			// 荞ݑJڂĂuh鑊ύX
-			if (m_state_machine_state == StateMachineState::InterruptTransition)
+			if (sm_instance.state == StateMachineState::InterruptTransition)
 			{
 				// currentƌ̑JڐTransition`FbN̂ݍsA荞ݑJڐ̓[V̍XV̂ݍs
-				m_current_valid_update |= blocks.at(m_interrupted_next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, false, true, elapsed_time, m_current_normalize_time, blocks, parameters, node_index);
+				sm_instance.current_valid_update |= blocks.at(sm_instance.interrupted_next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, false, true, elapsed_time, sm_instance.current_normalize_time, blocks, layer_instance, parameters, avatar);
 				// next
-				m_next_valid_update = blocks.at(m_next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, false, false, true, elapsed_time, m_next_normalize_time, blocks, parameters, node_index);
-				m_next_valid_update |= blocks.at(m_next_block_index)->UpdateKeyFrame(is_root_layer, is_additive, m_next_normalize_time, blocks, node_index, m_use_calc_keyframes[1]);
+				sm_instance.next_valid_update = blocks.at(sm_instance.next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, false, false, true, elapsed_time, sm_instance.next_normalize_time, blocks, layer_instance, parameters, avatar);
+				sm_instance.next_valid_update |= blocks.at(sm_instance.next_block_index)->UpdateKeyFrame(is_root_layer, is_additive, sm_instance.next_normalize_time, blocks, layer_instance, avatar, sm_instance.use_calc_keyframes[1]);
 			}
 			else
 			{
 				// current̃[VXVAnextTransition`FbNƃ[VXVs
-				m_current_valid_update |= blocks.at(m_current_block_index)->UpdateKeyFrame(is_root_layer, is_additive, m_current_normalize_time, blocks, node_index, m_use_calc_keyframes[0]);
+				sm_instance.current_valid_update |= blocks.at(sm_instance.current_block_index)->UpdateKeyFrame(is_root_layer, is_additive, sm_instance.current_normalize_time, blocks, layer_instance, avatar, sm_instance.use_calc_keyframes[0]);
 				// next
-				m_next_valid_update = blocks.at(m_next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, false, true, elapsed_time, m_next_normalize_time, blocks, parameters, node_index);
-				m_next_valid_update |= blocks.at(m_next_block_index)->UpdateKeyFrame(is_root_layer, is_additive, m_next_normalize_time, blocks, node_index, m_use_calc_keyframes[1]);
+				sm_instance.next_valid_update = blocks.at(sm_instance.next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, false, true, elapsed_time, sm_instance.next_normalize_time, blocks, layer_instance, parameters, avatar);
+				sm_instance.next_valid_update |= blocks.at(sm_instance.next_block_index)->UpdateKeyFrame(is_root_layer, is_additive, sm_instance.next_normalize_time, blocks, layer_instance, avatar, sm_instance.use_calc_keyframes[1]);
 			}
 		}
-		else if (m_state_machine_state == StateMachineState::InterruptTransition)
+		else if (sm_instance.state == StateMachineState::InterruptTransition)
 		{
 			// [0]Ɋ荞ݎ̏񂪑݂邽߁ALɂ
-			m_current_valid_update = true;
+			sm_instance.current_valid_update = true;
 			// current-current
-			blocks.at(m_current_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, true, true, elapsed_time, m_current_normalize_time, blocks, parameters, node_index);
+			blocks.at(sm_instance.current_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, true, true, elapsed_time, sm_instance.current_normalize_time, blocks, layer_instance, parameters, avatar);
 			// current-next
-			blocks.at(m_interrupted_next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, false, true, elapsed_time, m_current_normalize_time, blocks, parameters, node_index);
+			blocks.at(sm_instance.interrupted_next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, true, false, true, elapsed_time, sm_instance.current_normalize_time, blocks, layer_instance, parameters, avatar);
 			// next
-			m_next_valid_update = blocks.at(m_next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, false, false, true, elapsed_time, m_next_normalize_time, blocks, parameters, node_index);
-			m_next_valid_update |= blocks.at(m_next_block_index)->UpdateKeyFrame(is_root_layer, is_additive, m_next_normalize_time, blocks, node_index, m_use_calc_keyframes[1]);
+			sm_instance.next_valid_update = blocks.at(sm_instance.next_block_index)->UpdateBlock(goid, is_root_layer, is_additive, false, false, true, elapsed_time, sm_instance.next_normalize_time, blocks, layer_instance, parameters, avatar);
+			sm_instance.next_valid_update |= blocks.at(sm_instance.next_block_index)->UpdateKeyFrame(is_root_layer, is_additive, sm_instance.next_normalize_time, blocks, layer_instance, avatar, sm_instance.use_calc_keyframes[1]);
 		}
 
-		return m_current_valid_update || m_next_valid_update;
+		return sm_instance.current_valid_update || sm_instance.next_valid_update;
 	}
 
 	bool AnimatorStateMachine::UpdateKeyFrame(
@@ -563,19 +586,21 @@ namespace TKGEngine::Animations
 		const bool is_additive,
 		const float normalize_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, int>* node_index,
+		LayerInstance& layer_instance,
+		const AvatarBinding& avatar,
 		std::vector<KeyData>& dst_keydata
 	)
 	{
+		const auto& sm_instance = layer_instance.GetStateMachine(m_self_block_index);
 		// ǧ݂̏ԂRs[ĕԂ
-		std::copy(m_keyframe.begin(), m_keyframe.end(), dst_keydata.begin());
+		std::copy(sm_instance.keyframe.begin(), sm_instance.keyframe.end(), dst_keydata.begin());
 
 		return false;
 	}
 
-	void AnimatorStateMachine::OnReady(const float offset)
+	void AnimatorStateMachine::OnReady(const float offset, LayerInstance& layer_instance)
 	{
-		m_state_machine_state = StateMachineState::Entry;
+		layer_instance.GetStateMachine(m_self_block_index).state = StateMachineState::Entry;
 	}
 
 	void AnimatorStateMachine::OnRemoveBlock(int removed_index, std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks)
@@ -604,20 +629,22 @@ namespace TKGEngine::Animations
 	void AnimatorStateMachine::GetNormalizeTime(
 		const float elapsed_time,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+		LayerInstance& layer_instance,
+		std::vector<AnimatorControllerParameter>& parameters,
 		float& weighted_normalize_time,
 		float& normalize_time
 	)
 	{
+		const auto& sm_instance = layer_instance.GetStateMachine(m_self_block_index);
 		// Xe[g}ṼGg[ɃXe[g}VZbgĂꍇUpdateɌĂ΂邽߁Ap
-		if (m_state_machine_state == StateMachineState::Entry)
+		if (sm_instance.state == StateMachineState::Entry)
 		{
 			weighted_normalize_time = 0.0f;
 			normalize_time = 0.0f;
 			return;
 		}
 
-		blocks.at(m_current_block_index)->GetNormalizeTime(elapsed_time, blocks, parameters, weighted_normalize_time, normalize_time);
+		blocks.at(sm_instance.current_block_index)->GetNormalizeTime(elapsed_time, blocks, layer_instance, parameters, weighted_normalize_time, normalize_time);
 	}
 
 	void AnimatorStateMachine::OnRemoveBlockFixIndex(const int removed_index, const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks)
@@ -634,31 +661,7 @@ namespace TKGEngine::Animations
 		{
 			--m_entry_index;
 		}
-		// s̃CfbNX̏C
-		if (m_current_block_index == removed_index)
-		{
-			// Đ̃ubNȂȂ
-			m_state_machine_state = StateMachineState::Entry;
-			m_current_block_index = INVALID_BLOCK_INDEX;
-		}
-		else if (m_current_block_index > removed_index)
-		{
-			--m_current_block_index;
-		}
-		// JڒȂJڐCfbNX̏C
-		if (m_state_machine_state == StateMachineState::Transition)
-		{
-			if (m_next_block_index == removed_index)
-			{
-				// Jڐ̃ubNȂȂ
-				m_state_machine_state = StateMachineState::Play;
-				m_next_block_index = INVALID_BLOCK_INDEX;
-			}
-			else if (m_next_block_index > removed_index)
-			{
-				--m_next_block_index;
-			}
-		}
+		// Đ̃CfbNX̓C[̍\̕ύXɂAnimatorƂɍ蒼
 
 		// Entry Transition̑JڐmFAC
 		{
@@ -719,58 +722,59 @@ namespace TKGEngine::Animations
 		const float(&weights)[MAX_BONES],
 		const bool(&masks)[MAX_BONES],
 		const std::vector<int>& enable_nodes,
+		StateMachineInstance& sm_instance,
 		std::vector<KeyData>& dst_data
 	)
 	{
 		// Play͂傤ǑJڂt[
-		if (m_state_machine_state == StateMachineState::Play || m_on_transition_frame)
+		if (sm_instance.state == StateMachineState::Play || sm_instance.on_transition_frame)
 		{
 			// KeyData̎擾ɎsȂKeyȂ
-			if (!m_current_valid_update)
+			if (!sm_instance.current_valid_update)
 			{
 				return;
 			}
 			// dst_dataɓKp
-			OnApplyRootData(is_root_layer, is_additive, layer_weight, weights, masks, enable_nodes, dst_data);
+			OnApplyRootData(is_root_layer, is_additive, layer_weight, weights, masks, enable_nodes, sm_instance, dst_data);
 		}
 		// Jڎ
-		else if (m_state_machine_state == StateMachineState::Transition || m_state_machine_state == StateMachineState::InterruptTransition)
+		else if (sm_instance.state == StateMachineState::Transition || sm_instance.state == StateMachineState::InterruptTransition)
 		{
 			// KeyData̎擾ɎsȂKeyȂ
-			if (!m_current_valid_update && !m_next_valid_update)
+			if (!sm_instance.current_valid_update && !sm_instance.next_valid_update)
 			{
 				return;
 			}
 
 			// JڊuhvZ
-			float blend_ratio = 1.0f - (m_duration_normalize_timer * MyMath::InvertDivisionValue(m_duration_start_time));
+			float blend_ratio = 1.0f - (sm_instance.duration_normalize_timer * MyMath::InvertDivisionValue(sm_instance.duration_start_time));
 			blend_ratio = MyMath::Clamp(blend_ratio, 0.0f, 1.0f);
 
 			// ǂ擾
-			if (m_current_valid_update && m_next_valid_update)
+			if (sm_instance.current_valid_update && sm_instance.next_valid_update)
 			{
 				// JڌƑJڐ̃uh
-				BlendKeyFrame(m_use_calc_keyframes[0], m_use_calc_keyframes[1], blend_ratio, m_keyframe);
+				BlendKeyFrame(sm_instance.use_calc_keyframes[0], sm_instance.use_calc_keyframes[1], blend_ratio, sm_instance.keyframe);
 				// dst_dataɓKp
-				OnApplyRootData(is_root_layer, is_additive, layer_weight, weights, masks, enable_nodes, dst_data);
+				OnApplyRootData(is_root_layer, is_additive, layer_weight, weights, masks, enable_nodes, sm_instance, dst_data);
 				return;
 			}
 
 			// Current̎擾̂ݐ
-			if (!m_next_valid_update)
+			if (!sm_instance.next_valid_update)
 			{
 				// CurrentKeyData[0]Rs[
-				std::copy(m_use_calc_keyframes[0].begin(), m_use_calc_keyframes[0].end(), m_keyframe.begin());
+				std::copy(sm_instance.use_calc_keyframes[0].begin(), sm_instance.use_calc_keyframes[0].end(), sm_instance.keyframe.begin());
 				// dst_dataƃuh
-				OnApplyRootData(is_root_layer, is_additive, (1.0f - blend_ratio) * layer_weight, weights, masks, enable_nodes, dst_data);
+				OnApplyRootData(is_root_layer, is_additive, (1.0f - blend_ratio) * layer_weight, weights, masks, enable_nodes, sm_instance, dst_data);
 			}
 			// Next̎擾̂ݐ
-			else if (!m_current_valid_update)
+			else if (!sm_instance.current_valid_update)
 			{
 				// NextKeyData[1]Rs[
-				std::copy(m_use_calc_keyframes[1].begin(), m_use_calc_keyframes[1].end(), m_keyframe.begin());
+				std::copy(sm_instance.use_calc_keyframes[1].begin(), sm_instance.use_calc_keyframes[1].end(), sm_instance.keyframe.begin());
 				// dst_dataƃuh
-				OnApplyRootData(is_root_layer, is_additive, blend_ratio * layer_weight, weights, masks, enable_nodes, dst_data);
+				OnApplyRootData(is_root_layer, is_additive, blend_ratio * layer_weight, weights, masks, enable_nodes, sm_instance, dst_data);
 			}
 		}
 	}
@@ -782,6 +786,7 @@ namespace TKGEngine::Animations
 		const float(&weights)[MAX_BONES],
 		const bool(&masks)[MAX_BONES],
 		const std::vector<int>& enable_nodes,
+		const StateMachineInstance& sm_instance,
 		std::vector<KeyData>& dst_data
 	)
 	{
@@ -799,7 +804,7 @@ namespace TKGEngine::Animations
 				if (data_index == -1)
 					continue;
 				// L[f[^
-				dst_data.at(data_index) = m_keyframe.at(i);
+				dst_data.at(data_index) = sm_instance.keyframe.at(i);
 			}
 		}
 		// MaskC[
@@ -820,7 +825,7 @@ namespace TKGEngine::Animations
 				const float weight = layer_weight * weights[data_index];
 
 				auto& dst_key = dst_data.at(data_index);
-				auto& src_key = m_keyframe.at(i);
+				auto& src_key = sm_instance.keyframe.at(i);
 				// Additive
 				if (is_additive)
 				{
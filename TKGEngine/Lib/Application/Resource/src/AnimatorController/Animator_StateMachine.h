@@ -33,6 +33,7 @@ namespace TKGEngine::Animations
 		int OnGUIStateMachine(
 			const GameObjectID goid,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+			const LayerInstance* layer_instance,
 			std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters
 		);
 		void OnGUIEntry(const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks, std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters);
@@ -42,10 +43,12 @@ namespace TKGEngine::Animations
 		void SetEntryBlock(int index);
 		// Entry̑Jڐǉ
 		std::shared_ptr<AnimatorTransition> AddEntryTransition(const int destination_block_idx);
+		// EntryTransitionƎgTransitioñp[^vfԍ蓖Ă
+		void ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids) override;
 
 		// EntryTransitionɂJڂ`FbN
 		int CheckEntryTransition(
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+			std::vector<AnimatorControllerParameter>& parameters,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
 			float& offset
 		);
@@ -56,7 +59,8 @@ namespace TKGEngine::Animations
 			const int next,
 			const float duration,
 			const float offset,
-			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks
+			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+			LayerInstance& layer_instance
 		);
 
 		// qubNǉɊǗĂubÑCfbNXo^
@@ -67,7 +71,7 @@ namespace TKGEngine::Animations
 		void RemoveChildStateMachine(const int index);
 
 		// ݂̃L[f[^Ԃ
-		const std::vector<KeyData>* GetKeyFrame() const;
+		const std::vector<KeyData>* GetKeyFrame(const LayerInstance& layer_instance) const;
 
 		// [gC[ȂL[f[^㏑AqC[ȂL[f[^uh鏈
 		void ApplyKeyFrameData(
@@ -79,8 +83,9 @@ namespace TKGEngine::Animations
 			const float (&weights)[MAX_BONES],
 			const bool (&masks)[MAX_BONES],
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-			const std::unordered_map<std::string, int>* node_index,
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
+			const AvatarBinding& avatar,
 			const std::vector<int>& enable_nodes,
 			std::vector<KeyData>& dst_data
 		);
@@ -111,14 +116,6 @@ namespace TKGEngine::Animations
 			}
 		}
 
-		// Xe[g}V̍XV
-		enum class StateMachineState
-		{
-			Entry,
-			Play,
-			Transition,
-			InterruptTransition
-		};
 		// ==============================================
 		// private methods
 		// ==============================================
@@ -126,12 +123,15 @@ namespace TKGEngine::Animations
 		int OnGUI(
 			const GameObjectID goid,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
+			const LayerInstance* layer_instance,
 			std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters
 		) override;
 		bool OnGUISelectBlock(const ImGuiTextFilter& im_filter, const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks, int& current_index);
 		void OnGUIEntryTransition(const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks, std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters);
 #endif// #ifdef USE_IMGUI
 
+		void InitializeInstance(BlockInstance& instance) const override;
+
 		bool UpdateBlock(
 			const GameObjectID goid,
 			const bool is_root_layer,
@@ -142,18 +142,20 @@ namespace TKGEngine::Animations
 			const float elapsed_time,
 			const float normalize_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
-			const std::unordered_map<std::string, int>* node_index
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
+			const AvatarBinding& avatar
 		) override;
 		bool UpdateKeyFrame(
 			const bool is_root_layer,
 			const bool is_additive,
 			const float normalize_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, int>* node_index,
+			LayerInstance& layer_instance,
+			const AvatarBinding& avatar,
 			std::vector<KeyData>& dst_keydata
 		) override;
-		void OnReady(const float offset) override;
+		void OnReady(const float offset, LayerInstance& layer_instance) override;
 
 		// C[̂ꂩBlock폜ɔԍ̊mFƏC
 		void OnRemoveBlock(int removed_index, std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks) override;
@@ -162,7 +164,8 @@ namespace TKGEngine::Animations
 		void GetNormalizeTime(
 			const float elapsed_time,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+			LayerInstance& layer_instance,
+			std::vector<AnimatorControllerParameter>& parameters,
 			float& weighted_normalize_time,
 			float& normalize_time
 		) override;
@@ -178,6 +181,7 @@ namespace TKGEngine::Animations
 			const float(&weights)[MAX_BONES],
 			const bool(&masks)[MAX_BONES],
 			const std::vector<int>& enable_nodes,
+			StateMachineInstance& sm_instance,
 			std::vector<KeyData>& dst_data
 		);
 		// ApplyRootKeyDataŃC[ɉuh
@@ -188,6 +192,7 @@ namespace TKGEngine::Animations
 			const float(&weights)[MAX_BONES],
 			const bool(&masks)[MAX_BONES],
 			const std::vector<int>& enable_nodes,
+			const StateMachineInstance& sm_instance,
 			std::vector<KeyData>& dst_data
 		);
 
@@ -203,32 +208,6 @@ namespace TKGEngine::Animations
 		std::vector<std::shared_ptr<AnimatorTransition>> m_entry_transitions;
 		// n߂ɎsubÑCfbNX
 		int m_entry_index = INVALID_BLOCK_INDEX;
-
-		// Xe[g}V̌
-		StateMachineState m_state_machine_state = StateMachineState::Entry;
-		// ݂̃ubN
-		int m_current_block_index = INVALID_BLOCK_INDEX;
-		float m_current_normalize_time = 0.0f;
-		// 荞ݑJڂꂽƂ̑Jڐ̃ubNCfbNX
-		int m_interrupted_next_block_index = INVALID_BLOCK_INDEX;
-		// Jڐ̃ubN
-		int m_next_block_index = INVALID_BLOCK_INDEX;
-		float m_next_normalize_time = 0.0f;
-		// Transition̎cJڐK
-		float m_duration_normalize_timer = 0.0f;
-		// Transition̑Jڎ
-		float m_duration_start_time = 0.0f;
-
-		// Jڂt[
-		bool m_on_transition_frame = false;
-		// s̃ubN̍XVLǂ
-		bool m_current_valid_update = false;
-		bool m_next_valid_update = false;
-
-		// o͂錻݂̃Aj[V
-		std::vector<KeyData> m_keyframe;
-		// vZɎgpAj[V
-		std::vector<KeyData> m_use_calc_keyframes[2];
 	};
 
 
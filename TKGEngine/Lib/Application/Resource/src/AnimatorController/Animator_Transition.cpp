@@ -284,6 +284,14 @@ namespace TKGEngine::Animations
 		m_conditions.erase(m_conditions.begin() + index);
 	}
 
+	void AnimatorTransition::ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids)
+	{
+		for (auto& condition : m_conditions)
+		{
+			condition.parameter_id = FindParameterID(parameter_ids, condition.parameter_name);
+		}
+	}
+
 	void AnimatorTransition::HasExitTime(const bool use)
 	{
 		m_has_exit_time = use;
@@ -329,7 +337,7 @@ namespace TKGEngine::Animations
 		const bool state_transitioning,
 		const float normalized_time,
 		const int owner_index,
-		const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+		std::vector<AnimatorControllerParameter>& parameters,
 		const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
 		float& duration,
 		float& offset
@@ -408,11 +416,10 @@ namespace TKGEngine::Animations
 		return INVALID_BLOCK_INDEX;
 	}
 
-	bool AnimatorTransition::ConditionCheckOnCheckTransition(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters)
+	bool AnimatorTransition::ConditionCheckOnCheckTransition(std::vector<AnimatorControllerParameter>& parameters)
 	{
 		// Trigger𖞂肷邽߂̕ϐ
 		bool has_trigger = false;
-		std::vector<std::shared_ptr<AnimatorControllerParameter>> trigger_index;
 
 		const size_t cond_cnt = m_conditions.size();
 		if (cond_cnt == 0)
@@ -421,30 +428,28 @@ namespace TKGEngine::Animations
 			return true;
 		}
 		// ConditionSĖ`FbNAȂΑ^[
-		const auto itr_end = parameters.end();
 		for (size_t i = 0; i < cond_cnt; ++i)
 		{
-			AnimatorCondition& condition = m_conditions.at(i);
+			const AnimatorCondition& condition = m_conditions.at(i);
 
 			// p[^ɓĂȂOłꍇ͖
-			const auto itr_find = parameters.find(condition.parameter_name);
-			if (itr_find == itr_end)
+			const AnimatorControllerParameter* param = GetParameterByID(parameters, condition.parameter_id);
+			if (!param)
 				continue;
 
 			// p[^`FbN
 			const auto mode = condition.mode;
-			const std::shared_ptr<AnimatorControllerParameter>& param = itr_find->second;
-			switch ((param)->type)
+			switch (param->type)
 			{
 				case AnimatorControllerParameter::Type::Float:
 					switch (mode)
 					{
 						case AnimatorCondition::Mode::Greater:
-							if ((param)->default_float <= condition.threshold)
+							if (param->default_float <= condition.threshold)
 								return false;
 							break;
 						case AnimatorCondition::Mode::Less:
-							if ((param)->default_float >= condition.threshold)
+							if (param->default_float >= condition.threshold)
 								return false;
 							break;
 						default:
@@ -455,19 +460,19 @@ namespace TKGEngine::Animations
 					switch (mode)
 					{
 						case AnimatorCondition::Mode::Greater:
-							if ((param)->default_int <= static_cast<int>(condition.threshold))
+							if (param->default_int <= static_cast<int>(condition.threshold))
 								return false;
 							break;
 						case AnimatorCondition::Mode::Less:
-							if ((param)->default_int >= static_cast<int>(condition.threshold))
+							if (param->default_int >= static_cast<int>(condition.threshold))
 								return false;
 							break;
 						case AnimatorCondition::Mode::Equal:
-							if ((param)->default_int != static_cast<int>(condition.threshold))
+							if (param->default_int != static_cast<int>(condition.threshold))
 								return false;
 							break;
 						case AnimatorCondition::Mode::NotEqual:
-							if ((param)->default_int == static_cast<int>(condition.threshold))
+							if (param->default_int == static_cast<int>(condition.threshold))
 								return false;
 							break;
 						default:
@@ -478,7 +483,7 @@ namespace TKGEngine::Animations
 					switch (mode)
 					{
 						case AnimatorCondition::Mode::If:
-							if ((param)->default_bool)
+							if (param->default_bool)
 							{
 								if (MyMath::Approximately(condition.threshold, 0.0f))
 									return false;
@@ -494,23 +499,23 @@ namespace TKGEngine::Animations
 					}
 					break;
 				case AnimatorControllerParameter::Type::Trigger:
-					if (!(param)->default_bool)
+					if (!param->default_bool)
 					{
 						return false;
 					}
 					has_trigger = true;
-					trigger_index.emplace_back(param);
 					break;
 			}
 		}
 		// Triggergpꍇ̓tO낵Ă
 		if (has_trigger)
 		{
-			for (auto&& param : trigger_index)
+			for (size_t i = 0; i < cond_cnt; ++i)
 			{
-				if ((param)->type == AnimatorControllerParameter::Type::Trigger)
+				AnimatorControllerParameter* param = GetParameterByID(parameters, m_conditions.at(i).parameter_id);
+				if (param && param->type == AnimatorControllerParameter::Type::Trigger)
 				{
-					(param)->default_bool = false;
+					param->default_bool = false;
 				}
 			}
 		}
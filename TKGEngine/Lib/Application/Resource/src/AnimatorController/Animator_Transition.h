@@ -46,6 +46,8 @@ namespace TKGEngine::Animations
 		void AddCondition(AnimatorCondition::Mode mode, const char* parameter, int threshold);
 		void AddCondition(AnimatorCondition::Mode mode, const char* parameter, bool threshold);
 		void RemoveCondition(int index);
+		// ̃p[^vfԍ蓖Ă
+		void ResolveParameterIDs(const std::unordered_map<std::string, ParameterID>& parameter_ids);
 
 		void HasExitTime(bool use);
 		void ExitTime(float time);
@@ -68,7 +70,7 @@ namespace TKGEngine::Animations
 		/// <param name="state_transitioning">Jڒǂ</param>
 		/// <param name="normalized_time">o߂K</param>
 		/// <param name="owner_index">gǗXe[g}ṼCfbNX</param>
-		/// <param name="parameters">Jڃp[^̃}bv</param>
+		/// <param name="parameters">p[^̒l̔z(ParameterID̏)</param>
 		/// <param name="blocks">ubNXg</param>
 		/// <param name="duration">Jڂɂ鎞ԂԂ</param>
 		/// <param name="offset">Jڐ̊JnK</param>
@@ -78,7 +80,7 @@ namespace TKGEngine::Animations
 			const bool state_transitioning,
 			const float normalized_time,
 			const int owner_index,
-			const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters,
+			std::vector<AnimatorControllerParameter>& parameters,
 			const std::vector<std::shared_ptr<AnimatorBlockBase>>& blocks,
 			float& duration,
 			float& offset
@@ -116,7 +118,7 @@ namespace TKGEngine::Animations
 #endif// #ifdef USE_IMGUI
 
 		// ConditioneXgɍi邩`FbN
-		bool ConditionCheckOnCheckTransition(const std::unordered_map<std::string, std::shared_ptr<AnimatorControllerParameter>>& parameters);
+		bool ConditionCheckOnCheckTransition(std::vector<AnimatorControllerParameter>& parameters);
 
 
 		// ==============================================
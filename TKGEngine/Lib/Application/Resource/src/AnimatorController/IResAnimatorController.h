@@ -6,16 +6,20 @@
 #include "../ResourceManager.h"
 #include "Utility/inc/myfunc_vector.h"
 
+#include <mutex>
+
 namespace TKGEngine::Animations
 {
 	class AnimatorState;
 	class AnimatorControllerLayer;
+	struct AnimatorControllerInstance;
 }
 
 namespace TKGEngine
 {
 	/// <summary>
 	/// Animator Controller Resource interface
+	/// ファイルから読み込んだコントローラは共有され、再生状態はAnimatorごとのAnimatorControllerInstanceが持つ
 	/// </summary>
 	class IResAnimatorController
 		: public AssetDataBase
@@ -34,9 +38,10 @@ namespace TKGEngine
 		static std::shared_ptr<IResAnimatorController> Create(const std::string& controller_name);
 		static std::shared_ptr<IResAnimatorController> LoadAsync(const std::string& filename);
 		static std::shared_ptr<IResAnimatorController> Load(const std::string& filename);
+		static void RemoveUnused();
 
 #ifdef USE_IMGUI
-		virtual void OnGUI(const GameObjectID goid, const std::vector<std::string>* bone_names) = 0;
+		virtual void OnGUI(const GameObjectID goid, const std::vector<std::string>* bone_names, const Animations::AnimatorControllerInstance* instance) = 0;
 #endif // USE_IMGUI
 		// AssetDataBase
 		void Release() override;
@@ -48,6 +53,10 @@ namespace TKGEngine
 		virtual void AddParameter(const std::string& param_name, Animations::AnimatorControllerParameter::Type type) = 0;
 		virtual void RemoveParameter(const std::string& param_name) = 0;
 		virtual std::shared_ptr<Animations::AnimatorControllerParameter> GetParameter(const std::string& param_name) = 0;
+		// パラメータ名に割り当てた要素番号(パラメータの追加、削除、名前の変更までは変わらない)
+		virtual Animations::ParameterID GetParameterID(const std::string& param_name) const = 0;
+		// 遷移条件やブレンドツリーが参照するパラメータ名を要素番号に置き換える(変更があったときのみ、メインスレッドで呼ぶ)
+		virtual void ResolveParameterIDs() = 0;
 
 		virtual std::shared_ptr<Animations::AnimatorControllerLayer> AddLayer(const std::string& layer_name) = 0;
 		virtual void RemoveLayer(const std::string& layer_name) = 0;
@@ -55,21 +64,19 @@ namespace TKGEngine
 		virtual std::shared_ptr<Animations::AnimatorControllerLayer> GetLayer(const std::string& layer_name) = 0;
 		virtual std::shared_ptr<Animations::AnimatorControllerLayer> GetLayer(const int index) = 0;
 
-		virtual void SetBool(const std::string& param_name, bool param) = 0;
-		virtual void SetInteger(const std::string& param_name, int param) = 0;
-		virtual void SetFloat(const std::string& param_name, float param) = 0;
-		virtual void SetTrigger(const std::string& param_name) = 0;
+		// アニメーションLODの設定
+		virtual const Animations::AnimatorLODSettings& GetLODSettings() const = 0;
+		virtual void SetLODSettings(const Animations::AnimatorLODSettings& settings) = 0;
 
-		virtual bool GetBool(const std::string& param_name) = 0;
-		virtual int GetInteger(const std::string& param_name) = 0;
-		virtual float GetFloat(const std::string& param_name) = 0;
-		virtual void ResetTrigger(const std::string& param_name) = 0;
+		// 再生状態をコントローラの現在のパラメータとレイヤーの構造に合わせる
+		virtual void SyncInstance(Animations::AnimatorControllerInstance& instance) const = 0;
 
 		virtual void ApplyAnimationTransform(
 			GameObjectID goid,
 			const float elapsed_time,
-			const std::unordered_map<std::string, int>* node_index,
+			const Animations::AvatarBinding& avatar,
 			const std::vector<int>& enable_nodes,
+			Animations::AnimatorControllerInstance& instance,
 			std::vector<Animations::KeyData>& data
 		) = 0;
 
@@ -102,7 +109,8 @@ namespace TKGEngine
 		// ==============================================
 		// private variables
 		// ==============================================
-
+		static ResourceManager<IResAnimatorController> m_caches;
+		static std::mutex m_cache_mutex;
 	};
 
 }// namespace TKGEngine
@@ -3,6 +3,7 @@
 
 #include "Animator_State.h"
 #include "Animator_ControllerLayer.h"
+#include "Animator_Instance.h"
 
 #include "Systems/inc/LogSystem.h"
 #include "Systems/inc/AssetSystem.h"
@@ -36,6 +37,8 @@ namespace TKGEngine
 		void AddParameter(const std::string& param_name, Animations::AnimatorControllerParameter::Type type) override;
 		void RemoveParameter(const std::string& param_name) override;
 		std::shared_ptr<Animations::AnimatorControllerParameter> GetParameter(const std::string& param_name) override;
+		Animations::ParameterID GetParameterID(const std::string& param_name) const override;
+		void ResolveParameterIDs() override;
 
 		std::shared_ptr<Animations::AnimatorControllerLayer> AddLayer(const std::string& layer_name) override;
 		void RemoveLayer(const std::string& layer_name) override;
@@ -43,21 +46,17 @@ namespace TKGEngine
 		std::shared_ptr<Animations::AnimatorControllerLayer> GetLayer(const std::string& layer_name) override;
 		std::shared_ptr<Animations::AnimatorControllerLayer> GetLayer(const int index) override;
 
-		void SetBool(const std::string& param_name, bool param) override;
-		void SetInteger(const std::string& param_name, int param) override;
-		void SetFloat(const std::string& param_name, float param) override;
-		void SetTrigger(const std::string& param_name) override;
+		const Animations::AnimatorLODSettings& GetLODSettings() const override;
+		void SetLODSettings(const Animations::AnimatorLODSettings& settings) override;
 
-		bool GetBool(const std::string& param_name) override;
-		int GetInteger(const std::string& param_name) override;
-		float GetFloat(const std::string& param_name) override;
-		void ResetTrigger(const std::string& param_name) override;
+		void SyncInstance(Animations::AnimatorControllerInstance& instance) const override;
 
 		void ApplyAnimationTransform(
 			const GameObjectID goid,
 			const float elapsed_time,
-			const std::unordered_map<std::string, int>* node_index,
+			const Animations::AvatarBinding& avatar,
 			const std::vector<int>& enable_nodes,
+			Animations::AnimatorControllerInstance& instance,
 			std::vector<Animations::KeyData>& data
 		) override;
 
@@ -72,7 +71,7 @@ namespace TKGEngine
 		template <class Archive>
 		void serialize(Archive& archive, const std::uint32_t version)
 		{
-			//if (version > 0)
+			if (version == 1)
 			{
 				archive(
 					cereal::base_class<IResAnimatorController>(this),
@@ -80,6 +79,15 @@ namespace TKGEngine
 					CEREAL_NVP(m_parameters)
 				);
 			}
+			else if (version == 2)
+			{
+				archive(
+					cereal::base_class<IResAnimatorController>(this),
+					CEREAL_NVP(m_layers),
+					CEREAL_NVP(m_parameters),
+					CEREAL_NVP(m_lod_settings)
+				);
+			}
 		}
 
 		// ==============================================
@@ -88,20 +96,25 @@ namespace TKGEngine
 #ifdef USE_IMGUI
 		void OnGUI() override {}
 		// Ăяo֐
-		void OnGUI(const GameObjectID goid, const std::vector<std::string>* bone_names) override;
+		void OnGUI(const GameObjectID goid, const std::vector<std::string>* bone_names, const Animations::AnimatorControllerInstance* instance) override;
 		// p[^ݒp
 		void OnGUIParameter();
 		// C[Ip
 		void OnGUILayerSelect();
 		// C[Xe[g}V\p
-		void OnGUILayerStateMachine(const GameObjectID goid);
+		void OnGUILayerStateMachine(const GameObjectID goid, const Animations::AnimatorControllerInstance* instance);
 		// C[}XNݒp
 		void OnGUILayerMask(const std::vector<std::string>* bone_names);
+		// Aj[VLODݒp
+		void OnGUILODSettings();
 #endif // USE_IMGUI
 
 		void SetAsyncOnLoad() override;
 		void OnLoad() override;
 
+		// p[^̒ǉA폜AOƌ^̕ύXɃXbgIDXV
+		void OnChangeParameter();
+
 		// use GUI
 		bool Save();
 		// ~use GUI
@@ -116,7 +129,21 @@ namespace TKGEngine
 
 		std::vector<std::shared_ptr<Animations::AnimatorControllerLayer>> m_layers;
 		std::unordered_map<std::string, std::shared_ptr<Animations::AnimatorControllerParameter>> m_parameters;
-
+		// p[^̒ǉA폜A^ύX̉(쐬̍ĐԂ0Ƌʂ邽1n߂)
+		std::uint32_t m_parameter_revision = 1;
+		// ParameterID̃Xbg(p[^̎̂őΉÂ邽߁AOύXĂXbgg)
+		struct ParameterSlot
+		{
+			std::shared_ptr<Animations::AnimatorControllerParameter> param;	// 󂫃Xbgnullptr
+			std::uint32_t generation = 0;	// 󂫂ɂȂ邽тɐi߂
+		};
+		std::vector<ParameterSlot> m_parameter_slots;
+		// p[^ID̑Ή
+		std::unordered_map<std::string, Animations::ParameterID> m_parameter_ids;
+		// JڏȂǂQƂvfԍ̊蓖ĒKv
+		bool m_is_parameter_id_dirty = true;
+		// Aj[VLOD̐ݒ
+		Animations::AnimatorLODSettings m_lod_settings;
 	};
 
 
@@ -126,6 +153,9 @@ namespace TKGEngine
 
 	static constexpr const char* DEFAULT_NAME = "AnimController";
 
+	ResourceManager<IResAnimatorController> IResAnimatorController::m_caches;
+	std::mutex IResAnimatorController::m_cache_mutex;
+
 
 	////////////////////////////////////////////////////////
 	// Class Methods
@@ -153,25 +183,45 @@ namespace TKGEngine
 
 	std::shared_ptr<IResAnimatorController> IResAnimatorController::LoadAsync(const std::string& filename)
 	{
+		// Access resource map
+		m_cache_mutex.lock();
+		std::shared_ptr<IResAnimatorController> res_find = m_caches.Search(filename);
+		if (res_find)
+		{
+			m_cache_mutex.unlock();
+			return res_find;
+		}
 		// Create new Controller
 		std::shared_ptr<IResAnimatorController> res_new(CreateInterface());
 		res_new->SetFilePath(filename);
+		m_caches.Set(filename, res_new);
+		m_cache_mutex.unlock();
 
 		// Set async loader
 		std::lock_guard<std::mutex> lock(res_new->m_load_state_mutex);
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResAnimatorController::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResAnimatorController::SetAsyncOnLoad, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_PREFETCH);
 
 		return res_new;
 	}
 
 	std::shared_ptr<IResAnimatorController> IResAnimatorController::Load(const std::string& filename)
 	{
+		// Access resource map
+		m_cache_mutex.lock();
+		std::shared_ptr<IResAnimatorController> res_find = m_caches.Search(filename);
+		if (res_find)
+		{
+			m_cache_mutex.unlock();
+			return res_find;
+		}
 		// Create new Controller
 		std::shared_ptr<IResAnimatorController> res_new(CreateInterface());
 		res_new->SetFilePath(filename);
+		m_caches.Set(filename, res_new);
+		m_cache_mutex.unlock();
 
 		// Load Resource
 		res_new->m_load_state_mutex.lock();
@@ -190,9 +240,16 @@ namespace TKGEngine
 		return res_new;
 	}
 
+	void IResAnimatorController::RemoveUnused()
+	{
+		std::lock_guard<std::mutex> lock(m_cache_mutex);
+		m_caches.RemoveUnusedCache();
+	}
+
 	void IResAnimatorController::Release()
 	{
-		/* nothing */
+		std::lock_guard<std::mutex> lock(m_cache_mutex);
+		m_caches.RemoveCache(this->GetFilePath());
 	}
 	// ~IResAnimatorController
 
@@ -205,7 +262,7 @@ namespace TKGEngine
 	}
 
 #ifdef USE_IMGUI
-	void ResAnimatorController::OnGUI(const GameObjectID goid, const std::vector<std::string>* bone_names)
+	void ResAnimatorController::OnGUI(const GameObjectID goid, const std::vector<std::string>* bone_names, const Animations::AnimatorControllerInstance* instance)
 	{
 		ImGui::IDWrapped id(this);
 
@@ -236,6 +293,11 @@ namespace TKGEngine
 					OnGUILayerSelect();
 					ImGui::EndTabItem();
 				}
+				if (ImGui::BeginTabItem("LOD"))
+				{
+					OnGUILODSettings();
+					ImGui::EndTabItem();
+				}
 				ImGui::EndTabBar();
 			}
 		}
@@ -250,7 +312,7 @@ namespace TKGEngine
 				// StateMachine
 				if (ImGui::BeginTabItem("StateMachine"))
 				{
-					OnGUILayerStateMachine(goid);
+					OnGUILayerStateMachine(goid, instance);
 					ImGui::EndTabItem();
 				}
 				// Avatar Mask (RootC[̓}XNgpȂ)
@@ -267,6 +329,9 @@ namespace TKGEngine
 			}
 		}
 		ImGui::EndChild();
+
+		// GUIőJڏȂǂ̃p[^ύXĂ\
+		m_is_parameter_id_dirty = true;
 	}
 	void ResAnimatorController::OnGUIParameter()
 	{
@@ -340,6 +405,7 @@ namespace TKGEngine
 				if (ImGui::ButtonColorSettable("X##Erase Button", ImVec4(0.75f, 0.2f, 0.2f, 1.0f), ImVec4(0.55f, 0.2f, 0.2f, 1.0f), ImVec4(0.4f, 0.05f, 0.05f, 1.0f)))
 				{
 					itr_param = m_parameters.erase(itr_param);
+					OnChangeParameter();
 					continue;
 				}
 				// p[^
@@ -356,6 +422,7 @@ namespace TKGEngine
 						std::shared_ptr<Animations::AnimatorControllerParameter> param = itr_param->second;
 						itr_param = m_parameters.erase(itr_param);
 						m_parameters.emplace(str, std::move(param));
+						OnChangeParameter();
 						continue;
 					}
 				}
@@ -363,7 +430,13 @@ namespace TKGEngine
 				// p[^ƂGUI\
 				ImGui::SameLine();
 				ImGui::SetNextItemWidth(ImGui::GetContentRegionAvail().x);
+				const auto prev_type = itr_param->second->type;
 				itr_param->second->OnGUI();
+				// ^ύXꂽĐԂ̃p[^蒼
+				if (itr_param->second->type != prev_type)
+				{
+					OnChangeParameter();
+				}
 				ImGui::Separator();
 			}
 			// eraseĂȂƂ̓CNg
@@ -476,13 +549,19 @@ namespace TKGEngine
 			ImGui::Separator();
 		}
 	}
-	void ResAnimatorController::OnGUILayerStateMachine(const GameObjectID goid)
+	void ResAnimatorController::OnGUILayerStateMachine(const GameObjectID goid, const Animations::AnimatorControllerInstance* instance)
 	{
 		// ͈͊OANZXp
 		if (static_cast<int>(m_layers.size()) <= m_selecting_layer)
 			m_selecting_layer = 0;
 
-		m_layers.at(m_selecting_layer)->OnGUIStateMachine(goid, m_parameters);
+		// Đ̏Ԃ̓C[vĂ鎞̂ݕ\
+		const Animations::LayerInstance* layer_instance = nullptr;
+		if (instance && static_cast<int>(instance->layers.size()) > m_selecting_layer)
+		{
+			layer_instance = &instance->layers.at(m_selecting_layer);
+		}
+		m_layers.at(m_selecting_layer)->OnGUIStateMachine(goid, layer_instance, m_parameters);
 	}
 	void ResAnimatorController::OnGUILayerMask(const std::vector<std::string>* bone_name)
 	{
@@ -492,10 +571,15 @@ namespace TKGEngine
 
 		m_layers.at(m_selecting_layer)->OnGUIMask(bone_name, m_parameters);
 	}
+	void ResAnimatorController::OnGUILODSettings()
+	{
+		m_lod_settings.OnGUI();
+	}
 #endif // USE_IMGUI
 
 	std::shared_ptr<Animations::AnimatorState> ResAnimatorController::AddMotion(const std::string& motion_filepath)
 	{
+		m_is_parameter_id_dirty = true;
 		return m_layers.at(0)->AddMotion(motion_filepath);
 	}
 
@@ -509,11 +593,13 @@ namespace TKGEngine
 		auto s_ptr = std::make_shared<Animations::AnimatorControllerParameter>();
 		m_parameters.emplace(param_name, s_ptr);
 		s_ptr->type = type;
+		OnChangeParameter();
 	}
 
 	void ResAnimatorController::RemoveParameter(const std::string& param_name)
 	{
 		m_parameters.erase(param_name);
+		OnChangeParameter();
 	}
 
 	std::shared_ptr<Animations::AnimatorControllerParameter> ResAnimatorController::GetParameter(const std::string& param_name)
@@ -524,8 +610,26 @@ namespace TKGEngine
 		return itr->second;
 	}
 
+	Animations::ParameterID ResAnimatorController::GetParameterID(const std::string& param_name) const
+	{
+		return Animations::FindParameterID(m_parameter_ids, param_name);
+	}
+
+	void ResAnimatorController::ResolveParameterIDs()
+	{
+		if (!m_is_parameter_id_dirty)
+			return;
+		m_is_parameter_id_dirty = false;
+
+		for (const auto& layer : m_layers)
+		{
+			layer->ResolveParameterIDs(m_parameter_ids);
+		}
+	}
+
 	std::shared_ptr<Animations::AnimatorControllerLayer> ResAnimatorController::AddLayer(const std::string& layer_name)
 	{
+		m_is_parameter_id_dirty = true;
 		m_layers.emplace_back(std::make_shared<Animations::AnimatorControllerLayer>());
 		std::shared_ptr<Animations::AnimatorControllerLayer> s_ptr = m_layers.back();
 		s_ptr->SetName(layer_name);
@@ -560,6 +664,8 @@ namespace TKGEngine
 
 	std::shared_ptr<Animations::AnimatorControllerLayer> ResAnimatorController::GetLayer(const std::string& layer_name)
 	{
+		// 擾C[JڏȂǂύX\
+		m_is_parameter_id_dirty = true;
 		const auto itr_end = m_layers.end();
 		for (auto itr = m_layers.begin(); itr != itr_end; ++itr)
 		{
@@ -573,96 +679,86 @@ namespace TKGEngine
 
 	std::shared_ptr<Animations::AnimatorControllerLayer> ResAnimatorController::GetLayer(const int index)
 	{
+		// 擾C[JڏȂǂύX\
+		m_is_parameter_id_dirty = true;
 		if (index >= static_cast<int>(m_layers.size()))
 			return nullptr;
 
 		return m_layers.at(index);
 	}
 
-	void ResAnimatorController::SetBool(const std::string& param_name, bool param)
-	{
-		const auto itr = m_parameters.find(param_name);
-		if (itr == m_parameters.end())
-			return;
-		itr->second->default_bool = param;
-	}
-
-	void ResAnimatorController::SetInteger(const std::string& param_name, int param)
+	const Animations::AnimatorLODSettings& ResAnimatorController::GetLODSettings() const
 	{
-		const auto itr = m_parameters.find(param_name);
-		if (itr == m_parameters.end())
-			return;
-		itr->second->default_int = param;
+		return m_lod_settings;
 	}
 
-	void ResAnimatorController::SetFloat(const std::string& param_name, float param)
+	void ResAnimatorController::SetLODSettings(const Animations::AnimatorLODSettings& settings)
 	{
-		const auto itr = m_parameters.find(param_name);
-		if (itr == m_parameters.end())
-			return;
-		itr->second->default_float = param;
-	}
-
-	void ResAnimatorController::SetTrigger(const std::string& param_name)
-	{
-		const auto itr = m_parameters.find(param_name);
-		if (itr == m_parameters.end())
-			return;
-		itr->second->default_bool = true;
-	}
-
-	bool ResAnimatorController::GetBool(const std::string& param_name)
-	{
-		const auto itr = m_parameters.find(param_name);
-		if (itr == m_parameters.end())
-		{
-			assert(0 && "invalid argument");
-			return false;
-		}
-		return itr->second->default_bool;
+		m_lod_settings = settings;
 	}
 
-	int ResAnimatorController::GetInteger(const std::string& param_name)
+	void ResAnimatorController::SyncInstance(Animations::AnimatorControllerInstance& instance) const
 	{
-		const auto itr = m_parameters.find(param_name);
-		if (itr == m_parameters.end())
+		// p[^̒ǉA폜A^̕ύX΃Xbg̏ɍ蒼(IDœ^̒l͈p)
+		if (instance.parameter_revision != m_parameter_revision)
 		{
-			assert(0 && "invalid argument");
-			return 0;
+			const size_t slot_cnt = m_parameter_slots.size();
+			std::vector<Animations::AnimatorControllerParameter> parameters(slot_cnt);
+			for (size_t i = 0; i < slot_cnt; ++i)
+			{
+				const auto& default_param = m_parameter_slots[i].param;
+				if (!default_param)
+					continue;
+				parameters[i] = *default_param;
+				if (i >= instance.parameters.size())
+					continue;
+				const auto& prev_param = instance.parameters[i];
+				if (prev_param.id == default_param->id && prev_param.type == default_param->type)
+				{
+					parameters[i] = prev_param;
+				}
+			}
+			instance.parameters = std::move(parameters);
+			instance.parameter_revision = m_parameter_revision;
 		}
-		return itr->second->default_int;
-	}
-
-	float ResAnimatorController::GetFloat(const std::string& param_name)
-	{
-		const auto itr = m_parameters.find(param_name);
-		if (itr == m_parameters.end())
+		// C[̍\ςĂ΍ĐԂ蒼
+		const size_t layer_cnt = m_layers.size();
+		if (instance.layers.size() != layer_cnt)
 		{
-			assert(0 && "invalid argument");
-			return 0.0f;
+			instance.layers.resize(layer_cnt);
 		}
-		return itr->second->default_float;
-	}
-
-	void ResAnimatorController::ResetTrigger(const std::string& param_name)
-	{
-		const auto itr = m_parameters.find(param_name);
-		if (itr == m_parameters.end())
+		for (size_t i = 0; i < layer_cnt; ++i)
 		{
-			assert(0 && "invalid argument");
-			return;
+			const auto& layer = m_layers[i];
+			if (!layer->IsValidInstance(instance.layers[i]))
+			{
+				layer->CreateInstance(instance.layers[i]);
+			}
 		}
-		itr->second->default_bool = false;
 	}
 
 	void ResAnimatorController::ApplyAnimationTransform(
 		const GameObjectID goid,
 		const float elapsed_time,
-		const std::unordered_map<std::string, int>* node_index,
+		const Animations::AvatarBinding& avatar,
 		const std::vector<int>& enable_nodes,
+		Animations::AnimatorControllerInstance& instance,
 		std::vector<Animations::KeyData>& data
 	)
 	{
+		// AvatarςAς݂̕ϊe[uSĔj
+		if (!avatar.IsSame(instance.remap_avatar))
+		{
+			for (auto& layer_instance : instance.layers)
+			{
+				for (auto& block_instance : layer_instance.blocks)
+				{
+					block_instance.remap_tables.clear();
+				}
+			}
+			instance.remap_avatar = avatar.owner;
+		}
+
 		const size_t layer_cnt = m_layers.size();
 		for (size_t i = 0; i < layer_cnt; ++i)
 		{
@@ -670,14 +766,64 @@ namespace TKGEngine
 				goid,
 				elapsed_time,
 				(i == 0) ? true : false,
-				m_parameters,
-				node_index,
+				instance.layers.at(i),
+				instance.parameters,
+				avatar,
 				enable_nodes,
 				data
 			);
 		}
 	}
 
+	void ResAnimatorController::OnChangeParameter()
+	{
+		++m_parameter_revision;
+
+		// 폜ꂽp[^̃Xbg󂯁Ai߂ČÂID𖳌ɂ
+		std::unordered_set<const Animations::AnimatorControllerParameter*> current_params;
+		for (const auto& param : m_parameters)
+		{
+			current_params.emplace(param.second.get());
+		}
+		std::unordered_set<const Animations::AnimatorControllerParameter*> slotted_params;
+		for (auto& slot : m_parameter_slots)
+		{
+			if (!slot.param)
+				continue;
+			if (current_params.count(slot.param.get()) == 0)
+			{
+				slot.param.reset();
+				++slot.generation;
+				continue;
+			}
+			slotted_params.emplace(slot.param.get());
+		}
+
+		// Vp[^󂫃XbgɊ蓖Ă(̃p[^ID͕ςȂ)
+		size_t free_slot = 0;
+		m_parameter_ids.clear();
+		for (const auto& param : m_parameters)
+		{
+			if (slotted_params.count(param.second.get()) == 0)
+			{
+				while (free_slot < m_parameter_slots.size() && m_parameter_slots[free_slot].param)
+				{
+					++free_slot;
+				}
+				if (free_slot == m_parameter_slots.size())
+				{
+					assert(free_slot <= static_cast<size_t>(Animations::PARAMETER_ID_SLOT_MASK) && "Too many parameters ResAnimatorController::OnChangeParameter()");
+					m_parameter_slots.emplace_back();
+				}
+				auto& slot = m_parameter_slots[free_slot];
+				slot.param = param.second;
+				slot.param->id = Animations::MakeParameterID(static_cast<int>(free_slot), slot.generation);
+			}
+			m_parameter_ids.emplace(param.first, param.second->id);
+		}
+		m_is_parameter_id_dirty = true;
+	}
+
 	void ResAnimatorController::SetAsyncOnLoad()
 	{
 		// [h
@@ -711,13 +857,13 @@ namespace TKGEngine
 			if (b_result)
 			{
 				// 
-				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_SUCCESS;
-				m_has_resource = true;
-
 				////////// [h̏
-				/* nothing */
-
+				// p[^ɗvfԍ蓖Ă
+				// HasResourceĎQƂ邽߁A蓖ďIĂJ
+				OnChangeParameter();
 
+				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_SUCCESS;
+				m_has_resource = true;
 			}
 			else
 			{
@@ -758,12 +904,12 @@ namespace TKGEngine
 			if (b_result)
 			{
 				// 
-				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_SUCCESS;
-				m_has_resource = true;
-
 				////////// [h̏
-				/* nothing */
+				// p[^ɗvfԍ蓖Ă
+				OnChangeParameter();
 
+				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_SUCCESS;
+				m_has_resource = true;
 			}
 			else
 			{
@@ -824,5 +970,5 @@ namespace TKGEngine
 }// namespace TKGEngine
 
 CEREAL_REGISTER_TYPE(TKGEngine::ResAnimatorController);
-CEREAL_CLASS_VERSION(TKGEngine::ResAnimatorController, 1);
+CEREAL_CLASS_VERSION(TKGEngine::ResAnimatorController, 2);
 CEREAL_REGISTER_POLYMORPHIC_RELATION(TKGEngine::IResAnimatorController, TKGEngine::ResAnimatorController)
\ No newline at end of file
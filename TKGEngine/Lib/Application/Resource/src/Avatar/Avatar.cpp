@@ -89,6 +89,11 @@ namespace TKGEngine
 		return m_res_avatar == nullptr ? nullptr : m_res_avatar->GetNodeIndex();
 	}
 
+	std::weak_ptr<const void> Avatar::GetIdentity() const
+	{
+		return m_res_avatar;
+	}
+
 	const std::vector<std::string>* Avatar::GetAlignedBoneNames() const
 	{
 		return m_res_avatar == nullptr ? nullptr : m_res_avatar->GetAlignedBoneNames();
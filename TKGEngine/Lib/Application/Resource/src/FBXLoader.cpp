@@ -304,6 +304,7 @@ namespace TKGEngine
 								if (ImGui::CollapsingHeader("Motion"))
 								{
 									ImGui::Indent(20.0f);
+									ImGui::Checkbox("Compress", &data.compress_motion);
 									for (auto&& motion : data.motion_selection)
 									{
 										ImGui::Checkbox(motion.first.c_str(), &motion.second);
@@ -493,7 +494,7 @@ namespace TKGEngine
 						motion_names.emplace_back(motion.first);
 					}
 				}
-				IResMotion::CreateBinaryFromFBX(motion_filepathes, data.fbx_scene, motion_names, bone_name_index);
+				IResMotion::CreateBinaryFromFBX(motion_filepathes, data.fbx_scene, motion_names, bone_name_index, data.compress_motion);
 			}
 
 			// .object
@@ -310,7 +310,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResMaterial::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResMaterial::SetAsyncOnLoad, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_PREFETCH);
 
 		return res_new;
 	}
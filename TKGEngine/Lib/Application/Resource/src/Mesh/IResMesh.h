@@ -61,7 +61,7 @@ namespace TKGEngine
 		IResMesh& operator=(const IResMesh&) = delete;
 
 		static std::shared_ptr<IResMesh> Load(const std::string& filename);
-		static std::shared_ptr<IResMesh> LoadAsync(const std::string& filename);
+		static std::shared_ptr<IResMesh> LoadAsync(const std::string& filename, ASSET_LOAD_PRIORITY priority);
 #ifdef USE_IMGUI
 		static void CreateBinaryFromFBX(
 			const std::string& filepath,
@@ -71,6 +71,10 @@ namespace TKGEngine
 			std::unordered_map<std::string, int>& bone_name_index,
 			bool& is_skinned
 		);
+		/// <summary>
+		/// `(cereal).mesht@C}bvă[hł`ɕϊď㏑
+		/// </summary>
+		static bool ConvertBinary(const std::string& filepath);
 #endif// USE_IMGUI
 		static std::shared_ptr<IResMesh> Create();
 		static void RemoveUnused();
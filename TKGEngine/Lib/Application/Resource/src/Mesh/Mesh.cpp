@@ -26,14 +26,21 @@ namespace TKGEngine
 		IResMesh::RemoveUnused();
 	}
 
+#ifdef USE_IMGUI
+	bool Mesh::ConvertBinary(const std::string& filepath)
+	{
+		return IResMesh::ConvertBinary(filepath);
+	}
+#endif// USE_IMGUI
+
 	void Mesh::Load(const std::string& filename)
 	{
 		m_res_mesh = IResMesh::Load(filename);
 	}
 
-	void Mesh::LoadAsync(const std::string& filename)
+	void Mesh::LoadAsync(const std::string& filename, const ASSET_LOAD_PRIORITY priority)
 	{
-		m_res_mesh = IResMesh::LoadAsync(filename);
+		m_res_mesh = IResMesh::LoadAsync(filename, priority);
 	}
 
 	void Mesh::Create()
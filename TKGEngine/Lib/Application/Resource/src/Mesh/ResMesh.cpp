@@ -8,10 +8,13 @@
 #include "Utility/inc/myfunc_vector.h"
 #include "Utility/inc/myfunc_math.h"
 #include "Utility/inc/myfunc_file.h"
+#include "Utility/inc/mapped_file.h"
 #include "Utility/inc/bounds.h"
 
 #include <DirectXMath.h>
 #include <cfloat>
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
 namespace TKGEngine
@@ -39,6 +42,7 @@ namespace TKGEngine
 			std::unordered_map<std::string, int>& bone_name_index,
 			bool& is_skinned
 		);
+		static bool ConvertFromCerealBinary(const std::string& filepath);
 #endif// USE_IMGUI
 
 		// AssetDataBase
@@ -160,12 +164,19 @@ namespace TKGEngine
 
 #ifdef USE_IMGUI
 		void Save(const std::string& filepath);
+		bool SaveMappedBinary(const std::string& filepath) const;
 		void PrepareToFetch(FbxNode* fbx_node, FbxMesh* fbx_mesh);
 		void FetchSubset(const FbxNode* fbx_node, FbxMesh* fbx_mesh);
 		void FetchVertex(const FbxNode* fbx_node, FbxMesh* fbx_mesh, const std::unordered_map<std::string, int>& bone_name_index, bool& is_skinned);
 #endif// USE_IMGUI
 
+		// t@C`𔻕ʂă[hAobt@쐬
+		bool LoadFromFile();
+		bool LoadFromMappedFile(const MappedFile& file);
+
 		void CreateBuffers();
+		bool CreateVertexBuffer(VERTEX_ELEMENT_TYPE type, const void* p_data, int vertex_count);
+		const void* GetVertexStream(VERTEX_ELEMENT_TYPE type, int& vertex_count) const;
 		void ClearVerticesAndIndices();
 
 		VECTOR3 CalculateNormal(const VECTOR3& p0, const VECTOR3& p1, const VECTOR3& p2);
@@ -245,6 +256,81 @@ namespace TKGEngine
 	static constexpr const char* DEFAULT_NAME = "default";
 
 
+	////////////////////////////////////////////////////////
+	// Mesh Binary Format
+	////////////////////////////////////////////////////////
+	// [MeshFileHeader][MeshFileChunk * chunk_num][chunk data ...]
+	// e`N̓t@C擪MESH_FILE_ALIGNMENTŃACĂ
+	// _Xg[VertexBufferƓvfƂ̕тŊi[A}bvAhX̂܂ܓn
+	static constexpr std::uint32_t MESH_FILE_MAGIC = ('T' | ('K' << 8) | ('G' << 16) | ('M' << 24));
+	static constexpr std::uint32_t MESH_FILE_VERSION = 1;
+	static constexpr std::uint64_t MESH_FILE_ALIGNMENT = 16;
+
+	enum class MESH_FILE_CHUNK_TYPE : std::uint32_t
+	{
+		// POSITION ~ TEXCOORD7 VERTEX_ELEMENT_TYPEƓlg
+		MESH_FILE_CHUNK_INDEX = static_cast<std::uint32_t>(VERTEX_ELEMENT_TYPE::TEXCOORD7) + 1,
+		MESH_FILE_CHUNK_SUBSET,
+		MESH_FILE_CHUNK_NAME
+	};
+
+	struct MeshFileHeader
+	{
+		std::uint32_t magic = MESH_FILE_MAGIC;
+		std::uint32_t version = MESH_FILE_VERSION;
+		std::uint32_t chunk_num = 0;
+		std::int32_t heap_type = 0;
+		std::int32_t vertex_type_using_flags = 0;
+		std::int32_t vertex_count = 0;
+		std::int32_t index_count = 0;
+		std::int32_t subset_count = 0;
+		// Bounds
+		float bounds_center[3] = {};
+		float bounds_extents[3] = {};
+		float max_point[3] = {};
+		float min_point[3] = {};
+		// Global Transform
+		float translate[3] = {};
+		float rotate[4] = {};
+		float scale[3] = {};
+	};
+
+	struct MeshFileChunk
+	{
+		std::uint32_t type = 0;
+		std::uint32_t stride = 0;
+		std::uint64_t offset = 0;
+		std::uint64_t size = 0;
+	};
+
+	static_assert(std::is_trivially_copyable_v<Subset>, "Subset must be trivially copyable for MeshFileChunk.");
+	static_assert(sizeof(MeshFileHeader) % 4 == 0 && sizeof(MeshFileChunk) % 8 == 0, "invalid mesh file layout.");
+
+	inline bool IsMappedMeshFile(const MappedFile& file)
+	{
+		if (!file.IsOpen() || file.GetSize() < sizeof(MeshFileHeader))
+			return false;
+		return static_cast<const MeshFileHeader*>(file.GetData())->magic == MESH_FILE_MAGIC;
+	}
+
+	inline void StoreMeshFileFloat3(float(&dst)[3], const VECTOR3& src)
+	{
+		dst[0] = src.x;
+		dst[1] = src.y;
+		dst[2] = src.z;
+	}
+
+	inline VECTOR3 LoadMeshFileFloat3(const float(&src)[3])
+	{
+		return VECTOR3(src[0], src[1], src[2]);
+	}
+
+	inline std::uint64_t AlignMeshFileOffset(const std::uint64_t offset)
+	{
+		return (offset + MESH_FILE_ALIGNMENT - 1) & ~(MESH_FILE_ALIGNMENT - 1);
+	}
+
+
 	////////////////////////////////////////////////////////
 	// Local Methods
 	////////////////////////////////////////////////////////
@@ -344,7 +430,7 @@ namespace TKGEngine
 		return res_new;
 	}
 
-	std::shared_ptr<IResMesh> IResMesh::LoadAsync(const std::string& filename)
+	std::shared_ptr<IResMesh> IResMesh::LoadAsync(const std::string& filename, const ASSET_LOAD_PRIORITY priority)
 	{
 		// Access resource map
 		m_cache_mutex.lock();
@@ -364,7 +450,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResMesh::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResMesh::SetAsyncOnLoad, priority);
 
 		return res_new;
 	}
@@ -390,6 +476,11 @@ namespace TKGEngine
 		}
 		m_caches.Set(filepath, s_ptr);
 	}
+
+	bool IResMesh::ConvertBinary(const std::string& filepath)
+	{
+		return ResMesh::ConvertFromCerealBinary(filepath);
+	}
 #endif// USE_IMGUI
 
 	std::shared_ptr<IResMesh> IResMesh::Create()
@@ -865,15 +956,10 @@ namespace TKGEngine
 	void ResMesh::Save(const std::string& filepath)
 	{
 		// Binary
+		if (!SaveMappedBinary(filepath))
 		{
-			std::ofstream ofs(filepath.c_str(), std::ios::out | std::ios::binary);
-			if (!ofs.is_open())
-			{
-				assert(0 && "failed open file. ResMesh::Save()");
-				return;
-			}
-			cereal::BinaryOutputArchive ar(ofs);
-			ar(*this);
+			assert(0 && "failed open file. ResMesh::Save()");
+			return;
 		}
 
 #ifdef SAVE_JSON
@@ -891,6 +977,140 @@ namespace TKGEngine
 		}
 #endif//#ifdef SAVE_JSON
 	}
+
+	bool ResMesh::SaveMappedBinary(const std::string& filepath) const
+	{
+		MeshFileHeader header;
+		header.heap_type = static_cast<std::int32_t>(m_heap_type);
+		header.vertex_type_using_flags = m_vertex_type_using_flags;
+		header.vertex_count = static_cast<std::int32_t>(m_positions[0].size());
+		header.index_count = static_cast<std::int32_t>(m_indices[0].size());
+		header.subset_count = m_subset_count;
+		StoreMeshFileFloat3(header.bounds_center, m_bounds.GetCenter());
+		StoreMeshFileFloat3(header.bounds_extents, m_bounds.GetExtents());
+		StoreMeshFileFloat3(header.max_point, m_max_point);
+		StoreMeshFileFloat3(header.min_point, m_min_point);
+		StoreMeshFileFloat3(header.translate, m_translate);
+		header.rotate[0] = m_rotate.x;
+		header.rotate[1] = m_rotate.y;
+		header.rotate[2] = m_rotate.z;
+		header.rotate[3] = m_rotate.w;
+		StoreMeshFileFloat3(header.scale, m_scale);
+
+		// o`N̗
+		std::vector<MeshFileChunk> chunks;
+		std::vector<const void*> chunk_data;
+		const auto add_chunk = [&chunks, &chunk_data](const std::uint32_t type, const std::uint32_t stride, const void* p_data, const size_t size)
+		{
+			MeshFileChunk chunk;
+			chunk.type = type;
+			chunk.stride = stride;
+			chunk.size = size;
+			chunks.emplace_back(chunk);
+			chunk_data.emplace_back(p_data);
+		};
+		for (int i = 0; i <= static_cast<int>(VERTEX_ELEMENT_TYPE::TEXCOORD7); ++i)
+		{
+			if ((m_vertex_type_using_flags & (1 << i)) == 0)
+				continue;
+
+			int vertex_count = 0;
+			const void* p_stream = GetVertexStream(static_cast<VERTEX_ELEMENT_TYPE>(i), vertex_count);
+			if (p_stream == nullptr || vertex_count != header.vertex_count)
+			{
+				LOG_ASSERT("Vertex stream size mismatch.(%s) element(%d)", filepath.c_str(), i);
+				return false;
+			}
+			add_chunk(
+				static_cast<std::uint32_t>(i),
+				static_cast<std::uint32_t>(VERTEX_ELEMENT::ELEMENT_SIZE[i]),
+				p_stream,
+				static_cast<size_t>(vertex_count) * VERTEX_ELEMENT::ELEMENT_SIZE[i]
+			);
+		}
+		add_chunk(
+			static_cast<std::uint32_t>(MESH_FILE_CHUNK_TYPE::MESH_FILE_CHUNK_INDEX),
+			sizeof(unsigned),
+			m_indices[0].data(),
+			m_indices[0].size() * sizeof(unsigned)
+		);
+		add_chunk(
+			static_cast<std::uint32_t>(MESH_FILE_CHUNK_TYPE::MESH_FILE_CHUNK_SUBSET),
+			sizeof(Subset),
+			m_subsets.data(),
+			m_subsets.size() * sizeof(Subset)
+		);
+		const std::string name = GetName();
+		add_chunk(
+			static_cast<std::uint32_t>(MESH_FILE_CHUNK_TYPE::MESH_FILE_CHUNK_NAME),
+			sizeof(char),
+			name.data(),
+			name.size()
+		);
+		header.chunk_num = static_cast<std::uint32_t>(chunks.size());
+
+		// ItZbǧvZ
+		std::uint64_t offset = sizeof(MeshFileHeader) + sizeof(MeshFileChunk) * chunks.size();
+		for (auto&& chunk : chunks)
+		{
+			offset = AlignMeshFileOffset(offset);
+			chunk.offset = offset;
+			offset += chunk.size;
+		}
+
+		// o
+		std::ofstream ofs(filepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!ofs.is_open())
+		{
+			return false;
+		}
+		ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		ofs.write(reinterpret_cast<const char*>(chunks.data()), sizeof(MeshFileChunk) * chunks.size());
+		constexpr char padding[MESH_FILE_ALIGNMENT] = {};
+		std::uint64_t written = sizeof(MeshFileHeader) + sizeof(MeshFileChunk) * chunks.size();
+		const size_t chunk_num = chunks.size();
+		for (size_t i = 0; i < chunk_num; ++i)
+		{
+			ofs.write(padding, static_cast<std::streamsize>(chunks[i].offset - written));
+			if (chunks[i].size > 0)
+			{
+				ofs.write(static_cast<const char*>(chunk_data[i]), static_cast<std::streamsize>(chunks[i].size));
+			}
+			written = chunks[i].offset + chunks[i].size;
+		}
+
+		return ofs.good();
+	}
+
+	bool ResMesh::ConvertFromCerealBinary(const std::string& filepath)
+	{
+		// ϊς݂Ȃ牽Ȃ
+		{
+			MappedFile file;
+			if (file.Open(filepath) && IsMappedMeshFile(file))
+				return true;
+		}
+
+		const std::unique_ptr<ResMesh> p_mesh = std::make_unique<ResMesh>();
+		{
+			std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+			if (!ifs.is_open())
+			{
+				LOG_ASSERT("Failed open mesh file.(%s)", filepath.c_str());
+				return false;
+			}
+			cereal::BinaryInputArchive ar(ifs);
+			ar(*p_mesh);
+		}
+		p_mesh->SetFilePath(filepath);
+
+		if (!p_mesh->SaveMappedBinary(filepath))
+		{
+			LOG_ASSERT("Failed convert mesh file.(%s)", filepath.c_str());
+			return false;
+		}
+		return true;
+	}
 #endif// USE_IMGUI
 
 	void ResMesh::ActivateVB(ID3D11DeviceContext* p_context, int slot, VERTEX_ELEMENT_TYPE type)
@@ -1277,22 +1497,7 @@ namespace TKGEngine
 		}
 
 		// Load Mesh
-		bool b_result = false;
-		{
-			std::ifstream ifs(this->GetFilePath(), std::ios::in | std::ios::binary);
-
-			if (ifs.is_open() == false)
-			{
-				b_result = false;
-			}
-			else
-			{
-				cereal::BinaryInputArchive ar(ifs);
-
-				ar(*this);
-				b_result = true;
-			}
-		}
+		const bool b_result = LoadFromFile();
 
 		// Finish loading
 		{
@@ -1308,11 +1513,6 @@ namespace TKGEngine
 			{
 				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_SUCCESS;
 				m_has_resource = true;
-
-				// _obt@̍쐬
-				CreateBuffers();
-				// [h̓obt@쐬݂̂Ɏgp邽߁A쐬̓NA
-				ClearVerticesAndIndices();
 			}
 		}
 	}
@@ -1326,22 +1526,7 @@ namespace TKGEngine
 		}
 
 		// Load Mesh
-		bool b_result = false;
-		{
-			std::ifstream ifs(this->GetFilePath(), std::ios::in | std::ios::binary);
-
-			if (ifs.is_open() == false)
-			{
-				b_result = false;
-			}
-			else
-			{
-				cereal::BinaryInputArchive ar(ifs);
-
-				ar(*this);
-				b_result = true;
-			}
-		}
+		const bool b_result = LoadFromFile();
 
 		// Finish loading
 		{
@@ -1356,13 +1541,198 @@ namespace TKGEngine
 			{
 				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_SUCCESS;
 				m_has_resource = true;
+			}
+		}
+	}
+
+	bool ResMesh::LoadFromFile()
+	{
+		{
+			MappedFile file;
+			if (!file.Open(this->GetFilePath()))
+			{
+				return false;
+			}
+			if (IsMappedMeshFile(file))
+			{
+				return LoadFromMappedFile(file);
+			}
+		}
 
-				// _obt@̍쐬
-				CreateBuffers();
-				// [h̓obt@쐬݂̂Ɏgp邽߁A쐬̓NA
-				ClearVerticesAndIndices();
+		// `(cereal)̃t@C
+		{
+			std::ifstream ifs(this->GetFilePath(), std::ios::in | std::ios::binary);
+			if (ifs.is_open() == false)
+			{
+				return false;
 			}
+			cereal::BinaryInputArchive ar(ifs);
+			ar(*this);
 		}
+		// _obt@̍쐬
+		CreateBuffers();
+		// [h̓obt@쐬݂̂Ɏgp邽߁A쐬̓NA
+		ClearVerticesAndIndices();
+		return true;
+	}
+
+	bool ResMesh::LoadFromMappedFile(const MappedFile& file)
+	{
+		const auto* p_file = static_cast<const std::uint8_t*>(file.GetData());
+		const size_t file_size = file.GetSize();
+		const MeshFileHeader& header = *reinterpret_cast<const MeshFileHeader*>(p_file);
+		if (header.version != MESH_FILE_VERSION)
+		{
+			LOG_ASSERT("Unsupported mesh file version.(%s) version(%u)", this->GetFilePath(), header.version);
+			return false;
+		}
+		if (sizeof(MeshFileHeader) + sizeof(MeshFileChunk) * static_cast<size_t>(header.chunk_num) > file_size
+			|| header.vertex_count < 0 || header.index_count < 0 || header.subset_count <= 0)
+		{
+			LOG_ASSERT("Broken mesh file.(%s)", this->GetFilePath());
+			return false;
+		}
+
+		// `ÑAhXo(f[^̃Rs[͂Ȃ)
+		constexpr int VERTEX_STREAM_NUM = static_cast<int>(VERTEX_ELEMENT_TYPE::TEXCOORD7) + 1;
+		const void* vertex_streams[VERTEX_STREAM_NUM] = {};
+		const unsigned* p_indices = nullptr;
+		const Subset* p_subsets = nullptr;
+		const char* p_name = nullptr;
+		size_t name_length = 0;
+
+		const auto* chunks = reinterpret_cast<const MeshFileChunk*>(p_file + sizeof(MeshFileHeader));
+		for (std::uint32_t i = 0; i < header.chunk_num; ++i)
+		{
+			const MeshFileChunk& chunk = chunks[i];
+			if (chunk.offset > file_size || chunk.size > file_size - chunk.offset)
+			{
+				LOG_ASSERT("Broken mesh file.(%s) chunk(%u)", this->GetFilePath(), i);
+				return false;
+			}
+			const void* p_data = p_file + chunk.offset;
+
+			if (chunk.type < static_cast<std::uint32_t>(VERTEX_STREAM_NUM))
+			{
+				if (chunk.stride != static_cast<std::uint32_t>(VERTEX_ELEMENT::ELEMENT_SIZE[chunk.type])
+					|| chunk.size != static_cast<std::uint64_t>(chunk.stride) * header.vertex_count)
+				{
+					LOG_ASSERT("Broken mesh file.(%s) chunk(%u)", this->GetFilePath(), i);
+					return false;
+				}
+				vertex_streams[chunk.type] = p_data;
+				continue;
+			}
+			switch (static_cast<MESH_FILE_CHUNK_TYPE>(chunk.type))
+			{
+				case MESH_FILE_CHUNK_TYPE::MESH_FILE_CHUNK_INDEX:
+					if (chunk.size != sizeof(unsigned) * static_cast<std::uint64_t>(header.index_count))
+					{
+						LOG_ASSERT("Broken mesh file.(%s) index chunk size(%llu)", this->GetFilePath(), chunk.size);
+						return false;
+					}
+					p_indices = static_cast<const unsigned*>(p_data);
+					break;
+				case MESH_FILE_CHUNK_TYPE::MESH_FILE_CHUNK_SUBSET:
+					if (chunk.size != sizeof(Subset) * static_cast<std::uint64_t>(header.subset_count))
+					{
+						LOG_ASSERT("Broken mesh file.(%s) subset chunk size(%llu)", this->GetFilePath(), chunk.size);
+						return false;
+					}
+					p_subsets = static_cast<const Subset*>(p_data);
+					break;
+				case MESH_FILE_CHUNK_TYPE::MESH_FILE_CHUNK_NAME:
+					p_name = static_cast<const char*>(p_data);
+					name_length = static_cast<size_t>(chunk.size);
+					break;
+				default:
+					// m̃`N͓ǂݔ΂
+					break;
+			}
+		}
+		if (p_indices == nullptr || p_subsets == nullptr)
+		{
+			LOG_ASSERT("Broken mesh file.(%s)", this->GetFilePath());
+			return false;
+		}
+		// ͈͊O̒_QƂCfbNXGPUŕsȃANZXɂȂ邽ߓǂݍ܂Ȃ
+		for (std::int32_t i = 0; i < header.index_count; ++i)
+		{
+			if (p_indices[i] >= static_cast<unsigned>(header.vertex_count))
+			{
+				LOG_ASSERT("Broken mesh file.(%s) index[%d](%u) >= vertex count(%d)", this->GetFilePath(), i, p_indices[i], header.vertex_count);
+				return false;
+			}
+		}
+		for (std::int32_t i = 0; i < header.subset_count; ++i)
+		{
+			const Subset& subset = p_subsets[i];
+			if (subset.start_index < 0 || subset.index_count < 0
+				|| static_cast<std::int64_t>(subset.start_index) + subset.index_count > header.index_count)
+			{
+				LOG_ASSERT("Broken mesh file.(%s) subset[%d] start(%d) count(%d)", this->GetFilePath(), i, subset.start_index, subset.index_count);
+				return false;
+			}
+		}
+
+		// wb_
+		m_heap_type = static_cast<BUFFER_HEAP_TYPE>(header.heap_type);
+		m_vertex_type_using_flags = header.vertex_type_using_flags;
+		m_subset_count = header.subset_count;
+		m_subsets.assign(p_subsets, p_subsets + header.subset_count);
+		m_bounds.SetCenter(LoadMeshFileFloat3(header.bounds_center));
+		m_bounds.SetExtents(LoadMeshFileFloat3(header.bounds_extents));
+		m_max_point = LoadMeshFileFloat3(header.max_point);
+		m_min_point = LoadMeshFileFloat3(header.min_point);
+		m_translate = LoadMeshFileFloat3(header.translate);
+		m_rotate = Quaternion(header.rotate[0], header.rotate[1], header.rotate[2], header.rotate[3]);
+		m_scale = LoadMeshFileFloat3(header.scale);
+		if (p_name != nullptr && name_length > 0)
+		{
+			SetName(std::string(p_name, name_length));
+		}
+
+		// _obt@̍쐬
+		for (int i = 0; i < VERTEX_STREAM_NUM; ++i)
+		{
+			if ((m_vertex_type_using_flags & (1 << i)) == 0)
+				continue;
+
+			if (vertex_streams[i] == nullptr || !CreateVertexBuffer(static_cast<VERTEX_ELEMENT_TYPE>(i), vertex_streams[i], header.vertex_count))
+			{
+				LOG_ASSERT("Failed create vertex buffer.(%s) element(%d)", this->GetFilePath(), i);
+				return false;
+			}
+		}
+		if (m_IB.Create(const_cast<unsigned*>(p_indices), header.index_count, m_heap_type) == false)
+		{
+			LOG_ASSERT("Failed create index buffer.(%s)", this->GetFilePath());
+			return false;
+		}
+
+		// CPUŕێvf̂݃Rs[
+		const auto* p_positions = static_cast<const VECTOR3*>(vertex_streams[static_cast<int>(VERTEX_ELEMENT_TYPE::POSITION)]);
+		const auto* p_normals = static_cast<const VECTOR3*>(vertex_streams[static_cast<int>(VERTEX_ELEMENT_TYPE::NORMAL)]);
+		const auto* p_uvs = static_cast<const VECTOR2*>(vertex_streams[static_cast<int>(VERTEX_ELEMENT_TYPE::TEXCOORD0)]);
+		if (p_positions)
+		{
+			m_positions[0].assign(p_positions, p_positions + header.vertex_count);
+		}
+		if (p_normals)
+		{
+			m_normals[0].assign(p_normals, p_normals + header.vertex_count);
+		}
+		else
+		{
+			m_normals[0].assign(header.vertex_count, VECTOR3::Zero);
+		}
+		if (p_uvs)
+		{
+			m_uv0[0].assign(p_uvs, p_uvs + header.vertex_count);
+		}
+		m_indices[0].assign(p_indices, p_indices + header.index_count);
+
+		return true;
 	}
 
 	void ResMesh::CreateBuffers()
@@ -1627,6 +1997,55 @@ namespace TKGEngine
 
 	}
 
+	bool ResMesh::CreateVertexBuffer(const VERTEX_ELEMENT_TYPE type, const void* p_data, const int vertex_count)
+	{
+		const int element_type = static_cast<int>(type);
+		// XLjOComputeShaderQƂvfSRV쐬
+		const bool create_srv =
+			type == VERTEX_ELEMENT_TYPE::POSITION || type == VERTEX_ELEMENT_TYPE::NORMAL || type == VERTEX_ELEMENT_TYPE::TANGENT
+			|| type == VERTEX_ELEMENT_TYPE::BONES || type == VERTEX_ELEMENT_TYPE::WEIGHTS;
+
+		// CreateBuffer͏f[^ǂނȂ̂ŁA}bvǂݍݐp̈̂܂ܓn
+		return m_VBs[element_type].Create(
+			const_cast<void*>(p_data),
+			VERTEX_ELEMENT::ELEMENT_SIZE[element_type],
+			vertex_count,
+			type,
+			m_heap_type,
+			create_srv,
+			false);
+	}
+
+	const void* ResMesh::GetVertexStream(const VERTEX_ELEMENT_TYPE type, int& vertex_count) const
+	{
+		const auto get_stream = [&vertex_count](const auto& stream) -> const void*
+		{
+			vertex_count = static_cast<int>(stream.size());
+			return stream.data();
+		};
+
+		switch (type)
+		{
+			case VERTEX_ELEMENT_TYPE::POSITION:		return get_stream(m_positions[0]);
+			case VERTEX_ELEMENT_TYPE::NORMAL:		return get_stream(m_normals[0]);
+			case VERTEX_ELEMENT_TYPE::TANGENT:		return get_stream(m_tangents);
+			case VERTEX_ELEMENT_TYPE::BONES:		return get_stream(m_bones);
+			case VERTEX_ELEMENT_TYPE::WEIGHTS:		return get_stream(m_weights);
+			case VERTEX_ELEMENT_TYPE::COLOR:		return get_stream(m_colors);
+			case VERTEX_ELEMENT_TYPE::TEXCOORD0:	return get_stream(m_uv0[0]);
+			case VERTEX_ELEMENT_TYPE::TEXCOORD1:	return get_stream(m_uv1);
+			case VERTEX_ELEMENT_TYPE::TEXCOORD2:	return get_stream(m_uv2);
+			case VERTEX_ELEMENT_TYPE::TEXCOORD3:	return get_stream(m_uv3);
+			case VERTEX_ELEMENT_TYPE::TEXCOORD4:	return get_stream(m_uv4);
+			case VERTEX_ELEMENT_TYPE::TEXCOORD5:	return get_stream(m_uv5);
+			case VERTEX_ELEMENT_TYPE::TEXCOORD6:	return get_stream(m_uv6);
+			case VERTEX_ELEMENT_TYPE::TEXCOORD7:	return get_stream(m_uv7);
+			default:
+				vertex_count = 0;
+				return nullptr;
+		}
+	}
+
 	void ResMesh::ClearVerticesAndIndices()
 	{
 		m_tangents.clear();
@@ -36,13 +36,14 @@ namespace TKGEngine
 		IResMotion& operator=(const IResMotion&) = delete;
 
 		static std::shared_ptr<IResMotion> Load(const std::string& filename);
-		static std::shared_ptr<IResMotion> LoadAsync(const std::string& filename);
+		static std::shared_ptr<IResMotion> LoadAsync(const std::string& filename, ASSET_LOAD_PRIORITY priority);
 #ifdef USE_IMGUI
 		static void CreateBinaryFromFBX(
 			const std::vector<std::string>& filepathes,
 			FbxScene* fbx_scene,
 			std::vector<std::string>& motion_names,
-			std::unordered_map<std::string, int>& bone_name_index
+			std::unordered_map<std::string, int>& bone_name_index,
+			bool compress
 		);
 #endif// USE_IMGUI
 		static void RemoveUnused();
@@ -54,8 +55,17 @@ namespace TKGEngine
 		virtual float GetSampleRate() const = 0;
 		virtual float GetMotionLength() const = 0;
 
+		// 圧縮済みのモーションはnullptrを返す
 		virtual std::vector<Animations::KeyData>* GetKeyFrame(const int frame) = 0;
+		// 指定フレーム位置(小数部で補間する)のポーズをAvatarのノード順に取得する
+		virtual void SampleKeyFrame(float key, const std::vector<std::int16_t>& remap_table, std::vector<Animations::KeyData>& dst) const = 0;
+		// 加算レイヤーの差分の基準となる先頭フレームのポーズ
+		virtual const std::vector<Animations::KeyData>* GetReferenceKeyFrame() const = 0;
+		virtual bool IsCompressed() const = 0;
 		virtual std::unordered_map<std::string, int>* GetKeyIndex() = 0;
+		// Avatarのノード順からMotionデータ内のインデックスへの変換テーブルを取得する(Avatarごとに初回のみ作成)
+		// 戻り値はAvatarが破棄されるまで有効
+		virtual const std::vector<std::int16_t>* GetRemapTable(const Animations::AvatarBinding& avatar) = 0;
 
 
 		// ==============================================
@@ -26,9 +26,9 @@ namespace TKGEngine
 		m_res_motion = IResMotion::Load(filename);
 	}
 
-	void Motion::LoadAsync(const std::string& filename)
+	void Motion::LoadAsync(const std::string& filename, const ASSET_LOAD_PRIORITY priority)
 	{
-		m_res_motion = IResMotion::LoadAsync(filename);
+		m_res_motion = IResMotion::LoadAsync(filename, priority);
 	}
 
 	void Motion::Release()
@@ -80,9 +80,31 @@ namespace TKGEngine
 		return m_res_motion == nullptr ? nullptr : m_res_motion->GetKeyFrame(frame);
 	}
 
+	void Motion::SampleKeyFrame(const float key, const std::vector<std::int16_t>& remap_table, std::vector<Animations::KeyData>& dst) const
+	{
+		if (m_res_motion == nullptr)
+			return;
+		m_res_motion->SampleKeyFrame(key, remap_table, dst);
+	}
+
+	const std::vector<Animations::KeyData>* Motion::GetReferenceKeyFrame() const
+	{
+		return m_res_motion == nullptr ? nullptr : m_res_motion->GetReferenceKeyFrame();
+	}
+
+	bool Motion::IsCompressed() const
+	{
+		return m_res_motion == nullptr ? false : m_res_motion->IsCompressed();
+	}
+
 	std::unordered_map<std::string, int>* Motion::GetKeyIndex() const
 	{
 		return m_res_motion == nullptr ? nullptr : m_res_motion->GetKeyIndex();
 	}
 
+	const std::vector<std::int16_t>* Motion::GetRemapTable(const Animations::AvatarBinding& avatar) const
+	{
+		return m_res_motion == nullptr ? nullptr : m_res_motion->GetRemapTable(avatar);
+	}
+
 }// namespace TKGEngine
\ No newline at end of file
@@ -0,0 +1,496 @@
+
+#include "Motion_Compression.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+
+namespace TKGEngine::Animations
+{
+	////////////////////////////////////////////////////////
+	// Local Methods
+	////////////////////////////////////////////////////////
+	// ʎq鐬͈̔(ő听ȊÓ}1/2Ɏ܂)
+	constexpr float QUATERNION_COMPONENT_RANGE = 0.70710678f;
+	// 1̃rbg
+	constexpr int QUATERNION_COMPONENT_BITS = 15;
+	constexpr std::uint32_t QUATERNION_COMPONENT_MAX = (1u << QUATERNION_COMPONENT_BITS) - 1;
+	// L[t[ԍ̏
+	constexpr int MAX_COMPRESS_FRAME_COUNT = 0xFFFF;
+
+	// 2̉]̊Ԃ̊px
+	inline float QuaternionAngle(const Quaternion& q1, const Quaternion& q2)
+	{
+		const float dot = (std::min)(std::fabs(Quaternion::Dot(q1, q2)), 1.0f);
+		return 2.0f * std::acos(dot);
+	}
+
+	inline float VectorError(const VECTOR3& v1, const VECTOR3& v2)
+	{
+		return VECTOR3::Distance(v1, v2);
+	}
+
+
+	void SampleAnimation(const Animation& animation, const float key, const std::vector<std::int16_t>& remap_table, std::vector<KeyData>& dst)
+	{
+		const int frame_num = static_cast<int>(animation.keyframes.size());
+		if (frame_num <= 0)
+			return;
+
+		// L[͂ރt[擾
+		const int last_frame = frame_num - 1;
+		const int frame_1 = (std::min)((std::max)(static_cast<int>(key), 0), last_frame);
+		const int frame_2 = (std::min)(frame_1 + 1, last_frame);
+		// uh銄
+		const float ratio = (std::min)((std::max)(key - static_cast<float>(frame_1), 0.0f), 1.0f);
+
+		const auto& v1 = animation.keyframes[frame_1].keys;
+		const auto& v2 = animation.keyframes[frame_2].keys;
+		// o͐ƃL[͈̔͊O͏܂Ȃ
+		const size_t node_num = (std::min)(remap_table.size(), dst.size());
+		const int key_num = static_cast<int>((std::min)(v1.size(), v2.size()));
+
+		// Avatar̃{[̏ԂMotioñf[^ׂĂ
+		for (size_t dst_idx = 0; dst_idx < node_num; ++dst_idx)
+		{
+			const int key_idx = remap_table[dst_idx];
+			if (key_idx < 0 || key_idx >= key_num)
+				continue;
+
+			const auto& key_1 = v1[key_idx];
+			const auto& key_2 = v2[key_idx];
+			auto& dst_key = dst[dst_idx];
+
+			if (frame_1 == frame_2)
+			{
+				dst_key = key_1;
+				continue;
+			}
+			dst_key.translate = VECTOR3::Lerp(key_1.translate, key_2.translate, ratio);
+			dst_key.scale = VECTOR3::Lerp(key_1.scale, key_2.scale, ratio);
+			dst_key.rotate = Quaternion::Slerp(key_1.rotate, key_2.rotate, ratio);
+		}
+	}
+
+
+	////////////////////////////////////////////////////////
+	// Class Methods
+	////////////////////////////////////////////////////////
+	void CompressedAnimation::Compress(const Animation& animation, const MotionCompressionSettings& settings)
+	{
+		Clear();
+
+		const size_t frame_count = animation.keyframes.size();
+		if (frame_count == 0)
+			return;
+		if (frame_count > MAX_COMPRESS_FRAME_COUNT)
+		{
+			assert(0 && "Too many frames to compress. CompressedAnimation::Compress()");
+			return;
+		}
+		m_frame_count = static_cast<int>(frame_count);
+
+		const size_t bone_num = animation.keyframes.front().keys.size();
+		m_tracks.resize(bone_num);
+		for (size_t bone = 0; bone < bone_num; ++bone)
+		{
+			auto& track = m_tracks[bone];
+			CompressVectorTrack(animation, bone, false, settings.translate_tolerance, track.translate);
+			CompressRotateTrack(animation, bone, settings.rotate_tolerance, track.rotate);
+			CompressVectorTrack(animation, bone, true, settings.scale_tolerance, track.scale);
+		}
+
+		m_vector_frames.shrink_to_fit();
+		m_vector_keys.shrink_to_fit();
+		m_rotate_frames.shrink_to_fit();
+		m_rotate_keys.shrink_to_fit();
+	}
+
+	void CompressedAnimation::Clear()
+	{
+		m_frame_count = 0;
+		m_tracks.clear();
+		m_vector_frames.clear();
+		m_vector_keys.clear();
+		m_rotate_frames.clear();
+		m_rotate_keys.clear();
+	}
+
+	bool CompressedAnimation::IsEmpty() const
+	{
+		return m_frame_count <= 0;
+	}
+
+	int CompressedAnimation::GetFrameCount() const
+	{
+		return m_frame_count;
+	}
+
+	int CompressedAnimation::GetTrackNum() const
+	{
+		return static_cast<int>(m_tracks.size());
+	}
+
+	size_t CompressedAnimation::GetMemorySize() const
+	{
+		return sizeof(CompressedAnimation)
+			+ m_tracks.size() * sizeof(BoneTrack)
+			+ m_vector_frames.size() * sizeof(std::uint16_t)
+			+ m_vector_keys.size() * sizeof(VECTOR3)
+			+ m_rotate_frames.size() * sizeof(std::uint16_t)
+			+ m_rotate_keys.size() * sizeof(PackedQuaternion);
+	}
+
+	void CompressedAnimation::Sample(const float key, const std::vector<std::int16_t>& remap_table, std::vector<KeyData>& dst) const
+	{
+		if (IsEmpty())
+			return;
+
+		// o͈͐̔͊O͏܂Ȃ
+		const size_t node_num = (std::min)(remap_table.size(), dst.size());
+		const int track_num = static_cast<int>(m_tracks.size());
+
+		// Avatar̃{[̏ԂɃfR[hĂ
+		for (size_t dst_idx = 0; dst_idx < node_num; ++dst_idx)
+		{
+			const int key_idx = remap_table[dst_idx];
+			if (key_idx < 0 || key_idx >= track_num)
+				continue;
+
+			SampleBone(m_tracks[key_idx], key, dst[dst_idx]);
+		}
+	}
+
+	void CompressedAnimation::SampleAll(const float key, std::vector<KeyData>& dst) const
+	{
+		const size_t track_num = m_tracks.size();
+		dst.resize(track_num);
+		for (size_t i = 0; i < track_num; ++i)
+		{
+			SampleBone(m_tracks[i], key, dst[i]);
+		}
+	}
+
+	size_t CompressedAnimation::GetMemorySize(const Animation& animation)
+	{
+		size_t size = sizeof(Animation);
+		for (const auto& keyframe : animation.keyframes)
+		{
+			size += sizeof(KeyFrame) + keyframe.keys.size() * sizeof(KeyData);
+		}
+		return size;
+	}
+
+	MotionCompressionReport CompressedAnimation::Measure(const Animation& animation, const CompressedAnimation& compressed)
+	{
+		MotionCompressionReport report;
+		report.raw_bytes = GetMemorySize(animation);
+		report.compressed_bytes = compressed.GetMemorySize();
+
+		const int frame_count = static_cast<int>(animation.keyframes.size());
+		if (frame_count == 0 || compressed.IsEmpty())
+			return report;
+
+		// St[rčő덷߂
+		std::vector<KeyData> decoded;
+		for (int frame = 0; frame < frame_count; ++frame)
+		{
+			compressed.SampleAll(static_cast<float>(frame), decoded);
+			const auto& keys = animation.keyframes[frame].keys;
+			const size_t key_num = (std::min)(keys.size(), decoded.size());
+			for (size_t i = 0; i < key_num; ++i)
+			{
+				report.max_translate_error = (std::max)(report.max_translate_error, VectorError(keys[i].translate, decoded[i].translate));
+				report.max_rotate_error = (std::max)(report.max_rotate_error, QuaternionAngle(keys[i].rotate, decoded[i].rotate));
+				report.max_scale_error = (std::max)(report.max_scale_error, VectorError(keys[i].scale, decoded[i].scale));
+			}
+		}
+
+		// t[Ԃ̈ʒuőSt[TvO鎞
+		const size_t track_num = animation.keyframes.front().keys.size();
+		std::vector<std::int16_t> remap_table(track_num);
+		for (size_t i = 0; i < track_num; ++i)
+		{
+			remap_table[i] = static_cast<std::int16_t>(i);
+		}
+		std::vector<KeyData> dst(track_num);
+		using clock = std::chrono::steady_clock;
+		{
+			const auto begin = clock::now();
+			for (int frame = 0; frame < frame_count; ++frame)
+			{
+				SampleAnimation(animation, static_cast<float>(frame) + 0.5f, remap_table, dst);
+			}
+			report.raw_sample_ms = std::chrono::duration<double, std::milli>(clock::now() - begin).count();
+		}
+		{
+			const auto begin = clock::now();
+			for (int frame = 0; frame < frame_count; ++frame)
+			{
+				compressed.Sample(static_cast<float>(frame) + 0.5f, remap_table, dst);
+			}
+			report.compressed_sample_ms = std::chrono::duration<double, std::milli>(clock::now() - begin).count();
+		}
+
+		return report;
+	}
+
+	CompressedAnimation::PackedQuaternion CompressedAnimation::PackQuaternion(const Quaternion& q)
+	{
+		const Quaternion normalized = q.Normalize();
+		const float components[4] = { normalized.x, normalized.y, normalized.z, normalized.w };
+
+		// Βlő̐T
+		int largest = 0;
+		for (int i = 1; i < 4; ++i)
+		{
+			if (std::fabs(components[i]) > std::fabs(components[largest]))
+			{
+				largest = i;
+			}
+		}
+		// ő听ɂȂ悤ɕ𑵂(q  -q ͓])
+		const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+		// c3ʎq
+		std::uint64_t bits = static_cast<std::uint64_t>(largest);
+		int shift = 2;
+		for (int i = 0; i < 4; ++i)
+		{
+			if (i == largest)
+				continue;
+			const float normalized_component = (components[i] * sign / QUATERNION_COMPONENT_RANGE) * 0.5f + 0.5f;
+			const float clamped = (std::min)((std::max)(normalized_component, 0.0f), 1.0f);
+			const std::uint64_t quantized = static_cast<std::uint64_t>(clamped * static_cast<float>(QUATERNION_COMPONENT_MAX) + 0.5f);
+			bits |= quantized << shift;
+			shift += QUATERNION_COMPONENT_BITS;
+		}
+
+		PackedQuaternion packed;
+		packed.data[0] = static_cast<std::uint16_t>(bits & 0xFFFF);
+		packed.data[1] = static_cast<std::uint16_t>((bits >> 16) & 0xFFFF);
+		packed.data[2] = static_cast<std::uint16_t>((bits >> 32) & 0xFFFF);
+		return packed;
+	}
+
+	Quaternion CompressedAnimation::UnpackQuaternion(const PackedQuaternion& packed)
+	{
+		const std::uint64_t bits =
+			static_cast<std::uint64_t>(packed.data[0])
+			| (static_cast<std::uint64_t>(packed.data[1]) << 16)
+			| (static_cast<std::uint64_t>(packed.data[2]) << 32);
+
+		const int largest = static_cast<int>(bits & 0x3);
+		float components[4] = {};
+		float sum_sq = 0.0f;
+		int shift = 2;
+		for (int i = 0; i < 4; ++i)
+		{
+			if (i == largest)
+				continue;
+			const std::uint32_t quantized = static_cast<std::uint32_t>((bits >> shift) & QUATERNION_COMPONENT_MAX);
+			const float normalized_component = static_cast<float>(quantized) / static_cast<float>(QUATERNION_COMPONENT_MAX);
+			components[i] = (normalized_component * 2.0f - 1.0f) * QUATERNION_COMPONENT_RANGE;
+			sum_sq += components[i] * components[i];
+			shift += QUATERNION_COMPONENT_BITS;
+		}
+		// ő听͒Pʒ畜
+		components[largest] = std::sqrt((std::max)(1.0f - sum_sq, 0.0f));
+
+		return Quaternion(components[0], components[1], components[2], components[3]).Normalize();
+	}
+
+	void CompressedAnimation::CompressVectorTrack(const Animation& animation, const size_t bone, const bool is_scale, const float tolerance, Track& track)
+	{
+		const int frame_count = m_frame_count;
+		const auto value = [&](const int frame) -> const VECTOR3&
+		{
+			const auto& key = animation.keyframes[frame].keys[bone];
+			return is_scale ? key.scale : key.translate;
+		};
+
+		track.offset = static_cast<std::uint32_t>(m_vector_keys.size());
+
+		// St[擪Ƌe덷Ȃ1L[ɂ
+		bool is_constant = true;
+		for (int frame = 1; frame < frame_count; ++frame)
+		{
+			if (VectorError(value(0), value(frame)) > tolerance)
+			{
+				is_constant = false;
+				break;
+			}
+		}
+		if (is_constant)
+		{
+			m_vector_frames.emplace_back(static_cast<std::uint16_t>(0));
+			m_vector_keys.emplace_back(value(0));
+			track.key_num = 1;
+			return;
+		}
+
+		// 擪̃L[AԂ̃t[`Ԃŋe덷Ɏ߂łt[܂ŐL΂
+		int anchor = 0;
+		m_vector_frames.emplace_back(static_cast<std::uint16_t>(anchor));
+		m_vector_keys.emplace_back(value(anchor));
+		while (anchor < frame_count - 1)
+		{
+			int end = anchor + 1;
+			for (int candidate = end + 1; candidate < frame_count; ++candidate)
+			{
+				bool is_fit = true;
+				const float length = static_cast<float>(candidate - anchor);
+				for (int frame = anchor + 1; frame < candidate; ++frame)
+				{
+					const VECTOR3 lerped = VECTOR3::Lerp(value(anchor), value(candidate), static_cast<float>(frame - anchor) / length);
+					if (VectorError(lerped, value(frame)) > tolerance)
+					{
+						is_fit = false;
+						break;
+					}
+				}
+				if (!is_fit)
+					break;
+				end = candidate;
+			}
+			m_vector_frames.emplace_back(static_cast<std::uint16_t>(end));
+			m_vector_keys.emplace_back(value(end));
+			anchor = end;
+		}
+		track.key_num = static_cast<std::uint32_t>(m_vector_keys.size()) - track.offset;
+	}
+
+	void CompressedAnimation::CompressRotateTrack(const Animation& animation, const size_t bone, const float tolerance, Track& track)
+	{
+		const int frame_count = m_frame_count;
+		const auto value = [&](const int frame) -> const Quaternion&
+		{
+			return animation.keyframes[frame].keys[bone].rotate;
+		};
+		// 덷͗ʎq̒lŔ肷
+		std::vector<Quaternion> quantized(frame_count);
+		std::vector<PackedQuaternion> packed(frame_count);
+		for (int frame = 0; frame < frame_count; ++frame)
+		{
+			packed[frame] = PackQuaternion(value(frame));
+			quantized[frame] = UnpackQuaternion(packed[frame]);
+		}
+
+		track.offset = static_cast<std::uint32_t>(m_rotate_keys.size());
+
+		// St[擪Ƌe덷Ȃ1L[ɂ
+		bool is_constant = true;
+		for (int frame = 1; frame < frame_count; ++frame)
+		{
+			if (QuaternionAngle(quantized[0], value(frame)) > tolerance)
+			{
+				is_constant = false;
+				break;
+			}
+		}
+		if (is_constant)
+		{
+			m_rotate_frames.emplace_back(static_cast<std::uint16_t>(0));
+			m_rotate_keys.emplace_back(packed[0]);
+			track.key_num = 1;
+			return;
+		}
+
+		// 擪̃L[AԂ̃t[ʐ`Ԃŋe덷Ɏ߂łt[܂ŐL΂
+		int anchor = 0;
+		m_rotate_frames.emplace_back(static_cast<std::uint16_t>(anchor));
+		m_rotate_keys.emplace_back(packed[anchor]);
+		while (anchor < frame_count - 1)
+		{
+			int end = anchor + 1;
+			for (int candidate = end + 1; candidate < frame_count; ++candidate)
+			{
+				bool is_fit = true;
+				const float length = static_cast<float>(candidate - anchor);
+				for (int frame = anchor + 1; frame < candidate; ++frame)
+				{
+					const Quaternion slerped = Quaternion::Slerp(quantized[anchor], quantized[candidate], static_cast<float>(frame - anchor) / length);
+					if (QuaternionAngle(slerped, value(frame)) > tolerance)
+					{
+						is_fit = false;
+						break;
+					}
+				}
+				if (!is_fit)
+					break;
+				end = candidate;
+			}
+			m_rotate_frames.emplace_back(static_cast<std::uint16_t>(end));
+			m_rotate_keys.emplace_back(packed[end]);
+			anchor = end;
+		}
+		track.key_num = static_cast<std::uint32_t>(m_rotate_keys.size()) - track.offset;
+	}
+
+	void CompressedAnimation::FindKeys(const std::uint16_t* frames, const std::uint32_t key_num, const float key, std::uint32_t& key_1, std::uint32_t& key_2, float& ratio)
+	{
+		ratio = 0.0f;
+		if (key_num <= 1)
+		{
+			key_1 = key_2 = 0;
+			return;
+		}
+
+		// key̍ŏ̃L[T
+		const std::uint16_t* end = frames + key_num;
+		const std::uint16_t* itr = std::upper_bound(frames, end, key,
+			[](const float k, const std::uint16_t frame)
+			{
+				return k < static_cast<float>(frame);
+			});
+		if (itr == frames)
+		{
+			key_1 = key_2 = 0;
+		}
+		else if (itr == end)
+		{
+			key_1 = key_2 = key_num - 1;
+		}
+		else
+		{
+			key_2 = static_cast<std::uint32_t>(itr - frames);
+			key_1 = key_2 - 1;
+			const float frame_1 = static_cast<float>(frames[key_1]);
+			const float frame_2 = static_cast<float>(frames[key_2]);
+			ratio = (key - frame_1) / (frame_2 - frame_1);
+		}
+	}
+
+	void CompressedAnimation::SampleBone(const BoneTrack& bone, const float key, KeyData& dst) const
+	{
+		std::uint32_t key_1 = 0;
+		std::uint32_t key_2 = 0;
+		float ratio = 0.0f;
+
+		// Translate
+		{
+			const Track& track = bone.translate;
+			FindKeys(&m_vector_frames[track.offset], track.key_num, key, key_1, key_2, ratio);
+			const VECTOR3* keys = &m_vector_keys[track.offset];
+			dst.translate = key_1 == key_2 ? keys[key_1] : VECTOR3::Lerp(keys[key_1], keys[key_2], ratio);
+		}
+		// Rotate
+		{
+			const Track& track = bone.rotate;
+			FindKeys(&m_rotate_frames[track.offset], track.key_num, key, key_1, key_2, ratio);
+			const PackedQuaternion* keys = &m_rotate_keys[track.offset];
+			dst.rotate = key_1 == key_2 ?
+				UnpackQuaternion(keys[key_1]) :
+				Quaternion::Slerp(UnpackQuaternion(keys[key_1]), UnpackQuaternion(keys[key_2]), ratio);
+		}
+		// Scale
+		{
+			const Track& track = bone.scale;
+			FindKeys(&m_vector_frames[track.offset], track.key_num, key, key_1, key_2, ratio);
+			const VECTOR3* keys = &m_vector_keys[track.offset];
+			dst.scale = key_1 == key_2 ? keys[key_1] : VECTOR3::Lerp(keys[key_1], keys[key_2], ratio);
+		}
+	}
+
+}// namespace TKGEngine::Animations
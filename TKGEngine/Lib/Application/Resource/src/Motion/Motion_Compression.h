@@ -0,0 +1,212 @@
+#pragma once
+
+#include "Application/Resource/src/AnimatorController/Animation_Defined.h"
+#include "Utility/inc/myfunc_vector.h"
+#include "Systems/inc/TKGEngine_Defined.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace TKGEngine::Animations
+{
+	/// <summary>
+	/// k̋e덷(gbNƂɓKp)
+	/// </summary>
+	struct MotionCompressionSettings
+	{
+		float translate_tolerance = 1.0e-4f;	// sړ̋
+		float rotate_tolerance = 1.0e-3f;		// ]̊px(WA)
+		float scale_tolerance = 1.0e-4f;		// XP[̍
+	};
+
+	/// <summary>
+	/// kʂ̔r
+	/// </summary>
+	struct MotionCompressionReport
+	{
+		size_t raw_bytes = 0;
+		size_t compressed_bytes = 0;
+		// St[f[^Ɣrő덷
+		float max_translate_error = 0.0f;
+		float max_rotate_error = 0.0f;	// WA
+		float max_scale_error = 0.0f;
+		// St[1xTvOƂ̎(~b)
+		double raw_sample_ms = 0.0;
+		double compressed_sample_ms = 0.0;
+	};
+
+
+	/// <summary>
+	/// St[Aj[Vwt[ʒũ|[YAvatar̃m[hɎo
+	/// </summary>
+	void SampleAnimation(const Animation& animation, float key, const std::vector<std::int16_t>& remap_table, std::vector<KeyData>& dst);
+
+
+	// ===========================================
+	//
+	// kAj[Vf[^
+	// {[ƂɕsړA]AXP[̃gbNA
+	// ̃gbN1L[ɁAe덷Ő`ԂłL[͍폜
+	// ]͍ő听315bitɗʎq48bitŕێ(smallest three)
+	//
+	// ===========================================
+	class CompressedAnimation
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		CompressedAnimation() = default;
+		virtual ~CompressedAnimation() = default;
+		CompressedAnimation(const CompressedAnimation&) = default;
+		CompressedAnimation& operator=(const CompressedAnimation&) = default;
+
+		// St[̃Aj[V쐬
+		void Compress(const Animation& animation, const MotionCompressionSettings& settings);
+		void Clear();
+
+		bool IsEmpty() const;
+		int GetFrameCount() const;
+		int GetTrackNum() const;
+		size_t GetMemorySize() const;
+
+		/// <summary>
+		/// wt[ʒũ|[YAvatar̃m[hɎo
+		/// gbNƂɑO2L[fR[hĕԂ
+		/// </summary>
+		/// <param name="key">t[ʒu(ŕԂ)</param>
+		/// <param name="remap_table">Avatar̃m[hgbNւ̕ϊe[u</param>
+		/// <param name="dst">o͐(Avatar̃m[h)</param>
+		void Sample(float key, const std::vector<std::int16_t>& remap_table, std::vector<KeyData>& dst) const;
+		// wt[ʒũ|[YgbNɎo
+		void SampleAll(float key, std::vector<KeyData>& dst) const;
+
+		// f[^̃TCY
+		static size_t GetMemorySize(const Animation& animation);
+		// f[^ƔrČ덷ƃTvOԂ߂
+		static MotionCompressionReport Measure(const Animation& animation, const CompressedAnimation& compressed);
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		/* nothing */
+
+
+	private:
+		// ==============================================
+		// private struct
+		// ==============================================
+		/// <summary>
+		/// 48bitɗʎq]
+		/// </summary>
+		struct PackedQuaternion
+		{
+			std::uint16_t data[3] = {};
+
+		private:
+			friend class cereal::access;
+			template <class Archive>
+			void serialize(Archive& archive, const std::uint32_t version)
+			{
+				archive(
+					cereal::make_nvp("data", data)
+				);
+			}
+		};
+
+		/// <summary>
+		/// 1`l̃L[͈(key_num == 1Ȃ̃gbN)
+		/// </summary>
+		struct Track
+		{
+			std::uint32_t offset = 0;	// L[t[ƒl̔z̐擪
+			std::uint32_t key_num = 0;
+
+		private:
+			friend class cereal::access;
+			template <class Archive>
+			void serialize(Archive& archive, const std::uint32_t version)
+			{
+				archive(
+					CEREAL_NVP(offset),
+					CEREAL_NVP(key_num)
+				);
+			}
+		};
+
+		/// <summary>
+		/// {[1̃gbN
+		/// </summary>
+		struct BoneTrack
+		{
+			Track translate;
+			Track rotate;
+			Track scale;
+
+		private:
+			friend class cereal::access;
+			template <class Archive>
+			void serialize(Archive& archive, const std::uint32_t version)
+			{
+				archive(
+					CEREAL_NVP(translate),
+					CEREAL_NVP(rotate),
+					CEREAL_NVP(scale)
+				);
+			}
+		};
+
+
+		// ==============================================
+		// private methods
+		// ==============================================
+		friend class cereal::access;
+		template <class Archive>
+		void serialize(Archive& archive, const std::uint32_t version)
+		{
+			//if (version > 0)
+			{
+				archive(
+					CEREAL_NVP(m_frame_count),
+					CEREAL_NVP(m_tracks),
+					CEREAL_NVP(m_vector_frames),
+					CEREAL_NVP(m_vector_keys),
+					CEREAL_NVP(m_rotate_frames),
+					CEREAL_NVP(m_rotate_keys)
+				);
+			}
+		}
+
+		static PackedQuaternion PackQuaternion(const Quaternion& q);
+		static Quaternion UnpackQuaternion(const PackedQuaternion& packed);
+
+		// sړƃXP[̃gbN쐬
+		void CompressVectorTrack(const Animation& animation, size_t bone, bool is_scale, float tolerance, Track& track);
+		// ]̃gbN쐬
+		void CompressRotateTrack(const Animation& animation, size_t bone, float tolerance, Track& track);
+
+		// key͂ރL[̃CfbNXƕԗ߂
+		static void FindKeys(const std::uint16_t* frames, std::uint32_t key_num, float key, std::uint32_t& key_1, std::uint32_t& key_2, float& ratio);
+		// 1{[fR[h
+		void SampleBone(const BoneTrack& bone, float key, KeyData& dst) const;
+
+
+		// ==============================================
+		// private variables
+		// ==============================================
+		// f[^̃t[
+		int m_frame_count = 0;
+		// gbN(f[^̃L[)̃{[
+		std::vector<BoneTrack> m_tracks;
+		// sړƃXP[̃L[̃t[ԍƒl
+		std::vector<std::uint16_t> m_vector_frames;
+		std::vector<VECTOR3> m_vector_keys;
+		// ]̃L[̃t[ԍƒl
+		std::vector<std::uint16_t> m_rotate_frames;
+		std::vector<PackedQuaternion> m_rotate_keys;
+	};
+
+}// namespace TKGEngine::Animations
+
+CEREAL_CLASS_VERSION(TKGEngine::Animations::CompressedAnimation, 1)
@@ -1,5 +1,6 @@
 
 #include "IResMotion.h"
+#include "Motion_Compression.h"
 
 #include "Systems/inc/AssetSystem.h"
 
@@ -7,9 +8,11 @@
 
 #include "Utility/inc/myfunc_vector.h"
 #include "Utility/inc/myfunc_file.h"
+#include "Systems/inc/LogSystem.h"
 
 #include <vector>
 #include <unordered_map>
+#include <map>
 #include <string>
 #include <regex>
 
@@ -40,7 +43,8 @@ namespace TKGEngine
 			const std::vector<std::string>& filepathes,
 			FbxScene* fbx_scene,
 			std::vector<std::string>& motion_names,
-			std::unordered_map<std::string, int>& bone_name_index
+			std::unordered_map<std::string, int>& bone_name_index,
+			bool compress
 		);
 #endif// USE_IMGUI
 
@@ -55,7 +59,11 @@ namespace TKGEngine
 		float GetMotionLength() const override;
 
 		std::vector<Animations::KeyData>* GetKeyFrame(const int frame) override;
+		void SampleKeyFrame(float key, const std::vector<std::int16_t>& remap_table, std::vector<Animations::KeyData>& dst) const override;
+		const std::vector<Animations::KeyData>* GetReferenceKeyFrame() const override;
+		bool IsCompressed() const override;
 		std::unordered_map<std::string, int>* GetKeyIndex() override;
+		const std::vector<std::int16_t>* GetRemapTable(const Animations::AvatarBinding& avatar) override;
 
 
 		// ==============================================
@@ -84,6 +92,15 @@ namespace TKGEngine
 					CEREAL_NVP(m_key_index)
 				);
 			}
+			else if (version == 3)
+			{
+				archive(
+					cereal::base_class<IResMotion>(this),
+					CEREAL_NVP(m_animation),
+					CEREAL_NVP(m_key_index),
+					CEREAL_NVP(m_compressed)
+				);
+			}
 		}
 
 		// ==============================================
@@ -94,7 +111,11 @@ namespace TKGEngine
 
 #ifdef USE_IMGUI
 		void Save(const std::string& filepath);
+		// St[̃f[^kf[^ɒu
+		void Compress(const Animations::MotionCompressionSettings& settings);
 #endif// USE_IMGUI
+		// kς݂Ȃ擪t[fR[hĂ
+		void SetupReferenceKeyFrame();
 
 
 		// use GUI
@@ -107,6 +128,15 @@ namespace TKGEngine
 		// ==============================================
 		Animations::Animation m_animation;
 		std::unordered_map<std::string, int> m_key_index;
+		// łȂm_animatioñL[t[̑Ɏgp
+		Animations::CompressedAnimation m_compressed;
+		// kς݂̂Ƃ̐擪t[
+		std::vector<Animations::KeyData> m_reference_keys;
+
+		// <Avatar, Avatar̃m[hɕׂMotionf[^̃CfbNX(݂Ȃ-1)>
+		// weak_ptrŕێ̂ŁAjꂽAvatar̃AhXėpĂʂ̃L[ɂȂ
+		std::map<std::weak_ptr<const void>, std::vector<std::int16_t>, std::owner_less<std::weak_ptr<const void>>> m_remap_tables;
+		std::mutex m_remap_mutex;
 	};
 
 
@@ -192,7 +222,7 @@ namespace TKGEngine
 		return res_new;
 	}
 
-	std::shared_ptr<IResMotion> IResMotion::LoadAsync(const std::string& filename)
+	std::shared_ptr<IResMotion> IResMotion::LoadAsync(const std::string& filename, const ASSET_LOAD_PRIORITY priority)
 	{
 		// Access resource map
 		m_cache_mutex.lock();
@@ -212,7 +242,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResMotion::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResMotion::SetAsyncOnLoad, priority);
 
 		return res_new;
 	}
@@ -228,13 +258,14 @@ namespace TKGEngine
 		const std::vector<std::string>& filepathes,
 		FbxScene* fbx_scene,
 		std::vector<std::string>& motion_names,
-		std::unordered_map<std::string, int>& bone_name_index
+		std::unordered_map<std::string, int>& bone_name_index,
+		const bool compress
 	)
 	{
 		const int motion_cnt = static_cast<int>(motion_names.size());
 
 		std::lock_guard<std::mutex> lock(m_cache_mutex);
-		auto&& s_ptr_list = ResMotion::CreateFromFBX(filepathes, fbx_scene, motion_names, bone_name_index);
+		auto&& s_ptr_list = ResMotion::CreateFromFBX(filepathes, fbx_scene, motion_names, bone_name_index, compress);
 		for (int i = 0; i < motion_cnt; ++i)
 		{
 			if (!s_ptr_list.at(i))
@@ -252,7 +283,8 @@ namespace TKGEngine
 		const std::vector<std::string>& filepathes,
 		FbxScene* fbx_scene,
 		std::vector<std::string>& motion_names,
-		std::unordered_map<std::string, int>& bone_name_index
+		std::unordered_map<std::string, int>& bone_name_index,
+		const bool compress
 	)
 	{
 		using namespace fbxsdk;
@@ -423,6 +455,10 @@ namespace TKGEngine
 			// AssetDataBasȅ̃Zbg
 			p_motions.at(i)->SetName(MyFunc::SplitFileName(motion_path));
 			p_motions.at(i)->m_has_resource = true;
+			if (compress)
+			{
+				p_motions.at(i)->Compress(Animations::MotionCompressionSettings());
+			}
 			p_motions.at(i)->Save(motion_path);
 		}
 
@@ -461,6 +497,30 @@ namespace TKGEngine
 		}
 #endif//#ifdef SAVE_JSON
 	}
+
+	void ResMotion::Compress(const Animations::MotionCompressionSettings& settings)
+	{
+		if (m_animation.keyframes.empty())
+			return;
+
+		m_compressed.Compress(m_animation, settings);
+		if (m_compressed.IsEmpty())
+			return;
+
+		// f[^Ƃ̔ro͂
+		const auto report = Animations::CompressedAnimation::Measure(m_animation, m_compressed);
+		LOG_DEBUG("Compressed motion.(%s) %zu -> %zu bytes, max error T:%f R:%f(rad) S:%f, sampling %.3f -> %.3f ms",
+			GetName(),
+			report.raw_bytes, report.compressed_bytes,
+			report.max_translate_error, report.max_rotate_error, report.max_scale_error,
+			report.raw_sample_ms, report.compressed_sample_ms
+		);
+
+		// ƃTvO[gc
+		m_animation.keyframes.clear();
+		m_animation.keyframes.shrink_to_fit();
+		SetupReferenceKeyFrame();
+	}
 #endif// USE_IMGUI
 
 	void IResMotion::Release()
@@ -483,14 +543,91 @@ namespace TKGEngine
 
 	std::vector<Animations::KeyData>* ResMotion::GetKeyFrame(const int frame)
 	{
+		if (IsCompressed())
+			return nullptr;
 		return &m_animation.keyframes.at(frame).keys;
 	}
 
+	void ResMotion::SampleKeyFrame(const float key, const std::vector<std::int16_t>& remap_table, std::vector<Animations::KeyData>& dst) const
+	{
+		if (IsCompressed())
+		{
+			m_compressed.Sample(key, remap_table, dst);
+		}
+		else
+		{
+			Animations::SampleAnimation(m_animation, key, remap_table, dst);
+		}
+	}
+
+	const std::vector<Animations::KeyData>* ResMotion::GetReferenceKeyFrame() const
+	{
+		if (IsCompressed())
+			return &m_reference_keys;
+		return &m_animation.keyframes.at(0).keys;
+	}
+
+	bool ResMotion::IsCompressed() const
+	{
+		return !m_compressed.IsEmpty();
+	}
+
 	std::unordered_map<std::string, int>* ResMotion::GetKeyIndex()
 	{
 		return &m_key_index;
 	}
 
+	const std::vector<std::int16_t>* ResMotion::GetRemapTable(const Animations::AvatarBinding& avatar)
+	{
+		if (avatar.node_index == nullptr || avatar.owner.expired())
+			return nullptr;
+
+		std::lock_guard<std::mutex> lock(m_remap_mutex);
+
+		// 쐬ς݂Ȃ炻Ԃ
+		const auto itr_find = m_remap_tables.find(avatar.owner);
+		if (itr_find != m_remap_tables.end())
+		{
+			return &itr_find->second;
+		}
+
+		// jꂽAvatar̃e[u폜
+		for (auto itr = m_remap_tables.begin(); itr != m_remap_tables.end();)
+		{
+			itr = itr->first.expired() ? m_remap_tables.erase(itr) : std::next(itr);
+		}
+
+		// Avatar̃m[h̃e[u쐬
+		const auto* node_index = avatar.node_index;
+		int node_num = 0;
+		for (const auto& node : *node_index)
+		{
+			node_num = (std::max)(node_num, node.second + 1);
+		}
+		auto& table = m_remap_tables[avatar.owner];
+		table.resize(node_num, -1);
+
+		// {[̕񌟍̓e[u쐬̂ݍs
+		const auto itr_key_end = m_key_index.end();
+		for (const auto& node : *node_index)
+		{
+			const auto itr_key = m_key_index.find(node.first);
+			if (itr_key == itr_key_end)
+				continue;
+			table.at(node.second) = static_cast<std::int16_t>(itr_key->second);
+		}
+		return &table;
+	}
+
+	void ResMotion::SetupReferenceKeyFrame()
+	{
+		m_reference_keys.clear();
+		if (IsCompressed())
+		{
+			m_compressed.SampleAll(0.0f, m_reference_keys);
+		}
+	}
+
 	void ResMotion::SetAsyncOnLoad()
 	{
 		// Start loading
@@ -514,6 +651,7 @@ namespace TKGEngine
 				cereal::BinaryInputArchive ar(ifs);
 
 				ar(*this);
+				SetupReferenceKeyFrame();
 				b_result = true;
 			}
 		}
@@ -558,6 +696,7 @@ namespace TKGEngine
 				cereal::BinaryInputArchive ar(ifs);
 
 				ar(*this);
+				SetupReferenceKeyFrame();
 				b_result = true;
 			}
 		}
@@ -583,5 +722,5 @@ namespace TKGEngine
 }// namespace TKGEngine
 
 CEREAL_REGISTER_TYPE(TKGEngine::ResMotion)
-CEREAL_CLASS_VERSION(TKGEngine::ResMotion, 2)
+CEREAL_CLASS_VERSION(TKGEngine::ResMotion, 3)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(TKGEngine::IResMotion, TKGEngine::ResMotion)
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Application/Resource/inc/AssetDataBase.h"
+
+#include "../ResourceManager.h"
+#include "Systems/inc/TKGEngine_Defined.h"
+
+#include <string>
+
+#include <memory>
+#include <mutex>
+
+namespace TKGEngine
+{
+	/// <summary>
+	/// Prefab Resource interface
+	/// .objectt@C̃oCixǂݍ݁ACX^XɎg܂킷
+	/// </summary>
+	class IResPrefab
+		: public AssetDataBase
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		IResPrefab() = default;
+		virtual ~IResPrefab() = default;
+		IResPrefab(const IResPrefab&) = delete;
+		IResPrefab& operator=(const IResPrefab&) = delete;
+
+		static std::shared_ptr<IResPrefab> Load(const std::string& filename);
+		static std::shared_ptr<IResPrefab> LoadAsync(const std::string& filename, ASSET_LOAD_PRIORITY priority);
+		static void RemoveUnused();
+		// .objectt@C㏑ꂽƂɌÂLbVj
+		static void RemoveCache(const std::string& filename);
+
+		// AssetDataBase
+		void Release() override;
+		// ~AssetDataBase
+
+		// VACYς݂GameObject̃oCi
+		virtual const std::string& GetBinary() const = 0;
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		/* nothing */
+
+	private:
+		// ==============================================
+		// private methods
+		// ==============================================
+		virtual void SetAsyncOnLoad() = 0;
+		virtual void OnLoad() = 0;
+
+		static std::shared_ptr<IResPrefab> CreateInterface();
+
+		// ==============================================
+		// private variables
+		// ==============================================
+		static ResourceManager<IResPrefab> m_caches;
+		static std::mutex m_cache_mutex;
+	};
+
+}// namespace TKGEngine
@@ -0,0 +1,108 @@
+
+#include "../../inc/Prefab.h"
+
+#include "IResPrefab.h"
+#include "Application/Objects/Managers/GameObjectManager.h"
+#include "Application/Objects/Managers/SceneManager.h"
+
+
+namespace TKGEngine
+{
+	// ==================================================
+	// class methods
+	// ==================================================
+	Prefab& Prefab::operator=(const Prefab& prefab)
+	{
+		m_res_prefab = prefab.m_res_prefab;
+		return *this;
+	}
+
+	void Prefab::RemoveUnused()
+	{
+		IResPrefab::RemoveUnused();
+	}
+
+	void Prefab::RemoveCache(const std::string& filename)
+	{
+		IResPrefab::RemoveCache(filename);
+	}
+
+	void Prefab::Load(const std::string& filename)
+	{
+		m_res_prefab = IResPrefab::Load(filename);
+	}
+
+	void Prefab::LoadAsync(const std::string& filename, const ASSET_LOAD_PRIORITY priority)
+	{
+		m_res_prefab = IResPrefab::LoadAsync(filename, priority);
+	}
+
+	void Prefab::Release()
+	{
+		if (m_res_prefab != nullptr)
+		{
+			m_res_prefab->Release();
+		}
+		m_res_prefab.reset();
+	}
+
+	std::shared_ptr<IGameObject> Prefab::Instantiate() const
+	{
+		return Instantiate(SceneManager::GetMainSceneID());
+	}
+
+	std::shared_ptr<IGameObject> Prefab::Instantiate(const int scene_idx) const
+	{
+		if (!HasPrefab())
+			return std::shared_ptr<IGameObject>();
+
+		return GameObjectManager::InstantiateGameObject(m_res_prefab->GetBinary(), scene_idx);
+	}
+
+	std::shared_ptr<IGameObject> Prefab::Instantiate(const std::shared_ptr<IGameObject>& parent) const
+	{
+		if (!HasPrefab())
+			return std::shared_ptr<IGameObject>();
+
+		return GameObjectManager::InstantiateGameObject(m_res_prefab->GetBinary(), parent);
+	}
+
+	void Prefab::InstantiateMany(const int count, std::vector<std::shared_ptr<IGameObject>>& dst) const
+	{
+		InstantiateMany(count, SceneManager::GetMainSceneID(), dst);
+	}
+
+	void Prefab::InstantiateMany(const int count, const int scene_idx, std::vector<std::shared_ptr<IGameObject>>& dst) const
+	{
+		if (!HasPrefab())
+			return;
+
+		GameObjectManager::InstantiateGameObjects(m_res_prefab->GetBinary(), count, scene_idx, dst);
+	}
+
+	bool Prefab::IsLoaded() const
+	{
+		return m_res_prefab != nullptr ? m_res_prefab->IsLoaded() : false;
+	}
+
+	bool Prefab::HasPrefab() const
+	{
+		return m_res_prefab == nullptr ? false : m_res_prefab->HasResource();
+	}
+
+	const char* Prefab::GetName() const
+	{
+		return m_res_prefab == nullptr ? nullptr : m_res_prefab->GetName();
+	}
+
+	const char* Prefab::GetFilepath() const
+	{
+		return m_res_prefab == nullptr ? nullptr : m_res_prefab->GetFilePath();
+	}
+
+	unsigned Prefab::GetHash() const
+	{
+		return m_res_prefab == nullptr ? 0 : m_res_prefab->GetHash();
+	}
+
+}// namespace TKGEngine
@@ -0,0 +1,234 @@
+
+#include "IResPrefab.h"
+
+#include "Systems/inc/AssetSystem.h"
+
+#include <string>
+#include <fstream>
+
+#include <cassert>
+
+namespace TKGEngine
+{
+	class ResPrefab
+		: public IResPrefab
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		ResPrefab() = default;
+		virtual ~ResPrefab() = default;
+		ResPrefab(const ResPrefab&) = delete;
+		ResPrefab& operator=(const ResPrefab&) = delete;
+
+		// AssetDataBase
+#ifdef USE_IMGUI
+		void OnGUI() override {}
+#endif // USE_IMGUI
+		// ~AssetDataBase
+
+		const std::string& GetBinary() const override;
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		/* nothing */
+
+	private:
+		// ==============================================
+		// private methods
+		// ==============================================
+		void SetAsyncOnLoad() override;
+		void OnLoad() override;
+
+		// t@C̒ĝ܂܃obt@ɓǂݍ
+		bool ReadFile();
+
+
+		// ==============================================
+		// private variables
+		// ==============================================
+		std::string m_binary;
+	};
+
+
+	////////////////////////////////////////////////////////
+	// Static member definition
+	////////////////////////////////////////////////////////
+	ResourceManager<IResPrefab> IResPrefab::m_caches;
+	std::mutex IResPrefab::m_cache_mutex;
+
+
+	////////////////////////////////////////////////////////
+	// Class Methods
+	////////////////////////////////////////////////////////
+	// IResPrefab
+	std::shared_ptr<IResPrefab> IResPrefab::CreateInterface()
+	{
+		return std::make_shared<ResPrefab>();
+	}
+
+	std::shared_ptr<IResPrefab> IResPrefab::Load(const std::string& filename)
+	{
+		// Access resource map
+		m_cache_mutex.lock();
+		std::shared_ptr<IResPrefab> res_find = m_caches.Search(filename);
+		if (res_find)
+		{
+			m_cache_mutex.unlock();
+			return res_find;
+		}
+		std::shared_ptr<IResPrefab> res_new = IResPrefab::CreateInterface();
+		res_new->SetFilePath(filename);
+		m_caches.Set(filename, res_new);
+		m_cache_mutex.unlock();
+
+		// Load Resource
+		res_new->m_load_state_mutex.lock();
+		res_new->m_is_loading = true;
+		res_new->m_is_loaded = false;
+		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
+		res_new->OnLoad();
+		if (!res_new->HasResource())
+		{
+			res_new->Release();
+			res_new->m_load_state_mutex.unlock();
+			res_new.reset();
+			return std::shared_ptr<IResPrefab>();
+		}
+		res_new->m_load_state_mutex.unlock();
+		return res_new;
+	}
+
+	std::shared_ptr<IResPrefab> IResPrefab::LoadAsync(const std::string& filename, const ASSET_LOAD_PRIORITY priority)
+	{
+		// Access resource map
+		m_cache_mutex.lock();
+		std::shared_ptr<IResPrefab> res_find = m_caches.Search(filename);
+		if (res_find)
+		{
+			m_cache_mutex.unlock();
+			return res_find;
+		}
+		std::shared_ptr<IResPrefab> res_new(IResPrefab::CreateInterface());
+		res_new->SetFilePath(filename);
+		m_caches.Set(filename, res_new);
+		m_cache_mutex.unlock();
+
+		// Set async loader
+		std::lock_guard<std::mutex> lock(res_new->m_load_state_mutex);
+		res_new->m_is_loading = true;
+		res_new->m_is_loaded = false;
+		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
+		AssetSystem::GetInstance().AddLoad(res_new, &IResPrefab::SetAsyncOnLoad, priority);
+
+		return res_new;
+	}
+
+	void IResPrefab::RemoveUnused()
+	{
+		std::lock_guard<std::mutex> lock(m_cache_mutex);
+		m_caches.RemoveUnusedCache();
+	}
+
+	void IResPrefab::RemoveCache(const std::string& filename)
+	{
+		std::lock_guard<std::mutex> lock(m_cache_mutex);
+		m_caches.RemoveCache(filename);
+	}
+
+	void IResPrefab::Release()
+	{
+		std::lock_guard<std::mutex> lock(m_cache_mutex);
+		m_caches.RemoveCache(this->GetFilePath());
+	}
+	// ~IResPrefab
+
+	// ResPrefab
+	const std::string& ResPrefab::GetBinary() const
+	{
+		return m_binary;
+	}
+
+	void ResPrefab::SetAsyncOnLoad()
+	{
+		// Start loading
+		{
+			std::lock_guard<std::mutex> lock(m_load_state_mutex);
+			m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_LOADING;
+			m_has_resource = false;
+		}
+
+		// Load Prefab
+		const bool b_result = ReadFile();
+
+		// Finish loading
+		{
+			std::lock_guard<std::mutex> lock(m_load_state_mutex);
+			m_is_loading = false;
+			m_is_loaded = true;
+			if (b_result)
+			{
+				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_SUCCESS;
+				m_has_resource = true;
+			}
+			else
+			{
+				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_FAILED;
+				m_has_resource = false;
+			}
+		}
+	}
+
+	void ResPrefab::OnLoad()
+	{
+		// Ready loading
+		{
+			m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_LOADING;
+			m_has_resource = false;
+		}
+
+		// Load Prefab
+		const bool b_result = ReadFile();
+
+		// Finish loading
+		{
+			m_is_loading = false;
+			m_is_loaded = true;
+			if (b_result)
+			{
+				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_SUCCESS;
+				m_has_resource = true;
+			}
+			else
+			{
+				m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_FAILED;
+				m_has_resource = false;
+			}
+		}
+	}
+
+	bool ResPrefab::ReadFile()
+	{
+		std::ifstream ifs(this->GetFilePath(), std::ios::in | std::ios::binary);
+		if (!ifs.is_open())
+		{
+			return false;
+		}
+		// t@CTCYxɊmۂēǂݍ
+		ifs.seekg(0, std::ios::end);
+		const std::streamoff size = ifs.tellg();
+		ifs.seekg(0, std::ios::beg);
+		if (size <= 0)
+		{
+			return false;
+		}
+		m_binary.resize(static_cast<size_t>(size));
+		ifs.read(&m_binary[0], size);
+
+		return static_cast<bool>(ifs);
+	}
+	// ~ResPrefab
+}// namespace TKGEngine
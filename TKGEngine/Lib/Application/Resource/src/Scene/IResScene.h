@@ -55,6 +55,8 @@ namespace TKGEngine
 
 		virtual bool GetActive() const = 0;
 		virtual void SetActive(bool active) = 0;
+		// 所属するGameObjectのシーンのアクティブ状態を更新する
+		virtual void ApplyActiveToGameObjects() = 0;
 
 		virtual SceneID GetSceneID() const = 0;
 		virtual void SetSceneID(const SceneID scene_id) = 0;
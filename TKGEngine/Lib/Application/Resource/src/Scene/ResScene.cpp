@@ -113,6 +113,7 @@ namespace TKGEngine
 
 		bool GetActive() const override;
 		void SetActive(bool active) override;
+		void ApplyActiveToGameObjects() override;
 
 		SceneID GetSceneID() const override;
 		void SetSceneID(const SceneID scene_id) override;
@@ -132,6 +133,8 @@ namespace TKGEngine
 
 		// SetActiveɍċAIɏ
 		static void RecursiveSetActive(const std::shared_ptr<Transform>& transform, const bool is_active);
+		// ANeBuGameObject܂߂ăV[̃ANeBuԂċAIɃZbg
+		static void RecursiveApplySceneActive(const std::shared_ptr<Transform>& transform, const bool is_active);
 
 
 		// ==============================================
@@ -189,7 +192,8 @@ namespace TKGEngine
 		s_ptr->m_is_loading = true;
 		s_ptr->m_is_loaded = false;
 		s_ptr->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResScene::SetAsyncOnLoad, s_ptr));
+		// V[̃[hAA[h͑̃V[ƓɎsȂ悤ɒǉ1s
+		AssetSystem::GetInstance().AddSerial(std::bind(&IResScene::SetAsyncOnLoad, s_ptr));
 
 		return s_ptr;
 	}
@@ -221,7 +225,7 @@ namespace TKGEngine
 
 	void IResScene::UnloadAsync(const std::shared_ptr<IResScene>& scene)
 	{
-		AssetSystem::GetInstance().Add(std::bind(&IResScene::SetAsyncOnUnload, scene));
+		AssetSystem::GetInstance().AddSerial(std::bind(&IResScene::SetAsyncOnUnload, scene));
 	}
 
 	void IResScene::Unload(const std::shared_ptr<IResScene>& scene)
@@ -431,6 +435,8 @@ namespace TKGEngine
 			return;
 		// ԂɍXV
 		m_is_active = active;
+		// OnEnable,OnDisableɃLbVXVĂ
+		ApplyActiveToGameObjects();
 
 		// Root珇ɏԃ`FbN
 		for (const auto& goid : m_root_goid)
@@ -440,6 +446,17 @@ namespace TKGEngine
 		}
 	}
 
+	void ResScene::ApplyActiveToGameObjects()
+	{
+		for (const auto& goid : m_root_goid)
+		{
+			const auto& root_gameobject = GameObjectManager::GetGameObject(goid);
+			if (!root_gameobject)
+				continue;
+			RecursiveApplySceneActive(root_gameobject->GetTransform(), m_is_active);
+		}
+	}
+
 	SceneID ResScene::GetSceneID() const
 	{
 		return m_scene_id;
@@ -551,6 +568,18 @@ namespace TKGEngine
 		}
 	}
 
+	void ResScene::RecursiveApplySceneActive(const std::shared_ptr<Transform>& transform, const bool is_active)
+	{
+		const auto gameobject = transform->GetGameObject();
+		gameobject->GetActiveState()->is_active_scene.store(is_active, std::memory_order_relaxed);
+
+		const auto child_num = transform->GetChildCount();
+		for (int i = 0; i < child_num; ++i)
+		{
+			RecursiveApplySceneActive(transform->GetChild(i), is_active);
+		}
+	}
+
 	// ~ResScene
 
 
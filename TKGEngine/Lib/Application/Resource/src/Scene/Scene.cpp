@@ -84,6 +84,12 @@ namespace TKGEngine
 			m_res_scene->SetActive(is_active);
 	}
 
+	void Scene::ApplyActiveToGameObjects() const
+	{
+		if (m_res_scene)
+			m_res_scene->ApplyActiveToGameObjects();
+	}
+
 	SceneID Scene::GetSceneID() const
 	{
 		return m_res_scene ? m_res_scene->GetSceneID() : SceneManager::INVALID_SCENE_INDEX;
@@ -581,7 +581,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResVS::SetAsyncOnCompile, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResVS::SetAsyncOnCompile, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -638,7 +638,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResVS::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResVS::SetAsyncOnLoad, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -743,7 +743,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResPS::SetAsyncOnCompile, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResPS::SetAsyncOnCompile, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -800,7 +800,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResPS::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResPS::SetAsyncOnLoad, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -905,7 +905,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResGS::SetAsyncOnCompile, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResGS::SetAsyncOnCompile, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -962,7 +962,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResGS::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResGS::SetAsyncOnLoad, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -1067,7 +1067,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResDS::SetAsyncOnCompile, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResDS::SetAsyncOnCompile, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -1124,7 +1124,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResDS::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResDS::SetAsyncOnLoad, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -1229,7 +1229,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResHS::SetAsyncOnCompile, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResHS::SetAsyncOnCompile, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -1286,7 +1286,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResHS::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResHS::SetAsyncOnLoad, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -1392,7 +1392,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResCS::SetAsyncOnCompile, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResCS::SetAsyncOnCompile, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
@@ -1449,7 +1449,7 @@ namespace TKGEngine
 		res_new->m_is_loading = true;
 		res_new->m_is_loaded = false;
 		res_new->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResCS::SetAsyncOnLoad, res_new));
+		AssetSystem::GetInstance().AddLoad(res_new, &IResCS::SetAsyncOnLoad, ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
 
 		return res_new;
 	}
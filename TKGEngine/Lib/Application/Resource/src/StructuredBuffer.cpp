@@ -111,6 +111,27 @@ namespace TKGEngine
 		m_row_count = 0;
 	}
 
+	void StructuredBuffer::Update(ID3D11DeviceContext* p_context, const void* p_data, int row_count)
+	{
+		assert(row_count <= m_row_count);
+		if (row_count <= 0)
+			return;
+
+		D3D11_BOX box = {};
+		box.left = 0;
+		box.right = static_cast<UINT>(m_stride_size * row_count);
+		box.top = 0;
+		box.bottom = 1;
+		box.front = 0;
+		box.back = 1;
+		p_context->UpdateSubresource(m_SB.Get(), 0, &box, p_data, 0, 0);
+	}
+
+	int StructuredBuffer::GetRowCount() const
+	{
+		return m_row_count;
+	}
+
 	void StructuredBuffer::SetSRV(ID3D11DeviceContext* p_context, int slot, ShaderVisibility visibility)
 	{
 		switch (visibility)
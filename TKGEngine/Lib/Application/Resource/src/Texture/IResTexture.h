@@ -25,7 +25,7 @@ namespace TKGEngine
 		IResTexture& operator=(const IResTexture&) = delete;
 
 		static bool CreateDummyTexture();
-		static std::shared_ptr<IResTexture> LoadAsync(const std::string& filename, bool force_srgb);
+		static std::shared_ptr<IResTexture> LoadAsync(const std::string& filename, bool force_srgb, ASSET_LOAD_PRIORITY priority);
 		static std::shared_ptr<IResTexture> Load(const std::string& filename, bool force_srgb);
 		static void Reload(const std::string& filename, bool force_srgb);
 		static std::shared_ptr<IResTexture> Create(const TEX_DESC& desc, bool create_srv, bool create_uav, const void* p_src);
@@ -233,7 +233,7 @@ namespace TKGEngine
 		return std::static_pointer_cast<IResTexture>(std::make_shared<ResTexture>());
 	}
 
-	std::shared_ptr<IResTexture> IResTexture::LoadAsync(const std::string& filename, bool force_srgb)
+	std::shared_ptr<IResTexture> IResTexture::LoadAsync(const std::string& filename, bool force_srgb, const ASSET_LOAD_PRIORITY priority)
 	{
 		// Access resource map
 		m_cache_mutex.lock();
@@ -268,7 +268,7 @@ namespace TKGEngine
 		res_ptr->m_is_loading = true;
 		res_ptr->m_is_loaded = false;
 		res_ptr->m_load_state = ASSET_LOAD_ASYNC_STATE::ASSET_LOAD_ASYNC_WAITING;
-		AssetSystem::GetInstance().Add(std::bind(&IResTexture::SetAsyncOnLoad, res_ptr));
+		AssetSystem::GetInstance().AddLoad(res_ptr, &IResTexture::SetAsyncOnLoad, priority);
 
 		return res_ptr;
 	}
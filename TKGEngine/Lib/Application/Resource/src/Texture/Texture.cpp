@@ -89,10 +89,10 @@ namespace TKGEngine
 	}
 #endif // USE_IMGUI
 
-	void Texture::LoadAsync(const std::string& filename, bool force_srgb)
+	void Texture::LoadAsync(const std::string& filename, bool force_srgb, const ASSET_LOAD_PRIORITY priority)
 	{
 		m_force_srgb = force_srgb;
-		m_res_texture = IResTexture::LoadAsync(filename, force_srgb);
+		m_res_texture = IResTexture::LoadAsync(filename, force_srgb, priority);
 	}
 
 	void Texture::Load(const std::string& filename, bool force_srgb)
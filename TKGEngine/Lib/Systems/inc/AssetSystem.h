@@ -1,11 +1,16 @@
 #pragma once
 
+#include "Application/Resource/inc/Asset_Defined.h"
+
 #include <functional>
 #include <mutex>
 #include <thread>
 #include <condition_variable>
 #include <vector>
 #include <deque>
+#include <set>
+#include <memory>
+#include <cstdint>
 
 #include <Windows.h>
 #include <cassert>
@@ -26,8 +31,20 @@ namespace TKGEngine
 		static void Destroy();
 		static AssetSystem& GetInstance();
 
-		bool Add(const std::function<void()>& func);
-		bool Add(std::function<void()>&& func);
+		// L[tȂ󂫂o܂őҋ@
+		bool Add(const std::function<void()>& func, ASSET_LOAD_PRIORITY priority = ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_PREFETCH);
+		bool Add(std::function<void()>&& func, ASSET_LOAD_PRIORITY priority = ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_PREFETCH);
+		// sOresւ̎QƂSĐ؂ĂLZǂݍݏǉ
+		template<class T, class Func>
+		bool AddLoad(const std::shared_ptr<T>& res, Func func, ASSET_LOAD_PRIORITY priority);
+		// V[̃[hAA[ĥ悤Ɍ݂ɓɎsłȂǉ
+		// ǉ1sADxt̏Ɏo
+		bool AddSerial(std::function<void()>&& func);
+
+		// _܂łɒǉꂽ̊mFp̃`PbgԂ
+		std::uint64_t GetFenceTicket();
+		// ticketOɒǉꂽSďI(LZ)Ă邩
+		bool HasFinishedBefore(std::uint64_t ticket);
 
 		ID3D11Device* GetDevice() const;
 		ID3D11DeviceContext* GetCopyDC() const;
@@ -39,12 +56,34 @@ namespace TKGEngine
 
 
 	private:
+		// ==============================================
+		// private struct
+		// ==============================================
+		struct LoadTask
+		{
+			std::function<void()> func;
+			// QƂ؂ĂsȂ
+			std::weak_ptr<void> cancel_token;
+			bool is_cancelable = false;
+			// ǉ1s鏈
+			bool is_serial = false;
+			std::uint64_t ticket = 0;
+		};
+
+
 		// ==============================================
 		// private methods
 		// ==============================================
 		void Init();
 		void Term();
 
+		bool AddTask(LoadTask&& task, ASSET_LOAD_PRIORITY priority);
+		void RunTask(LoadTask& task);
+		// o鏈邩(m_mutexbNԂŌĂ)
+		bool HasRunnableTask() const;
+		// ǉ̏ADx̍̏Ɏo(m_mutexbNԂŌĂ)
+		void PopTask(LoadTask& task);
+
 
 		// ==============================================
 		// private variables
@@ -55,12 +94,25 @@ namespace TKGEngine
 		AssetSystem& operator=(const AssetSystem&) = delete;
 
 		static AssetSystem* m_instance;
+		// [hXbhŎs
+		static thread_local bool m_is_load_thread;
 
 		bool m_is_termination_requested = true;
 		std::mutex m_mutex;
 		std::condition_variable m_cv;
+		// L[ɋ󂫂oƂʒm
+		std::condition_variable m_not_full_cv;
 		std::vector<std::thread> m_threads;
-		std::deque<std::function<void()>> m_func_deque;
+		// DxƂ̃L[
+		std::deque<LoadTask> m_task_deques[static_cast<int>(ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_MAX)];
+		// ǉ1sL[(ɎsXbh1)
+		std::deque<LoadTask> m_serial_tasks;
+		bool m_is_serial_running = false;
+		int m_queued_task_num = 0;
+		// ̏̃`Pbg
+		std::uint64_t m_next_ticket = 0;
+		std::set<std::uint64_t> m_outstanding_tickets;
+
 		std::function<void()> m_load_func = [this]()
 		{
 			// Xbh̏
@@ -69,31 +121,51 @@ namespace TKGEngine
 				assert(0 && "failed create thread AssetSystem");
 				return;
 			}
+			m_is_load_thread = true;
 			// ֐̎s[v
 			while (true)
 			{
-				std::function<void()> func;
+				LoadTask task;
 				{
 					std::unique_lock<std::mutex> lock(m_mutex);
-					// DequeɃf[^݂ȂԂ͑ҋ@
-					while (m_func_deque.empty())
+					// of[^݂ȂԂ͑ҋ@
+					m_cv.wait(lock, [this]() { return HasRunnableTask() || m_is_termination_requested; });
+					// CX^X̏I͎cĂI
+					// (s̒ǉ̏̎ćAs̃Xbh)
+					if (!HasRunnableTask())
 					{
-						// CX^X̏I̓Xbh̏I
-						if (m_is_termination_requested)
-						{
-							return;
-						}
-						m_cv.wait(lock);
+						break;
 					}
-					func = std::move(m_func_deque.front());
-					m_func_deque.pop_front();
+					PopTask(task);
 				}
-				func();
+				m_not_full_cv.notify_one();
+				RunTask(task);
 			}
 			// Xbh̏I[
 			CoUninitialize();
 		};
 	};
 
+	////////////////////////////////////////////////////////
+	// Template Methods
+	////////////////////////////////////////////////////////
+	template<class T, class Func>
+	inline bool AssetSystem::AddLoad(const std::shared_ptr<T>& res, Func func, ASSET_LOAD_PRIORITY priority)
+	{
+		// L[ɂweak_ptrŎāAQƂ؂ꂽ\[X̓[hȂ
+		const std::weak_ptr<T> weak_res = res;
+		LoadTask task;
+		task.func = [weak_res, func]()
+		{
+			if (const auto s_ptr = weak_res.lock())
+			{
+				(s_ptr.get()->*func)();
+			}
+		};
+		task.cancel_token = weak_res;
+		task.is_cancelable = true;
+		return AddTask(std::move(task), priority);
+	}
+
 
 }// namespace TKGEngine
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <mutex>
+#include <cstdint>
 
 namespace TKGEngine
 {
@@ -18,6 +18,7 @@ namespace TKGEngine
 		AsyncFence(const AsyncFence&) = delete;
 		AsyncFence& operator=(const AsyncFence&) = delete;
 
+		// ܂łɒǉꂽ񓯊̊Ď
 		void SetChecker();
 		bool HasFinished() const;
 
@@ -33,15 +34,16 @@ namespace TKGEngine
 		// ==============================================
 		// private methods
 		// ==============================================
-		void Checker();
-
+		/* nothing */
 
 
 		// ==============================================
 		// private variables
 		// ==============================================
-		bool m_has_finished = false;
-		std::mutex m_mutex;
+		// [hXbĥŁAL[̖̊ł͔łȂ
+		// SetChecker_̃`PbgȌSďIŔ肷
+		bool m_is_checking = false;
+		std::uint64_t m_ticket = 0;
 
 	};
 
@@ -51,14 +53,10 @@ namespace TKGEngine
 	// ------------------
 	// AsyncFence
 	// ------------------
-	inline bool AsyncFence::HasFinished() const
-	{
-		return m_has_finished;
-	}
-
 	inline void AsyncFence::Reset()
 	{
-		m_has_finished = false;
+		m_is_checking = false;
+		m_ticket = 0;
 	}
 
 
@@ -6,6 +6,7 @@
 #include "Systems/inc/Physics_Defined.h"
 #include "Systems/inc/LogSystem.h"
 #include "Utility/inc/myfunc_vector.h"
+#include "Utility/inc/template_HandleMap.h"
 
 #include <btBulletCollisionCommon.h>
 #include <btBulletDynamicsCommon.h>
@@ -44,6 +45,14 @@ namespace TKGEngine
 				);
 
 			}
+			if (version > 1)
+			{
+				archive(
+					CEREAL_NVP(m_use_fixed_time_step),
+					CEREAL_NVP(m_fixed_time_step),
+					CEREAL_NVP(m_max_sub_steps)
+				);
+			}
 			// Gravity̒lXV
 			SetWorldGravity(m_gravity);
 			// C[}XNl\vZ
@@ -59,6 +68,14 @@ namespace TKGEngine
 					CEREAL_NVP(m_gravity)
 				);
 			}
+			if (version > 1)
+			{
+				archive(
+					CEREAL_NVP(m_use_fixed_time_step),
+					CEREAL_NVP(m_fixed_time_step),
+					CEREAL_NVP(m_max_sub_steps)
+				);
+			}
 		}
 
 	public:
@@ -135,6 +152,29 @@ namespace TKGEngine
 			return m_gravity;
 		}
 
+		// Œ^CXebvōXV邩
+		// (falseȂt[̌oߎԂ1񂾂XV)
+		void SetUseFixedTimeStep(const bool use_fixed)
+		{
+			m_use_fixed_time_step = use_fixed;
+		}
+		[[nodiscard]] bool GetUseFixedTimeStep() const
+		{
+			return m_use_fixed_time_step;
+		}
+		// Œ^CXebv̊Ԋu
+		void SetFixedTimeStep(const float time_step);
+		[[nodiscard]] float GetFixedTimeStep() const
+		{
+			return m_fixed_time_step;
+		}
+		// 1t[ŎsőTuXebv
+		void SetMaxSubSteps(const int max_sub_steps);
+		[[nodiscard]] int GetMaxSubSteps() const
+		{
+			return m_max_sub_steps;
+		}
+
 		// C[}XNl\vZ
 		void CreateLayerMaskParam();
 
@@ -142,7 +182,7 @@ namespace TKGEngine
 		int GetLayerMask(Layer layer);
 
 		// Collider}bṽ|C^Ԃ
-		[[nodiscard]] const std::unordered_map<int, std::shared_ptr<ICollider>>* GetColliderMap() const
+		[[nodiscard]] const HandleMap<std::shared_ptr<ICollider>>* GetColliderMap() const
 		{
 			return &m_collider_map;
 		}
@@ -181,6 +221,9 @@ namespace TKGEngine
 		void OnDebugDraw() const;
 #endif // USE_IMGUI
 
+		// TuXebvƂBulletĂ΂
+		static void OnInternalTick(btDynamicsWorld* world, btScalar time_step);
+
 		// Փ˂ĂIuWFNgyȀԂXV
 		void UpdateCollisionState();
 
@@ -251,13 +294,23 @@ namespace TKGEngine
 		// [hd͉x
 		VECTOR3 m_gravity = VECTOR3(0.0f, -9.8f, 0.0f);
 
+		// Œ^CXebvōXV邩
+		bool m_use_fixed_time_step = true;
+		// Œ^CXebv̊Ԋu
+		float m_fixed_time_step = 1.0f / 60.0f;
+		// 1t[ŎsőTuXebv(Ԃ͐؂̂Ă)
+		int m_max_sub_steps = 4;
+		// ől
+		static constexpr int MAX_SUB_STEPS_LIMIT = 16;
+		static constexpr float MIN_FIXED_TIME_STEP = 1.0f / 1000.0f;
+
 		// RWeXg̃}XNIɕ\\p
 		bool m_layer_mask[30][30] = {};
 		// sJnɃC[Ɍ肳}XNl
 		int m_layer_mask_param[30] = {};
 
-		// CollisionObjectComponent֘At
-		std::unordered_map<int, std::shared_ptr<ICollider>> m_collider_map;
+		// CollisionObjectComponent֘At(userIndexɂColliderInstanceID)
+		HandleMap<std::shared_ptr<ICollider>> m_collider_map;
 
 		// GameObjectIDCollisionObject֘At
 		std::unordered_map<GameObjectID, std::unordered_set<int>> m_goid_collision_map;
@@ -266,6 +319,6 @@ namespace TKGEngine
 }// namespace TKGEngine
 
 
-CEREAL_CLASS_VERSION(TKGEngine::PhysicsSystem, 1)
+CEREAL_CLASS_VERSION(TKGEngine::PhysicsSystem, 2)
 // archiveload savegpB
 CEREAL_SPECIALIZE_FOR_ALL_ARCHIVES(TKGEngine::PhysicsSystem, cereal::specialization::member_load_save)
\ No newline at end of file
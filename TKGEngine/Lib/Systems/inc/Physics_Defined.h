@@ -1,6 +1,7 @@
 #pragma once
 
 #include <btBulletCollisionCommon.h>
+#include <BulletDynamics/Dynamics/btDynamicsWorld.h>
 #include "../../Utility/inc/myfunc_vector.h"
 
 namespace TKGEngine
@@ -74,6 +75,20 @@ namespace TKGEngine
 		return ret_val;
 	}
 
+	// [hoߎԕi߁AsTuXebvԂ
+	// Œ^CXebvł͌oߎԂ~ςČŒԊuōőmax_sub_stepsXVAԂ͐؂̂Ă
+	// σ^CXebvł͌oߎԂ1񂾂XV
+	inline int StepPhysicsWorld(btDynamicsWorld* world, const float elapsed_time, const bool use_fixed_time_step, const float fixed_time_step, const int max_sub_steps)
+	{
+		if (use_fixed_time_step)
+		{
+			// stepSimulation͐؂̂đÕXebvԂ
+			const int sub_step_num = world->stepSimulation(elapsed_time, max_sub_steps, fixed_time_step);
+			return sub_step_num < max_sub_steps ? sub_step_num : max_sub_steps;
+		}
+		return world->stepSimulation(elapsed_time, 1, elapsed_time);
+	}
+
 
 	// ==============================================
 	// Definition
@@ -16,6 +16,17 @@
 #endif// #ifdef USE_IMGUI
 // ---------------------------
 
+// ---------------------------
+// CPU Profiler
+// ---------------------------
+// If use CPU_PROFILE_SCOPE
+// fobOrhImGUIgƂ̂݌v𖄂ߍ(v̂GUILɂ)
+// ȊÕrhŎgꍇ̓RpCIvVUSE_CPU_PROFILER`
+#if !defined(USE_CPU_PROFILER) && defined(USE_IMGUI) && (defined(DEBUG) || defined(_DEBUG))
+#define USE_CPU_PROFILER
+#endif// #if !defined(USE_CPU_PROFILER) && defined(USE_IMGUI) && (defined(DEBUG) || defined(_DEBUG))
+// ---------------------------
+
 // ---------------------------
 // cereal
 // ---------------------------
@@ -68,6 +79,8 @@ namespace TKGEngine
 {
 	/// <summary>
 	/// Starting at 1. 0 is initial value.
+	/// ʃrbg̓XbgԍAʃrbg͐\nh
+	/// XbgėpƐオς邽߁Ajς݃IuWFNgID͕ʂ̃IuWFNgwȂ
 	/// </summary>
 	///	Unique Instance ID
 	typedef unsigned int InstanceID;
@@ -75,6 +88,26 @@ namespace TKGEngine
 	// sID̒l
 	static constexpr InstanceID INVALID_ID = 0;
 
+	// Xbgԍ̃rbg(ɑ݂łIuWFNg̏)
+	static constexpr unsigned INSTANCE_ID_INDEX_BITS = 20;
+	static constexpr InstanceID INSTANCE_ID_INDEX_MASK = (1u << INSTANCE_ID_INDEX_BITS) - 1;
+	// 1n܂Aŏʃrbg͎gpȂ(btCollisionObject::userIndexintŐ̒lɂȂ悤ɂ)
+	static constexpr unsigned INSTANCE_ID_GENERATION_BITS = 31 - INSTANCE_ID_INDEX_BITS;
+	static constexpr InstanceID INSTANCE_ID_GENERATION_MAX = (1u << INSTANCE_ID_GENERATION_BITS) - 1;
+
+	constexpr InstanceID MakeInstanceID(const unsigned index, const unsigned generation)
+	{
+		return (generation << INSTANCE_ID_INDEX_BITS) | (index & INSTANCE_ID_INDEX_MASK);
+	}
+	constexpr unsigned GetInstanceIDIndex(const InstanceID id)
+	{
+		return id & INSTANCE_ID_INDEX_MASK;
+	}
+	constexpr unsigned GetInstanceIDGeneration(const InstanceID id)
+	{
+		return id >> INSTANCE_ID_INDEX_BITS;
+	}
+
 	/// <summary>
 	///	Unique GameObject ID
 	/// Starting at 1. 0 is initial value.
@@ -83,10 +116,13 @@ namespace TKGEngine
 
 	/// <summary>
 	///	Unique ComponentType ID
-	/// Starting at 1. 0 is initial value.
+	/// Dense index starting at 0. INVALID_COMPONENT_TYPE_ID is initial value.
 	/// </summary>
 	typedef InstanceID ComponentTypeID;
 
+	// sComponentTypeID̒l(0͗LTypeID̂INVALID_ID͎gȂ)
+	static constexpr ComponentTypeID INVALID_COMPONENT_TYPE_ID = static_cast<ComponentTypeID>(-1);
+
 	/// <summary>
 	///	Unique Scene ID
 	/// -2 : Invalid ID. -1 : Don't Destroy. Starting at 0.
@@ -17,8 +17,11 @@
 #include "Systems/inc/IInput.h"
 
 #include "Application/inc/SystemSetting.h"
+#include "Application/Objects/Managers/TransformManager.h"
 
 #include "Utility/inc/random.h"
+#include "Utility/inc/job_system.h"
+#include "Utility/inc/cpu_profiler.h"
 #include "Utility/inc/myfunc_math.h"
 
 #include "../../DirectXTK/Inc/Keyboard.h"
@@ -46,6 +49,9 @@ namespace TKGEngine
 
 	bool Application::OnInit()
 	{
+		// Initialize Job System
+		JobSystem::Initialize();
+
 		// Initialize Graphics System
 		graphics_system = Graphics::IGraphicsSystem::CreateInterface();
 		if (!graphics_system->OnInit())
@@ -137,6 +143,8 @@ namespace TKGEngine
 		{
 			graphics_system->OnTerm();
 		}
+
+		JobSystem::Terminate();
 	}
 
 	void Application::OnMsgProc(const HWND hwnd, const UINT msg, const WPARAM wparam, const LPARAM lparam)
@@ -225,6 +233,11 @@ namespace TKGEngine
 
 	void Application::OnFrameBegin(const FrameEventArgs& args)
 	{
+#ifdef USE_CPU_PROFILER
+		CPUProfiler::BeginFrame();
+#endif// #ifdef USE_CPU_PROFILER
+		CPU_PROFILE_SCOPE("Application::OnFrameBegin");
+
 		input_system->OnFrameBegin(args);
 		audio_system->OnFrameBegin(args);
 
@@ -255,23 +268,37 @@ namespace TKGEngine
 
 	void Application::OnFrameRender(const FrameEventArgs& args)
 	{
+		CPU_PROFILE_SCOPE("Application::OnFrameRender");
+
 		scene_system->OnFrameRender(args);
 
 		graphics_system->OnFrameRender(args);
 
 #ifdef USE_IMGUI
 		Log::LogSystem::GetInstance()->Draw();
+#ifdef USE_CPU_PROFILER
+		// CPUvt@CʂGUI
+		CPUProfiler::OnGUI();
+#endif// #ifdef USE_CPU_PROFILER
+		TransformManager::OnGUI();
 		gui_system->OnFrameRender(args);
 #endif
 	}
 
 	void Application::OnFrameEnd(const FrameEventArgs& args)
 	{
+		{
+			CPU_PROFILE_SCOPE("Application::OnFrameEnd");
 #ifdef USE_IMGUI
-		gui_system->OnFrameEnd(args);
+			gui_system->OnFrameEnd(args);
 #endif
-		scene_system->OnFrameEnd(args);
-		//graphics_system->OnFrameEnd(args);
+			scene_system->OnFrameEnd(args);
+			//graphics_system->OnFrameEnd(args);
+		}
+#ifdef USE_CPU_PROFILER
+		// XbhƂ̌vʂ
+		CPUProfiler::EndFrame();
+#endif// #ifdef USE_CPU_PROFILER
 	}
 
 }	// namespace TKGEngine
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Application/Resource/inc/Asset_Defined.h"
 #include "Systems/inc/IGraphics.h"
 #include "Systems/inc/Graphics_Defined.h"
+#include "Utility/inc/myfunc_math.h"
 
 namespace TKGEngine
 {
@@ -12,6 +13,7 @@ namespace TKGEngine
 	// Static definition
 	////////////////////////////////////////////////////////
 	AssetSystem* AssetSystem::m_instance = nullptr;
+	thread_local bool AssetSystem::m_is_load_thread = false;
 
 
 	////////////////////////////////////////////////////////
@@ -42,34 +44,143 @@ namespace TKGEngine
 		return *m_instance;
 	}
 
-	bool AssetSystem::Add(const std::function<void()>& func)
+	bool AssetSystem::Add(const std::function<void()>& func, const ASSET_LOAD_PRIORITY priority)
+	{
+		LoadTask task;
+		task.func = func;
+		return AddTask(std::move(task), priority);
+	}
+
+	bool AssetSystem::Add(std::function<void()>&& func, const ASSET_LOAD_PRIORITY priority)
+	{
+		LoadTask task;
+		task.func = std::move(func);
+		return AddTask(std::move(task), priority);
+	}
+
+	bool AssetSystem::AddSerial(std::function<void()>&& func)
+	{
+		LoadTask task;
+		task.func = std::move(func);
+		task.is_serial = true;
+		return AddTask(std::move(task), ASSET_LOAD_PRIORITY::ASSET_LOAD_PRIORITY_VISIBLE);
+	}
+
+	std::uint64_t AssetSystem::GetFenceTicket()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_next_ticket;
+	}
+
+	bool AssetSystem::HasFinishedBefore(const std::uint64_t ticket)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_outstanding_tickets.empty() || *m_outstanding_tickets.begin() >= ticket;
+	}
+
+	bool AssetSystem::AddTask(LoadTask&& task, const ASSET_LOAD_PRIORITY priority)
 	{
 		{
 			std::unique_lock<std::mutex> lock(m_mutex);
-			if (g_max_num_system_deque_size <= m_func_deque.size())
+			if (m_is_termination_requested)
 			{
 				return false;
 			}
-			m_func_deque.emplace_back(func);
+			task.ticket = m_next_ticket++;
+			m_outstanding_tickets.emplace(task.ticket);
+
+			// ǉɎs鏈́Aۂ߂ɃL[̏Ɋւ炸ς
+			if (task.is_serial)
+			{
+				m_serial_tasks.emplace_back(std::move(task));
+				++m_queued_task_num;
+				lock.unlock();
+				m_cv.notify_one();
+				return true;
+			}
+
+			// L[t̂Ƃ
+			if (g_max_num_system_deque_size <= m_queued_task_num)
+			{
+				// [hXbh̒ǉ͑ҋ@ƃfbhbN̂ŁȀŎs
+				if (m_is_load_thread)
+				{
+					lock.unlock();
+					RunTask(task);
+					return true;
+				}
+				// 󂫂o܂őҋ@
+				m_not_full_cv.wait(lock, [this]()
+					{
+						return m_queued_task_num < g_max_num_system_deque_size || m_is_termination_requested;
+					});
+				if (m_is_termination_requested)
+				{
+					m_outstanding_tickets.erase(task.ticket);
+					return false;
+				}
+			}
+			m_task_deques[static_cast<int>(priority)].emplace_back(std::move(task));
+			++m_queued_task_num;
 		}
-		m_cv.notify_all();
+		m_cv.notify_one();
 
 		return true;
 	}
 
-	bool AssetSystem::Add(std::function<void()>&& func)
+	void AssetSystem::RunTask(LoadTask& task)
 	{
+		// QƂ؂ĂLZ
+		if (!task.is_cancelable || !task.cancel_token.expired())
 		{
-			std::unique_lock<std::mutex> lock(m_mutex);
-			if (g_max_num_system_deque_size <= m_func_deque.size())
+			task.func();
+		}
+		// ֐IuWFNgQƂ̓bNOŉ
+		task.func = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_outstanding_tickets.erase(task.ticket);
+			if (task.is_serial)
 			{
-				return false;
+				m_is_serial_running = false;
 			}
-			m_func_deque.emplace_back(std::move(func));
 		}
-		m_cv.notify_all();
+		// ҋ@̒ǉ̏o悤ɂȂƂʒm
+		if (task.is_serial)
+		{
+			m_cv.notify_one();
+		}
+	}
 
-		return true;
+	bool AssetSystem::HasRunnableTask() const
+	{
+		if (!m_is_serial_running && !m_serial_tasks.empty())
+			return true;
+		return m_queued_task_num > static_cast<int>(m_serial_tasks.size());
+	}
+
+	void AssetSystem::PopTask(LoadTask& task)
+	{
+		// ǉ͎̏ŝ̂Ƃo
+		if (!m_is_serial_running && !m_serial_tasks.empty())
+		{
+			task = std::move(m_serial_tasks.front());
+			m_serial_tasks.pop_front();
+			m_is_serial_running = true;
+			--m_queued_task_num;
+			return;
+		}
+		// Dx̍L[o
+		for (auto& deque : m_task_deques)
+		{
+			if (deque.empty())
+				continue;
+			task = std::move(deque.front());
+			deque.pop_front();
+			--m_queued_task_num;
+			return;
+		}
 	}
 
 	ID3D11Device* AssetSystem::GetDevice() const
@@ -86,9 +197,11 @@ namespace TKGEngine
 	{
 		// Create threads
 		m_is_termination_requested = false;
-		m_threads.reserve(g_max_num_asset_load_threads);
+		// t@Cǂݍ݂̑҂̂Ř_RA̔xg
+		const int thread_num = MyMath::Clamp(static_cast<int>(std::thread::hardware_concurrency()) / 2, 1, g_max_num_asset_load_threads);
+		m_threads.reserve(thread_num);
 
-		for (int i = 0; i < g_max_num_asset_load_threads; ++i)
+		for (int i = 0; i < thread_num; ++i)
 		{
 			m_threads.emplace_back(std::thread(m_load_func));
 		}
@@ -110,6 +223,7 @@ namespace TKGEngine
 		}
 		// DequeɂăXbhI
 		m_cv.notify_all();
+		m_not_full_cv.notify_all();
 		for (auto& th : m_threads)
 		{
 			th.join();
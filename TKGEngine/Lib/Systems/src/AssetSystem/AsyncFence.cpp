@@ -8,13 +8,15 @@ namespace TKGEngine
 {
 	void AsyncFence::SetChecker()
 	{
-		AssetSystem::GetInstance().Add(std::bind(&AsyncFence::Checker, this));
+		m_ticket = AssetSystem::GetInstance().GetFenceTicket();
+		m_is_checking = true;
 	}
 
-	void AsyncFence::Checker()
+	bool AsyncFence::HasFinished() const
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-		m_has_finished = true;
+		if (!m_is_checking)
+			return false;
+		return AssetSystem::GetInstance().HasFinishedBefore(m_ticket);
 	}
 
 }// namespace TKGEngine
\ No newline at end of file
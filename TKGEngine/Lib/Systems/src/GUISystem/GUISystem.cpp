@@ -11,6 +11,7 @@
 #include "Systems/inc/IGraphics.h"
 #include "Systems/inc/IInput.h"
 #include "Systems/inc/PhysicsSystem.h"
+#include "Systems/inc/LogSystem.h"
 #include "Managers/SceneManager.h"
 #include "Managers/GameObjectManager.h"
 #include "Managers/CameraManager.h"
@@ -18,6 +19,7 @@
 #include "GUI_Gizmo.h"
 
 #include "Application/Resource/inc/FBXLoader.h"
+#include "Application/Resource/inc/Mesh.h"
 
 #include "Utility/inc/myfunc_file.h"
 #include "Utility/inc/myfunc_imgui.h"
@@ -1046,6 +1048,21 @@ namespace TKGEngine::GUI
 		{
 			m_active_export_fbx = true;
 		}
+		// `.mesht@Cϊ
+		if (ImGui::MenuItem("Convert Mesh Binary"))
+		{
+			std::list<std::string> mesh_filename_list;
+			if (MyFunc::FetchOpenFileNames(mesh_filename_list, TEXT("Mesh(*.mesh)\0*.mesh\0"), TEXT("Convert Mesh File")))
+			{
+				for (const auto& filename : mesh_filename_list)
+				{
+					if (Mesh::ConvertBinary(filename))
+					{
+						LOG_DEBUG("Converted mesh file.(%s)", filename.c_str());
+					}
+				}
+			}
+		}
 	}
 
 	void GUISystem::InMenuItemSetting()
@@ -1079,6 +1096,27 @@ namespace TKGEngine::GUI
 					}
 					ImGui::EndMenu();
 				}
+				// Time Step
+				if (ImGui::BeginMenu("Time Step"))
+				{
+					auto* physics = PhysicsSystem::GetInstance();
+					bool use_fixed = physics->GetUseFixedTimeStep();
+					if (ImGui::Checkbox("Fixed Time Step", &use_fixed))
+					{
+						physics->SetUseFixedTimeStep(use_fixed);
+					}
+					float time_step = physics->GetFixedTimeStep();
+					if (ImGui::InputFloat("Time Step##Physics", &time_step, 0.0f, 0.0f, "%.4f", ImGuiInputTextFlags_EnterReturnsTrue))
+					{
+						physics->SetFixedTimeStep(time_step);
+					}
+					int max_sub_steps = physics->GetMaxSubSteps();
+					if (ImGui::InputInt("Max Sub Steps##Physics", &max_sub_steps, 1, 1, ImGuiInputTextFlags_EnterReturnsTrue))
+					{
+						physics->SetMaxSubSteps(max_sub_steps);
+					}
+					ImGui::EndMenu();
+				}
 				ImGui::EndMenu();
 			}
 			// Light
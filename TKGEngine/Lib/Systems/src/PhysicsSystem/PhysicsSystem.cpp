@@ -4,6 +4,8 @@
 #include "IBulletDebugDraw.h"
 
 #include "Systems/inc/IGUI.h"
+#include "Utility/inc/myfunc_math.h"
+#include "Utility/inc/cpu_profiler.h"
 
 #include "Application/Objects/Components/inc/CCollider.h"
 #include "Application/Objects/Components/interface/ICollider.h"
@@ -45,6 +47,8 @@ namespace TKGEngine
 
 	void PhysicsSystem::FrameUpdate(const float elapsed_time)
 	{
+		CPU_PROFILE_SCOPE("PhysicsSystem::FrameUpdate");
+
 		if (m_instance)
 		{
 			m_instance->Update(elapsed_time);
@@ -163,7 +167,7 @@ namespace TKGEngine
 
 		// Ǘpzɓo^
 		// Collider̓o^
-		m_collider_map.emplace(collider_id, collider);
+		m_collider_map.Emplace(collider_id, collider);
 		// ColliderID̓o^
 		m_goid_collision_map[collider->GetOwnerID()].emplace(collider_id);
 	}
@@ -174,16 +178,17 @@ namespace TKGEngine
 		m_dynamics_world->removeRigidBody(rigid_body);
 
 		// Ǘpz񂩂
-		const auto itr_find = m_collider_map.find(rigid_body->getUserIndex());
+		const InstanceID col_id = rigid_body->getUserIndex();
+		const auto* col_find = m_collider_map.Find(col_id);
 		// Collider
-		if (itr_find != m_collider_map.end())
+		if (col_find)
 		{
-			const auto goid_itr_find = m_goid_collision_map.find(itr_find->second->GetGameObjectID());
+			const auto goid_itr_find = m_goid_collision_map.find((*col_find)->GetGameObjectID());
 			// OwnerID
 			if (goid_itr_find != m_goid_collision_map.end())
 			{
 				// XgColliderID폜
-				const int collider_id = itr_find->second->GetColliderID();
+				const int collider_id = (*col_find)->GetColliderID();
 				const auto col_itr = goid_itr_find->second.find(collider_id);
 				if (col_itr != goid_itr_find->second.end())
 				{
@@ -197,7 +202,7 @@ namespace TKGEngine
 				}
 			}
 			// Collider̍폜
-			m_collider_map.erase(itr_find);
+			m_collider_map.Erase(col_id);
 		}
 	}
 
@@ -209,7 +214,7 @@ namespace TKGEngine
 
 		// Ǘpzɓo^
 		// Collider̓o^
-		m_collider_map.emplace(collider_id, collider);
+		m_collider_map.Emplace(collider_id, collider);
 		// ColliderID̓o^
 		m_goid_collision_map[collider->GetOwnerID()].emplace(collider_id);
 	}
@@ -220,16 +225,17 @@ namespace TKGEngine
 		m_dynamics_world->removeCollisionObject(ghost_obj);
 
 		// Ǘpz񂩂
-		const auto itr_find = m_collider_map.find(ghost_obj->getUserIndex());
+		const InstanceID col_id = ghost_obj->getUserIndex();
+		const auto* col_find = m_collider_map.Find(col_id);
 		// Collider
-		if (itr_find != m_collider_map.end())
+		if (col_find)
 		{
-			const auto goid_itr_find = m_goid_collision_map.find(itr_find->second->GetGameObjectID());
+			const auto goid_itr_find = m_goid_collision_map.find((*col_find)->GetGameObjectID());
 			// OwnerID
 			if (goid_itr_find != m_goid_collision_map.end())
 			{
 				// XgColliderID폜
-				const int collider_id = itr_find->second->GetColliderID();
+				const int collider_id = (*col_find)->GetColliderID();
 				const auto col_itr = goid_itr_find->second.find(collider_id);
 				if (col_itr != goid_itr_find->second.end())
 				{
@@ -243,7 +249,7 @@ namespace TKGEngine
 				}
 			}
 			// Collider̍폜
-			m_collider_map.erase(itr_find);
+			m_collider_map.Erase(col_id);
 		}
 	}
 
@@ -268,22 +274,21 @@ namespace TKGEngine
 		}
 
 		// ColliderIDCollider̊֐Ă
-		const auto col_itr_end = m_collider_map.end();
 		for (const auto& id : itr_find->second)
 		{
-			const auto col_itr = m_collider_map.find(id);
-			// I[mF
-			if (col_itr == col_itr_end)
+			const auto* col_find = m_collider_map.Find(id);
+			// ݊mF
+			if (col_find == nullptr)
 				continue;
 			// ANeBuTrueɂ鎞͑SĂ̏TruełȂƂȂ
 			if (is_active)
 			{
 				// ANeBu`FbN
-				if (!col_itr->second->IsActiveCollider())
+				if (!(*col_find)->IsActiveCollider())
 					continue;
 			}
 			// Collider̗LAύX̊֐Ă
-			col_itr->second->OnSetCollisionActive(is_active);
+			(*col_find)->OnSetCollisionActive(is_active);
 		}
 	}
 
@@ -293,6 +298,16 @@ namespace TKGEngine
 		m_dynamics_world->setGravity(ConvertVectorTobtVector(gravity));
 	}
 
+	void PhysicsSystem::SetFixedTimeStep(const float time_step)
+	{
+		m_fixed_time_step = MyMath::Clamp(time_step, MIN_FIXED_TIME_STEP, 1.0f);
+	}
+
+	void PhysicsSystem::SetMaxSubSteps(const int max_sub_steps)
+	{
+		m_max_sub_steps = MyMath::Clamp(max_sub_steps, 1, MAX_SUB_STEPS_LIMIT);
+	}
+
 	void PhysicsSystem::CreateLayerMaskParam()
 	{
 		constexpr int MAX_USER_LAYER_NUM = static_cast<int>(Layer::MAX_USER_LAYER_NUM);
@@ -322,14 +337,14 @@ namespace TKGEngine
 
 	std::shared_ptr<Collider> PhysicsSystem::GetColliderForID(const int col_id)
 	{
-		const auto itr_find = m_collider_map.find(col_id);
-		if (itr_find == m_collider_map.end())
+		const auto* col_find = m_collider_map.Find(col_id);
+		if (col_find == nullptr)
 		{
 			return std::shared_ptr<Collider>();
 		}
 		else
 		{
-			return std::static_pointer_cast<Collider>(itr_find->second);
+			return std::static_pointer_cast<Collider>(*col_find);
 		}
 	}
 
@@ -437,6 +452,11 @@ namespace TKGEngine
 		m_broadphase_filter_callback = std::make_unique<BroadphaseFilterCallback>();
 		m_dynamics_world->getPairCache()->setOverlapFilterCallback(m_broadphase_filter_callback.get());
 
+		// TuXebvƂ̏ՓˏԂ̎W
+		m_dynamics_world->setInternalTickCallback(OnInternalTick, this);
+		// MotionStateɂ͒O2XebvԂԂpn
+		m_dynamics_world->setLatencyMotionStateInterpolation(true);
+
 #ifdef USE_IMGUI
 		// BulletfobO\
 		m_bullet_debug_draw = std::make_unique<IBulletDebugDraw>();
@@ -500,8 +520,61 @@ namespace TKGEngine
 
 	void PhysicsSystem::Update(const float elapsed_time)
 	{
-		// Physics World̍XV
-		m_dynamics_world->stepSimulation(elapsed_time, 1, elapsed_time);
+		// Œ^CXebv
+		if (m_use_fixed_time_step)
+		{
+			// Physics World̍XV
+			// oߎԂŒ~ςČŒԊuōőm_max_sub_stepsXVA
+			// ]ԕMotionStateɕԂpn
+			// ՓˏԂ̓TuXebvƂOnInternalTickŒ~ς
+			const int sub_step_num = StepPhysicsWorld(m_dynamics_world.get(), elapsed_time, true, m_fixed_time_step, m_max_sub_steps);
+
+#ifdef USE_IMGUI
+			// sȊO͌Ă΂Ȃ
+			if (!IGUI::Get().IsPlaying())
+			{
+				return;
+			}
+#endif // USE_IMGUI
+
+			// XebviłȂΏՓˏԂ͑Ot[̂܂
+			if (sub_step_num == 0)
+			{
+				return;
+			}
+
+			// ՓˏԂɉ֐Ă
+			CallCollisionFunction();
+			return;
+		}
+
+		// σ^CXebv
+		{
+			// Physics World̍XV
+			StepPhysicsWorld(m_dynamics_world.get(), elapsed_time, false, m_fixed_time_step, m_max_sub_steps);
+
+#ifdef USE_IMGUI
+			// sȊO͌Ă΂Ȃ
+			if (!IGUI::Get().IsPlaying())
+			{
+				return;
+			}
+#endif // USE_IMGUI
+
+			// ՓˏԂ擾čXV
+			UpdateCollisionState();
+
+			// ՓˏԂɉ֐Ă
+			CallCollisionFunction();
+		}
+	}
+
+	void PhysicsSystem::OnInternalTick(btDynamicsWorld* world, btScalar time_step)
+	{
+		auto* physics = static_cast<PhysicsSystem*>(world->getWorldUserInfo());
+		// σ^CXebvłUpdateŒڎ擾
+		if (!physics->m_use_fixed_time_step)
+			return;
 
 #ifdef USE_IMGUI
 		// sȊO͌Ă΂Ȃ
@@ -511,11 +584,8 @@ namespace TKGEngine
 		}
 #endif // USE_IMGUI
 
-		// ՓˏԂ擾čXV
-		UpdateCollisionState();
-
-		// ՓˏԂɉ֐Ă
-		CallCollisionFunction();
+		// TuXebvƂ̏Փ˂~ς (Enter/Stay/Exit̔̓t[)
+		physics->UpdateCollisionState();
 	}
 
 #ifdef USE_IMGUI
@@ -551,8 +621,12 @@ namespace TKGEngine
 			}
 
 			// CollisionIDColliderR|[lg擾
-			const auto& col_a = m_collider_map.at(obj_a->getUserIndex());
-			const auto& col_b = m_collider_map.at(obj_b->getUserIndex());
+			const auto* col_a_find = m_collider_map.Find(obj_a->getUserIndex());
+			const auto* col_b_find = m_collider_map.Find(obj_b->getUserIndex());
+			if (col_a_find == nullptr || col_b_find == nullptr)
+				continue;
+			const auto& col_a = *col_a_find;
+			const auto& col_b = *col_b_find;
 
 			// ֐ĂԂǂ
 			const bool do_call_func_a = col_a->IsCallOnFunction();
@@ -584,15 +658,15 @@ namespace TKGEngine
 		for (const auto& col : m_collider_map)
 		{
 			// IuWFNg̃ANeBu`FbN
-			if (!col.second->IsActiveCollider())
+			if (!col->IsActiveCollider())
 				continue;
 
 			// ֐Ă΂ȂȂ瑁^[
-			if (!col.second->IsCallOnFunction())
+			if (!col->IsCallOnFunction())
 				continue;
 
 			// ꂼ̍XV
-			col.second->UpdateHitState();
+			col->UpdateHitState();
 		}
 	}
 }
\ No newline at end of file
@@ -16,9 +16,11 @@
 #include "Managers/LightManager.h"
 #include "Managers/SceneManager.h"
 #include "Managers/AnimatorManager.h"
+#include "Managers/TransformManager.h"
 #include "Systems/inc/PhysicsSystem.h"
 #include "Application/Resource/inc/Effect.h"
-#include "Utility/inc/template_thread.h"
+#include "Utility/inc/job_system.h"
+#include "Utility/inc/cpu_profiler.h"
 
 #include <cassert>
 #include <filesystem>
@@ -107,9 +109,8 @@ namespace TKGEngine
 		static constexpr const char* TempFolderPath = "./Temporary_Scene_Save_Folder";
 #endif
 
-		// EffectXVpXbh
-		ThreadPool m_effect_update_thread = ThreadPool(4);
-		std::future<void> m_effect_thread_result;
+		// EffectXVWů҂p
+		JobCounter m_effect_update_counter;
 	};
 
 	////////////////////////////////////////////////////////
@@ -159,6 +160,8 @@ namespace TKGEngine
 
 	void SceneSystem::OnFrameBegin(const FrameEventArgs& args)
 	{
+		CPU_PROFILE_SCOPE("SceneSystem::OnFrameBegin");
+
 		// Aj[V̍XVŝXgɎo
 		AnimatorManager::CheckUpdatable();
 
@@ -173,21 +176,36 @@ namespace TKGEngine
 			MonoBehaviourManager::Run();
 		}
 
-		// Effect̍XVXbh쐬
-		// (join܂ŁAEffectɐGȂ)
-		m_effect_thread_result = m_effect_update_thread.Add(Effect::OnFrameUpdate, args.unscaled_delta_time, args.delta_time);
+		// Effect̍XVWuǉ
+		// (҂܂ŁAEffectɐGȂ)
+		const float unscaled_delta_time = args.unscaled_delta_time;
+		const float delta_time = args.delta_time;
+		JobSystem::Run(m_effect_update_counter, [unscaled_delta_time, delta_time]()
+			{
+				CPU_PROFILE_SCOPE("Effect::OnFrameUpdate");
+				Effect::OnFrameUpdate(unscaled_delta_time, delta_time);
+			});
 
 		// ̍XV
 		PhysicsSystem::FrameUpdate(args.delta_time);
 
+		// ύX̂Transform̃[hsqGL[ɈꊇXV
+		{
+			CPU_PROFILE_SCOPE("TransformManager::UpdateWorldMatrices");
+			TransformManager::UpdateWorldMatrices();
+		}
+
 		// {[̃gXtH[ǂăAj[VsvZ
-		AnimatorManager::UpdateAnimationMatrix();
+		{
+			CPU_PROFILE_SCOPE("AnimatorManager::UpdateAnimationMatrix");
+			AnimatorManager::UpdateAnimationMatrix();
+		}
 
 		// SceneǗCBufferƔ񓯊Xg̍XV
 		SceneManager::FrameUpdate();
 
-		// EffectXbhjoin
-		m_effect_thread_result.wait();
+		// Effect̍XVWuҋ@
+		JobSystem::Wait(m_effect_update_counter);
 
 		// Object::DestroyPool̍XV
 		ObjectManager::FrameUpdate(args.unscaled_delta_time);
@@ -195,8 +213,10 @@ namespace TKGEngine
 
 	void SceneSystem::OnFrameRender(const FrameEventArgs& args)
 	{
+		CPU_PROFILE_SCOPE("SceneSystem::OnFrameRender");
+
 		// V[̃Cg\[g
-		// TODO : JƂɎgp郉CgJO鏈Kv
+		// JƂ̃Cg̑ILightManager::CalculateSceneLightŃNX^[Ɋ蓖Ăčs
 		LightManager::SortSceneLight();
 
 		// `
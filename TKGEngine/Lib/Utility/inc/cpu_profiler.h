@@ -0,0 +1,258 @@
+#pragma once
+
+#include "Systems/inc/TKGEngine_Defined.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace TKGEngine
+{
+	// ===========================================
+	//
+	// CPŨXR[vPʂ̌v
+	// XbhƂlock-freeȃOobt@ɏ݁ACXbht[ƂɉďWv
+	// Lv`ԂChrome trace`(chrome://tracing, Perfetto)ŏo
+	//
+	// ===========================================
+	class CPUProfiler
+	{
+	public:
+		// ==============================================
+		// public struct
+		// ==============================================
+		/// <summary>
+		/// XR[v̊JnI܂łv
+		/// </summary>
+		class ScopedZone
+		{
+		public:
+			explicit ScopedZone(const char* name);
+			~ScopedZone();
+			ScopedZone(const ScopedZone&) = delete;
+			ScopedZone& operator=(const ScopedZone&) = delete;
+
+		private:
+			const char* m_name = nullptr;
+			std::int64_t m_begin = 0;
+		};
+
+		/// <summary>
+		/// t[̃][Ƃ̏Wv
+		/// </summary>
+		struct ZoneStat
+		{
+			const char* name = nullptr;
+			double total_ms = 0.0;	// SXbh̍v
+			double max_ms = 0.0;	// 1̍ő厞
+			int call_count = 0;
+		};
+
+
+		// ==============================================
+		// public methods
+		// ==============================================
+		// v̗L(Ԃ͖Ã][͎擾Ȃ)
+		static void SetEnable(bool enable);
+		static bool IsEnabled();
+
+		// ĂяoXbh̕\ݒ肷
+		static void SetThreadName(const char* name);
+
+		// CXbhŃt[̊JnƏIɌĂ
+		// EndFrameŊeXbh̃obt@ďWv
+		static void BeginFrame();
+		static void EndFrame();
+
+		// Lv`̊JnƏI
+		static void StartCapture();
+		static void StopCapture();
+		static bool IsCapturing();
+		// Lv`ԂChrome trace`JSONŏo
+		static bool ExportChromeTrace(const std::string& filepath);
+
+		// Õt[̏Wv(vԂ̍~)
+		static const std::vector<ZoneStat>& GetFrameStats();
+		// Oobt@ǂzĎꂽ][
+		static std::uint64_t GetDroppedZoneNum();
+
+#ifdef USE_IMGUI
+		static void OnGUI();
+#endif// #ifdef USE_IMGUI
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		// XbhƂɕێ][(2ׂ̂)
+		static constexpr std::uint32_t RING_BUFFER_SIZE = 1 << 14;
+		static constexpr std::uint32_t RING_BUFFER_MASK = RING_BUFFER_SIZE - 1;
+		// Lv`łő̃][
+		static constexpr size_t MAX_CAPTURE_ZONE_NUM = 1 << 21;
+		// Xbh̕\̍ő咷
+		static constexpr size_t THREAD_NAME_SIZE = 32;
+
+
+	private:
+		// ==============================================
+		// private struct
+		// ==============================================
+		/// <summary>
+		/// I][
+		/// </summary>
+		struct ZoneEvent
+		{
+			const char* name = nullptr;
+			std::int64_t begin = 0;
+			std::int64_t end = 0;
+			std::uint32_t depth = 0;
+		};
+
+		/// <summary>
+		/// Lv`][
+		/// </summary>
+		struct CapturedZone
+		{
+			ZoneEvent zone;
+			std::uint32_t thread_index = 0;
+		};
+
+		/// <summary>
+		/// XbhƂ̃Oobt@(݂͏LXbĥ݁Aǂݍ݂̓CXbĥ)
+		/// </summary>
+		struct ThreadBuffer
+		{
+			ZoneEvent zones[RING_BUFFER_SIZE];
+			// 񂾑(LXbhreleaseŐi߂)
+			std::atomic<std::uint64_t> write_count = 0;
+			// ς݂̑(CXbĥ)
+			std::uint64_t read_count = 0;
+			// lXg̐[(LXbĥ)
+			std::uint32_t depth = 0;
+			std::uint32_t thread_index = 0;
+			// \(m_buffer_mutexŕی삷)
+			char thread_name[THREAD_NAME_SIZE] = {};
+		};
+
+
+		// ==============================================
+		// private methods
+		// ==============================================
+		// vɎg
+		static std::int64_t Now();
+		// ĂяoXbh̃obt@擾AȂ΍쐬
+		static ThreadBuffer* GetThreadBuffer();
+		// ][̊JnƏI
+		static void PushZone(ThreadBuffer* buffer);
+		static void PopZone(ThreadBuffer* buffer, const char* name, std::int64_t begin, std::int64_t end);
+		// obt@܂ĂȂ][o
+		static void DrainBuffer(ThreadBuffer& buffer);
+		// ~bƃ}CNbɕϊ
+		static double ToMilliseconds(std::int64_t ticks);
+		static double ToMicroseconds(std::int64_t ticks);
+
+
+		// ==============================================
+		// private variables
+		// ==============================================
+		static std::atomic<bool> m_is_enabled;
+
+		// SXbh̃obt@(XbhIĂێ)
+		static std::vector<std::unique_ptr<ThreadBuffer>> m_thread_buffers;
+		static std::mutex m_buffer_mutex;
+		static thread_local ThreadBuffer* t_thread_buffer;
+
+		// t[̏Wv
+		static std::int64_t m_frame_begin;
+		// ʂ̖|Pʂ̓̕񃊃e܂Ƃ߂邽߁AAhXł͂Ȃeň
+		static std::unordered_map<std::string_view, ZoneStat> m_stat_map;
+		static std::vector<ZoneStat> m_frame_stats;
+		static std::uint64_t m_dropped_zone_num;
+
+		// Lv`
+		static bool m_is_capturing;
+		static std::int64_t m_capture_begin;
+		static std::vector<CapturedZone> m_captured_zones;
+	};
+
+
+	// ------------------------------------------------
+	// vp}N
+	// ------------------------------------------------
+#define CPU_PROFILE_CONCAT_IMPL(a, b) a ## b
+#define CPU_PROFILE_CONCAT(a, b) CPU_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef USE_CPU_PROFILER
+	// XR[v̏I܂łv(name͕񃊃e)
+#define CPU_PROFILE_SCOPE(name) ::TKGEngine::CPUProfiler::ScopedZone CPU_PROFILE_CONCAT(cpu_profile_zone_, __LINE__)(name)
+	// ֐Ōv
+#define CPU_PROFILE_FUNCTION() CPU_PROFILE_SCOPE(__FUNCTION__)
+#else
+#define CPU_PROFILE_SCOPE(name)
+#define CPU_PROFILE_FUNCTION()
+#endif// #ifdef USE_CPU_PROFILER
+
+
+	// ------------------------------------------------
+	// inline
+	// ------------------------------------------------
+	inline std::int64_t CPUProfiler::Now()
+	{
+		return std::chrono::steady_clock::now().time_since_epoch().count();
+	}
+
+	inline CPUProfiler::ScopedZone::ScopedZone(const char* name)
+	{
+		if (!m_is_enabled.load(std::memory_order_relaxed))
+			return;
+		m_name = name;
+		PushZone(GetThreadBuffer());
+		m_begin = Now();
+	}
+
+	inline CPUProfiler::ScopedZone::~ScopedZone()
+	{
+		// Jnɖ][͋L^Ȃ
+		if (!m_name)
+			return;
+		const std::int64_t end = Now();
+		PopZone(t_thread_buffer, m_name, m_begin, end);
+	}
+
+	inline CPUProfiler::ThreadBuffer* CPUProfiler::GetThreadBuffer()
+	{
+		if (t_thread_buffer)
+			return t_thread_buffer;
+
+		auto buffer = std::make_unique<ThreadBuffer>();
+		std::lock_guard<std::mutex> lock(m_buffer_mutex);
+		buffer->thread_index = static_cast<std::uint32_t>(m_thread_buffers.size());
+		t_thread_buffer = buffer.get();
+		m_thread_buffers.emplace_back(std::move(buffer));
+		return t_thread_buffer;
+	}
+
+	inline void CPUProfiler::PushZone(ThreadBuffer* buffer)
+	{
+		++buffer->depth;
+	}
+
+	inline void CPUProfiler::PopZone(ThreadBuffer* buffer, const char* name, const std::int64_t begin, const std::int64_t end)
+	{
+		--buffer->depth;
+		const std::uint64_t index = buffer->write_count.load(std::memory_order_relaxed);
+		ZoneEvent& zone = buffer->zones[index & RING_BUFFER_MASK];
+		zone.name = name;
+		zone.begin = begin;
+		zone.end = end;
+		zone.depth = buffer->depth;
+		buffer->write_count.store(index + 1, std::memory_order_release);
+	}
+
+}// namespace TKGEngine
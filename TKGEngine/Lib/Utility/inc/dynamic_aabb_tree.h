@@ -0,0 +1,171 @@
+#pragma once
+
+#include "bounds.h"
+
+#include <vector>
+#include <cassert>
+
+namespace TKGEngine
+{
+	// ===========================================
+	//
+	// AABB̓IBVH
+	// t͏傫߂AABB(fat AABB)A͂ݏoƂ؂gݑւ
+	// }͕\ʐςŏɂȂʒuIсA]ō̃oXƂ
+	//
+	// ===========================================
+	class DynamicAABBTree
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		DynamicAABBTree() = default;
+		virtual ~DynamicAABBTree() = default;
+		DynamicAABBTree(const DynamicAABBTree&) = delete;
+		DynamicAABBTree& operator=(const DynamicAABBTree&) = delete;
+
+		// t쐬IDԂ
+		int CreateProxy(const Bounds& aabb, int user_data);
+		void DestroyProxy(int proxy_id);
+		// AABBfat AABB͂ݏoƂ̂ݍđ}
+		// đ}trueԂ
+		bool MoveProxy(int proxy_id, const Bounds& aabb);
+
+		void SetUserData(int proxy_id, int user_data);
+		int GetUserData(int proxy_id) const;
+		const Bounds& GetFatAABB(int proxy_id) const;
+
+		int GetProxyCount() const;
+		int GetHeight() const;
+		void Clear();
+
+		// eq̌qAAAABB̕܁AtƋ󂫃m[h̐mF(fobOp)
+		bool Validate() const;
+
+		// test(const Bounds&)trueԂm[ĥݒHABt func(user_data, fat_aabb) Ă
+		// tAABBfat AABBȂ̂ŁAKvȂĂяoŐmȔs
+		// ǂݍ݂݂̂Ȃ̂ŁA؂ύXĂȂԂ͕XbhĂׂ
+		template<class Test, class Func>
+		void Query(Test&& test, Func&& func) const;
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		static constexpr int NULL_NODE = -1;
+
+
+	private:
+		// ==============================================
+		// private struct
+		// ==============================================
+		struct Node
+		{
+			Bounds aabb;
+			// gp͐em[hA󂫃Xg͎̋󂫃m[h
+			int parent = NULL_NODE;
+			int child1 = NULL_NODE;
+			int child2 = NULL_NODE;
+			// t0A󂫃m[h-1
+			int height = -1;
+			int user_data = -1;
+
+			bool IsLeaf() const
+			{
+				return child1 == NULL_NODE;
+			}
+		};
+
+
+		// ==============================================
+		// private methods
+		// ==============================================
+		int AllocateNode();
+		void FreeNode(int node_id);
+
+		void InsertLeaf(int leaf);
+		void RemoveLeaf(int leaf);
+		// node_idƂ镔؂΂ĂΉ]AVԂ
+		int Balance(int node_id);
+
+		// node_idƂ镔؂mFAt̐Z
+		bool ValidateNode(int node_id, int parent, int& leaf_count) const;
+
+
+		// ==============================================
+		// private variables
+		// ==============================================
+		// T̃X^bN̍ő吔
+		static constexpr int MAX_QUERY_STACK = 256;
+
+		std::vector<Node> m_nodes;
+		int m_root = NULL_NODE;
+		int m_free_list = NULL_NODE;
+		int m_proxy_count = 0;
+	};
+
+
+	////////////////////////////////////////////////////////
+	// Inline Methods
+	////////////////////////////////////////////////////////
+	inline void DynamicAABBTree::SetUserData(const int proxy_id, const int user_data)
+	{
+		assert(m_nodes[proxy_id].IsLeaf());
+		m_nodes[proxy_id].user_data = user_data;
+	}
+
+	inline int DynamicAABBTree::GetUserData(const int proxy_id) const
+	{
+		return m_nodes[proxy_id].user_data;
+	}
+
+	inline const Bounds& DynamicAABBTree::GetFatAABB(const int proxy_id) const
+	{
+		return m_nodes[proxy_id].aabb;
+	}
+
+	inline int DynamicAABBTree::GetProxyCount() const
+	{
+		return m_proxy_count;
+	}
+
+	inline int DynamicAABBTree::GetHeight() const
+	{
+		return m_root == NULL_NODE ? 0 : m_nodes[m_root].height;
+	}
+
+
+	////////////////////////////////////////////////////////
+	// Template Methods
+	////////////////////////////////////////////////////////
+	template<class Test, class Func>
+	inline void DynamicAABBTree::Query(Test&& test, Func&& func) const
+	{
+		if (m_root == NULL_NODE)
+			return;
+
+		int stack[MAX_QUERY_STACK];
+		int stack_num = 0;
+		stack[stack_num++] = m_root;
+
+		while (stack_num > 0)
+		{
+			const Node& node = m_nodes[stack[--stack_num]];
+			if (!test(node.aabb))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				func(node.user_data, node.aabb);
+			}
+			else
+			{
+				assert(stack_num + 2 <= MAX_QUERY_STACK && "query stack overflow. DynamicAABBTree::Query()");
+				stack[stack_num++] = node.child1;
+				stack[stack_num++] = node.child2;
+			}
+		}
+	}
+
+}// namespace TKGEngine
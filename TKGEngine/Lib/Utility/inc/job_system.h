@@ -0,0 +1,213 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cassert>
+
+namespace TKGEngine
+{
+	/// <summary>
+	/// Wů҂ɎgJE^
+	/// </summary>
+	struct JobCounter
+	{
+		// ̃Wu
+		std::atomic<int> count = 0;
+
+		bool IsDone() const
+		{
+			return count.load(std::memory_order_acquire) == 0;
+		}
+	};
+
+
+	// ===========================================
+	//
+	// GWŜŋLWuVXe
+	// [J[Ƃlock-freedequework stealingŕׂ𕪎U
+	//
+	// ===========================================
+	class JobSystem
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		// [J[XbhN(ĂяoXbhCXbhɂȂ)
+		// thread_num <= 0 ̂Ƃ͘_RA - 1 N
+		static void Initialize(int thread_num = 0);
+		// SẴ[J[Xbhjoin
+		static void Terminate();
+
+		// CXbh܂߂WusXbh
+		static int GetThreadNum();
+
+		// funcWuƂĒǉ
+		template<class F>
+		static void Run(JobCounter& counter, F&& func);
+		// [0, count)batch_sizeɕ func(begin, end) WuƂĒǉ
+		template<class F>
+		static void ParallelFor(JobCounter& counter, int count, int batch_size, F&& func);
+
+		// counter0ɂȂ܂ŁÃWusȂҋ@
+		// ҋ@͖֌WȃWũXbhŎŝŁA
+		// WuŎ擾mutexbN܂܌Ă΂Ȃ
+		static void Wait(JobCounter& counter);
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		/* nothing */
+
+
+	private:
+		// ==============================================
+		// private struct
+		// ==============================================
+		// Wuɕێł֐IuWFNg̍őTCY
+		static constexpr size_t JOB_STORAGE_SIZE = 112;
+		// 1XbhɕێłWu̍ő吔(2ׂ̂)
+		// gp̃WuŖ܂ĂƂ̓L[ɐς܂ɂ̏Ŏs
+		static constexpr std::uint32_t MAX_JOB_NUM = 4096;
+		static constexpr std::uint32_t JOB_INDEX_MASK = MAX_JOB_NUM - 1;
+
+		/// <summary>
+		/// ֐IuWFNgq[vmۂɕێWu
+		/// </summary>
+		struct alignas(64) Job
+		{
+			void(*invoke)(Job*) = nullptr;
+			JobCounter* counter = nullptr;
+			// L[ɐς܂ĂsI܂true
+			std::atomic<bool> is_used = false;
+			alignas(16) unsigned char storage[JOB_STORAGE_SIZE];
+		};
+
+		/// <summary>
+		/// Chase-Lev work stealing deque
+		/// LXbĥ݂Push/PopÃXbhSteal
+		/// </summary>
+		class WorkStealingQueue
+		{
+		public:
+			// tȂς܂falseԂ
+			bool Push(Job* job);
+			Job* Pop();
+			Job* Steal();
+
+		private:
+			std::atomic<std::int64_t> m_top = 0;
+			std::atomic<std::int64_t> m_bottom = 0;
+			std::atomic<Job*> m_jobs[MAX_JOB_NUM] = {};
+		};
+
+		/// <summary>
+		/// XbhƂ̃Wumۗ̈ƃL[
+		/// </summary>
+		struct Worker
+		{
+			WorkStealingQueue queue;
+			std::unique_ptr<Job[]> job_ring;
+			std::uint32_t allocated_num = 0;
+		};
+
+
+		// ==============================================
+		// private methods
+		// ==============================================
+		// 󂫂nullptrԂ
+		static Job* AllocateJob();
+		static void Submit(Job* job);
+		static Job* GetJob();
+		static void Execute(Job* job);
+		static void WorkerLoop(int index);
+
+
+		// ==============================================
+		// private variables
+		// ==============================================
+		// ҋ@ɓOɃWuT
+		static constexpr int SPIN_COUNT_BEFORE_SLEEP = 64;
+
+		// [0]CXbhA[1 ~][J[Xbh
+		static std::vector<std::unique_ptr<Worker>> m_workers;
+		static std::vector<std::thread> m_threads;
+		static bool m_is_initialized;
+		static std::atomic<bool> m_is_stop;
+
+		// L[ɐς܂ĂāA܂oĂȂWu
+		static std::atomic<int> m_pending_job_num;
+		// ҋ@̃[J[
+		static std::atomic<int> m_sleeping_num;
+		static std::mutex m_sleep_mutex;
+		static std::condition_variable m_sleep_cv;
+
+		// sXbh̃[J[ԍ(WuVXeÕXbh-1)
+		static thread_local int t_worker_index;
+	};
+
+
+	////////////////////////////////////////////////////////
+	// Template Methods
+	////////////////////////////////////////////////////////
+	template<class F>
+	inline void JobSystem::Run(JobCounter& counter, F&& func)
+	{
+		using Func = std::decay_t<F>;
+		static_assert(sizeof(Func) <= JOB_STORAGE_SIZE, "Job function object is too large. JobSystem::Run()");
+		static_assert(alignof(Func) <= 16, "Job function object alignment is too large. JobSystem::Run()");
+
+		// WuVXeÕXbhNO͂̏Ŏs
+		if (!m_is_initialized || t_worker_index < 0)
+		{
+			func();
+			return;
+		}
+
+		// Oobt@gp̃WuŖ܂Ă炻̏Ŏs
+		Job* job = AllocateJob();
+		if (!job)
+		{
+			func();
+			return;
+		}
+		new (job->storage) Func(std::forward<F>(func));
+		job->invoke = [](Job* p_job)
+		{
+			Func* f = std::launder(reinterpret_cast<Func*>(p_job->storage));
+			(*f)();
+			f->~Func();
+		};
+		job->counter = &counter;
+		counter.count.fetch_add(1, std::memory_order_relaxed);
+		Submit(job);
+	}
+
+	template<class F>
+	inline void JobSystem::ParallelFor(JobCounter& counter, int count, int batch_size, F&& func)
+	{
+		using Func = std::decay_t<F>;
+
+		if (count <= 0)
+			return;
+		batch_size = batch_size > 0 ? batch_size : 1;
+
+		for (int begin = 0; begin < count; begin += batch_size)
+		{
+			const int end = (begin + batch_size < count) ? begin + batch_size : count;
+			// ֐IuWFNg̓ob`ƂɃRs[ĕێ
+			Run(counter, [func = Func(func), begin, end]() { func(begin, end); });
+		}
+	}
+
+}// namespace TKGEngine
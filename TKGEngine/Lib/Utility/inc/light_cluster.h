@@ -0,0 +1,154 @@
+#pragma once
+
+#include "myfunc_vector.h"
+#include "job_system.h"
+#include "Application/Resource/inc/Shader_Defined.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace TKGEngine
+{
+	/// <summary>
+	/// NX^[Ɋ蓖Ă郉Cǧ`([h)
+	/// </summary>
+	struct ClusterLightShape
+	{
+		VECTOR3 position = VECTOR3::Zero;
+		float range = 0.0f;
+		// X|bgCǧ(Kς)
+		VECTOR3 direction = VECTOR3::Forward;
+		// X|bgCg̊O~cos(/2)A|CgCg-1
+		float cone_cos = -1.0f;
+	};
+
+	/// <summary>
+	/// NX^[Ƃ̃CgCfbNXXg͈̔
+	/// </summary>
+	struct ClusterRange
+	{
+		std::uint32_t offset = 0;
+		std::uint32_t count = 0;
+	};
+
+
+	// ===========================================
+	//
+	// r[Ԃ̎XỸ^CƎw[xŋ؂(froxel)A
+	// Cg̋EƃX|bgCg̉~dȂNX^[ƂɃCgCfbNX蓖Ă
+	// [xXCXƂɃWuɕ̂ŁAXCXԂŏݐ͋LȂ
+	//
+	// ===========================================
+	class LightCluster
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		LightCluster() = default;
+		virtual ~LightCluster() = default;
+		LightCluster(const LightCluster&) = delete;
+		LightCluster& operator=(const LightCluster&) = delete;
+
+		/// <summary>
+		/// NX^[쐬ăCg蓖Ă
+		/// </summary>
+		/// <param name="view">[hԂr[Ԃւ̍s</param>
+		/// <param name="projection">vWFNVs(Reversed-Z̗L͖Ȃ)</param>
+		/// <param name="near_plane">ߕʂ܂ł̋</param>
+		/// <param name="far_plane">ʂ܂ł̋</param>
+		/// <param name="lights">蓖Ă郉CgAXg̃CfbNXo͂</param>
+		void Build(const MATRIX& view, const MATRIX& projection, float near_plane, float far_plane, const std::vector<ClusterLightShape>& lights);
+
+		// NX^[CfbNX(x + y * CLUSTER_NUM_X + z * CLUSTER_NUM_X * CLUSTER_NUM_Y)Ƃ͈̔
+		const std::vector<ClusterRange>& GetClusterRanges() const;
+		// SNX^[̃CgCfbNXl߂Xg
+		const std::vector<std::uint32_t>& GetLightIndices() const;
+
+		// VF[_[Ő[xXCX߂W slice = log(depth) * scale + bias
+		float GetDepthSliceScale() const;
+		float GetDepthSliceBias() const;
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		static constexpr int SIMD_WIDTH = 4;
+
+
+	private:
+		// ==============================================
+		// private struct
+		// ==============================================
+		/// <summary>
+		/// [xXCXƂ̍Ɨ̈(t[ׂŗeʂėp)
+		/// </summary>
+		struct SliceWork
+		{
+			// XCXƏdȂ郉Cg̋E(vfƂ̔zASIMD_WIDTH̔{ɐ؂グ)
+			std::vector<float> center_x;
+			std::vector<float> center_y;
+			std::vector<float> center_z;
+			std::vector<float> radius_sq;
+			std::vector<std::uint32_t> light_index;
+			// XCX̃NX^[Ƃ͈̔(offset̓XCX̃CfbNX)
+			ClusterRange ranges[CLUSTER_NUM_X * CLUSTER_NUM_Y];
+			std::vector<std::uint32_t> indices;
+		};
+
+		/// <summary>
+		/// r[([xɂȂ)ɕϊCǧ`
+		/// </summary>
+		struct ViewLight
+		{
+			VECTOR3 center;
+			float radius;
+			VECTOR3 position;
+			float range;
+			VECTOR3 direction;
+			float cone_cos;
+			float cone_sin;
+		};
+
+
+		// ==============================================
+		// private methods
+		// ==============================================
+		// vWFNVs񂪕ςƂNX^[AABB蒼
+		void UpdateClusterBounds(const MATRIX& projection, float near_plane, float far_plane);
+		// Cgr[Ԃ̋Eɕϊ
+		void TransformLights(const MATRIX& view, const std::vector<ClusterLightShape>& lights);
+		// [begin, end)̃XCXɃCg蓖Ă
+		void AssignSlices(int begin, int end);
+		// XCXƂ̌ʂ1̃Xgɋl߂
+		void GatherSlices();
+
+
+		// ==============================================
+		// private variables
+		// ==============================================
+		// NX^[AABB(r[ԁA[xɂȂ)
+		VECTOR3 m_cluster_min[CLUSTER_NUM];
+		VECTOR3 m_cluster_max[CLUSTER_NUM];
+		// XCX̐[x͈
+		float m_slice_depth[CLUSTER_NUM_Z + 1] = {};
+
+		// NX^[쐬Ƃ̃p[^
+		MATRIX m_cached_projection = MATRIX::Identity;
+		float m_cached_near = -1.0f;
+		float m_cached_far = -1.0f;
+
+		float m_depth_slice_scale = 0.0f;
+		float m_depth_slice_bias = 0.0f;
+
+		std::vector<ViewLight> m_view_lights;
+		SliceWork m_slice_works[CLUSTER_NUM_Z];
+
+		// o
+		std::vector<ClusterRange> m_cluster_ranges;
+		std::vector<std::uint32_t> m_light_indices;
+
+		JobCounter m_job_counter;
+	};
+
+}// namespace TKGEngine
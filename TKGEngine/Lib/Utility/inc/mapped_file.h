@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+namespace TKGEngine
+{
+	// ===========================================
+	//
+	// ǂݍݐpŃt@CɃ}bv
+	// }bv̈ClosefXgN^ŉ
+	//
+	// ===========================================
+	class MappedFile
+	{
+	public:
+		// ==============================================
+		// public methods
+		// ==============================================
+		MappedFile() = default;
+		virtual ~MappedFile();
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool Open(const std::string& filepath);
+		void Close();
+
+		bool IsOpen() const;
+		// 擪AhX(y[WEɃACĂ)
+		const void* GetData() const;
+		size_t GetSize() const;
+
+
+		// ==============================================
+		// public variables
+		// ==============================================
+		/* nothing */
+
+
+	private:
+		// ==============================================
+		// private variables
+		// ==============================================
+		void* m_file_handle = nullptr;
+		void* m_mapping_handle = nullptr;
+		const void* m_data = nullptr;
+		size_t m_size = 0;
+	};
+
+
+	////////////////////////////////////////////////////////
+	// Inline Methods
+	////////////////////////////////////////////////////////
+	inline bool MappedFile::IsOpen() const
+	{
+		return m_data != nullptr;
+	}
+
+	inline const void* MappedFile::GetData() const
+	{
+		return m_data;
+	}
+
+	inline size_t MappedFile::GetSize() const
+	{
+		return m_size;
+	}
+
+}// namespace TKGEngine
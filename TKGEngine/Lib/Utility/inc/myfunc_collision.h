@@ -3,6 +3,9 @@
 #include "bounds.h"
 #include "Frustum.h"
 
+#include <vector>
+#include <cstdint>
+
 namespace TKGEngine::MyFunc
 {
 	// =============================================================
@@ -15,4 +18,31 @@ namespace TKGEngine::MyFunc
 	bool SweepIntersectionTest(const Bounds& object_aabb, const VECTOR3(&frustum_points)[8], const VECTOR3& sweep_dir);
 
 
+	// =============================================================
+	// JO
+	// =============================================================
+	/// <summary>
+	/// ꊇJOpAABB̒SƔavfƂ̔zŕێ
+	/// vfSIMD̕(4)̔{ɐ؂グĊmۂ
+	/// </summary>
+	struct PackedBounds
+	{
+		static constexpr int SIMD_WIDTH = 4;
+
+		std::vector<float> center_x;
+		std::vector<float> center_y;
+		std::vector<float> center_z;
+		std::vector<float> extents_x;
+		std::vector<float> extents_y;
+		std::vector<float> extents_z;
+
+		void Resize(int count);
+		void Set(int index, const Bounds& bounds);
+	};
+
+	// [begin, end)AABB6ʂ4肵AȂ1AȂ0resultsɏ
+	// beginSIMD_WIDTH̔{ł邱
+	void FrustumCulling(const Frustum& frustum, const PackedBounds& bounds, int begin, int end, std::uint8_t* results);
+
+
 }
\ No newline at end of file
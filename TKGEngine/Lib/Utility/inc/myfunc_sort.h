@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+namespace TKGEngine::MyFunc
+{
+	// =============================================================
+	// \[g
+	// =============================================================
+	/// <summary>
+	/// 64bit̃\[gL[ƌ̃Xg̃CfbNX̑g
+	/// </summary>
+	struct SortKey
+	{
+		std::uint64_t key;
+		int index;
+	};
+
+	/// <summary>
+	/// key̏ňLSD\[gs(8bit8pXASvf̃pX͔΂)
+	/// </summary>
+	/// <param name="keys">\[gL[</param>
+	/// <param name="work">Ɨpobt@(countȏ̗vf)</param>
+	/// <param name="count">vf</param>
+	/// <returns>\[gς݂̔z(keyswork̂ǂ炩)</returns>
+	SortKey* RadixSort(SortKey* keys, SortKey* work, int count);
+
+
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Systems/inc/TKGEngine_Defined.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace TKGEngine
+{
+	/// <summary>
+	/// InstanceIDL[ɂ}bv
+	/// ID̃XbgԍYɂaz񂩂Avfl߂Ďz
+	/// ̓nbVg킸O(1)ŁAオvȂÂID͌ȂɂȂ
+	/// </summary>
+	template <typename Ty>
+	class HandleMap
+	{
+	public:
+		HandleMap() = default;
+		~HandleMap() = default;
+		HandleMap(const HandleMap&) = delete;
+		HandleMap& operator=(const HandleMap&) = delete;
+
+		/// <summary>
+		/// Ȃnullptr
+		/// </summary>
+		Ty* Find(const InstanceID id)
+		{
+			const std::uint32_t dense = GetDenseIndex(id);
+			return dense == INVALID_INDEX ? nullptr : &m_dense_values[dense];
+		}
+		const Ty* Find(const InstanceID id) const
+		{
+			const std::uint32_t dense = GetDenseIndex(id);
+			return dense == INVALID_INDEX ? nullptr : &m_dense_values[dense];
+		}
+		bool Contains(const InstanceID id) const
+		{
+			return GetDenseIndex(id) != INVALID_INDEX;
+		}
+
+		/// <summary>
+		/// XbgɌÂIDcĂΏ㏑
+		/// IDɑ݂false
+		/// </summary>
+		bool Emplace(const InstanceID id, const Ty& value)
+		{
+			const std::uint32_t slot = GetInstanceIDIndex(id);
+			if (slot >= m_sparse.size())
+			{
+				m_sparse.resize(static_cast<size_t>(slot) + 1, INVALID_INDEX);
+			}
+			std::uint32_t& dense = m_sparse[slot];
+			if (dense != INVALID_INDEX)
+			{
+				if (m_dense_keys[dense] == id)
+					return false;
+				m_dense_keys[dense] = id;
+				m_dense_values[dense] = value;
+				return true;
+			}
+			dense = static_cast<std::uint32_t>(m_dense_values.size());
+			m_dense_keys.emplace_back(id);
+			m_dense_values.emplace_back(value);
+			return true;
+		}
+
+		/// <summary>
+		/// ̗vf폜ʒuɈړċl߂
+		/// </summary>
+		bool Erase(const InstanceID id)
+		{
+			const std::uint32_t dense = GetDenseIndex(id);
+			if (dense == INVALID_INDEX)
+				return false;
+
+			const std::uint32_t last = static_cast<std::uint32_t>(m_dense_values.size()) - 1;
+			if (dense != last)
+			{
+				const InstanceID last_id = m_dense_keys[last];
+				m_dense_keys[dense] = last_id;
+				m_dense_values[dense] = std::move(m_dense_values[last]);
+				m_sparse[GetInstanceIDIndex(last_id)] = dense;
+			}
+			m_dense_keys.pop_back();
+			m_dense_values.pop_back();
+			m_sparse[GetInstanceIDIndex(id)] = INVALID_INDEX;
+			return true;
+		}
+
+		void Clear()
+		{
+			m_sparse.clear();
+			m_dense_keys.clear();
+			m_dense_values.clear();
+		}
+
+		int Size() const
+		{
+			return static_cast<int>(m_dense_values.size());
+		}
+		InstanceID GetKey(const int dense_index) const
+		{
+			return m_dense_keys[dense_index];
+		}
+		Ty& GetValue(const int dense_index)
+		{
+			return m_dense_values[dense_index];
+		}
+		const Ty& GetValue(const int dense_index) const
+		{
+			return m_dense_values[dense_index];
+		}
+
+		// z̏ɒl𑖍
+		typename std::vector<Ty>::iterator begin() { return m_dense_values.begin(); }
+		typename std::vector<Ty>::iterator end() { return m_dense_values.end(); }
+		typename std::vector<Ty>::const_iterator begin() const { return m_dense_values.begin(); }
+		typename std::vector<Ty>::const_iterator end() const { return m_dense_values.end(); }
+
+	private:
+		static constexpr std::uint32_t INVALID_INDEX = 0xffffffff;
+
+		std::uint32_t GetDenseIndex(const InstanceID id) const
+		{
+			const std::uint32_t slot = GetInstanceIDIndex(id);
+			if (slot >= m_sparse.size())
+				return INVALID_INDEX;
+			const std::uint32_t dense = m_sparse[slot];
+			// オႦΕʂ̃IuWFNg
+			if (dense == INVALID_INDEX || m_dense_keys[dense] != id)
+				return INVALID_INDEX;
+			return dense;
+		}
+
+		// Xbgԍ疧z̓Y
+		std::vector<std::uint32_t> m_sparse;
+		std::vector<InstanceID> m_dense_keys;
+		std::vector<Ty> m_dense_values;
+	};
+
+}// namespace TKGEngine
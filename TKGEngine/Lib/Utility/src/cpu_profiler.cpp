@@ -0,0 +1,332 @@
+#include "../inc/cpu_profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace TKGEngine
+{
+	////////////////////////////////////////////////////////
+	// Static member definition
+	////////////////////////////////////////////////////////
+	std::atomic<bool> CPUProfiler::m_is_enabled = false;
+
+	std::vector<std::unique_ptr<CPUProfiler::ThreadBuffer>> CPUProfiler::m_thread_buffers;
+	std::mutex CPUProfiler::m_buffer_mutex;
+	thread_local CPUProfiler::ThreadBuffer* CPUProfiler::t_thread_buffer = nullptr;
+
+	std::int64_t CPUProfiler::m_frame_begin = 0;
+	std::unordered_map<std::string_view, CPUProfiler::ZoneStat> CPUProfiler::m_stat_map;
+	std::vector<CPUProfiler::ZoneStat> CPUProfiler::m_frame_stats;
+	std::uint64_t CPUProfiler::m_dropped_zone_num = 0;
+
+	bool CPUProfiler::m_is_capturing = false;
+	std::int64_t CPUProfiler::m_capture_begin = 0;
+	std::vector<CPUProfiler::CapturedZone> CPUProfiler::m_captured_zones;
+
+
+	////////////////////////////////////////////////////////
+	// Local Methods
+	////////////////////////////////////////////////////////
+	// JSONƂăGXP[vďo
+	static void WriteJsonString(std::FILE* fp, const char* str)
+	{
+		std::fputc('"', fp);
+		for (const char* c = str; c && *c; ++c)
+		{
+			switch (*c)
+			{
+				case '"':
+					std::fputs("\\\"", fp);
+					break;
+				case '\\':
+					std::fputs("\\\\", fp);
+					break;
+				case '\n':
+					std::fputs("\\n", fp);
+					break;
+				case '\t':
+					std::fputs("\\t", fp);
+					break;
+				default:
+					if (static_cast<unsigned char>(*c) < 0x20)
+					{
+						std::fprintf(fp, "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(*c)));
+					}
+					else
+					{
+						std::fputc(*c, fp);
+					}
+					break;
+			}
+		}
+		std::fputc('"', fp);
+	}
+
+
+	////////////////////////////////////////////////////////
+	// Class Methods
+	////////////////////////////////////////////////////////
+	void CPUProfiler::SetEnable(const bool enable)
+	{
+		m_is_enabled.store(enable, std::memory_order_relaxed);
+	}
+
+	bool CPUProfiler::IsEnabled()
+	{
+		return m_is_enabled.load(std::memory_order_relaxed);
+	}
+
+	void CPUProfiler::SetThreadName(const char* name)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> lock(m_buffer_mutex);
+		strncpy_s(buffer->thread_name, name, _TRUNCATE);
+	}
+
+	void CPUProfiler::BeginFrame()
+	{
+		m_frame_begin = IsEnabled() ? Now() : 0;
+	}
+
+	void CPUProfiler::EndFrame()
+	{
+		// t[ŜCXbh̃][ƂċL^
+		if (m_frame_begin != 0)
+		{
+			ThreadBuffer* buffer = GetThreadBuffer();
+			PushZone(buffer);
+			PopZone(buffer, "Frame", m_frame_begin, Now());
+			m_frame_begin = 0;
+		}
+
+		// eXbh̃obt@ďWv
+		m_stat_map.clear();
+		{
+			std::lock_guard<std::mutex> lock(m_buffer_mutex);
+			for (auto& buffer : m_thread_buffers)
+			{
+				DrainBuffer(*buffer);
+			}
+		}
+
+		m_frame_stats.clear();
+		m_frame_stats.reserve(m_stat_map.size());
+		for (const auto& stat : m_stat_map)
+		{
+			m_frame_stats.emplace_back(stat.second);
+		}
+		std::sort(m_frame_stats.begin(), m_frame_stats.end(),
+			[](const ZoneStat& a, const ZoneStat& b)
+			{
+				return a.total_ms > b.total_ms;
+			});
+	}
+
+	void CPUProfiler::StartCapture()
+	{
+		m_captured_zones.clear();
+		m_capture_begin = Now();
+		m_is_capturing = true;
+	}
+
+	void CPUProfiler::StopCapture()
+	{
+		m_is_capturing = false;
+	}
+
+	bool CPUProfiler::IsCapturing()
+	{
+		return m_is_capturing;
+	}
+
+	bool CPUProfiler::ExportChromeTrace(const std::string& filepath)
+	{
+		std::FILE* fp = nullptr;
+		if (fopen_s(&fp, filepath.c_str(), "w") != 0 || !fp)
+		{
+			return false;
+		}
+
+		std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", fp);
+		bool is_first = true;
+		// Xbh̃^f[^
+		{
+			std::lock_guard<std::mutex> lock(m_buffer_mutex);
+			for (const auto& buffer : m_thread_buffers)
+			{
+				const char* name = buffer->thread_name;
+				if (name[0] == '\0')
+					continue;
+				std::fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+					is_first ? "" : ",\n", buffer->thread_index);
+				WriteJsonString(fp, name);
+				std::fputs("}}", fp);
+				is_first = false;
+			}
+		}
+		// ][͊Cxg(ph:X)Ƃďo
+		for (const auto& captured : m_captured_zones)
+		{
+			const ZoneEvent& zone = captured.zone;
+			std::fputs(is_first ? "{\"name\":" : ",\n{\"name\":", fp);
+			WriteJsonString(fp, zone.name);
+			std::fprintf(fp, ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%u}}",
+				captured.thread_index,
+				ToMicroseconds(zone.begin - m_capture_begin),
+				ToMicroseconds(zone.end - zone.begin),
+				zone.depth);
+			is_first = false;
+		}
+		std::fputs("\n]}\n", fp);
+
+		const bool succeeded = std::ferror(fp) == 0;
+		std::fclose(fp);
+		return succeeded;
+	}
+
+	const std::vector<CPUProfiler::ZoneStat>& CPUProfiler::GetFrameStats()
+	{
+		return m_frame_stats;
+	}
+
+	std::uint64_t CPUProfiler::GetDroppedZoneNum()
+	{
+		return m_dropped_zone_num;
+	}
+
+	void CPUProfiler::DrainBuffer(ThreadBuffer& buffer)
+	{
+		const std::uint64_t write_count = buffer.write_count.load(std::memory_order_acquire);
+		// ǂzꂽ͎Ă
+		// write_count̗vf͏LXbhݒ̉\Aʒuwwrite_count - RING_BUFFER_SIZEǂ߂Ȃ
+		std::uint64_t begin = buffer.read_count;
+		if (write_count - begin >= RING_BUFFER_SIZE)
+		{
+			const std::uint64_t oldest = write_count - RING_BUFFER_SIZE + 1;
+			m_dropped_zone_num += oldest - begin;
+			begin = oldest;
+		}
+
+		for (std::uint64_t i = begin; i < write_count; ++i)
+		{
+			const ZoneEvent zone = buffer.zones[i & RING_BUFFER_MASK];
+			// Rs[̓ǂݍ݂write_count̍ēǂݍ݂OɊ(seqlock̓ǂݍݑ)
+			std::atomic_thread_fence(std::memory_order_acquire);
+			// Rs[ɏLXbhvfĂ̂Ă
+			const std::uint64_t latest_count = buffer.write_count.load(std::memory_order_relaxed);
+			if (latest_count - i >= RING_BUFFER_SIZE)
+			{
+				++m_dropped_zone_num;
+				continue;
+			}
+
+			// Wv
+			const double elapsed_ms = ToMilliseconds(zone.end - zone.begin);
+			ZoneStat& stat = m_stat_map[zone.name];
+			stat.name = zone.name;
+			stat.total_ms += elapsed_ms;
+			stat.max_ms = (std::max)(stat.max_ms, elapsed_ms);
+			++stat.call_count;
+
+			// Lv`
+			if (m_is_capturing && zone.begin >= m_capture_begin)
+			{
+				if (m_captured_zones.size() < MAX_CAPTURE_ZONE_NUM)
+				{
+					m_captured_zones.push_back({ zone, buffer.thread_index });
+				}
+				else
+				{
+					++m_dropped_zone_num;
+				}
+			}
+		}
+		buffer.read_count = write_count;
+	}
+
+	double CPUProfiler::ToMilliseconds(const std::int64_t ticks)
+	{
+		using period = std::chrono::steady_clock::period;
+		return static_cast<double>(ticks) * 1000.0 * period::num / period::den;
+	}
+
+	double CPUProfiler::ToMicroseconds(const std::int64_t ticks)
+	{
+		using period = std::chrono::steady_clock::period;
+		return static_cast<double>(ticks) * 1000000.0 * period::num / period::den;
+	}
+
+#ifdef USE_IMGUI
+	void CPUProfiler::OnGUI()
+	{
+		// Lv`̏o
+		constexpr const char* TRACE_FILEPATH = "./cpu_trace.json";
+		static bool is_exported = false;
+		static bool export_succeeded = false;
+
+		ImGui::SetNextWindowSize(ImVec2(320.0f, 240.0f), ImGuiCond_FirstUseEver);
+		if (ImGui::Begin("CPU Profiler"))
+		{
+			bool is_enabled = IsEnabled();
+			if (ImGui::Checkbox("Enable", &is_enabled))
+			{
+				SetEnable(is_enabled);
+			}
+			ImGui::SameLine();
+			if (!m_is_capturing)
+			{
+				if (ImGui::Button("Start Capture"))
+				{
+					StartCapture();
+					is_exported = false;
+				}
+			}
+			else
+			{
+				if (ImGui::Button("Stop & Export"))
+				{
+					StopCapture();
+					export_succeeded = ExportChromeTrace(TRACE_FILEPATH);
+					is_exported = true;
+				}
+				ImGui::SameLine();
+				ImGui::Text("%d zones", static_cast<int>(m_captured_zones.size()));
+			}
+			if (is_exported)
+			{
+				ImGui::Text(export_succeeded ? "Exported : %s" : "Failed to export : %s", TRACE_FILEPATH);
+			}
+			if (m_dropped_zone_num > 0)
+			{
+				ImGui::Text("Dropped : %llu", static_cast<unsigned long long>(m_dropped_zone_num));
+			}
+
+			// Õt[̏Wv
+			if (ImGui::BeginTable("##CPU Zone Stats", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable))
+			{
+				ImGui::TableSetupColumn("Zone");
+				ImGui::TableSetupColumn("Total(ms)");
+				ImGui::TableSetupColumn("Max(ms)");
+				ImGui::TableSetupColumn("Count");
+				ImGui::TableHeadersRow();
+				for (const auto& stat : m_frame_stats)
+				{
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(stat.name);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.3f", stat.total_ms);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.3f", stat.max_ms);
+					ImGui::TableNextColumn();
+					ImGui::Text("%d", stat.call_count);
+				}
+				ImGui::EndTable();
+			}
+		}
+		ImGui::End();
+	}
+#endif// #ifdef USE_IMGUI
+
+}// namespace TKGEngine
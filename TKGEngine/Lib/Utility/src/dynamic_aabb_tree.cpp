@@ -0,0 +1,429 @@
+
+#include "../inc/dynamic_aabb_tree.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace TKGEngine
+{
+	////////////////////////////////////////////////////////
+	// Local Methods
+	////////////////////////////////////////////////////////
+	// fat AABB̊g(aɑ΂銄ƌŒl)
+	static constexpr float AABB_EXTENSION_RATE = 0.1f;
+	static constexpr float AABB_EXTENSION = 0.1f;
+
+	inline Bounds MergeAABB(const Bounds& a, const Bounds& b)
+	{
+		Bounds ret = a;
+		ret.Union(b);
+		return ret;
+	}
+
+	// }RXgɎgp\ʐ(萔{͏ȗ)
+	inline float AreaAABB(const Bounds& aabb)
+	{
+		const VECTOR3 e = aabb.GetExtents();
+		return e.x * e.y + e.y * e.z + e.z * e.x;
+	}
+
+	inline bool ContainsAABB(const Bounds& outer, const Bounds& inner)
+	{
+		const VECTOR3 outer_c = outer.GetCenter();
+		const VECTOR3 outer_e = outer.GetExtents();
+		const VECTOR3 inner_c = inner.GetCenter();
+		const VECTOR3 inner_e = inner.GetExtents();
+		return
+			outer_c.x - outer_e.x <= inner_c.x - inner_e.x && inner_c.x + inner_e.x <= outer_c.x + outer_e.x &&
+			outer_c.y - outer_e.y <= inner_c.y - inner_e.y && inner_c.y + inner_e.y <= outer_c.y + outer_e.y &&
+			outer_c.z - outer_e.z <= inner_c.z - inner_e.z && inner_c.z + inner_e.z <= outer_c.z + outer_e.z;
+	}
+
+	// SƑ傫狁߂E̊ۂߌ덷eܔ
+	inline bool NearlyContainsAABB(const Bounds& outer, const Bounds& inner)
+	{
+		const VECTOR3 outer_c = outer.GetCenter();
+		const VECTOR3 outer_e = outer.GetExtents();
+		const VECTOR3 inner_c = inner.GetCenter();
+		const VECTOR3 inner_e = inner.GetExtents();
+		const float tolerance = 1.0e-4f * (1.0f + (std::max)({ std::abs(outer_c.x), std::abs(outer_c.y), std::abs(outer_c.z), outer_e.x, outer_e.y, outer_e.z }));
+		return
+			outer_c.x - outer_e.x <= inner_c.x - inner_e.x + tolerance && inner_c.x + inner_e.x <= outer_c.x + outer_e.x + tolerance &&
+			outer_c.y - outer_e.y <= inner_c.y - inner_e.y + tolerance && inner_c.y + inner_e.y <= outer_c.y + outer_e.y + tolerance &&
+			outer_c.z - outer_e.z <= inner_c.z - inner_e.z + tolerance && inner_c.z + inner_e.z <= outer_c.z + outer_e.z + tolerance;
+	}
+
+	inline Bounds FattenAABB(const Bounds& aabb)
+	{
+		const VECTOR3 extents = aabb.GetExtents();
+		return Bounds(aabb.GetCenter(), extents + extents * AABB_EXTENSION_RATE + VECTOR3(AABB_EXTENSION, AABB_EXTENSION, AABB_EXTENSION));
+	}
+
+
+	////////////////////////////////////////////////////////
+	// Class Methods
+	////////////////////////////////////////////////////////
+	int DynamicAABBTree::CreateProxy(const Bounds& aabb, const int user_data)
+	{
+		const int proxy_id = AllocateNode();
+		Node& node = m_nodes[proxy_id];
+		node.aabb = FattenAABB(aabb);
+		node.user_data = user_data;
+		node.height = 0;
+
+		InsertLeaf(proxy_id);
+		++m_proxy_count;
+		return proxy_id;
+	}
+
+	void DynamicAABBTree::DestroyProxy(const int proxy_id)
+	{
+		assert(0 <= proxy_id && proxy_id < static_cast<int>(m_nodes.size()));
+		assert(m_nodes[proxy_id].IsLeaf());
+
+		RemoveLeaf(proxy_id);
+		FreeNode(proxy_id);
+		--m_proxy_count;
+	}
+
+	bool DynamicAABBTree::MoveProxy(const int proxy_id, const Bounds& aabb)
+	{
+		assert(0 <= proxy_id && proxy_id < static_cast<int>(m_nodes.size()));
+		assert(m_nodes[proxy_id].IsLeaf());
+
+		// fat AABBɎ܂ĂΖ؂͕ύXȂ
+		if (ContainsAABB(m_nodes[proxy_id].aabb, aabb))
+			return false;
+
+		RemoveLeaf(proxy_id);
+		m_nodes[proxy_id].aabb = FattenAABB(aabb);
+		InsertLeaf(proxy_id);
+		return true;
+	}
+
+	void DynamicAABBTree::Clear()
+	{
+		m_nodes.clear();
+		m_root = NULL_NODE;
+		m_free_list = NULL_NODE;
+		m_proxy_count = 0;
+	}
+
+	bool DynamicAABBTree::Validate() const
+	{
+		int leaf_count = 0;
+		if (m_root != NULL_NODE && !ValidateNode(m_root, NULL_NODE, leaf_count))
+			return false;
+		if (leaf_count != m_proxy_count)
+			return false;
+
+		// ؂Ɋ܂܂m[h(tƓm[h2 * t - 1)Ƌ󂫃XgőSm[hɂȂ
+		int free_count = 0;
+		for (int index = m_free_list; index != NULL_NODE; index = m_nodes[index].parent)
+		{
+			if (index < 0 || index >= static_cast<int>(m_nodes.size()) || m_nodes[index].height != -1)
+				return false;
+			if (++free_count > static_cast<int>(m_nodes.size()))
+				return false;
+		}
+		const int tree_count = leaf_count > 0 ? 2 * leaf_count - 1 : 0;
+		return tree_count + free_count == static_cast<int>(m_nodes.size());
+	}
+
+	int DynamicAABBTree::AllocateNode()
+	{
+		if (m_free_list == NULL_NODE)
+		{
+			m_nodes.emplace_back();
+			return static_cast<int>(m_nodes.size()) - 1;
+		}
+
+		const int node_id = m_free_list;
+		Node& node = m_nodes[node_id];
+		m_free_list = node.parent;
+		node.parent = NULL_NODE;
+		node.child1 = NULL_NODE;
+		node.child2 = NULL_NODE;
+		node.height = 0;
+		node.user_data = -1;
+		return node_id;
+	}
+
+	void DynamicAABBTree::FreeNode(const int node_id)
+	{
+		Node& node = m_nodes[node_id];
+		node.parent = m_free_list;
+		node.child1 = NULL_NODE;
+		node.child2 = NULL_NODE;
+		node.height = -1;
+		m_free_list = node_id;
+	}
+
+	void DynamicAABBTree::InsertLeaf(const int leaf)
+	{
+		if (m_root == NULL_NODE)
+		{
+			m_root = leaf;
+			m_nodes[leaf].parent = NULL_NODE;
+			return;
+		}
+
+		// \ʐς̑ŏɂȂZm[hT
+		const Bounds leaf_aabb = m_nodes[leaf].aabb;
+		int index = m_root;
+		while (!m_nodes[index].IsLeaf())
+		{
+			const Node& node = m_nodes[index];
+			const int child1 = node.child1;
+			const int child2 = node.child2;
+
+			const float area = AreaAABB(node.aabb);
+			const float combined_area = AreaAABB(MergeAABB(node.aabb, leaf_aabb));
+			// ̃m[hƌZɂꍇ̃RXg
+			const float cost = 2.0f * combined_area;
+			// qɍ~ꍇɑc悪傫Ȃ镪̃RXg
+			const float inheritance_cost = 2.0f * (combined_area - area);
+
+			const auto child_cost = [this, &leaf_aabb, inheritance_cost](const int child)
+			{
+				const Node& child_node = m_nodes[child];
+				const float merged_area = AreaAABB(MergeAABB(leaf_aabb, child_node.aabb));
+				if (child_node.IsLeaf())
+					return merged_area + inheritance_cost;
+				return (merged_area - AreaAABB(child_node.aabb)) + inheritance_cost;
+			};
+			const float cost1 = child_cost(child1);
+			const float cost2 = child_cost(child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+			index = cost1 < cost2 ? child1 : child2;
+		}
+		const int sibling = index;
+
+		// Vem[h쐬(AllocateNodeŔz񂪍Ċmۂ̂ŎQƂ͌Ŏ)
+		const int old_parent = m_nodes[sibling].parent;
+		const int new_parent = AllocateNode();
+		{
+			Node& parent_node = m_nodes[new_parent];
+			parent_node.parent = old_parent;
+			parent_node.user_data = -1;
+			parent_node.aabb = MergeAABB(leaf_aabb, m_nodes[sibling].aabb);
+			parent_node.height = m_nodes[sibling].height + 1;
+			parent_node.child1 = sibling;
+			parent_node.child2 = leaf;
+		}
+		m_nodes[sibling].parent = new_parent;
+		m_nodes[leaf].parent = new_parent;
+
+		if (old_parent != NULL_NODE)
+		{
+			Node& old_parent_node = m_nodes[old_parent];
+			if (old_parent_node.child1 == sibling)
+				old_parent_node.child1 = new_parent;
+			else
+				old_parent_node.child2 = new_parent;
+		}
+		else
+		{
+			m_root = new_parent;
+		}
+
+		// ɌčAABBXV
+		index = m_nodes[leaf].parent;
+		while (index != NULL_NODE)
+		{
+			index = Balance(index);
+
+			Node& node = m_nodes[index];
+			const Node& node1 = m_nodes[node.child1];
+			const Node& node2 = m_nodes[node.child2];
+			node.height = 1 + (std::max)(node1.height, node2.height);
+			node.aabb = MergeAABB(node1.aabb, node2.aabb);
+
+			index = node.parent;
+		}
+	}
+
+	void DynamicAABBTree::RemoveLeaf(const int leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = NULL_NODE;
+			return;
+		}
+
+		const int parent = m_nodes[leaf].parent;
+		const int grand_parent = m_nodes[parent].parent;
+		const int sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+		if (grand_parent != NULL_NODE)
+		{
+			// em[h폜ČZcɌq
+			Node& grand_parent_node = m_nodes[grand_parent];
+			if (grand_parent_node.child1 == parent)
+				grand_parent_node.child1 = sibling;
+			else
+				grand_parent_node.child2 = sibling;
+			m_nodes[sibling].parent = grand_parent;
+			FreeNode(parent);
+
+			// ɌčAABBXV
+			int index = grand_parent;
+			while (index != NULL_NODE)
+			{
+				index = Balance(index);
+
+				Node& node = m_nodes[index];
+				const Node& node1 = m_nodes[node.child1];
+				const Node& node2 = m_nodes[node.child2];
+				node.aabb = MergeAABB(node1.aabb, node2.aabb);
+				node.height = 1 + (std::max)(node1.height, node2.height);
+
+				index = node.parent;
+			}
+		}
+		else
+		{
+			m_root = sibling;
+			m_nodes[sibling].parent = NULL_NODE;
+			FreeNode(parent);
+		}
+		m_nodes[leaf].parent = NULL_NODE;
+	}
+
+	int DynamicAABBTree::Balance(const int i_A)
+	{
+		Node& A = m_nodes[i_A];
+		if (A.IsLeaf() || A.height < 2)
+			return i_A;
+
+		const int i_B = A.child1;
+		const int i_C = A.child2;
+		Node& B = m_nodes[i_B];
+		Node& C = m_nodes[i_C];
+
+		const int balance = C.height - B.height;
+
+		// Cɉ]
+		if (balance > 1)
+		{
+			const int i_F = C.child1;
+			const int i_G = C.child2;
+			Node& F = m_nodes[i_F];
+			Node& G = m_nodes[i_G];
+
+			C.child1 = i_A;
+			C.parent = A.parent;
+			A.parent = i_C;
+
+			if (C.parent != NULL_NODE)
+			{
+				if (m_nodes[C.parent].child1 == i_A)
+					m_nodes[C.parent].child1 = i_C;
+				else
+					m_nodes[C.parent].child2 = i_C;
+			}
+			else
+			{
+				m_root = i_C;
+			}
+
+			if (F.height > G.height)
+			{
+				C.child2 = i_F;
+				A.child2 = i_G;
+				G.parent = i_A;
+				A.aabb = MergeAABB(B.aabb, G.aabb);
+				C.aabb = MergeAABB(A.aabb, F.aabb);
+				A.height = 1 + (std::max)(B.height, G.height);
+				C.height = 1 + (std::max)(A.height, F.height);
+			}
+			else
+			{
+				C.child2 = i_G;
+				A.child2 = i_F;
+				F.parent = i_A;
+				A.aabb = MergeAABB(B.aabb, F.aabb);
+				C.aabb = MergeAABB(A.aabb, G.aabb);
+				A.height = 1 + (std::max)(B.height, F.height);
+				C.height = 1 + (std::max)(A.height, G.height);
+			}
+			return i_C;
+		}
+
+		// Bɉ]
+		if (balance < -1)
+		{
+			const int i_D = B.child1;
+			const int i_E = B.child2;
+			Node& D = m_nodes[i_D];
+			Node& E = m_nodes[i_E];
+
+			B.child1 = i_A;
+			B.parent = A.parent;
+			A.parent = i_B;
+
+			if (B.parent != NULL_NODE)
+			{
+				if (m_nodes[B.parent].child1 == i_A)
+					m_nodes[B.parent].child1 = i_B;
+				else
+					m_nodes[B.parent].child2 = i_B;
+			}
+			else
+			{
+				m_root = i_B;
+			}
+
+			if (D.height > E.height)
+			{
+				B.child2 = i_D;
+				A.child1 = i_E;
+				E.parent = i_A;
+				A.aabb = MergeAABB(C.aabb, E.aabb);
+				B.aabb = MergeAABB(A.aabb, D.aabb);
+				A.height = 1 + (std::max)(C.height, E.height);
+				B.height = 1 + (std::max)(A.height, D.height);
+			}
+			else
+			{
+				B.child2 = i_E;
+				A.child1 = i_D;
+				D.parent = i_A;
+				A.aabb = MergeAABB(C.aabb, D.aabb);
+				B.aabb = MergeAABB(A.aabb, E.aabb);
+				A.height = 1 + (std::max)(C.height, D.height);
+				B.height = 1 + (std::max)(A.height, E.height);
+			}
+			return i_B;
+		}
+
+		return i_A;
+	}
+
+	bool DynamicAABBTree::ValidateNode(const int node_id, const int parent, int& leaf_count) const
+	{
+		if (node_id < 0 || node_id >= static_cast<int>(m_nodes.size()))
+			return false;
+		const Node& node = m_nodes[node_id];
+		if (node.parent != parent)
+			return false;
+
+		if (node.IsLeaf())
+		{
+			++leaf_count;
+			return node.child2 == NULL_NODE && node.height == 0;
+		}
+
+		if (!ValidateNode(node.child1, node_id, leaf_count) || !ValidateNode(node.child2, node_id, leaf_count))
+			return false;
+		const Node& node1 = m_nodes[node.child1];
+		const Node& node2 = m_nodes[node.child2];
+		if (node.height != 1 + (std::max)(node1.height, node2.height))
+			return false;
+		// m[hAABB͎qAABB܂
+		return NearlyContainsAABB(node.aabb, node1.aabb) && NearlyContainsAABB(node.aabb, node2.aabb);
+	}
+
+}// namespace TKGEngine
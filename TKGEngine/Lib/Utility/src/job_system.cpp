@@ -0,0 +1,267 @@
+
+#include "../inc/job_system.h"
+#include "../inc/cpu_profiler.h"
+
+#include <cstdio>
+
+namespace TKGEngine
+{
+	////////////////////////////////////////////////////////
+	// Static member definition
+	////////////////////////////////////////////////////////
+	std::vector<std::unique_ptr<JobSystem::Worker>> JobSystem::m_workers;
+	std::vector<std::thread> JobSystem::m_threads;
+	bool JobSystem::m_is_initialized = false;
+	std::atomic<bool> JobSystem::m_is_stop = false;
+
+	std::atomic<int> JobSystem::m_pending_job_num = 0;
+	std::atomic<int> JobSystem::m_sleeping_num = 0;
+	std::mutex JobSystem::m_sleep_mutex;
+	std::condition_variable JobSystem::m_sleep_cv;
+
+	thread_local int JobSystem::t_worker_index = -1;
+
+
+	////////////////////////////////////////////////////////
+	// WorkStealingQueue Methods
+	////////////////////////////////////////////////////////
+	bool JobSystem::WorkStealingQueue::Push(Job* job)
+	{
+		const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+		// tȂς܂Ȃ(Ăяoł̏Ŏs)
+		if (bottom - m_top.load(std::memory_order_acquire) >= static_cast<std::int64_t>(MAX_JOB_NUM))
+			return false;
+
+		m_jobs[bottom & JOB_INDEX_MASK].store(job, std::memory_order_relaxed);
+		m_bottom.store(bottom + 1, std::memory_order_release);
+		return true;
+	}
+
+	JobSystem::Job* JobSystem::WorkStealingQueue::Pop()
+	{
+		const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		m_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::int64_t top = m_top.load(std::memory_order_relaxed);
+
+		// Ȃ߂
+		if (top > bottom)
+		{
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		Job* job = m_jobs[bottom & JOB_INDEX_MASK].load(std::memory_order_relaxed);
+		// c1̂ƂStealƋ̂topi߂Ď荇
+		if (top == bottom)
+		{
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				job = nullptr;
+			}
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+
+	JobSystem::Job* JobSystem::WorkStealingQueue::Steal()
+	{
+		std::int64_t top = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+			return nullptr;
+
+		Job* job = m_jobs[top & JOB_INDEX_MASK].load(std::memory_order_relaxed);
+		// ̃XbhɐɎꂽ玸s
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr;
+		return job;
+	}
+
+
+	////////////////////////////////////////////////////////
+	// Class Methods
+	////////////////////////////////////////////////////////
+	void JobSystem::Initialize(int thread_num)
+	{
+		if (m_is_initialized)
+			return;
+
+		if (thread_num <= 0)
+		{
+			thread_num = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+			thread_num = thread_num > 0 ? thread_num : 1;
+		}
+
+		// CXbh܂߂Ċmۂ
+		m_workers.reserve(static_cast<size_t>(thread_num) + 1);
+		for (int i = 0; i <= thread_num; ++i)
+		{
+			auto worker = std::make_unique<Worker>();
+			worker->job_ring = std::make_unique<Job[]>(MAX_JOB_NUM);
+			m_workers.emplace_back(std::move(worker));
+		}
+
+		m_is_stop = false;
+		t_worker_index = 0;
+		m_is_initialized = true;
+		CPUProfiler::SetThreadName("Main");
+
+		m_threads.reserve(thread_num);
+		for (int i = 1; i <= thread_num; ++i)
+		{
+			m_threads.emplace_back(WorkerLoop, i);
+		}
+	}
+
+	void JobSystem::Terminate()
+	{
+		if (!m_is_initialized)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(m_sleep_mutex);
+			m_is_stop = true;
+		}
+		m_sleep_cv.notify_all();
+		for (auto& thread : m_threads)
+		{
+			thread.join();
+		}
+		m_threads.clear();
+		m_workers.clear();
+
+		t_worker_index = -1;
+		m_is_initialized = false;
+	}
+
+	int JobSystem::GetThreadNum()
+	{
+		return m_is_initialized ? static_cast<int>(m_workers.size()) : 1;
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		// ҂ĂԂ󂢂ĂWus
+		while (!counter.IsDone())
+		{
+			Job* job = (t_worker_index >= 0) ? GetJob() : nullptr;
+			if (job)
+			{
+				Execute(job);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	JobSystem::Job* JobSystem::AllocateJob()
+	{
+		// XbhƂ̃Oobt@mۂ̂Ŕr͕sv
+		Worker& worker = *m_workers[t_worker_index];
+		Job* job = &worker.job_ring[worker.allocated_num & JOB_INDEX_MASK];
+		// Ă܂sIĂȂWu͏㏑Ȃ
+		if (job->is_used.load(std::memory_order_acquire))
+			return nullptr;
+		job->is_used.store(true, std::memory_order_relaxed);
+		++worker.allocated_num;
+		return job;
+	}
+
+	void JobSystem::Submit(Job* job)
+	{
+		m_pending_job_num.fetch_add(1, std::memory_order_seq_cst);
+		// L[tȂ炻̏Ŏs
+		if (!m_workers[t_worker_index]->queue.Push(job))
+		{
+			m_pending_job_num.fetch_sub(1, std::memory_order_relaxed);
+			Execute(job);
+			return;
+		}
+
+		// ҋ@̃[J[΋N
+		if (m_sleeping_num.load(std::memory_order_seq_cst) > 0)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_sleep_mutex);
+			}
+			m_sleep_cv.notify_one();
+		}
+	}
+
+	JobSystem::Job* JobSystem::GetJob()
+	{
+		const int worker_num = static_cast<int>(m_workers.size());
+
+		// ̃L[o
+		Job* job = m_workers[t_worker_index]->queue.Pop();
+		if (!job)
+		{
+			// ̃Xbh̃L[瓐
+			for (int i = 1; i < worker_num; ++i)
+			{
+				const int victim = (t_worker_index + i) % worker_num;
+				job = m_workers[victim]->queue.Steal();
+				if (job)
+					break;
+			}
+		}
+		if (job)
+		{
+			m_pending_job_num.fetch_sub(1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+
+	void JobSystem::Execute(Job* job)
+	{
+		JobCounter* counter = job->counter;
+		job->invoke(job);
+		// Wü̗ėp\ɂĂ犮ʒm
+		job->is_used.store(false, std::memory_order_release);
+		counter->count.fetch_sub(1, std::memory_order_release);
+	}
+
+	void JobSystem::WorkerLoop(const int index)
+	{
+		t_worker_index = index;
+		{
+			char thread_name[CPUProfiler::THREAD_NAME_SIZE];
+			std::snprintf(thread_name, sizeof(thread_name), "Worker %d", index);
+			CPUProfiler::SetThreadName(thread_name);
+		}
+
+		int spin_count = 0;
+		while (!m_is_stop.load(std::memory_order_relaxed))
+		{
+			Job* job = GetJob();
+			if (job)
+			{
+				Execute(job);
+				spin_count = 0;
+				continue;
+			}
+
+			// ΂炭WuΒǉ܂Ŗ
+			if (++spin_count < SPIN_COUNT_BEFORE_SLEEP)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+			spin_count = 0;
+
+			std::unique_lock<std::mutex> lock(m_sleep_mutex);
+			m_sleeping_num.fetch_add(1, std::memory_order_seq_cst);
+			m_sleep_cv.wait(lock, []
+				{
+					return m_is_stop.load(std::memory_order_relaxed) || m_pending_job_num.load(std::memory_order_seq_cst) > 0;
+				});
+			m_sleeping_num.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+}// namespace TKGEngine
@@ -0,0 +1,352 @@
+#include "../inc/light_cluster.h"
+#include "../inc/cpu_profiler.h"
+
+#include "Systems/inc/TKGEngine_Defined.h"
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace TKGEngine
+{
+	////////////////////////////////////////////////////////
+	// Local Methods
+	////////////////////////////////////////////////////////
+	// r[ԂZ[x(J̑O)ɕϊ镄
+#ifdef AXIS_RH
+	static constexpr float VIEW_DEPTH_SIGN = -1.0f;
+#else
+	static constexpr float VIEW_DEPTH_SIGN = 1.0f;
+#endif// #ifdef AXIS_RH
+
+	static constexpr int CLUSTER_NUM_XY = CLUSTER_NUM_X * CLUSTER_NUM_Y;
+	// L~͋Ê݂Ŕ肷
+	static constexpr float MIN_CONE_COS = 0.0f;
+
+	// ~ƃNX^[̋Ě
+	// https://bartwronski.com/2017/04/13/cull-that-cone/
+	inline bool IntersectConeSphere(
+		const VECTOR3& cone_pos, const VECTOR3& cone_dir, const float cone_range, const float cone_cos, const float cone_sin,
+		const VECTOR3& sphere_center, const float sphere_radius)
+	{
+		const VECTOR3 v = sphere_center - cone_pos;
+		const float v_len_sq = v.LengthSq();
+		const float v1_len = v.Dot(cone_dir);
+		const float distance_closest_point = cone_cos * std::sqrt((std::max)(v_len_sq - v1_len * v1_len, 0.0f)) - v1_len * cone_sin;
+
+		const bool angle_cull = distance_closest_point > sphere_radius;
+		const bool front_cull = v1_len > sphere_radius + cone_range;
+		const bool back_cull = v1_len < -sphere_radius;
+		return !(angle_cull || front_cull || back_cull);
+	}
+
+
+	////////////////////////////////////////////////////////
+	// Class Methods
+	////////////////////////////////////////////////////////
+	void LightCluster::Build(const MATRIX& view, const MATRIX& projection, const float near_plane, const float far_plane, const std::vector<ClusterLightShape>& lights)
+	{
+		CPU_PROFILE_SCOPE("LightCluster::Build");
+
+		UpdateClusterBounds(projection, near_plane, far_plane);
+		TransformLights(view, lights);
+
+		// 蓖Ă郉CgȂ΋̃XgԂ
+		if (m_view_lights.empty())
+		{
+			m_cluster_ranges.assign(CLUSTER_NUM, ClusterRange());
+			m_light_indices.clear();
+			return;
+		}
+
+		// [xXCXƂɃWuƂČvZ
+		JobSystem::ParallelFor(m_job_counter, CLUSTER_NUM_Z, 1,
+			[this](const int begin, const int end)
+			{
+				CPU_PROFILE_SCOPE("LightCluster::AssignSlices");
+				AssignSlices(begin, end);
+			});
+		JobSystem::Wait(m_job_counter);
+
+		GatherSlices();
+	}
+
+	const std::vector<ClusterRange>& LightCluster::GetClusterRanges() const
+	{
+		return m_cluster_ranges;
+	}
+
+	const std::vector<std::uint32_t>& LightCluster::GetLightIndices() const
+	{
+		return m_light_indices;
+	}
+
+	float LightCluster::GetDepthSliceScale() const
+	{
+		return m_depth_slice_scale;
+	}
+
+	float LightCluster::GetDepthSliceBias() const
+	{
+		return m_depth_slice_bias;
+	}
+
+	void LightCluster::UpdateClusterBounds(const MATRIX& projection, const float near_plane, const float far_plane)
+	{
+		if (m_cached_near == near_plane && m_cached_far == far_plane && m_cached_projection == projection)
+			return;
+		m_cached_projection = projection;
+		m_cached_near = near_plane;
+		m_cached_far = far_plane;
+
+		// [xw
+		const float log_ratio = std::log(far_plane / near_plane);
+		for (int z = 0; z <= CLUSTER_NUM_Z; ++z)
+		{
+			m_slice_depth[z] = near_plane * std::exp(log_ratio * static_cast<float>(z) / CLUSTER_NUM_Z);
+		}
+		m_slice_depth[0] = near_plane;
+		m_slice_depth[CLUSTER_NUM_Z] = far_plane;
+		m_depth_slice_scale = CLUSTER_NUM_Z / log_ratio;
+		m_depth_slice_bias = -CLUSTER_NUM_Z * std::log(near_plane) / log_ratio;
+
+		// ^C̊pʂ钼(ߕʂƉʏ̓_)߂
+		constexpr int CORNER_NUM_X = CLUSTER_NUM_X + 1;
+		constexpr int CORNER_NUM_Y = CLUSTER_NUM_Y + 1;
+		VECTOR3 corner_near[CORNER_NUM_X * CORNER_NUM_Y];
+		VECTOR3 corner_far[CORNER_NUM_X * CORNER_NUM_Y];
+		const MATRIX inv_projection = projection.Invert();
+		for (int y = 0; y < CORNER_NUM_Y; ++y)
+		{
+			// ^CY͉ʏォ琔
+			const float ndc_y = 1.0f - 2.0f * static_cast<float>(y) / CLUSTER_NUM_Y;
+			for (int x = 0; x < CORNER_NUM_X; ++x)
+			{
+				const float ndc_x = -1.0f + 2.0f * static_cast<float>(x) / CLUSTER_NUM_X;
+				VECTOR3& p0 = corner_near[x + y * CORNER_NUM_X];
+				VECTOR3& p1 = corner_far[x + y * CORNER_NUM_X];
+				p0 = VECTOR3::TransformMatrix(VECTOR3(ndc_x, ndc_y, 0.0f), inv_projection);
+				p1 = VECTOR3::TransformMatrix(VECTOR3(ndc_x, ndc_y, 1.0f), inv_projection);
+				p0.z *= VIEW_DEPTH_SIGN;
+				p1.z *= VIEW_DEPTH_SIGN;
+			}
+		}
+		// Ŏw肵[xɂ_
+		const auto point_on_depth = [&corner_near, &corner_far](const int corner, const float depth)
+		{
+			const VECTOR3& p0 = corner_near[corner];
+			const VECTOR3& p1 = corner_far[corner];
+			const float t = (depth - p0.z) / (p1.z - p0.z);
+			return p0 + (p1 - p0) * t;
+		};
+
+		// NX^[8_AABB
+		for (int z = 0; z < CLUSTER_NUM_Z; ++z)
+		{
+			for (int y = 0; y < CLUSTER_NUM_Y; ++y)
+			{
+				for (int x = 0; x < CLUSTER_NUM_X; ++x)
+				{
+					const int corners[4] =
+					{
+						x + y * CORNER_NUM_X,
+						(x + 1) + y * CORNER_NUM_X,
+						x + (y + 1) * CORNER_NUM_X,
+						(x + 1) + (y + 1) * CORNER_NUM_X
+					};
+					VECTOR3 aabb_min = point_on_depth(corners[0], m_slice_depth[z]);
+					VECTOR3 aabb_max = aabb_min;
+					for (int i = 0; i < 4; ++i)
+					{
+						for (int d = 0; d < 2; ++d)
+						{
+							const VECTOR3 p = point_on_depth(corners[i], m_slice_depth[z + d]);
+							aabb_min = VECTOR3::Min(aabb_min, p);
+							aabb_max = VECTOR3::Max(aabb_max, p);
+						}
+					}
+					const int cluster = x + y * CLUSTER_NUM_X + z * CLUSTER_NUM_XY;
+					m_cluster_min[cluster] = aabb_min;
+					m_cluster_max[cluster] = aabb_max;
+				}
+			}
+		}
+	}
+
+	void LightCluster::TransformLights(const MATRIX& view, const std::vector<ClusterLightShape>& lights)
+	{
+		const size_t light_num = lights.size();
+		m_view_lights.resize(light_num);
+		for (size_t i = 0; i < light_num; ++i)
+		{
+			const ClusterLightShape& shape = lights[i];
+			ViewLight& light = m_view_lights[i];
+
+			light.position = VECTOR3::TransformMatrix(shape.position, view);
+			light.position.z *= VIEW_DEPTH_SIGN;
+			light.range = shape.range;
+
+			// |CgCgƍL~͔͈͂̋Ŕ肷
+			if (shape.cone_cos <= MIN_CONE_COS)
+			{
+				light.center = light.position;
+				light.radius = shape.range;
+				light.cone_cos = -1.0f;
+				light.cone_sin = 0.0f;
+				continue;
+			}
+
+			light.direction = VECTOR3::TransformNormal(shape.direction, view).Normalized();
+			light.direction.z *= VIEW_DEPTH_SIGN;
+			light.cone_cos = shape.cone_cos;
+			light.cone_sin = std::sqrt((std::max)(1.0f - shape.cone_cos * shape.cone_cos, 0.0f));
+			// ~ލŏ̋
+			// https://bartwronski.com/2017/04/13/cull-that-cone/
+			constexpr float COS_QUARTER_PI = 0.70710678f;
+			if (shape.cone_cos < COS_QUARTER_PI)
+			{
+				light.center = light.position + light.direction * (shape.range * light.cone_cos);
+				light.radius = shape.range * light.cone_sin;
+			}
+			else
+			{
+				const float radius = shape.range / (2.0f * light.cone_cos);
+				light.center = light.position + light.direction * radius;
+				light.radius = radius;
+			}
+		}
+	}
+
+	void LightCluster::AssignSlices(const int begin, const int end)
+	{
+		using namespace DirectX;
+
+		const int light_num = static_cast<int>(m_view_lights.size());
+		for (int z = begin; z < end; ++z)
+		{
+			SliceWork& work = m_slice_works[z];
+			work.center_x.clear();
+			work.center_y.clear();
+			work.center_z.clear();
+			work.radius_sq.clear();
+			work.light_index.clear();
+			work.indices.clear();
+
+			// XCX̐[x͈͂ƏdȂ郉Cgɂ
+			const float slice_near = m_slice_depth[z];
+			const float slice_far = m_slice_depth[z + 1];
+			for (int i = 0; i < light_num; ++i)
+			{
+				const ViewLight& light = m_view_lights[i];
+				if (light.center.z + light.radius < slice_near || light.center.z - light.radius > slice_far)
+					continue;
+				work.center_x.emplace_back(light.center.x);
+				work.center_y.emplace_back(light.center.y);
+				work.center_z.emplace_back(light.center.z);
+				work.radius_sq.emplace_back(light.radius * light.radius);
+				work.light_index.emplace_back(static_cast<std::uint32_t>(i));
+			}
+			const int candidate_num = static_cast<int>(work.light_index.size());
+			if (candidate_num == 0)
+			{
+				std::fill(std::begin(work.ranges), std::end(work.ranges), ClusterRange());
+				continue;
+			}
+			// SIMD_WIDTH̔{܂Ő΂ɓȂŖ߂
+			constexpr float FAR_AWAY = (std::numeric_limits<float>::max)();
+			while (work.center_x.size() % SIMD_WIDTH != 0)
+			{
+				work.center_x.emplace_back(FAR_AWAY);
+				work.center_y.emplace_back(FAR_AWAY);
+				work.center_z.emplace_back(FAR_AWAY);
+				work.radius_sq.emplace_back(0.0f);
+			}
+			const int padded_num = static_cast<int>(work.center_x.size());
+
+			for (int xy = 0; xy < CLUSTER_NUM_XY; ++xy)
+			{
+				const int cluster = xy + z * CLUSTER_NUM_XY;
+				const VECTOR3& aabb_min = m_cluster_min[cluster];
+				const VECTOR3& aabb_max = m_cluster_max[cluster];
+				const XMVECTOR min_x = XMVectorReplicate(aabb_min.x);
+				const XMVECTOR min_y = XMVectorReplicate(aabb_min.y);
+				const XMVECTOR min_z = XMVectorReplicate(aabb_min.z);
+				const XMVECTOR max_x = XMVectorReplicate(aabb_max.x);
+				const XMVECTOR max_y = XMVectorReplicate(aabb_max.y);
+				const XMVECTOR max_z = XMVectorReplicate(aabb_max.z);
+				const XMVECTOR zero = XMVectorZero();
+				// ~̔ɎgNX^[̋E
+				const VECTOR3 sphere_center = (aabb_min + aabb_max) * 0.5f;
+				const float sphere_radius = (aabb_max - aabb_min).Length() * 0.5f;
+
+				ClusterRange& range = work.ranges[xy];
+				range.offset = static_cast<std::uint32_t>(work.indices.size());
+
+				// 4̋EAABB̍ŋߐړ_̋܂Ƃ߂ċ߂
+				for (int i = 0; i < padded_num; i += SIMD_WIDTH)
+				{
+					const XMVECTOR cx = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&work.center_x[i]));
+					const XMVECTOR cy = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&work.center_y[i]));
+					const XMVECTOR cz = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&work.center_z[i]));
+					const XMVECTOR r_sq = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&work.radius_sq[i]));
+
+					const XMVECTOR dx = XMVectorMax(XMVectorMax(XMVectorSubtract(min_x, cx), zero), XMVectorSubtract(cx, max_x));
+					const XMVECTOR dy = XMVectorMax(XMVectorMax(XMVectorSubtract(min_y, cy), zero), XMVectorSubtract(cy, max_y));
+					const XMVECTOR dz = XMVectorMax(XMVectorMax(XMVectorSubtract(min_z, cz), zero), XMVectorSubtract(cz, max_z));
+					XMVECTOR dist_sq = XMVectorMultiply(dx, dx);
+					dist_sq = XMVectorMultiplyAdd(dy, dy, dist_sq);
+					dist_sq = XMVectorMultiplyAdd(dz, dz, dist_sq);
+					const XMVECTOR hit = XMVectorLessOrEqual(dist_sq, r_sq);
+					// 4ƂOĂΎ
+					if (XMVector4EqualInt(hit, XMVectorFalseInt()))
+						continue;
+
+					std::uint32_t masks[SIMD_WIDTH];
+					XMStoreInt4(masks, hit);
+					const int num = (candidate_num - i < SIMD_WIDTH) ? candidate_num - i : SIMD_WIDTH;
+					for (int j = 0; j < num; ++j)
+					{
+						if (masks[j] == 0)
+							continue;
+						const std::uint32_t light_index = work.light_index[i + j];
+						// X|bgCg͉~ł肷
+						const ViewLight& light = m_view_lights[light_index];
+						if (light.cone_cos > MIN_CONE_COS &&
+							!IntersectConeSphere(light.position, light.direction, light.range, light.cone_cos, light.cone_sin, sphere_center, sphere_radius))
+						{
+							continue;
+						}
+						work.indices.emplace_back(light_index);
+					}
+				}
+				range.count = static_cast<std::uint32_t>(work.indices.size()) - range.offset;
+			}
+		}
+	}
+
+	void LightCluster::GatherSlices()
+	{
+		size_t total_num = 0;
+		for (const auto& work : m_slice_works)
+		{
+			total_num += work.indices.size();
+		}
+		m_cluster_ranges.resize(CLUSTER_NUM);
+		m_light_indices.resize(total_num);
+
+		std::uint32_t slice_offset = 0;
+		for (int z = 0; z < CLUSTER_NUM_Z; ++z)
+		{
+			const SliceWork& work = m_slice_works[z];
+			for (int xy = 0; xy < CLUSTER_NUM_XY; ++xy)
+			{
+				ClusterRange& range = m_cluster_ranges[xy + z * CLUSTER_NUM_XY];
+				range.offset = work.ranges[xy].offset + slice_offset;
+				range.count = work.ranges[xy].count;
+			}
+			std::copy(work.indices.begin(), work.indices.end(), m_light_indices.begin() + slice_offset);
+			slice_offset += static_cast<std::uint32_t>(work.indices.size());
+		}
+	}
+
+}// namespace TKGEngine
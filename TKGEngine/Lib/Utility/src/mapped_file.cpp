@@ -0,0 +1,82 @@
+
+#include "../inc/mapped_file.h"
+
+#include <Windows.h>
+
+namespace TKGEngine
+{
+	////////////////////////////////////////////////////////
+	// Class Methods
+	////////////////////////////////////////////////////////
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		const HANDLE file = CreateFileA(
+			filepath.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+			nullptr
+		);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+		m_file_handle = file;
+
+		LARGE_INTEGER file_size = {};
+		if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0)
+		{
+			// TCY0̃t@C̓}bvłȂ
+			Close();
+			return false;
+		}
+
+		const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr)
+		{
+			Close();
+			return false;
+		}
+		m_mapping_handle = mapping;
+
+		m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (m_data == nullptr)
+		{
+			Close();
+			return false;
+		}
+		m_size = static_cast<size_t>(file_size.QuadPart);
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_data)
+		{
+			UnmapViewOfFile(m_data);
+			m_data = nullptr;
+		}
+		if (m_mapping_handle)
+		{
+			CloseHandle(static_cast<HANDLE>(m_mapping_handle));
+			m_mapping_handle = nullptr;
+		}
+		if (m_file_handle)
+		{
+			CloseHandle(static_cast<HANDLE>(m_file_handle));
+			m_file_handle = nullptr;
+		}
+		m_size = 0;
+	}
+
+}// namespace TKGEngine
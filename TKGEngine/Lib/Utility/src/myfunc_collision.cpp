@@ -1,6 +1,8 @@
 
 #include "Utility/inc/myfunc_collision.h"
 
+#include <cassert>
+
 namespace TKGEngine::MyFunc
 {
 	// =============================================================
@@ -290,4 +292,87 @@ namespace TKGEngine::MyFunc
 		return true;
 	}
 
-}
\ No newline at end of file
+
+	// =============================================================
+	// JO
+	// =============================================================
+	void PackedBounds::Resize(const int count)
+	{
+		const size_t size = static_cast<size_t>((count + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH);
+		if (center_x.size() >= size)
+			return;
+		center_x.resize(size);
+		center_y.resize(size);
+		center_z.resize(size);
+		extents_x.resize(size);
+		extents_y.resize(size);
+		extents_z.resize(size);
+	}
+
+	void PackedBounds::Set(const int index, const Bounds& bounds)
+	{
+		const VECTOR3 center = bounds.GetCenter();
+		const VECTOR3 extents = bounds.GetExtents();
+		center_x[index] = center.x;
+		center_y[index] = center.y;
+		center_z[index] = center.z;
+		extents_x[index] = extents.x;
+		extents_y[index] = extents.y;
+		extents_z[index] = extents.z;
+	}
+
+	void FrustumCulling(const Frustum& frustum, const PackedBounds& bounds, const int begin, const int end, std::uint8_t* results)
+	{
+		using namespace DirectX;
+
+		assert(begin % PackedBounds::SIMD_WIDTH == 0);
+
+		// ʂ̖@͊OȂ̂ŁAdot(n, c) + d > dot(|n|, e) Ȃ畽ʂ̊O
+		XMVECTOR planes[6];
+		static_cast<BoundingFrustum>(frustum).GetPlanes(&planes[0], &planes[1], &planes[2], &planes[3], &planes[4], &planes[5]);
+		XMVECTOR plane_x[6], plane_y[6], plane_z[6], plane_w[6];
+		XMVECTOR abs_x[6], abs_y[6], abs_z[6];
+		for (int i = 0; i < 6; ++i)
+		{
+			plane_x[i] = XMVectorSplatX(planes[i]);
+			plane_y[i] = XMVectorSplatY(planes[i]);
+			plane_z[i] = XMVectorSplatZ(planes[i]);
+			plane_w[i] = XMVectorSplatW(planes[i]);
+			abs_x[i] = XMVectorAbs(plane_x[i]);
+			abs_y[i] = XMVectorAbs(plane_y[i]);
+			abs_z[i] = XMVectorAbs(plane_z[i]);
+		}
+
+		for (int i = begin; i < end; i += PackedBounds::SIMD_WIDTH)
+		{
+			const XMVECTOR cx = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.center_x[i]));
+			const XMVECTOR cy = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.center_y[i]));
+			const XMVECTOR cz = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.center_z[i]));
+			const XMVECTOR ex = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.extents_x[i]));
+			const XMVECTOR ey = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.extents_y[i]));
+			const XMVECTOR ez = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.extents_z[i]));
+
+			XMVECTOR outside = XMVectorFalseInt();
+			for (int p = 0; p < 6; ++p)
+			{
+				XMVECTOR dist = XMVectorMultiplyAdd(cx, plane_x[p], plane_w[p]);
+				dist = XMVectorMultiplyAdd(cy, plane_y[p], dist);
+				dist = XMVectorMultiplyAdd(cz, plane_z[p], dist);
+				XMVECTOR radius = XMVectorMultiply(ex, abs_x[p]);
+				radius = XMVectorMultiplyAdd(ey, abs_y[p], radius);
+				radius = XMVectorMultiplyAdd(ez, abs_z[p], radius);
+				outside = XMVectorOrInt(outside, XMVectorGreater(dist, radius));
+			}
+
+			// 4̔茋ʂ
+			std::uint32_t masks[PackedBounds::SIMD_WIDTH];
+			XMStoreInt4(masks, outside);
+			const int num = (end - i < PackedBounds::SIMD_WIDTH) ? end - i : PackedBounds::SIMD_WIDTH;
+			for (int j = 0; j < num; ++j)
+			{
+				results[i + j] = masks[j] == 0 ? 1 : 0;
+			}
+		}
+	}
+
+}
@@ -0,0 +1,66 @@
+
+#include "Utility/inc/myfunc_sort.h"
+
+#include <cstring>
+
+namespace TKGEngine::MyFunc
+{
+	// =============================================================
+	// \[g
+	// =============================================================
+	SortKey* RadixSort(SortKey* keys, SortKey* work, const int count)
+	{
+		constexpr int RADIX_BITS = 8;
+		constexpr int BUCKET_NUM = 1 << RADIX_BITS;
+		constexpr int PASS_NUM = 64 / RADIX_BITS;
+
+		if (count <= 1)
+			return keys;
+
+		// SpX̃qXgO1̑ō
+		unsigned histograms[PASS_NUM][BUCKET_NUM];
+		std::memset(histograms, 0, sizeof(histograms));
+		for (int i = 0; i < count; ++i)
+		{
+			std::uint64_t key = keys[i].key;
+			for (int pass = 0; pass < PASS_NUM; ++pass)
+			{
+				++histograms[pass][key & (BUCKET_NUM - 1)];
+				key >>= RADIX_BITS;
+			}
+		}
+
+		SortKey* src = keys;
+		SortKey* dst = work;
+		for (int pass = 0; pass < PASS_NUM; ++pass)
+		{
+			unsigned* histogram = histograms[pass];
+			const int shift = pass * RADIX_BITS;
+
+			// SvfȂт͕ςȂ
+			if (histogram[(src[0].key >> shift) & (BUCKET_NUM - 1)] == static_cast<unsigned>(count))
+				continue;
+
+			// qXgOݐ̃ItZbgɕϊ
+			unsigned offset = 0;
+			for (int bucket = 0; bucket < BUCKET_NUM; ++bucket)
+			{
+				const unsigned num = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += num;
+			}
+
+			for (int i = 0; i < count; ++i)
+			{
+				const unsigned bucket = static_cast<unsigned>((src[i].key >> shift) & (BUCKET_NUM - 1));
+				dst[histogram[bucket]++] = src[i];
+			}
+
+			SortKey* const tmp = src;
+			src = dst;
+			dst = tmp;
+		}
+		return src;
+	}
+
+}
@@ -13,19 +13,21 @@ float4 main(VS_Out pin) : SV_TARGET
 	// Dir Light
 	float3 dir_light = AddDirectionalLight(directional_light, pin.w_pos.xyz, normal, v_camera, 1.0, 1.0, 20.0);
 
-	// Spot Light
+	// Point Light, Spot Light
 	float3 add_light_color = (float3) 0;
-	int i = 0;
-	[unroll]
-	for (i = 0; i < MAX_SPOTLIGHT; ++i)
+	const uint2 cluster_range = GetLightClusterRange(pin.w_pos.xyz);
+	[loop]
+	for (uint i = 0; i < cluster_range.y; ++i)
 	{
-		add_light_color += float3(AddSpotLight(spot_lights[i], pin.w_pos.xyz, normal, v_camera, 1.0, 1.0, 20.0));
-	}
-	// Point Light
-	[unroll]
-	for (i = 0; i < MAX_POINTLIGHT; ++i)
-	{
-		add_light_color += float3(AddPointLight(point_lights[i], pin.w_pos.xyz, normal, v_camera, 1.0, 1.0, 20.0));
+		const uint light_index = cluster_light_indices[cluster_range.x + i];
+		if (light_index < cluster_point_light_num)
+		{
+			add_light_color += AddPointLight(cluster_point_lights[light_index], pin.w_pos.xyz, normal, v_camera, 1.0, 1.0, 20.0);
+		}
+		else
+		{
+			add_light_color += AddSpotLight(cluster_spot_lights[light_index - cluster_point_light_num], pin.w_pos.xyz, normal, v_camera, 1.0, 1.0, 20.0);
+		}
 	}
 
 	return max(0.0, tex_color) * float4(dir_light, 1.0) + float4(add_light_color, 0.0) + float4(ambient_light, 0.0);
@@ -124,9 +124,16 @@ struct PointLight
 CBUFFER(CB_LIGHT, CBS_LIGHT)
 {
 	DirectionalLight directional_light;
-	SpotLight spot_lights[MAX_SPOTLIGHT];
-	PointLight point_lights[MAX_POINTLIGHT];
+	float cluster_depth_scale;	// XCX = log(depth) * scale + bias
+	float cluster_depth_bias;
+	uint cluster_point_light_num;	// CgCfbNX菬΃|CgCg
+	uint cluster_spot_light_num;
 }
+// NX^[Ƃ̃Cg
+STRUCTUREDBUFFER(cluster_point_lights, PointLight, TEXSLOT_CLUSTER_POINT_LIGHTS);
+STRUCTUREDBUFFER(cluster_spot_lights, SpotLight, TEXSLOT_CLUSTER_SPOT_LIGHTS);
+STRUCTUREDBUFFER(cluster_ranges, uint2, TEXSLOT_CLUSTER_RANGES);	// ( offset, count )
+STRUCTUREDBUFFER(cluster_light_indices, uint, TEXSLOT_CLUSTER_LIGHT_INDICES);
 
 // CB_MODEL (5)
 CBUFFER(CB_MODEL, CBS_MODEL)
@@ -21,6 +21,29 @@ float3 AddHemiSphereLight(in float3 w_normal, in float3 sky_color, in float3 gro
 	return lerp(ground_color, sky_color, (w_normal.y + 1.0) * 0.5);
 }
 
+///////////////////////////////////////////////
+// NX^[̃CgXg͈
+// 
+// w_position	:	Ǝˈʒu[hW
+// 
+// return	:	( cluster_light_indices̃ItZbg, Cg )
+///////////////////////////////////////////////
+uint2 GetLightClusterRange(in float3 w_position)
+{
+	const float4 v_position = mul(camera.V, float4(w_position, 1.0));
+	const float4 c_position = mul(camera.P, v_position);
+	const float2 ndc = c_position.xy * InvertDivisionValue(c_position.w);
+	
+	// ʏ[̃^C
+	const float2 tile = floor((ndc * float2(0.5, -0.5) + 0.5) * float2(CLUSTER_NUM_X, CLUSTER_NUM_Y));
+	const uint2 tile_index = (uint2) clamp(tile, float2(0.0, 0.0), float2(CLUSTER_NUM_X - 1, CLUSTER_NUM_Y - 1));
+	// w[xXCX
+	const float depth = max(abs(v_position.z), 1e-4);
+	const uint slice = (uint) clamp(floor(log(depth) * cluster_depth_scale + cluster_depth_bias), 0.0, CLUSTER_NUM_Z - 1);
+	
+	return cluster_ranges[tile_index.x + tile_index.y * CLUSTER_NUM_X + slice * CLUSTER_NUM_X * CLUSTER_NUM_Y];
+}
+
 ///////////////////////////////////////////////
 // |CgCg
 // https://www.3dgep.com/texturing-lighting-directx-11/#Point_Lights
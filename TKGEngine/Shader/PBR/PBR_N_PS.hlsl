@@ -36,18 +36,20 @@ float4 main(VS_Out pin) : SV_TARGET0
 	{
 		// Directional Light
 		AddDirectionalLightBRDF(directional_light, diffuse_reflectance, F0, pin.w_position, pin.normal, v_normal, v_eye, roughness_param, direct_diffuse, direct_specular);
-		// Spot Light
-		int dynamic_light_index = 0;
-		[unroll]
-		for (dynamic_light_index = 0; dynamic_light_index < MAX_SPOTLIGHT; ++dynamic_light_index)
+		// Point Light, Spot Light
+		const uint2 cluster_range = GetLightClusterRange(pin.w_position.xyz);
+		[loop]
+		for (uint cluster_light = 0; cluster_light < cluster_range.y; ++cluster_light)
 		{
-			AddSpotLightBRDF(spot_lights[dynamic_light_index], diffuse_reflectance, F0, pin.w_position, pin.normal, v_normal, v_eye, roughness_param, direct_diffuse, direct_specular);
-		}
-		// Point Light
-		[unroll]
-		for (dynamic_light_index = 0; dynamic_light_index < MAX_POINTLIGHT; ++dynamic_light_index)
-		{
-			AddPointLightBRDF(point_lights[dynamic_light_index], diffuse_reflectance, F0, pin.w_position, pin.normal, v_normal, v_eye, roughness_param, direct_diffuse, direct_specular);
+			const uint light_index = cluster_light_indices[cluster_range.x + cluster_light];
+			if (light_index < cluster_point_light_num)
+			{
+				AddPointLightBRDF(cluster_point_lights[light_index], diffuse_reflectance, F0, pin.w_position, pin.normal, v_normal, v_eye, roughness_param, direct_diffuse, direct_specular);
+			}
+			else
+			{
+				AddSpotLightBRDF(cluster_spot_lights[light_index - cluster_point_light_num], diffuse_reflectance, F0, pin.w_position, pin.normal, v_normal, v_eye, roughness_param, direct_diffuse, direct_specular);
+			}
 		}
 	}
 
@@ -0,0 +1,246 @@
+#include "test_common.h"
+
+#include "Application/Resource/src/AnimatorController/Animation_Blend.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace TKGEngine;
+using namespace TKGEngine::Animations;
+
+namespace
+{
+	constexpr int BONE_NUM = 128;
+
+	Quaternion RandomRotation(Test::TestRandom& random)
+	{
+		return Quaternion(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f)).Normalize();
+	}
+
+	// Ɗpx(WA)̉]
+	Quaternion AxisAngle(Test::TestRandom& random, const float angle)
+	{
+		const VECTOR3 axis = VECTOR3(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(0.1f, 1.0f)).Normalized();
+		const float s = std::sin(angle * 0.5f);
+		return Quaternion(axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f));
+	}
+
+	std::vector<KeyData> CreatePose(Test::TestRandom& random)
+	{
+		std::vector<KeyData> pose(BONE_NUM);
+		for (auto& key : pose)
+		{
+			key.translate = VECTOR3(random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f));
+			key.rotate = RandomRotation(random);
+			key.scale = VECTOR3(random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f));
+		}
+		return pose;
+	}
+
+	// e{[őmax_angle(WA)]|[Y(Aj[Vm̃uhz)
+	std::vector<KeyData> CreateNearPose(Test::TestRandom& random, const std::vector<KeyData>& base, const float max_angle)
+	{
+		std::vector<KeyData> pose = base;
+		for (auto& key : pose)
+		{
+			key.translate += VECTOR3(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+			key.rotate = (key.rotate * AxisAngle(random, random.Range(0.0f, max_angle))).Normalize();
+			key.scale = VECTOR3(random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f));
+			// ͕𔽓]čŒZoH̏ʂ
+			if (random.Next() & 1)
+			{
+				key.rotate = Quaternion(-key.rotate.x, -key.rotate.y, -key.rotate.z, -key.rotate.w);
+			}
+		}
+		return pose;
+	}
+
+	bool IsSameBits(const KeyData& a, const KeyData& b)
+	{
+		return
+			std::memcmp(&a.translate, &b.translate, sizeof(VECTOR3)) == 0 &&
+			std::memcmp(&a.rotate, &b.rotate, sizeof(Quaternion)) == 0 &&
+			std::memcmp(&a.scale, &b.scale, sizeof(VECTOR3)) == 0;
+	}
+
+	// 2̉]̊px(WAAq-q͓])
+	float RotationError(const Quaternion& a, const Quaternion& b)
+	{
+		const float dot = std::fabs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w);
+		return 2.0f * std::acos((std::min)(dot, 1.0f));
+	}
+
+	float VectorError(const VECTOR3& a, const VECTOR3& b)
+	{
+		return (std::max)({ std::fabs(a.x - b.x), std::fabs(a.y - b.y), std::fabs(a.z - b.z) });
+	}
+
+	// ʕԂ̓XJ[VECTOR3::Lerp, Quaternion::SlerpƃrbgPʂňv
+	void TestSlerpMatchesScalar(Test::TestRandom& random)
+	{
+		const auto pose_a = CreatePose(random);
+		const auto pose_b = CreateNearPose(random, pose_a, 3.0f);
+		std::vector<KeyData> dst(BONE_NUM);
+
+		const float ratios[] = { -0.25f, 0.0f, 0.3f, 0.5f, 0.75f, 1.0f, 1.5f };
+		for (const float ratio : ratios)
+		{
+			BlendKeyFrame(pose_a, pose_b, ratio, dst);
+			for (int i = 0; i < BONE_NUM; ++i)
+			{
+				KeyData expected;
+				expected.translate = VECTOR3::Lerp(pose_a[i].translate, pose_b[i].translate, ratio);
+				expected.rotate = Quaternion::Slerp(pose_a[i].rotate, pose_b[i].rotate, ratio);
+				expected.scale = VECTOR3::Lerp(pose_a[i].scale, pose_b[i].scale, ratio);
+				TEST_CHECK(IsSameBits(dst[i], expected));
+			}
+
+			// BlendTreê悤dstƓ͂złʂ͕ςȂ
+			std::vector<KeyData> in_place = pose_b;
+			BlendKeyFrame(pose_a, in_place, ratio, in_place);
+			for (int i = 0; i < BONE_NUM; ++i)
+			{
+				TEST_CHECK(IsSameBits(in_place[i], dst[i]));
+			}
+		}
+	}
+
+	// K`Ԃ60xȓ̍Ȃ狅ʕԂƂ̌덷A]ĂĂ]ɂȂ
+	void TestNlerpApproximatesSlerp(Test::TestRandom& random)
+	{
+		constexpr float MAX_ANGLE = 3.14159265f / 3.0f;
+		constexpr float ROTATE_TOLERANCE = 1.0e-2f;
+		constexpr float VECTOR_TOLERANCE = 1.0e-5f;
+
+		const auto pose_a = CreatePose(random);
+		const auto pose_b = CreateNearPose(random, pose_a, MAX_ANGLE);
+		std::vector<KeyData> slerp(BONE_NUM);
+		std::vector<KeyData> nlerp(BONE_NUM);
+
+		for (int step = 0; step <= 10; ++step)
+		{
+			const float ratio = static_cast<float>(step) / 10.0f;
+			BlendKeyFrame(pose_a, pose_b, ratio, slerp, false);
+			BlendKeyFrame(pose_a, pose_b, ratio, nlerp, true);
+			for (int i = 0; i < BONE_NUM; ++i)
+			{
+				TEST_CHECK(VectorError(slerp[i].translate, nlerp[i].translate) <= VECTOR_TOLERANCE);
+				TEST_CHECK(VectorError(slerp[i].scale, nlerp[i].scale) <= VECTOR_TOLERANCE);
+				TEST_CHECK(RotationError(slerp[i].rotate, nlerp[i].rotate) <= ROTATE_TOLERANCE);
+				TEST_CHECK(std::fabs(nlerp[i].rotate.Dot(nlerp[i].rotate) - 1.0f) <= 1.0e-5f);
+			}
+		}
+	}
+
+	// N̏dݕtuh́A𑵂]̏dݕta𐳋K̂ƈv
+	void TestWeightedBlend(Test::TestRandom& random)
+	{
+		constexpr int SOURCE_NUM = 4;
+		constexpr float TOLERANCE = 1.0e-5f;
+
+		const auto base = CreatePose(random);
+		std::vector<std::vector<KeyData>> poses;
+		for (int n = 0; n < SOURCE_NUM; ++n)
+		{
+			poses.emplace_back(CreateNearPose(random, base, 1.0f));
+		}
+		const std::vector<KeyData>* sources[SOURCE_NUM];
+		for (int n = 0; n < SOURCE_NUM; ++n)
+		{
+			sources[n] = &poses[n];
+		}
+		const float weights[SOURCE_NUM] = { 0.1f, 0.4f, 0.2f, 0.3f };
+		std::vector<KeyData> dst(BONE_NUM);
+
+		BlendKeyFrameWeighted(sources, weights, SOURCE_NUM, dst);
+		for (int i = 0; i < BONE_NUM; ++i)
+		{
+			VECTOR3 translate = VECTOR3::Zero;
+			VECTOR3 scale = VECTOR3::Zero;
+			Quaternion rotate(0.0f, 0.0f, 0.0f, 0.0f);
+			const Quaternion& r0 = poses[0][i].rotate;
+			for (int n = 0; n < SOURCE_NUM; ++n)
+			{
+				const KeyData& key = poses[n][i];
+				const float sign = r0.Dot(key.rotate) < 0.0f ? -1.0f : 1.0f;
+				translate += key.translate * weights[n];
+				scale += key.scale * weights[n];
+				rotate = Quaternion(
+					rotate.x + key.rotate.x * weights[n] * sign,
+					rotate.y + key.rotate.y * weights[n] * sign,
+					rotate.z + key.rotate.z * weights[n] * sign,
+					rotate.w + key.rotate.w * weights[n] * sign);
+			}
+			TEST_CHECK(VectorError(dst[i].translate, translate) <= TOLERANCE);
+			TEST_CHECK(VectorError(dst[i].scale, scale) <= TOLERANCE);
+			TEST_CHECK(RotationError(dst[i].rotate, rotate.Normalize()) <= 1.0e-3f);
+		}
+
+		// 2̃uh͐K`ԂBlendKeyFrameƈv
+		const float pair_weights[2] = { 0.35f, 0.65f };
+		std::vector<KeyData> pair(BONE_NUM);
+		BlendKeyFrameWeighted(sources, pair_weights, 2, dst);
+		BlendKeyFrame(poses[0], poses[1], 0.65f, pair, true);
+		for (int i = 0; i < BONE_NUM; ++i)
+		{
+			TEST_CHECK(VectorError(dst[i].translate, pair[i].translate) <= TOLERANCE);
+			TEST_CHECK(RotationError(dst[i].rotate, pair[i].rotate) <= 1.0e-3f);
+		}
+
+		// d݂̍v0Ȃ1ڂ̂܂ܕԂ
+		const float zero_weights[SOURCE_NUM] = {};
+		BlendKeyFrameWeighted(sources, zero_weights, SOURCE_NUM, dst);
+		for (int i = 0; i < BONE_NUM; ++i)
+		{
+			TEST_CHECK(IsSameBits(dst[i], poses[0][i]));
+		}
+	}
+
+	// 1RȀ(|[Y/b)
+	void PrintThroughput(Test::TestRandom& random)
+	{
+		constexpr int LOOP_NUM = 20000;
+		const auto pose_a = CreatePose(random);
+		const auto pose_b = CreateNearPose(random, pose_a, 1.0f);
+		const auto pose_c = CreateNearPose(random, pose_a, 1.0f);
+		const auto pose_d = CreateNearPose(random, pose_a, 1.0f);
+		const std::vector<KeyData>* sources[4] = { &pose_a, &pose_b, &pose_c, &pose_d };
+		const float weights[4] = { 0.25f, 0.25f, 0.25f, 0.25f };
+		std::vector<KeyData> dst(BONE_NUM);
+
+		const auto measure = [&](const char* name, const auto& func)
+		{
+			const Test::Stopwatch stopwatch;
+			for (int loop = 0; loop < LOOP_NUM; ++loop)
+			{
+				func(static_cast<float>(loop % 100) / 100.0f);
+			}
+			const double seconds = stopwatch.ElapsedMilliseconds() / 1000.0;
+			std::printf("%-28s %12.0f poses/s (%d bones)\n", name, LOOP_NUM / seconds, BONE_NUM);
+		};
+		measure("slerp", [&](float t) { BlendKeyFrame(pose_a, pose_b, t, dst, false); });
+		measure("nlerp", [&](float t) { BlendKeyFrame(pose_a, pose_b, t, dst, true); });
+		measure("slerp x3 (4 sources)", [&](float t)
+			{
+				BlendKeyFrame(pose_a, pose_b, t, dst, false);
+				BlendKeyFrame(pose_c, dst, 0.5f, dst, false);
+				BlendKeyFrame(pose_d, dst, 0.66f, dst, false);
+			});
+		measure("weighted nlerp (4 sources)", [&](float) { BlendKeyFrameWeighted(sources, weights, 4, dst); });
+	}
+}
+
+int main()
+{
+	Test::TestRandom random(20240601);
+
+	TestSlerpMatchesScalar(random);
+	TestNlerpApproximatesSlerp(random);
+	TestWeightedBlend(random);
+	PrintThroughput(random);
+
+	std::printf("test_blend_keyframe : passed\n");
+	return 0;
+}
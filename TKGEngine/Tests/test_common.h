@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// 𖞂ȂΎsꏊ\ďI(ctest͏IR[hŔ肷)
+#define TEST_CHECK(expr) \
+	do { \
+		if (!(expr)) { \
+			std::fprintf(stderr, "%s(%d): TEST_CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+			std::exit(1); \
+		} \
+	} while (0)
+
+namespace TKGEngine::Test
+{
+	// oߎԂ̌v(~b)
+	class Stopwatch
+	{
+	public:
+		Stopwatch() : m_begin(std::chrono::steady_clock::now()) {}
+		double ElapsedMilliseconds() const
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_begin).count();
+		}
+
+	private:
+		std::chrono::steady_clock::time_point m_begin;
+	};
+
+	// Č̂闐(eXgƂɓl̗Ԃ)
+	class TestRandom
+	{
+	public:
+		explicit TestRandom(unsigned seed) : m_state(seed ? seed : 1u) {}
+		unsigned Next()
+		{
+			// xorshift32
+			m_state ^= m_state << 13;
+			m_state ^= m_state >> 17;
+			m_state ^= m_state << 5;
+			return m_state;
+		}
+		// [min, max)̎
+		float Range(float min, float max)
+		{
+			return min + (max - min) * (static_cast<float>(Next() >> 8) / static_cast<float>(1u << 24));
+		}
+
+	private:
+		unsigned m_state;
+	};
+}
@@ -0,0 +1,367 @@
+#include "test_common.h"
+
+#include "Utility/inc/cpu_profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace TKGEngine;
+
+namespace
+{
+	constexpr int WORKER_NUM = 4;
+	constexpr int LOOP_NUM = 2000;
+	constexpr const char* TRACE_FILEPATH = "test_cpu_profiler_trace.json";
+	// o%.3f(}CNb)Ȃ̂Ŋۂߌ덷e
+	constexpr double TIME_TOLERANCE_US = 0.002;
+
+	// ==============================================
+	// og[X̌؂ɕKvȕJSONp[T
+	// ==============================================
+	struct JsonValue
+	{
+		enum class Type { Null, Bool, Number, String, Array, Object };
+		Type type = Type::Null;
+		bool boolean = false;
+		double number = 0.0;
+		std::string string;
+		std::vector<JsonValue> array;
+		std::map<std::string, JsonValue> object;
+
+		const JsonValue* Find(const std::string& key) const
+		{
+			const auto itr = object.find(key);
+			return itr == object.end() ? nullptr : &itr->second;
+		}
+	};
+
+	class JsonParser
+	{
+	public:
+		explicit JsonParser(const std::string& text) : m_text(text) {}
+
+		bool Parse(JsonValue& value)
+		{
+			if (!ParseValue(value))
+				return false;
+			SkipSpace();
+			return m_pos == m_text.size();
+		}
+
+	private:
+		void SkipSpace()
+		{
+			while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos])))
+				++m_pos;
+		}
+
+		bool Consume(const char c)
+		{
+			SkipSpace();
+			if (m_pos >= m_text.size() || m_text[m_pos] != c)
+				return false;
+			++m_pos;
+			return true;
+		}
+
+		bool ConsumeWord(const char* word)
+		{
+			const size_t length = std::char_traits<char>::length(word);
+			if (m_text.compare(m_pos, length, word) != 0)
+				return false;
+			m_pos += length;
+			return true;
+		}
+
+		bool ParseValue(JsonValue& value)
+		{
+			SkipSpace();
+			if (m_pos >= m_text.size())
+				return false;
+			switch (m_text[m_pos])
+			{
+				case '{':
+					return ParseObject(value);
+				case '[':
+					return ParseArray(value);
+				case '"':
+					value.type = JsonValue::Type::String;
+					return ParseString(value.string);
+				case 't':
+					value.type = JsonValue::Type::Bool;
+					value.boolean = true;
+					return ConsumeWord("true");
+				case 'f':
+					value.type = JsonValue::Type::Bool;
+					return ConsumeWord("false");
+				case 'n':
+					return ConsumeWord("null");
+				default:
+					return ParseNumber(value);
+			}
+		}
+
+		bool ParseObject(JsonValue& value)
+		{
+			value.type = JsonValue::Type::Object;
+			Consume('{');
+			if (Consume('}'))
+				return true;
+			do
+			{
+				std::string key;
+				SkipSpace();
+				if (!ParseString(key) || !Consume(':') || !ParseValue(value.object[key]))
+					return false;
+			} while (Consume(','));
+			return Consume('}');
+		}
+
+		bool ParseArray(JsonValue& value)
+		{
+			value.type = JsonValue::Type::Array;
+			Consume('[');
+			if (Consume(']'))
+				return true;
+			do
+			{
+				value.array.emplace_back();
+				if (!ParseValue(value.array.back()))
+					return false;
+			} while (Consume(','));
+			return Consume(']');
+		}
+
+		bool ParseString(std::string& str)
+		{
+			if (m_pos >= m_text.size() || m_text[m_pos] != '"')
+				return false;
+			++m_pos;
+			while (m_pos < m_text.size())
+			{
+				const char c = m_text[m_pos++];
+				if (c == '"')
+					return true;
+				if (static_cast<unsigned char>(c) < 0x20)
+					return false;
+				if (c != '\\')
+				{
+					str.push_back(c);
+					continue;
+				}
+				if (m_pos >= m_text.size())
+					return false;
+				const char escaped = m_text[m_pos++];
+				switch (escaped)
+				{
+					case '"': str.push_back('"'); break;
+					case '\\': str.push_back('\\'); break;
+					case '/': str.push_back('/'); break;
+					case 'n': str.push_back('\n'); break;
+					case 't': str.push_back('\t'); break;
+					case 'u':
+						if (m_pos + 4 > m_text.size())
+							return false;
+						str.push_back(static_cast<char>(std::stoi(m_text.substr(m_pos, 4), nullptr, 16)));
+						m_pos += 4;
+						break;
+					default:
+						return false;
+				}
+			}
+			return false;
+		}
+
+		bool ParseNumber(JsonValue& value)
+		{
+			const char* begin = m_text.c_str() + m_pos;
+			char* end = nullptr;
+			value.type = JsonValue::Type::Number;
+			value.number = std::strtod(begin, &end);
+			if (end == begin)
+				return false;
+			m_pos += static_cast<size_t>(end - begin);
+			return true;
+		}
+
+		const std::string& m_text;
+		size_t m_pos = 0;
+	};
+
+	// ==============================================
+	// v
+	// ==============================================
+	// q̃][L^(ÕGXP[vmF)
+	void RecordZones()
+	{
+		volatile unsigned sink = 0;
+		for (int loop = 0; loop < LOOP_NUM; ++loop)
+		{
+			CPU_PROFILE_SCOPE("Outer");
+			{
+				CPU_PROFILE_SCOPE("Inner");
+				for (unsigned i = 0; i < 64; ++i)
+				{
+					sink = sink + i;
+				}
+				{
+					CPU_PROFILE_SCOPE("Leaf \"quoted\"\\");
+					sink = sink + 1;
+				}
+			}
+		}
+	}
+
+	struct TraceZone
+	{
+		double ts = 0.0;
+		double dur = 0.0;
+		int depth = 0;
+	};
+
+	// q̃][Xbh1󂢃][̋ԂɊ܂܂Ă邩
+	bool IsNested(const std::vector<TraceZone>& parents, const TraceZone& child)
+	{
+		const auto itr = std::upper_bound(parents.begin(), parents.end(), child.ts + TIME_TOLERANCE_US,
+			[](const double ts, const TraceZone& zone) { return ts < zone.ts; });
+		if (itr == parents.begin())
+			return false;
+		const TraceZone& parent = *(itr - 1);
+		return parent.depth + 1 == child.depth
+			&& parent.ts + parent.dur + TIME_TOLERANCE_US >= child.ts + child.dur;
+	}
+}
+
+int main()
+{
+	// ł͖ŁA][͋L^Ȃ
+	TEST_CHECK(!CPUProfiler::IsEnabled());
+	{
+		CPU_PROFILE_SCOPE("Disabled");
+	}
+	CPUProfiler::EndFrame();
+	TEST_CHECK(CPUProfiler::GetFrameStats().empty());
+
+	// XbhŋL^Ȃ烁CXbhŉ
+	CPUProfiler::SetEnable(true);
+	CPUProfiler::SetThreadName("Main");
+	CPUProfiler::StartCapture();
+	std::vector<std::thread> workers;
+	std::atomic<int> finished_num = 0;
+	for (int n = 0; n < WORKER_NUM; ++n)
+	{
+		workers.emplace_back([n, &finished_num]()
+			{
+				const std::string name = "Worker " + std::to_string(n);
+				CPUProfiler::SetThreadName(name.c_str());
+				RecordZones();
+				++finished_num;
+			});
+	}
+	int frame_num = 0;
+	while (finished_num.load() < WORKER_NUM)
+	{
+		CPUProfiler::BeginFrame();
+		std::this_thread::yield();
+		CPUProfiler::EndFrame();
+		++frame_num;
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	CPUProfiler::BeginFrame();
+	CPUProfiler::EndFrame();
+	++frame_num;
+	CPUProfiler::StopCapture();
+	TEST_CHECK(CPUProfiler::GetDroppedZoneNum() == 0);
+	TEST_CHECK(CPUProfiler::ExportChromeTrace(TRACE_FILEPATH));
+
+	// ot@CJSONƂēǂ߂邩
+	std::ifstream ifs(TRACE_FILEPATH);
+	TEST_CHECK(ifs.is_open());
+	std::stringstream ss;
+	ss << ifs.rdbuf();
+	const std::string text = ss.str();
+	JsonValue root;
+	TEST_CHECK(JsonParser(text).Parse(root));
+	TEST_CHECK(root.type == JsonValue::Type::Object);
+	const JsonValue* events = root.Find("traceEvents");
+	TEST_CHECK(events && events->type == JsonValue::Type::Array);
+
+	// Xbhƃ][XbhƂɂ܂Ƃ߂
+	std::map<int, std::string> thread_names;
+	std::map<int, std::map<std::string, std::vector<TraceZone>>> thread_zones;
+	for (const JsonValue& event : events->array)
+	{
+		const JsonValue* name = event.Find("name");
+		const JsonValue* ph = event.Find("ph");
+		const JsonValue* tid = event.Find("tid");
+		const JsonValue* args = event.Find("args");
+		TEST_CHECK(name && ph && tid && args);
+		TEST_CHECK(event.Find("pid") && event.Find("pid")->number == 1.0);
+		if (ph->string == "M")
+		{
+			TEST_CHECK(name->string == "thread_name");
+			TEST_CHECK(args->Find("name"));
+			thread_names[static_cast<int>(tid->number)] = args->Find("name")->string;
+			continue;
+		}
+		TEST_CHECK(ph->string == "X");
+		const JsonValue* ts = event.Find("ts");
+		const JsonValue* dur = event.Find("dur");
+		const JsonValue* depth = args->Find("depth");
+		TEST_CHECK(ts && dur && depth);
+		TEST_CHECK(ts->number >= 0.0 && dur->number >= 0.0);
+		thread_zones[static_cast<int>(tid->number)][name->string].push_back({ ts->number, dur->number, static_cast<int>(depth->number) });
+	}
+
+	int worker_found = 0;
+	for (auto& [tid, zones] : thread_zones)
+	{
+		TEST_CHECK(thread_names.count(tid) == 1);
+		const std::string& thread_name = thread_names[tid];
+		if (thread_name == "Main")
+		{
+			// t[Ƃ̃][
+			TEST_CHECK(zones.size() == 1 && zones.count("Frame") == 1);
+			TEST_CHECK(static_cast<int>(zones["Frame"].size()) == frame_num);
+			continue;
+		}
+		TEST_CHECK(thread_name.compare(0, 7, "Worker ") == 0);
+		++worker_found;
+
+		auto& outer = zones["Outer"];
+		auto& inner = zones["Inner"];
+		auto& leaf = zones["Leaf \"quoted\"\\"];
+		TEST_CHECK(zones.size() == 3);
+		TEST_CHECK(outer.size() == LOOP_NUM && inner.size() == LOOP_NUM && leaf.size() == LOOP_NUM);
+		const auto by_begin = [](const TraceZone& a, const TraceZone& b) { return a.ts < b.ts; };
+		std::sort(outer.begin(), outer.end(), by_begin);
+		std::sort(inner.begin(), inner.end(), by_begin);
+		for (const auto& zone : outer)
+		{
+			TEST_CHECK(zone.depth == 0);
+		}
+		for (const auto& zone : inner)
+		{
+			TEST_CHECK(IsNested(outer, zone));
+		}
+		for (const auto& zone : leaf)
+		{
+			TEST_CHECK(IsNested(inner, zone));
+		}
+	}
+	TEST_CHECK(worker_found == WORKER_NUM);
+
+	std::printf("test_cpu_profiler : passed (%d frames, %d events)\n", frame_num, static_cast<int>(events->array.size()));
+	return 0;
+}
@@ -0,0 +1,227 @@
+#include "test_common.h"
+
+#include "Utility/inc/dynamic_aabb_tree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace TKGEngine;
+
+namespace
+{
+	constexpr float WORLD_SIZE = 100.0f;
+
+	// ؂̊Oŕێ鐶̗t
+	struct Proxy
+	{
+		int proxy_id = DynamicAABBTree::NULL_NODE;
+		Bounds aabb;
+	};
+
+	Bounds RandomAABB(Test::TestRandom& random)
+	{
+		return Bounds(
+			VECTOR3(random.Range(-WORLD_SIZE, WORLD_SIZE), random.Range(-WORLD_SIZE, WORLD_SIZE), random.Range(-WORLD_SIZE, WORLD_SIZE)),
+			VECTOR3(random.Range(0.1f, 5.0f), random.Range(0.1f, 5.0f), random.Range(0.1f, 5.0f)));
+	}
+
+	bool Overlaps(const Bounds& a, const Bounds& b)
+	{
+		const VECTOR3 a_c = a.GetCenter();
+		const VECTOR3 a_e = a.GetExtents();
+		const VECTOR3 b_c = b.GetCenter();
+		const VECTOR3 b_e = b.GetExtents();
+		return
+			std::abs(a_c.x - b_c.x) <= a_e.x + b_e.x &&
+			std::abs(a_c.y - b_c.y) <= a_e.y + b_e.y &&
+			std::abs(a_c.z - b_c.z) <= a_e.z + b_e.z;
+	}
+
+	bool Contains(const Bounds& outer, const Bounds& inner)
+	{
+		const VECTOR3 outer_c = outer.GetCenter();
+		const VECTOR3 outer_e = outer.GetExtents();
+		const VECTOR3 inner_c = inner.GetCenter();
+		const VECTOR3 inner_e = inner.GetExtents();
+		return
+			outer_c.x - outer_e.x <= inner_c.x - inner_e.x && inner_c.x + inner_e.x <= outer_c.x + outer_e.x &&
+			outer_c.y - outer_e.y <= inner_c.y - inner_e.y && inner_c.y + inner_e.y <= outer_c.y + outer_e.y &&
+			outer_c.z - outer_e.z <= inner_c.z - inner_e.z && inner_c.z + inner_e.z <= outer_c.z + outer_e.z;
+	}
+
+	// ؂̏ԂƊOŕێĂtv邱ƂmF
+	void CheckTree(const DynamicAABBTree& tree, const std::vector<Proxy>& proxies)
+	{
+		TEST_CHECK(tree.Validate());
+		TEST_CHECK(tree.GetProxyCount() == static_cast<int>(proxies.size()));
+		for (int i = 0; i < static_cast<int>(proxies.size()); ++i)
+		{
+			// user_dataɂproxies̗vfԍĂ
+			TEST_CHECK(tree.GetUserData(proxies[i].proxy_id) == i);
+			TEST_CHECK(Contains(tree.GetFatAABB(proxies[i].proxy_id), proxies[i].aabb));
+		}
+
+		// ؂̍͗t̐̑ΐxɎ܂
+		if (proxies.size() > 1)
+		{
+			const int max_height = 2 * static_cast<int>(std::ceil(std::log2(static_cast<double>(proxies.size())))) + 2;
+			TEST_CHECK(tree.GetHeight() <= max_height);
+		}
+	}
+
+	// SĂ̗t𒲂ׂʂQuery̌ʂv邱ƂmF
+	void CheckQuery(const DynamicAABBTree& tree, const std::vector<Proxy>& proxies, const Bounds& query)
+	{
+		std::vector<int> expected;
+		for (int i = 0; i < static_cast<int>(proxies.size()); ++i)
+		{
+			if (Overlaps(tree.GetFatAABB(proxies[i].proxy_id), query))
+			{
+				expected.emplace_back(i);
+			}
+		}
+
+		std::vector<int> result;
+		tree.Query(
+			[&query](const Bounds& aabb)
+			{
+				return Overlaps(aabb, query);
+			},
+			[&result](const int user_data, const Bounds&)
+			{
+				result.emplace_back(user_data);
+			});
+
+		std::sort(result.begin(), result.end());
+		TEST_CHECK(result == expected);
+	}
+
+	void AddProxy(DynamicAABBTree& tree, std::vector<Proxy>& proxies, const Bounds& aabb)
+	{
+		Proxy proxy;
+		proxy.aabb = aabb;
+		proxy.proxy_id = tree.CreateProxy(aabb, static_cast<int>(proxies.size()));
+		proxies.emplace_back(proxy);
+	}
+
+	// Ɠւč폜(ւtuser_dataXV)
+	void RemoveProxy(DynamicAABBTree& tree, std::vector<Proxy>& proxies, const int index)
+	{
+		tree.DestroyProxy(proxies[index].proxy_id);
+		if (index != static_cast<int>(proxies.size()) - 1)
+		{
+			proxies[index] = proxies.back();
+			tree.SetUserData(proxies[index].proxy_id, index);
+		}
+		proxies.pop_back();
+	}
+}
+
+int main()
+{
+	Test::TestRandom random(0xaabb);
+	DynamicAABBTree tree;
+	std::vector<Proxy> proxies;
+
+	// ̖
+	CheckTree(tree, proxies);
+	CheckQuery(tree, proxies, RandomAABB(random));
+
+	// }
+	constexpr int INITIAL_PROXY_NUM = 1000;
+	for (int i = 0; i < INITIAL_PROXY_NUM; ++i)
+	{
+		AddProxy(tree, proxies, RandomAABB(random));
+		if (i < 16 || i % 97 == 0)
+		{
+			CheckTree(tree, proxies);
+		}
+	}
+	CheckTree(tree, proxies);
+
+	// }A폜AړČJԂ
+	constexpr int OPERATION_NUM = 20000;
+	for (int op = 0; op < OPERATION_NUM; ++op)
+	{
+		const unsigned type = random.Next() % 8;
+		if (type < 2 || proxies.empty())
+		{
+			AddProxy(tree, proxies, RandomAABB(random));
+		}
+		else if (type < 4)
+		{
+			RemoveProxy(tree, proxies, static_cast<int>(random.Next() % proxies.size()));
+		}
+		else
+		{
+			Proxy& proxy = proxies[random.Next() % proxies.size()];
+			const Bounds prev_fat_aabb = tree.GetFatAABB(proxy.proxy_id);
+			// Ȉړfat AABBɎ܂邱ƂA傫Ȉړ͍đ}ɂȂ
+			const float distance = (type < 7) ? 0.05f : WORLD_SIZE;
+			const VECTOR3 offset(random.Range(-distance, distance), random.Range(-distance, distance), random.Range(-distance, distance));
+			proxy.aabb = Bounds(proxy.aabb.GetCenter() + offset, proxy.aabb.GetExtents());
+
+			const bool is_inside = Contains(prev_fat_aabb, proxy.aabb);
+			const bool is_reinserted = tree.MoveProxy(proxy.proxy_id, proxy.aabb);
+			TEST_CHECK(is_reinserted == !is_inside);
+			if (!is_reinserted)
+			{
+				const Bounds fat_aabb = tree.GetFatAABB(proxy.proxy_id);
+				TEST_CHECK(fat_aabb.GetCenter() == prev_fat_aabb.GetCenter());
+				TEST_CHECK(fat_aabb.GetExtents() == prev_fat_aabb.GetExtents());
+			}
+		}
+
+		if (op % 250 == 0)
+		{
+			CheckTree(tree, proxies);
+			for (int i = 0; i < 8; ++i)
+			{
+				const Bounds query(
+					VECTOR3(random.Range(-WORLD_SIZE, WORLD_SIZE), random.Range(-WORLD_SIZE, WORLD_SIZE), random.Range(-WORLD_SIZE, WORLD_SIZE)),
+					VECTOR3(random.Range(1.0f, 30.0f), random.Range(1.0f, 30.0f), random.Range(1.0f, 30.0f)));
+				CheckQuery(tree, proxies, query);
+			}
+		}
+	}
+	CheckTree(tree, proxies);
+
+	// Ŝ𕢂NG͑SĂ̗tԂ
+	{
+		const Bounds all(VECTOR3(0.0f, 0.0f, 0.0f), VECTOR3(WORLD_SIZE * 4.0f, WORLD_SIZE * 4.0f, WORLD_SIZE * 4.0f));
+		int count = 0;
+		tree.Query(
+			[&all](const Bounds& aabb)
+			{
+				return Overlaps(aabb, all);
+			},
+			[&count](int, const Bounds&)
+			{
+				++count;
+			});
+		TEST_CHECK(count == static_cast<int>(proxies.size()));
+	}
+	std::printf("%d proxies : height %d\n", tree.GetProxyCount(), tree.GetHeight());
+
+	// Sč폜Ƌ̖؂ɖ߂Am[h͍ėp
+	while (!proxies.empty())
+	{
+		RemoveProxy(tree, proxies, static_cast<int>(random.Next() % proxies.size()));
+		if (proxies.size() % 100 == 0)
+		{
+			CheckTree(tree, proxies);
+		}
+	}
+	TEST_CHECK(tree.GetHeight() == 0);
+	CheckQuery(tree, proxies, RandomAABB(random));
+	AddProxy(tree, proxies, RandomAABB(random));
+	CheckTree(tree, proxies);
+
+	tree.Clear();
+	proxies.clear();
+	CheckTree(tree, proxies);
+
+	std::printf("test_dynamic_aabb_tree : passed\n");
+	return 0;
+}
@@ -0,0 +1,261 @@
+#include "test_common.h"
+
+#include "Utility/inc/light_cluster.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace TKGEngine;
+
+namespace
+{
+	constexpr float NEAR_PLANE = 0.1f;
+	constexpr float FAR_PLANE = 500.0f;
+	constexpr float FOV_Y = 1.0471976f;	// 60
+	// ̌덷ɉeȂ悤ACg̋E̓_mF
+	constexpr float SAMPLE_MARGIN = 0.98f;
+	constexpr int SAMPLE_PER_LIGHT = 400;
+
+	struct Camera
+	{
+		MATRIX view;
+		MATRIX projection;
+	};
+
+	Camera CreateCamera(const VECTOR3& eye, const VECTOR3& target, const float aspect)
+	{
+		Camera camera;
+		camera.view = MATRIX::CreateLookAt(eye, target, VECTOR3::Up);
+		camera.projection = MATRIX::CreatePerspectiveFieldOfView(FOV_Y, aspect, NEAR_PLANE, FAR_PLANE);
+		return camera;
+	}
+
+	VECTOR3 RandomDirection(Test::TestRandom& random)
+	{
+		while (true)
+		{
+			const VECTOR3 v(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f));
+			const float length_sq = v.LengthSq();
+			if (length_sq > 1.0e-4f && length_sq <= 1.0f)
+				return v.Normalized();
+		}
+	}
+
+	// Cg͈̔(X|bgCg͉~)̓̓_
+	VECTOR3 RandomPointInLight(Test::TestRandom& random, const ClusterLightShape& light)
+	{
+		const float distance = light.range * SAMPLE_MARGIN * std::cbrt(random.Range(0.05f, 1.0f));
+		if (light.cone_cos <= -1.0f)
+		{
+			return light.position + RandomDirection(random) * distance;
+		}
+		// ~̎̊pxƎ̊pxŌ߂
+		const float half_angle = std::acos(light.cone_cos) * SAMPLE_MARGIN;
+		const float cos_theta = 1.0f - random.Range(0.0f, 1.0f) * (1.0f - std::cos(half_angle));
+		const float sin_theta = std::sqrt((std::max)(1.0f - cos_theta * cos_theta, 0.0f));
+		const float phi = random.Range(0.0f, 6.2831853f);
+		const VECTOR3 axis = light.direction.Normalized();
+		const VECTOR3 tangent = axis.Cross(std::fabs(axis.y) < 0.9f ? VECTOR3::Up : VECTOR3::Right).Normalized();
+		const VECTOR3 bitangent = axis.Cross(tangent);
+		const VECTOR3 dir = axis * cos_theta + (tangent * std::cos(phi) + bitangent * std::sin(phi)) * sin_theta;
+		return light.position + dir * distance;
+	}
+
+	// VF[_[(Light.hlsli GetLightClusterRange)Ɠ@œ_NX^[߂
+	// ʊOƕ`͈͊O̐[x-1Ԃ
+	int ClusterIndexOf(const LightCluster& cluster, const Camera& camera, const VECTOR3& w_position)
+	{
+		const VECTOR3 v_position = VECTOR3::TransformMatrix(w_position, camera.view);
+#ifdef AXIS_RH
+		const float depth = -v_position.z;
+#else
+		const float depth = v_position.z;
+#endif// #ifdef AXIS_RH
+		if (depth < NEAR_PLANE || depth > FAR_PLANE)
+			return -1;
+		const VECTOR3 ndc = VECTOR3::TransformMatrix(v_position, camera.projection);
+		if (std::fabs(ndc.x) >= 1.0f || std::fabs(ndc.y) >= 1.0f)
+			return -1;
+
+		const int tile_x = (std::min)((std::max)(static_cast<int>(std::floor((ndc.x * 0.5f + 0.5f) * CLUSTER_NUM_X)), 0), CLUSTER_NUM_X - 1);
+		const int tile_y = (std::min)((std::max)(static_cast<int>(std::floor((ndc.y * -0.5f + 0.5f) * CLUSTER_NUM_Y)), 0), CLUSTER_NUM_Y - 1);
+		const float slice_f = std::floor(std::log(depth) * cluster.GetDepthSliceScale() + cluster.GetDepthSliceBias());
+		const int slice = (std::min)((std::max)(static_cast<int>(slice_f), 0), CLUSTER_NUM_Z - 1);
+		return tile_x + tile_y * CLUSTER_NUM_X + slice * CLUSTER_NUM_X * CLUSTER_NUM_Y;
+	}
+
+	bool HasLight(const LightCluster& cluster, const int cluster_index, const std::uint32_t light_index)
+	{
+		const ClusterRange& range = cluster.GetClusterRanges()[cluster_index];
+		const auto begin = cluster.GetLightIndices().begin() + range.offset;
+		const auto end = begin + range.count;
+		return std::find(begin, end, light_index) != end;
+	}
+
+	// Cg蓖ĂꂽNX^[
+	int CountClusters(const LightCluster& cluster, const std::uint32_t light_index)
+	{
+		int count = 0;
+		for (int i = 0; i < CLUSTER_NUM; ++i)
+		{
+			if (HasLight(cluster, i, light_index))
+			{
+				++count;
+			}
+		}
+		return count;
+	}
+
+	// ͈͂XgԂȂANX^[̃CfbNXŏdȂƂmF
+	void CheckLayout(const LightCluster& cluster, const size_t light_num)
+	{
+		const auto& ranges = cluster.GetClusterRanges();
+		const auto& indices = cluster.GetLightIndices();
+		TEST_CHECK(ranges.size() == CLUSTER_NUM);
+
+		std::uint32_t offset = 0;
+		for (const auto& range : ranges)
+		{
+			TEST_CHECK(range.offset == offset);
+			offset += range.count;
+			for (std::uint32_t i = 0; i < range.count; ++i)
+			{
+				const std::uint32_t light_index = indices[range.offset + i];
+				TEST_CHECK(light_index < light_num);
+				TEST_CHECK(i == 0 || indices[range.offset + i - 1] < light_index);
+			}
+		}
+		TEST_CHECK(offset == indices.size());
+	}
+
+	// Cg̕`悳_́AK̓_̃NX^[Ɋ蓖ĂĂ
+	int CheckCoverage(Test::TestRandom& random, const LightCluster& cluster, const Camera& camera, const std::vector<ClusterLightShape>& lights)
+	{
+		int visible_sample_num = 0;
+		for (size_t i = 0; i < lights.size(); ++i)
+		{
+			for (int sample = 0; sample < SAMPLE_PER_LIGHT; ++sample)
+			{
+				const int cluster_index = ClusterIndexOf(cluster, camera, RandomPointInLight(random, lights[i]));
+				if (cluster_index < 0)
+					continue;
+				TEST_CHECK(HasLight(cluster, cluster_index, static_cast<std::uint32_t>(i)));
+				++visible_sample_num;
+			}
+		}
+		return visible_sample_num;
+	}
+
+	std::vector<ClusterLightShape> CreateLights(Test::TestRandom& random, const int light_num)
+	{
+		std::vector<ClusterLightShape> lights(light_num);
+		for (int i = 0; i < light_num; ++i)
+		{
+			ClusterLightShape& light = lights[i];
+			light.position = VECTOR3(random.Range(-40.0f, 40.0f), random.Range(-10.0f, 10.0f), random.Range(-80.0f, 5.0f));
+			light.range = random.Range(0.5f, 15.0f);
+			// ̓X|bgCg(~ƍL~)
+			if (i % 2 == 1)
+			{
+				light.direction = RandomDirection(random);
+				light.cone_cos = std::cos(random.Range(0.1f, 1.4f));
+			}
+		}
+		return lights;
+	}
+}
+
+int main()
+{
+	JobSystem::Initialize();
+
+	Test::TestRandom random(0x1c1u);
+	LightCluster cluster;
+	const Camera camera = CreateCamera(VECTOR3(0.0f, 2.0f, 10.0f), VECTOR3(0.0f, 0.0f, -30.0f), 16.0f / 9.0f);
+
+	// CgȂΑSẴNX^[
+	{
+		cluster.Build(camera.view, camera.projection, NEAR_PLANE, FAR_PLANE, {});
+		CheckLayout(cluster, 0);
+		TEST_CHECK(cluster.GetLightIndices().empty());
+	}
+
+	// Cg̓_͑SẴNX^[Ɋ܂܂
+	const std::vector<ClusterLightShape> lights = CreateLights(random, 256);
+	{
+		Test::Stopwatch stopwatch;
+		cluster.Build(camera.view, camera.projection, NEAR_PLANE, FAR_PLANE, lights);
+		const double build_ms = stopwatch.ElapsedMilliseconds();
+		CheckLayout(cluster, lights.size());
+		const int visible_sample_num = CheckCoverage(random, cluster, camera, lights);
+		TEST_CHECK(visible_sample_num > SAMPLE_PER_LIGHT * 16);
+		std::printf("%zu lights : %zu indices, build %.3f ms\n", lights.size(), cluster.GetLightIndices().size(), build_ms);
+	}
+
+	// ͓͂ʂɂȂ
+	{
+		const std::vector<ClusterRange> ranges = cluster.GetClusterRanges();
+		const std::vector<std::uint32_t> indices = cluster.GetLightIndices();
+		cluster.Build(camera.view, camera.projection, NEAR_PLANE, FAR_PLANE, lights);
+		TEST_CHECK(cluster.GetLightIndices() == indices);
+		for (int i = 0; i < CLUSTER_NUM; ++i)
+		{
+			TEST_CHECK(cluster.GetClusterRanges()[i].offset == ranges[i].offset);
+			TEST_CHECK(cluster.GetClusterRanges()[i].count == ranges[i].count);
+		}
+	}
+
+	// JƃvWFNVςĂNX^[蒼Ċ蓖Ă
+	for (int i = 0; i < 8; ++i)
+	{
+		const VECTOR3 eye(random.Range(-20.0f, 20.0f), random.Range(-5.0f, 10.0f), random.Range(0.0f, 20.0f));
+		const VECTOR3 target(random.Range(-30.0f, 30.0f), random.Range(-5.0f, 5.0f), random.Range(-60.0f, -20.0f));
+		const Camera moved = CreateCamera(eye, target, random.Range(1.0f, 2.4f));
+		cluster.Build(moved.view, moved.projection, NEAR_PLANE, FAR_PLANE, lights);
+		CheckLayout(cluster, lights.size());
+		CheckCoverage(random, cluster, moved, lights);
+	}
+
+	// `͈͊ÕCg͂ǂ̃NX^[ɂ蓖ĂȂ
+	{
+		std::vector<ClusterLightShape> outside(2);
+		// J̌
+		outside[0].position = VECTOR3(0.0f, 2.0f, 30.0f);
+		outside[0].range = 5.0f;
+		// ʂ艜
+		outside[1].position = VECTOR3(0.0f, 0.0f, 10.0f - FAR_PLANE - 50.0f);
+		outside[1].range = 20.0f;
+		cluster.Build(camera.view, camera.projection, NEAR_PLANE, FAR_PLANE, outside);
+		CheckLayout(cluster, outside.size());
+		TEST_CHECK(cluster.GetLightIndices().empty());
+	}
+
+	// ȃCg͋߂̃NX^[Ɋ蓖āAX|bgCg͓͈͂̃|CgCg菭ȂȂ
+	{
+		std::vector<ClusterLightShape> local(2);
+		local[0].position = VECTOR3(1.0f, 1.5f, -5.0f);
+		local[0].range = 0.5f;
+		local[1].position = VECTOR3(-3.0f, 0.0f, -20.0f);
+		local[1].range = 12.0f;
+		std::vector<ClusterLightShape> spot = local;
+		spot[1].direction = VECTOR3(-1.0f, 0.0f, 0.0f);
+		spot[1].cone_cos = std::cos(0.35f);
+
+		cluster.Build(camera.view, camera.projection, NEAR_PLANE, FAR_PLANE, local);
+		const int small_count = CountClusters(cluster, 0);
+		const int point_count = CountClusters(cluster, 1);
+		cluster.Build(camera.view, camera.projection, NEAR_PLANE, FAR_PLANE, spot);
+		CheckCoverage(random, cluster, camera, spot);
+		const int spot_count = CountClusters(cluster, 1);
+
+		TEST_CHECK(small_count > 0 && small_count <= 64);
+		TEST_CHECK(spot_count > 0 && spot_count < point_count);
+		std::printf("clusters : small point %d, point %d, spot %d\n", small_count, point_count, spot_count);
+	}
+
+	JobSystem::Terminate();
+
+	std::printf("test_light_cluster : passed\n");
+	return 0;
+}
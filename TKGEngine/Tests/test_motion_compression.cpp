@@ -0,0 +1,287 @@
+#include "test_common.h"
+
+#include "Application/Resource/src/Motion/Motion_Compression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+using namespace TKGEngine;
+using namespace TKGEngine::Animations;
+
+namespace
+{
+	constexpr int BONE_NUM = 48;
+	constexpr int FRAME_NUM = 300;
+	constexpr float SAMPLING_RATE = 60.0f;
+	// 덷̑Ɋ܂܂镂_̊ۂߕ(sړ͍ő50x)
+	constexpr float ERROR_EPSILON = 1.0e-5f;
+
+	// gbN̓
+	enum class TrackPattern
+	{
+		Constant,	// St[l
+		Linear,		// ̑
+		Smooth,		// g
+		Step,		// ԊuŒl
+		Noise,		// t[Ƃɂ΂΂
+
+		Max_TrackPattern
+	};
+
+	// Ɗpx(WA)̉]
+	Quaternion AxisAngle(const VECTOR3& axis, const float angle)
+	{
+		const VECTOR3 n = axis.Normalized();
+		const float s = std::sin(angle * 0.5f);
+		return Quaternion(n.x * s, n.y * s, n.z * s, std::cos(angle * 0.5f));
+	}
+
+	float PatternValue(const TrackPattern pattern, const int frame, const float phase, Test::TestRandom& random)
+	{
+		const float t = static_cast<float>(frame) / SAMPLING_RATE;
+		switch (pattern)
+		{
+			case TrackPattern::Constant:
+				return phase;
+			case TrackPattern::Linear:
+				return phase + t * 0.8f;
+			case TrackPattern::Smooth:
+				return std::sin(t * 3.0f + phase) * 0.7f + std::sin(t * 7.3f + phase * 2.0f) * 0.2f;
+			case TrackPattern::Step:
+				return static_cast<float>((frame / 20) % 3) * 0.5f + phase;
+			case TrackPattern::Noise:
+				return random.Range(-1.0f, 1.0f);
+			default:
+				return 0.0f;
+		}
+	}
+
+	// {[ƂɕsړA]AXP[̓ςAj[V쐬
+	Animation CreateAnimation(Test::TestRandom& random, const int frame_num)
+	{
+		Animation animation;
+		animation.sampling_rate = SAMPLING_RATE;
+		animation.seconds_length = static_cast<float>(frame_num - 1) / SAMPLING_RATE;
+		animation.keyframes.resize(frame_num);
+
+		const int pattern_num = static_cast<int>(TrackPattern::Max_TrackPattern);
+		std::vector<VECTOR3> axes(BONE_NUM);
+		std::vector<float> phases(BONE_NUM);
+		for (int bone = 0; bone < BONE_NUM; ++bone)
+		{
+			axes[bone] = VECTOR3(random.Range(-1.0f, 1.0f), random.Range(-1.0f, 1.0f), random.Range(0.1f, 1.0f));
+			phases[bone] = random.Range(-1.0f, 1.0f);
+		}
+
+		for (int frame = 0; frame < frame_num; ++frame)
+		{
+			KeyFrame& keyframe = animation.keyframes[frame];
+			keyframe.seconds = static_cast<float>(frame) / SAMPLING_RATE;
+			keyframe.keys.resize(BONE_NUM);
+			for (int bone = 0; bone < BONE_NUM; ++bone)
+			{
+				// 3`lʂ̃p^[ɂȂ悤ɂ炷
+				const auto translate_pattern = static_cast<TrackPattern>(bone % pattern_num);
+				const auto rotate_pattern = static_cast<TrackPattern>((bone / pattern_num) % pattern_num);
+				const auto scale_pattern = static_cast<TrackPattern>((bone + 2) % pattern_num);
+				const float phase = phases[bone];
+
+				KeyData& key = keyframe.keys[bone];
+				const float translate = PatternValue(translate_pattern, frame, phase, random);
+				key.translate = VECTOR3(translate * 10.0f, translate * -3.0f + phase, 5.0f);
+
+				// f[^Ɋ܂܂ꂤ q  -q ̓ւ
+				const float angle = PatternValue(rotate_pattern, frame, phase, random) * 3.0f;
+				key.rotate = AxisAngle(axes[bone], angle);
+				if (frame % 7 == 3)
+				{
+					key.rotate = Quaternion(-key.rotate.x, -key.rotate.y, -key.rotate.z, -key.rotate.w);
+				}
+
+				const float scale = 1.0f + PatternValue(scale_pattern, frame, phase, random) * 0.25f;
+				key.scale = VECTOR3(scale, scale, 1.0f);
+			}
+		}
+		return animation;
+	}
+
+	void CheckError(const MotionCompressionReport& report, const MotionCompressionSettings& settings)
+	{
+		TEST_CHECK(report.max_translate_error <= settings.translate_tolerance + ERROR_EPSILON);
+		TEST_CHECK(report.max_rotate_error <= settings.rotate_tolerance + ERROR_EPSILON);
+		TEST_CHECK(report.max_scale_error <= settings.scale_tolerance + ERROR_EPSILON);
+	}
+
+	float QuaternionAngle(const Quaternion& q1, const Quaternion& q2)
+	{
+		const float dot = (std::min)(std::fabs(Quaternion::Dot(q1, q2)), 1.0f);
+		return 2.0f * std::acos(dot);
+	}
+
+	// ](acos1t߂̕\ႢߐŔr)
+	bool NearlyEqualRotation(const Quaternion& q1, const Quaternion& q2)
+	{
+		const float sign = Quaternion::Dot(q1, q2) < 0.0f ? -1.0f : 1.0f;
+		return
+			std::fabs(q1.x - q2.x * sign) <= ERROR_EPSILON &&
+			std::fabs(q1.y - q2.y * sign) <= ERROR_EPSILON &&
+			std::fabs(q1.z - q2.z * sign) <= ERROR_EPSILON &&
+			std::fabs(q1.w - q2.w * sign) <= ERROR_EPSILON;
+	}
+}
+
+int main()
+{
+	Test::TestRandom random(0xc0de);
+	const Animation animation = CreateAnimation(random, FRAME_NUM);
+
+	// 1t[̃Aj[V
+	{
+		CompressedAnimation compressed;
+		compressed.Compress(Animation(), MotionCompressionSettings());
+		TEST_CHECK(compressed.IsEmpty());
+
+		Animation single = CreateAnimation(random, 1);
+		compressed.Compress(single, MotionCompressionSettings());
+		TEST_CHECK(compressed.GetFrameCount() == 1);
+		TEST_CHECK(compressed.GetTrackNum() == BONE_NUM);
+		CheckError(CompressedAnimation::Measure(single, compressed), MotionCompressionSettings());
+	}
+
+	// e덷ƂɑSt[̌덷܂邱ƂmF
+	const MotionCompressionSettings settings_list[] =
+	{
+		{ 1.0e-4f, 1.0e-3f, 1.0e-4f },	// l
+		{ 1.0e-3f, 5.0e-3f, 1.0e-3f },
+		{ 1.0e-2f, 2.0e-2f, 1.0e-2f },
+	};
+	for (const auto& settings : settings_list)
+	{
+		CompressedAnimation compressed;
+		compressed.Compress(animation, settings);
+		TEST_CHECK(compressed.GetFrameCount() == FRAME_NUM);
+		TEST_CHECK(compressed.GetTrackNum() == BONE_NUM);
+
+		const MotionCompressionReport report = CompressedAnimation::Measure(animation, compressed);
+		CheckError(report, settings);
+		TEST_CHECK(report.compressed_bytes < report.raw_bytes);
+
+		std::printf("tolerance(%g, %g, %g) : %zu -> %zu bytes, error(%g, %g, %g), sample %.3f ms -> %.3f ms\n",
+			settings.translate_tolerance, settings.rotate_tolerance, settings.scale_tolerance,
+			report.raw_bytes, report.compressed_bytes,
+			report.max_translate_error, report.max_rotate_error, report.max_scale_error,
+			report.raw_sample_ms, report.compressed_sample_ms);
+	}
+
+	const MotionCompressionSettings settings;
+	CompressedAnimation compressed;
+	compressed.Compress(animation, settings);
+
+	// t[Ԃłf[^̕ԂƂ̍̓L[̌덷͈̔͂Ɏ܂
+	{
+		std::vector<std::int16_t> remap_table(BONE_NUM);
+		for (int i = 0; i < BONE_NUM; ++i)
+		{
+			remap_table[i] = static_cast<std::int16_t>(i);
+		}
+		std::vector<KeyData> raw(BONE_NUM);
+		std::vector<KeyData> decoded(BONE_NUM);
+		for (int i = 0; i < FRAME_NUM * 4; ++i)
+		{
+			const float key = random.Range(0.0f, static_cast<float>(FRAME_NUM - 1));
+			SampleAnimation(animation, key, remap_table, raw);
+			compressed.Sample(key, remap_table, decoded);
+			for (int bone = 0; bone < BONE_NUM; ++bone)
+			{
+				TEST_CHECK(VECTOR3::Distance(raw[bone].translate, decoded[bone].translate) <= settings.translate_tolerance + ERROR_EPSILON);
+				TEST_CHECK(VECTOR3::Distance(raw[bone].scale, decoded[bone].scale) <= settings.scale_tolerance + ERROR_EPSILON);
+				// ]̕Ԃ͐`ł͂Ȃߗ]T
+				TEST_CHECK(QuaternionAngle(raw[bone].rotate, decoded[bone].rotate) <= settings.rotate_tolerance * 2.0f);
+			}
+		}
+	}
+
+	// ͈͊Õt[ʒu͐擪Ɩ̃L[ɂȂ
+	{
+		std::vector<KeyData> first;
+		std::vector<KeyData> before;
+		std::vector<KeyData> last;
+		std::vector<KeyData> after;
+		compressed.SampleAll(0.0f, first);
+		compressed.SampleAll(-10.0f, before);
+		compressed.SampleAll(static_cast<float>(FRAME_NUM - 1), last);
+		compressed.SampleAll(static_cast<float>(FRAME_NUM + 10), after);
+		for (int bone = 0; bone < BONE_NUM; ++bone)
+		{
+			TEST_CHECK(first[bone].translate == before[bone].translate);
+			TEST_CHECK(first[bone].scale == before[bone].scale);
+			TEST_CHECK(NearlyEqualRotation(first[bone].rotate, before[bone].rotate));
+			TEST_CHECK(last[bone].translate == after[bone].translate);
+			TEST_CHECK(last[bone].scale == after[bone].scale);
+			TEST_CHECK(NearlyEqualRotation(last[bone].rotate, after[bone].rotate));
+		}
+	}
+
+	// ϊe[uAvatar̃m[hɕׁAΉȂm[h͏Ȃ
+	{
+		std::vector<KeyData> all;
+		const float key = 123.25f;
+		compressed.SampleAll(key, all);
+
+		constexpr int NODE_NUM = BONE_NUM + 4;
+		std::vector<std::int16_t> remap_table(NODE_NUM);
+		for (int node = 0; node < NODE_NUM; ++node)
+		{
+			remap_table[node] = (node % 5 == 4 || node >= BONE_NUM) ? static_cast<std::int16_t>(-1) : static_cast<std::int16_t>(BONE_NUM - 1 - node);
+		}
+		KeyData untouched;
+		untouched.translate = VECTOR3(123.0f, 456.0f, 789.0f);
+		std::vector<KeyData> dst(NODE_NUM, untouched);
+		compressed.Sample(key, remap_table, dst);
+		for (int node = 0; node < NODE_NUM; ++node)
+		{
+			const KeyData& expected = remap_table[node] < 0 ? untouched : all[remap_table[node]];
+			TEST_CHECK(dst[node].translate == expected.translate);
+			TEST_CHECK(dst[node].scale == expected.scale);
+			TEST_CHECK(NearlyEqualRotation(dst[node].rotate, expected.rotate));
+		}
+	}
+
+	// VACYēǂݍłlɂȂ
+	{
+		std::stringstream stream;
+		{
+			cereal::BinaryOutputArchive archive(stream);
+			archive(compressed);
+		}
+		CompressedAnimation loaded;
+		{
+			cereal::BinaryInputArchive archive(stream);
+			archive(loaded);
+		}
+		TEST_CHECK(loaded.GetFrameCount() == compressed.GetFrameCount());
+		TEST_CHECK(loaded.GetTrackNum() == compressed.GetTrackNum());
+		TEST_CHECK(loaded.GetMemorySize() == compressed.GetMemorySize());
+
+		std::vector<KeyData> expected;
+		std::vector<KeyData> decoded;
+		for (int frame = 0; frame < FRAME_NUM; frame += 7)
+		{
+			const float key = static_cast<float>(frame) + 0.5f;
+			compressed.SampleAll(key, expected);
+			loaded.SampleAll(key, decoded);
+			for (int bone = 0; bone < BONE_NUM; ++bone)
+			{
+				TEST_CHECK(decoded[bone].translate == expected[bone].translate);
+				TEST_CHECK(decoded[bone].scale == expected[bone].scale);
+				TEST_CHECK(decoded[bone].rotate.x == expected[bone].rotate.x && decoded[bone].rotate.y == expected[bone].rotate.y &&
+					decoded[bone].rotate.z == expected[bone].rotate.z && decoded[bone].rotate.w == expected[bone].rotate.w);
+			}
+		}
+	}
+
+	std::printf("test_motion_compression : passed\n");
+	return 0;
+}
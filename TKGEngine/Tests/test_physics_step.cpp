@@ -0,0 +1,320 @@
+#include "test_common.h"
+
+#include "Systems/inc/Physics_Defined.h"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace TKGEngine;
+
+namespace
+{
+	constexpr float FIXED_TIME_STEP = 1.0f / 60.0f;
+	constexpr int MAX_SUB_STEPS = 4;
+	constexpr float TRACE_SECONDS = 6.0f;
+
+	// TuXebvI̍̂̏
+	struct BodyState
+	{
+		btScalar origin[3];
+		btScalar rotation[4];
+		btScalar linear_velocity[3];
+	};
+
+	// TuXebv1񕪂̋L^
+	struct TickRecord
+	{
+		btScalar time_step = 0;
+		std::vector<BodyState> bodies;
+		// ڐG_}jtH[h
+		int contact_manifold_num = 0;
+	};
+
+	// PhysicsSystem::InitializeƓ\̃[h
+	class TestWorld
+	{
+	public:
+		TestWorld()
+		{
+			btDefaultCollisionConstructionInfo cci;
+			m_collision_configuration = std::make_unique<btDefaultCollisionConfiguration>(cci);
+			m_collision_dispatcher = std::make_unique<btCollisionDispatcher>(m_collision_configuration.get());
+			m_broadphase = std::make_unique<btDbvtBroadphase>();
+			m_solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+			m_world = std::make_unique<btDiscreteDynamicsWorld>(
+				m_collision_dispatcher.get(), m_broadphase.get(), m_solver.get(), m_collision_configuration.get());
+			m_world->setGravity(btVector3(0.0f, -9.8f, 0.0f));
+			m_world->setInternalTickCallback(OnInternalTick, this);
+			m_world->setLatencyMotionStateInterpolation(true);
+
+			// nʂƁAdȂȂ痎ĐςݏdȂ鋅Ɣ
+			m_ground_shape = std::make_unique<btBoxShape>(btVector3(20.0f, 0.5f, 20.0f));
+			m_sphere_shape = std::make_unique<btSphereShape>(0.5f);
+			m_box_shape = std::make_unique<btBoxShape>(btVector3(0.4f, 0.3f, 0.5f));
+			AddBody(m_ground_shape.get(), 0.0f, btVector3(0.0f, -0.5f, 0.0f));
+			for (int i = 0; i < 12; ++i)
+			{
+				const btVector3 position(0.3f * static_cast<float>(i % 3) - 0.3f, 2.0f + 1.1f * static_cast<float>(i), 0.2f * static_cast<float>(i % 2));
+				AddBody(i % 2 == 0 ? m_sphere_shape.get() : m_box_shape.get(), 1.0f + 0.5f * static_cast<float>(i % 3), position);
+			}
+		}
+
+		~TestWorld()
+		{
+			for (int i = m_world->getNumCollisionObjects() - 1; i >= 0; --i)
+			{
+				btCollisionObject* obj = m_world->getCollisionObjectArray()[i];
+				btRigidBody* body = btRigidBody::upcast(obj);
+				m_world->removeCollisionObject(obj);
+				if (body)
+				{
+					delete body->getMotionState();
+				}
+				delete obj;
+			}
+		}
+
+		// 1t[i߂ĎsTuXebvԂ
+		int Step(const float elapsed_time, const bool use_fixed_time_step)
+		{
+			return StepPhysicsWorld(m_world.get(), elapsed_time, use_fixed_time_step, FIXED_TIME_STEP, MAX_SUB_STEPS);
+		}
+
+		const std::vector<TickRecord>& GetTicks() const
+		{
+			return m_ticks;
+		}
+
+		// MotionStateɓnꂽ(Ԃ)p
+		btVector3 GetGraphicsOrigin(const int body_index) const
+		{
+			btTransform transform;
+			m_bodies[body_index]->getMotionState()->getWorldTransform(transform);
+			return transform.getOrigin();
+		}
+
+		int GetBodyNum() const
+		{
+			return static_cast<int>(m_bodies.size());
+		}
+
+	private:
+		void AddBody(btCollisionShape* shape, const btScalar mass, const btVector3& position)
+		{
+			btVector3 inertia(0.0f, 0.0f, 0.0f);
+			if (mass > 0.0f)
+			{
+				shape->calculateLocalInertia(mass, inertia);
+			}
+			auto* motion_state = new btDefaultMotionState(btTransform(btQuaternion::getIdentity(), position));
+			auto* body = new btRigidBody(btRigidBody::btRigidBodyConstructionInfo(mass, motion_state, shape, inertia));
+			m_world->addRigidBody(body);
+			if (mass > 0.0f)
+			{
+				m_bodies.emplace_back(body);
+			}
+		}
+
+		static void OnInternalTick(btDynamicsWorld* world, const btScalar time_step)
+		{
+			auto* test_world = static_cast<TestWorld*>(world->getWorldUserInfo());
+			TickRecord record;
+			record.time_step = time_step;
+			for (const btRigidBody* body : test_world->m_bodies)
+			{
+				const btTransform& transform = body->getWorldTransform();
+				const btQuaternion rotation = transform.getRotation();
+				BodyState state = {};
+				for (int i = 0; i < 3; ++i)
+				{
+					state.origin[i] = transform.getOrigin()[i];
+					state.linear_velocity[i] = body->getLinearVelocity()[i];
+				}
+				for (int i = 0; i < 4; ++i)
+				{
+					state.rotation[i] = rotation[i];
+				}
+				record.bodies.emplace_back(state);
+			}
+			// PhysicsSystem::UpdateCollisionStateƓڐG_̂}jtH[h𐔂
+			btDispatcher* dispatcher = world->getDispatcher();
+			for (int i = 0; i < dispatcher->getNumManifolds(); ++i)
+			{
+				if (dispatcher->getManifoldByIndexInternal(i)->getNumContacts() > 0)
+				{
+					++record.contact_manifold_num;
+				}
+			}
+			test_world->m_ticks.emplace_back(std::move(record));
+		}
+
+		std::unique_ptr<btDefaultCollisionConfiguration> m_collision_configuration;
+		std::unique_ptr<btCollisionDispatcher> m_collision_dispatcher;
+		std::unique_ptr<btBroadphaseInterface> m_broadphase;
+		std::unique_ptr<btSequentialImpulseConstraintSolver> m_solver;
+		std::unique_ptr<btDiscreteDynamicsWorld> m_world;
+		std::unique_ptr<btCollisionShape> m_ground_shape;
+		std::unique_ptr<btCollisionShape> m_sphere_shape;
+		std::unique_ptr<btCollisionShape> m_box_shape;
+		std::vector<btRigidBody*> m_bodies;
+		std::vector<TickRecord> m_ticks;
+	};
+
+	// ̃t[[ǧoߎ
+	std::vector<float> CreateSteadyTrace(const float fps)
+	{
+		const int frame_num = static_cast<int>(TRACE_SECONDS * fps);
+		return std::vector<float>(frame_num, 1.0f / fps);
+	}
+
+	// t[Ƃɂ΂oߎ(spike_intervalt[Ƃɑ傫x)
+	std::vector<float> CreateJitterTrace(Test::TestRandom& random, const int spike_interval)
+	{
+		std::vector<float> trace;
+		float total = 0.0f;
+		while (total < TRACE_SECONDS)
+		{
+			const bool is_spike = spike_interval > 0 && static_cast<int>(trace.size()) % spike_interval == spike_interval - 1;
+			const float elapsed_time = is_spike ? random.Range(0.1f, 0.3f) : random.Range(0.004f, 0.04f);
+			trace.emplace_back(elapsed_time);
+			total += elapsed_time;
+		}
+		return trace;
+	}
+
+	// oߎԂ̗ĐATuXebvƂ̋L^Ԃ
+	std::vector<TickRecord> Replay(const std::vector<float>& trace)
+	{
+		TestWorld world;
+		int total_step_num = 0;
+		for (const float elapsed_time : trace)
+		{
+			const int step_num = world.Step(elapsed_time, true);
+			TEST_CHECK(0 <= step_num && step_num <= MAX_SUB_STEPS);
+			total_step_num += step_num;
+		}
+		TEST_CHECK(total_step_num == static_cast<int>(world.GetTicks().size()));
+		return world.GetTicks();
+	}
+
+	bool IsSameTick(const TickRecord& a, const TickRecord& b)
+	{
+		if (a.time_step != b.time_step || a.contact_manifold_num != b.contact_manifold_num || a.bodies.size() != b.bodies.size())
+			return false;
+		for (size_t i = 0; i < a.bodies.size(); ++i)
+		{
+			const BodyState& s0 = a.bodies[i];
+			const BodyState& s1 = b.bodies[i];
+			for (int j = 0; j < 3; ++j)
+			{
+				if (s0.origin[j] != s1.origin[j] || s0.linear_velocity[j] != s1.linear_velocity[j])
+					return false;
+			}
+			for (int j = 0; j < 4; ++j)
+			{
+				if (s0.rotation[j] != s1.rotation[j])
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// t[̋؂ɂ炸A񐔖ڂ̃TuXebv͓ԂɂȂ
+	void CheckSameTicks(const std::vector<TickRecord>& reference, const std::vector<TickRecord>& ticks)
+	{
+		const size_t tick_num = (std::min)(reference.size(), ticks.size());
+		for (size_t i = 0; i < tick_num; ++i)
+		{
+			TEST_CHECK(IsSameTick(reference[i], ticks[i]));
+		}
+	}
+}
+
+int main()
+{
+	Test::TestRandom random(0xb7u);
+	const int expected_tick_num = static_cast<int>(TRACE_SECONDS / FIXED_TIME_STEP);
+
+	// 60fps̋L^ɁAʂ̃t[[gƗh炬̂L^ĐĔr
+	const std::vector<TickRecord> reference = Replay(CreateSteadyTrace(60.0f));
+	TEST_CHECK(std::abs(static_cast<int>(reference.size()) - expected_tick_num) <= 1);
+	{
+		int contact_tick_num = 0;
+		for (const auto& tick : reference)
+		{
+			TEST_CHECK(tick.time_step == FIXED_TIME_STEP);
+			if (tick.contact_manifold_num > 0)
+			{
+				++contact_tick_num;
+			}
+		}
+		// ڐGNĂȂΔr̈ӖȂ
+		TEST_CHECK(contact_tick_num > expected_tick_num / 2);
+	}
+
+	const float steady_fps[] = { 30.0f, 59.94f, 75.0f, 144.0f, 240.0f };
+	for (const float fps : steady_fps)
+	{
+		const std::vector<TickRecord> ticks = Replay(CreateSteadyTrace(fps));
+		// 1t[MAX_SUB_STEPS𒴂Ȃ̂ŎԂ͐؂̂ĂȂ
+		TEST_CHECK(std::abs(static_cast<int>(ticks.size()) - expected_tick_num) <= 2);
+		CheckSameTicks(reference, ticks);
+	}
+	{
+		// Ō̃t[ōĐԂ𒴂Ȃ
+		const std::vector<TickRecord> ticks = Replay(CreateJitterTrace(random, 0));
+		TEST_CHECK(std::abs(static_cast<int>(ticks.size()) - expected_tick_num) <= 3);
+		CheckSameTicks(reference, ticks);
+	}
+	{
+		// xꂽt[MAX_SUB_STEPSőł؂邽߁ATuXebv͌邪eԂ͕ςȂ
+		const std::vector<TickRecord> ticks = Replay(CreateJitterTrace(random, 25));
+		TEST_CHECK(static_cast<int>(ticks.size()) < expected_tick_num);
+		CheckSameTicks(reference, ticks);
+	}
+
+	// t[͍őTuXebvőł؂AԂ͎̃t[ɎzȂ
+	{
+		TestWorld world;
+		TEST_CHECK(world.Step(1.0f, true) == MAX_SUB_STEPS);
+		TEST_CHECK(static_cast<int>(world.GetTicks().size()) == MAX_SUB_STEPS);
+		TEST_CHECK(world.Step(FIXED_TIME_STEP * 0.5f, true) <= 1);
+		TEST_CHECK(static_cast<int>(world.GetTicks().size()) <= MAX_SUB_STEPS + 1);
+	}
+
+	// MotionStateɂ͒O2TuXebv̊ԂԂpn
+	{
+		TestWorld world;
+		world.Step(FIXED_TIME_STEP * 3.0f, true);
+		world.Step(FIXED_TIME_STEP * 0.5f, true);
+		const auto& ticks = world.GetTicks();
+		TEST_CHECK(ticks.size() >= 2);
+		const BodyState& prev = ticks[ticks.size() - 2].bodies.back();
+		const BodyState& current = ticks.back().bodies.back();
+		// ԏ̂͂̕܂R
+		TEST_CHECK(current.origin[1] < prev.origin[1]);
+		const btVector3 graphics = world.GetGraphicsOrigin(world.GetBodyNum() - 1);
+		TEST_CHECK(graphics.y() >= current.origin[1] - 1.0e-4f);
+		TEST_CHECK(graphics.y() <= prev.origin[1] + 1.0e-4f);
+	}
+
+	// σ^CXebv̓t[ƂɌoߎԂ1񂾂i߂
+	{
+		TestWorld world;
+		const std::vector<float> trace = CreateJitterTrace(random, 0);
+		for (size_t i = 0; i < trace.size(); ++i)
+		{
+			TEST_CHECK(world.Step(trace[i], false) == 1);
+			TEST_CHECK(world.GetTicks().size() == i + 1);
+			TEST_CHECK(world.GetTicks().back().time_step == trace[i]);
+		}
+	}
+
+	std::printf("test_physics_step : %d ticks replayed per trace\n", static_cast<int>(reference.size()));
+	std::printf("test_physics_step : passed\n");
+	return 0;
+}
@@ -0,0 +1,149 @@
+#include "test_common.h"
+
+#include "Utility/inc/myfunc_sort.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace TKGEngine;
+
+namespace
+{
+	// L[̐@
+	enum class KeyPattern
+	{
+		Random,			// 64bitŜ΂΂
+		FewValues,		// L[(萫̊mF)
+		HighByteOnly,	// ŏʂ̌قȂ(r̃pX΂)
+		LowByteOnly,	// ŉʂ̌قȂ
+		Same,			// SēL[
+		Sorted,
+		Reversed,
+
+		Max_KeyPattern
+	};
+
+	std::uint64_t RandomKey(Test::TestRandom& random)
+	{
+		return (static_cast<std::uint64_t>(random.Next()) << 32) | random.Next();
+	}
+
+	std::vector<MyFunc::SortKey> CreateKeys(Test::TestRandom& random, const KeyPattern pattern, const int count)
+	{
+		std::vector<MyFunc::SortKey> keys(count);
+		for (int i = 0; i < count; ++i)
+		{
+			std::uint64_t key = 0;
+			switch (pattern)
+			{
+				case KeyPattern::Random:
+					key = RandomKey(random);
+					break;
+				case KeyPattern::FewValues:
+					key = (random.Next() % 4) * 0x0101010101010101ull;
+					break;
+				case KeyPattern::HighByteOnly:
+					key = (static_cast<std::uint64_t>(random.Next() & 0xff) << 56) | 0x0000123456789abcull;
+					break;
+				case KeyPattern::LowByteOnly:
+					key = 0xfedcba9876543200ull | (random.Next() & 0xff);
+					break;
+				case KeyPattern::Same:
+					key = 0x8000000000000001ull;
+					break;
+				case KeyPattern::Sorted:
+					key = static_cast<std::uint64_t>(i) * 0x0001000100010001ull;
+					break;
+				case KeyPattern::Reversed:
+					key = static_cast<std::uint64_t>(count - i) * 0x0001000100010001ull;
+					break;
+				default:
+					break;
+			}
+			keys[i] = { key, i };
+		}
+		return keys;
+	}
+
+	// std::stable_sortƓ(L[ƃCfbNX̗)ɂȂ邱ƂmF
+	void CheckSort(const std::vector<MyFunc::SortKey>& keys)
+	{
+		const int count = static_cast<int>(keys.size());
+		std::vector<MyFunc::SortKey> radix_keys = keys;
+		std::vector<MyFunc::SortKey> work(count);
+		const MyFunc::SortKey* sorted = MyFunc::RadixSort(radix_keys.data(), work.data(), count);
+		TEST_CHECK(count == 0 || sorted == radix_keys.data() || sorted == work.data());
+
+		std::vector<MyFunc::SortKey> expected = keys;
+		std::stable_sort(expected.begin(), expected.end(),
+			[](const MyFunc::SortKey& a, const MyFunc::SortKey& b)
+			{
+				return a.key < b.key;
+			});
+
+		for (int i = 0; i < count; ++i)
+		{
+			TEST_CHECK(sorted[i].key == expected[i].key);
+			TEST_CHECK(sorted[i].index == expected[i].index);
+		}
+	}
+}
+
+int main()
+{
+	Test::TestRandom random(0x5eed);
+
+	// vf01͓͂̂܂ܕԂ
+	{
+		MyFunc::SortKey key = { 42, 0 };
+		MyFunc::SortKey work = {};
+		TEST_CHECK(MyFunc::RadixSort(&key, &work, 0) == &key);
+		TEST_CHECK(MyFunc::RadixSort(&key, &work, 1) == &key);
+		TEST_CHECK(key.key == 42 && key.index == 0);
+	}
+
+	// pX΂ǂŕԂobt@ς邽߁Ap^[Ɨvf̑gݍ킹ŊmF
+	const int counts[] = { 2, 3, 17, 255, 256, 257, 1000, 4096 };
+	for (int pattern = 0; pattern < static_cast<int>(KeyPattern::Max_KeyPattern); ++pattern)
+	{
+		for (const int count : counts)
+		{
+			CheckSort(CreateKeys(random, static_cast<KeyPattern>(pattern), count));
+		}
+	}
+
+	// `惊Xg̋K͂ł̏
+	{
+		constexpr int SORT_COUNT = 100000;
+		constexpr int ITERATION = 20;
+		const std::vector<MyFunc::SortKey> keys = CreateKeys(random, KeyPattern::Random, SORT_COUNT);
+		std::vector<MyFunc::SortKey> radix_keys(SORT_COUNT);
+		std::vector<MyFunc::SortKey> work(SORT_COUNT);
+
+		Test::Stopwatch radix_watch;
+		for (int i = 0; i < ITERATION; ++i)
+		{
+			radix_keys = keys;
+			MyFunc::RadixSort(radix_keys.data(), work.data(), SORT_COUNT);
+		}
+		const double radix_ms = radix_watch.ElapsedMilliseconds() / ITERATION;
+
+		Test::Stopwatch stable_watch;
+		for (int i = 0; i < ITERATION; ++i)
+		{
+			radix_keys = keys;
+			std::stable_sort(radix_keys.begin(), radix_keys.end(),
+				[](const MyFunc::SortKey& a, const MyFunc::SortKey& b)
+				{
+					return a.key < b.key;
+				});
+		}
+		const double stable_ms = stable_watch.ElapsedMilliseconds() / ITERATION;
+
+		std::printf("%d keys : RadixSort %.3f ms, std::stable_sort %.3f ms\n", SORT_COUNT, radix_ms, stable_ms);
+	}
+
+	std::printf("test_radix_sort : passed\n");
+	return 0;
+}